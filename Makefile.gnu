@@ -1,12 +1,17 @@
 # Standard GNU Makefile for the generic development environment at
 # Phorward Software (no autotools, etc. wanted in here).
 
-CFLAGS 			= -g -DUTF8 -DUNICODE -DDEBUG -Wall -I. $(CLOCAL)
+CFLAGS 			= -g -DUTF8 -DUNICODE -DDEBUG -DHAVE_LIBPTHREAD -Wall -I. $(CLOCAL)
+LIBS			= -lpthread
 
 SOURCES	= 	\
 	lib/phorward.c \
+	src/arena.c \
+	src/bitset.c \
 	src/build.c \
+	src/charmap.c \
 	src/debug.c \
+	src/digraph.c \
 	src/error.c \
 	src/first.c \
 	src/integrity.c \
@@ -45,7 +50,7 @@ make_uninstall:
 # --- UniCC --------------------------------------------------------------------
 
 unicc: $(OBJECTS)
-	$(CC) -o $@ $(OBJECTS)
+	$(CC) -o $@ $(OBJECTS) $(LIBS)
 
 # --- UniCC Documentation ------------------------------------------------------
 #
@@ -75,7 +80,20 @@ $(TESTPREFIX)c_ast:
 	cc -o $@ $@.c
 	echo $(TESTEXPR) | ./$@ -sl
 
-test_c: $(TESTPREFIX)c_expr $(TESTPREFIX)c_ast
+$(TESTPREFIX)c_comb:
+	(cat examples/expr.c.par; echo; echo "#compressed tables;") >$@.par
+	./unicc -o $@ $@.par
+	cc -o $@  $@.c
+	test "`echo $(TESTEXPR) | ./$@ -sl`" = $(TESTRESULT)
+
+$(TESTPREFIX)c_read:
+	./unicc -o $@ examples/expr.c.par
+	cc "-DUNICC_READ(pcb,buf,n)=fread(buf,sizeof(UNICC_CHAR),n,stdin)" \
+		-DUNICC_UTF8=0 -o $@ $@.c
+	test "`echo $(TESTEXPR) | ./$@ -sl`" = $(TESTRESULT)
+
+test_c: $(TESTPREFIX)c_expr $(TESTPREFIX)c_ast $(TESTPREFIX)c_comb \
+		$(TESTPREFIX)c_read
 	@echo "--- $@ succeeded ---"
 	@rm $(TESTPREFIX)*
 
@@ -92,7 +110,20 @@ $(TESTPREFIX)cpp_ast:
 	g++ -o $@ $@.cpp
 	echo $(TESTEXPR) | ./$@ -sl
 
-test_cpp: $(TESTPREFIX)cpp_expr $(TESTPREFIX)cpp_ast
+$(TESTPREFIX)cpp_comb:
+	(cat examples/expr.cpp.par; echo; echo "#compressed tables;") >$@.par
+	./unicc -o $@ $@.par
+	g++ -o $@  $@.cpp
+	test "`echo $(TESTEXPR) | ./$@ -sl`" = $(TESTRESULT)
+
+$(TESTPREFIX)cpp_read:
+	./unicc -o $@ examples/expr.cpp.par
+	g++ "-DUNICC_READ(pcb,buf,n)=fread(buf,sizeof(UNICC_CHAR),n,stdin)" \
+		-DUNICC_UTF8=0 -o $@ $@.cpp
+	test "`echo $(TESTEXPR) | ./$@ -sl`" = $(TESTRESULT)
+
+test_cpp: $(TESTPREFIX)cpp_expr $(TESTPREFIX)cpp_ast $(TESTPREFIX)cpp_comb \
+		$(TESTPREFIX)cpp_read
 	@echo "--- $@ succeeded ---"
 	@rm $(TESTPREFIX)*
 
@@ -138,7 +169,88 @@ test_json: $(TESTPREFIX)js_expr $(TESTPREFIX)json_ast
 	@echo "--- $@ succeded ---"
 	@rm $(TESTPREFIX)*
 
+# Parse tables
+#
+# Generates the JSON tables for every example grammar, and compares them
+# against the checksums in examples/tables.md5. Any change to the table
+# construction must yield byte-identical tables for these grammars, with
+# both the closure and the digraph lookahead computation.
+
+$(TESTPREFIX)tables.md5:
+	for f in examples/*.par; do \
+		sed '/^[%#]!language/d' $$f >$(TESTPREFIX)tables.par; \
+		./unicc -wtl json $(UNICCFLAGS) $(TESTPREFIX)tables.par 2>/dev/null \
+			| md5sum | sed "s|-|$$f|"; \
+	done >$@
+
+test_tables: $(TESTPREFIX)tables.md5
+	diff examples/tables.md5 $(TESTPREFIX)tables.md5
+	@echo "--- $@ succeeded ---"
+	@rm $(TESTPREFIX)*
+
+test_digraph:
+	$(MAKE) -f Makefile.gnu test_tables UNICCFLAGS=--digraph
+
+test_jobs:
+	$(MAKE) -f Makefile.gnu test_tables UNICCFLAGS="-j 4"
+
+# DFA minimization
+#
+# Minimizes the DFAs of randomized pattern sets and the state lexers of every
+# example grammar, and compares the results against the unminimized DFAs and
+# the previous minimization algorithm.
+
+$(TESTPREFIX)dfa_minimize: tests/minimize.c $(OBJECTS)
+	$(CC) $(CFLAGS) -o $@ tests/minimize.c \
+		$(filter-out src/main.o,$(OBJECTS)) $(LIBS)
+
+test_minimize: $(TESTPREFIX)dfa_minimize
+	./$(TESTPREFIX)dfa_minimize 1000 1 examples/*.par
+	@echo "--- $@ succeeded ---"
+	@rm $(TESTPREFIX)*
+
+# Character-classes
+#
+# Modifies randomized character-classes over the full Unicode universe, and
+# compares the results against bitmaps. Prints the timings of the character-
+# class operations afterwards.
+
+$(TESTPREFIX)ccl_ops: tests/ccl.c lib/phorward.o
+	$(CC) $(CFLAGS) -o $@ tests/ccl.c lib/phorward.o
+
+test_ccl: $(TESTPREFIX)ccl_ops
+	./$(TESTPREFIX)ccl_ops 20
+	@echo "--- $@ succeeded ---"
+	@rm $(TESTPREFIX)*
+
+# Character-class benchmark
+#
+# Generates a grammar of $(CHARSETS) character-classes, each overlapping with
+# its neighbours, and measures the time to build its parser. Not part of the
+# test target.
+
+CHARSETS = 300
+
+$(TESTPREFIX)charsets.par:
+	awk 'BEGIN { \
+		print "%!mode scannerless;"; \
+		print "start$$ : items ;"; \
+		print "items : items item | item ;"; \
+		for( i = 0; i < $(CHARSETS); i++ ) \
+			printf( "%s \x27\\u%04X-\\u%04X\x27 \x27\\u%04X\x27\n", \
+				i ? "\t|" : "item :", 256 + i * 5, 293 + i * 5, 19968 + i ); \
+		print "\t;"; \
+	}' >$@
+
+bench_charsets: $(TESTPREFIX)charsets.par
+	@start=`date +%s%N`; \
+		./unicc -sw -o $(TESTPREFIX)charsets $(TESTPREFIX)charsets.par \
+			&& echo "$(CHARSETS) character-classes:" \
+				`expr \( \`date +%s%N\` - $$start \) / 1000000` ms
+	@rm $(TESTPREFIX)*
+
 # Test
 
-test: test_c test_cpp test_py test_js test_json
+test: test_c test_cpp test_py test_js test_json test_tables test_digraph test_jobs \
+	test_minimize test_ccl
 	@echo "=== $+ succeeded ==="
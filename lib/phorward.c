@@ -1018,8 +1018,12 @@ void parray_set_sortfn( parray* array,
 }
 
 
-/* Prototype */
-static pboolean pccl_ADDRANGE( pccl* ccl, wchar_t begin, wchar_t end );
+/* Characters covered by the bitmap of a character-class */
+#define PCCL_MAP_MAX		0xFF
+
+/* Tests a character of the bitmap of a character-class */
+#define PCCL_MAP_TEST( ccl, ch ) \
+	( (ccl)->map[ (ch) >> 3 ] & ( 1 << ( (ch) & 7 ) ) )
 
 /* Sort-function required for quick sort */
 static int ccl_SORTFUNC( parray* arr, void* a, void* b )
@@ -1027,6 +1031,92 @@ static int ccl_SORTFUNC( parray* arr, void* a, void* b )
 	return ((pcrange*)b)->begin - ((pcrange*)a)->begin;
 }
 
+/* Sets or clears the characters //begin// to //end// in the bitmap of
+//ccl//, as far as they are covered by the bitmap. */
+static void pccl_map( pccl* ccl, wchar_t begin, wchar_t end, pboolean set )
+{
+	if( begin < 0 )
+		begin = 0;
+
+	if( end > PCCL_MAP_MAX )
+		end = PCCL_MAP_MAX;
+
+	for( ; begin <= end; begin++ )
+	{
+		if( set )
+			ccl->map[ begin >> 3 ] |= 1 << ( begin & 7 );
+		else
+			ccl->map[ begin >> 3 ] &= ~( 1 << ( begin & 7 ) );
+	}
+}
+
+/* Rebuilds the bitmap of //ccl// from its ranges. */
+static void pccl_remap( pccl* ccl )
+{
+	pcrange*	r;
+
+	memset( ccl->map, 0, sizeof( ccl->map ) );
+
+	parray_for( &ccl->ranges, r )
+	{
+		if( r->begin > PCCL_MAP_MAX )
+			break;
+
+		pccl_map( ccl, r->begin, r->end, TRUE );
+	}
+}
+
+/* Returns the offset of the first range of //ccl// that ends at or behind
+character //ch//, or the number of ranges if there is none. The ranges are
+always sorted and coalesced, so this is a binary search. */
+static size_t pccl_find( pccl* ccl, wchar_t ch )
+{
+	pcrange*	r;
+	size_t		lo		= 0;
+	size_t		hi;
+	size_t		mid;
+
+	if( !( r = (pcrange*)parray_first( &ccl->ranges ) ) )
+		return 0;
+
+	hi = pccl_size( ccl );
+
+	while( lo < hi )
+	{
+		mid = ( lo + hi ) / 2;
+
+		if( r[ mid ].end < ch )
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+/* Appends the range //begin// to //end// to the ranges of //ccl//, which must
+not begin before the last range. The range is merged into the last range if
+both overlap or touch. The bitmap is not updated. */
+static pboolean pccl_PUSHRANGE( pccl* ccl, wchar_t begin, wchar_t end )
+{
+	pcrange		cr;
+	pcrange*	last;
+
+	if( ( last = (pcrange*)parray_last( &ccl->ranges ) )
+			&& begin <= last->end + 1 )
+	{
+		if( end > last->end )
+			last->end = end;
+
+		return TRUE;
+	}
+
+	cr.begin = begin;
+	cr.end = end;
+
+	return parray_push( &ccl->ranges, &cr ) ? TRUE : FALSE;
+}
+
 /** Constructor function to create a new character-class.
 
 //min// and //max// can either be specified as -1, so the configured default
@@ -1132,64 +1222,12 @@ pccl* pccl_dup( pccl* ccl )
 
 	/* Copy elements */
 	parray_for( &ccl->ranges, cr )
-		pccl_ADDRANGE( dup, cr->begin, cr->end );
-
-	return dup;
-}
-
-/* Normalizes a pre-parsed or modified character-class.
-
-Normalization means, that duplicate elements will be removed, the range pairs
-are sorted and intersections are resolved. The result is a unique, normalized
-character-class to be used for further operations.
-
-//ccl// is the character-class to be normalized.
+		if( !parray_push( &dup->ranges, cr ) )
+			return pccl_free( dup );
 
-Returns the number of cycles used for normalization.
-*/
-static size_t pccl_normalize( pccl* ccl )
-{
-	pcrange*	l;
-	pcrange*	r;
-	size_t		count;
-	size_t		oldcount	= 0;
-	size_t		cycles		= 0;
-
-	while( ( count = pccl_size( ccl ) ) != oldcount )
-	{
-		oldcount = count;
-
-		/* First sort the character ranges */
-		parray_sort( &ccl->ranges );
-
-		/* Then, find intersections and... */
-		parray_for( &ccl->ranges, l )
-		{
-			if( ( r = l + 1 ) < (pcrange*)ccl->ranges.top )
-			{
-				if( r->begin <= l->end && r->end >= l->begin )
-				{
-					if( r->end > l->end )
-						l->end = r->end;
-
-					parray_remove( &ccl->ranges,
-							parray_offset( &ccl->ranges, r ), NULL );
-					break;
-				}
-				else if( l->end + 1 == r->begin )
-				{
-					l->end = r->end;
-					parray_remove( &ccl->ranges,
-							parray_offset( &ccl->ranges, r ), NULL );
-					break;
-				}
-			}
-		}
+	memcpy( dup->map, ccl->map, sizeof( ccl->map ) );
 
-		cycles++;
-	}
-
-	return cycles;
+	return dup;
 }
 
 /** Tests a character-class to match a character range.
@@ -1198,15 +1236,26 @@ static size_t pccl_normalize( pccl* ccl )
 //begin// is the begin of character-range to be tested.
 //end// is the end of character-range to be tested.
 
+Single characters up to 0xFF are looked up in a bitmap, everything else is
+searched binary in the sorted ranges.
+
 Returns TRUE if the entire character range matches the class, and FALSE if not.
 */
 pboolean pccl_testrange( pccl* ccl, wchar_t begin, wchar_t end )
 {
 	pcrange*	cr;
+	size_t		i;
 
-	parray_for( &ccl->ranges, cr )
-		if( begin >= cr->begin && end <= cr->end )
-			return TRUE;
+	if( begin == end && begin >= 0 && begin <= PCCL_MAP_MAX )
+		return PCCL_MAP_TEST( ccl, begin ) ? TRUE : FALSE;
+
+	if( ( i = pccl_find( ccl, begin ) ) >= pccl_size( ccl ) )
+		return FALSE;
+
+	cr = (pcrange*)parray_get( &ccl->ranges, i );
+
+	if( begin >= cr->begin && end <= cr->end )
+		return TRUE;
 
 	return FALSE;
 }
@@ -1222,6 +1271,9 @@ It returns TRUE, if the character matches the class, and FALSE if not.
 */
 pboolean pccl_test( pccl* ccl, wchar_t ch )
 {
+	if( ch >= 0 && ch <= PCCL_MAP_MAX )
+		return PCCL_MAP_TEST( ccl, ch ) ? TRUE : FALSE;
+
 	return pccl_testrange( ccl, ch, ch );
 }
 
@@ -1255,10 +1307,25 @@ pboolean pccl_instest( pccl* ccl, wchar_t ch )
 	return pccl_test( ccl, ch );
 }
 
-/* Internal function without normalization */
-static pboolean pccl_ADDRANGE( pccl* ccl, wchar_t begin, wchar_t end )
+/** Integrates a character range into a character-class.
+
+//ccl// is the pointer to the character-class to be affected. If //ccl// is
+provided as (pccl*)NULL, it will be created by the function.
+
+//begin// is the begin of character range to be integrated.
+//end// is the end of character range to be integrated.
+
+If //begin// is greater than //end//, the values will be swapped.
+
+The range is inserted at its sorted position, and merged with all ranges it
+overlaps or touches.
+*/
+pboolean pccl_addrange( pccl* ccl, wchar_t begin, wchar_t end )
 {
 	pcrange		cr;
+	pcrange*	r;
+	size_t		i;
+	size_t		j;
 
 	if( begin > end )
 	{
@@ -1277,37 +1344,43 @@ static pboolean pccl_ADDRANGE( pccl* ccl, wchar_t begin, wchar_t end )
 	if( cr.end > ccl->max )
 		cr.end = ccl->max;
 
-	if( pccl_testrange( ccl, cr.begin, cr.end ) )
-		/* Range already in character-class */
-		return TRUE;
-
-	if( cr.begin > ccl->max || cr.end < ccl->min )
+	if( cr.begin > cr.end )
 		/* Character-range not in the universe of character-class */
 		return FALSE;
 
-	return parray_push( &ccl->ranges, &cr ) ? TRUE : FALSE;
-}
+	pccl_map( ccl, cr.begin, cr.end, TRUE );
 
-/** Integrates a character range into a character-class.
+	/* First range touching the new one */
+	i = pccl_find( ccl, cr.begin > ccl->min ? cr.begin - 1 : cr.begin );
 
-//ccl// is the pointer to the character-class to be affected. If //ccl// is
-provided as (pccl*)NULL, it will be created by the function.
+	if( !( r = (pcrange*)parray_get( &ccl->ranges, i ) )
+			|| r->begin > cr.end + 1 )
+		return parray_insert( &ccl->ranges, i, &cr ) ? TRUE : FALSE;
 
-//begin// is the begin of character range to be integrated.
-//end// is the end of character range to be integrated.
+	/* Merge all touched ranges into the first one */
+	if( cr.begin < r->begin )
+		r->begin = cr.begin;
 
-If //begin// is greater than //end//, the values will be swapped.
-*/
-pboolean pccl_addrange( pccl* ccl, wchar_t begin, wchar_t end )
-{
-	if( !pccl_ADDRANGE( ccl, begin, end ) )
-		return FALSE;
+	for( j = i + 1; j < pccl_size( ccl )
+			&& ( (pcrange*)parray_get( &ccl->ranges, j ) )->begin
+					<= cr.end + 1; )
+	{
+		cr.end = ( cr.end > ( (pcrange*)parray_get(
+							&ccl->ranges, j ) )->end )
+					? cr.end
+					: ( (pcrange*)parray_get( &ccl->ranges, j ) )->end;
+
+		parray_remove( &ccl->ranges, j, (void**)NULL );
+	}
+
+	r = (pcrange*)parray_get( &ccl->ranges, i );
+
+	if( cr.end > r->end )
+		r->end = cr.end;
 
-	pccl_normalize( ccl );
 	return TRUE;
 }
 
-
 /** Integrates a single character into a character-class.
 
 //ccl// is the pointer to the character-class to be affected.
@@ -1330,6 +1403,7 @@ pboolean pccl_delrange( pccl* ccl, wchar_t begin, wchar_t end )
 {
 	pcrange		d;
 	pcrange*	r;
+	size_t		i;
 
 	if( begin > end )
 	{
@@ -1342,46 +1416,42 @@ pboolean pccl_delrange( pccl* ccl, wchar_t begin, wchar_t end )
 		d.end = end;
 	}
 
-	/* Which elements do match? */
-	do
+	pccl_map( ccl, d.begin, d.end, FALSE );
+
+	/* First range that ends within or behind the removed range */
+	if( !( r = (pcrange*)parray_get( &ccl->ranges,
+									( i = pccl_find( ccl, d.begin ) ) ) )
+			|| r->begin > d.end )
+		return TRUE;
+
+	/* Splitting required? */
+	if( r->begin < d.begin && r->end > d.end )
 	{
-		parray_for( &ccl->ranges, r )
-		{
-			if( d.begin <= r->end && end >= r->begin )
-			{
-				/* Slitting required? */
-				if( d.begin > r->begin && d.end < r->end )
-				{
-					/* Split current range */
-					end = r->end;
-					r->end = d.begin - 1;
+		end = r->end;
+		r->end = d.begin - 1;
 
-					if( !pccl_addrange( ccl, d.end + 1, end ) )
-						return FALSE;
+		d.begin = d.end + 1;
+		d.end = end;
 
-					break;
-				}
-				/* Move end of current range */
-				else if( d.begin > r->begin )
-					r->end = d.begin - 1;
-				/* Change begin of current range */
-				else if( d.end < r->end )
-					r->begin = d.end + 1;
-				/* Remove entire range */
-				else
-				{
-					parray_remove( &ccl->ranges,
-							parray_offset( &ccl->ranges, r ), NULL );
+		return parray_insert( &ccl->ranges, i + 1, &d ) ? TRUE : FALSE;
+	}
 
-					r = parray_first( &ccl->ranges );
-					break;
-				}
-			}
-		}
+	/* Move end of current range */
+	if( r->begin < d.begin )
+	{
+		r->end = d.begin - 1;
+		i++;
 	}
-	while( r );
 
-	pccl_normalize( ccl );
+	/* Remove entire ranges */
+	while( ( r = (pcrange*)parray_get( &ccl->ranges, i ) )
+				&& r->end <= d.end )
+		parray_remove( &ccl->ranges, i, (void**)NULL );
+
+	/* Change begin of next range */
+	if( r && r->begin <= d.end )
+		r->begin = d.end + 1;
+
 	return TRUE;
 }
 
@@ -1405,39 +1475,29 @@ Returns a pointer to //ccl//.
 */
 pccl* pccl_negate( pccl* ccl )
 {
-	wchar_t		start;
-	wchar_t		end;
+	parray		ranges;
 	pcrange*	r;
+	wchar_t		start;
 
-	start = end = ccl->min;
+	start = ccl->min;
 
-	do
+	ranges = ccl->ranges;
+	parray_init( &ccl->ranges, sizeof( pcrange ), 0 );
+	parray_set_sortfn( &ccl->ranges, ccl_SORTFUNC );
+
+	parray_for( &ranges, r )
 	{
-		parray_for( &ccl->ranges, r )
-		{
-			if( end < r->begin )
-			{
-				start = r->begin;
-				r->begin = end;
+		if( start < r->begin )
+			pccl_PUSHRANGE( ccl, start, r->begin - 1 );
 
-				end = r->end + 1;
-				r->end = start - 1;
-			}
-			else
-			{
-				end = r->end + 1;
-				parray_remove( &ccl->ranges,
-						parray_offset( &ccl->ranges, r ), NULL );
-				break;
-			}
-		}
+		start = r->end + 1;
 	}
-	while( r );
 
-	if( end < ccl->max )
-		pccl_addrange( ccl, end, ccl->max );
+	if( start <= ccl->max )
+		pccl_PUSHRANGE( ccl, start, ccl->max );
 
-	pccl_normalize( ccl );
+	parray_erase( &ranges );
+	pccl_remap( ccl );
 
 	return ccl;
 }
@@ -1456,18 +1516,33 @@ pccl* pccl_union( pccl* ccl, pccl* add )
 {
 	pccl*		un;
 	pcrange*	r;
+	pcrange*	s;
 
 	if( !pccl_compat( ccl, add ) )
 		/* Incompatible character-classes */
 		return NULL;
 
-	un = pccl_dup( ccl );
+	un = pccl_create( ccl->min, ccl->max, (char*)NULL );
 
-	parray_for( &add->ranges, r )
-		if( !pccl_ADDRANGE( un, r->begin, r->end ) )
-			return NULL;
+	/* Merge both sorted range lists */
+	r = (pcrange*)parray_first( &ccl->ranges );
+	s = (pcrange*)parray_first( &add->ranges );
+
+	while( r || s )
+	{
+		if( r && ( !s || r->begin <= s->begin ) )
+		{
+			pccl_PUSHRANGE( un, r->begin, r->end );
+			r = (pcrange*)parray_next( &ccl->ranges, r );
+		}
+		else
+		{
+			pccl_PUSHRANGE( un, s->begin, s->end );
+			s = (pcrange*)parray_next( &add->ranges, s );
+		}
+	}
 
-	pccl_normalize( un );
+	pccl_remap( un );
 
 	return un;
 }
@@ -1487,17 +1562,45 @@ error.
 pccl* pccl_diff( pccl* ccl, pccl* rem )
 {
 	pcrange*	r;
+	pcrange*	s;
+	pcrange*	t;
 	pccl*		diff;
+	wchar_t		begin;
 
 	if( !pccl_compat( ccl, rem ) )
 		/* Incompatible character-classes */
 		return NULL;
 
-	if( !( diff = pccl_dup( ccl ) ) )
-		return diff;
+	diff = pccl_create( ccl->min, ccl->max, (char*)NULL );
+
+	/* Walk both sorted range lists; s is the first range of rem that does
+		not end before the current range of ccl. */
+	s = (pcrange*)parray_first( &rem->ranges );
+
+	parray_for( &ccl->ranges, r )
+	{
+		while( s && s->end < r->begin )
+			s = (pcrange*)parray_next( &rem->ranges, s );
+
+		begin = r->begin;
+
+		for( t = s; t && t->begin <= r->end;
+				t = (pcrange*)parray_next( &rem->ranges, t ) )
+		{
+			if( t->begin > begin )
+				pccl_PUSHRANGE( diff, begin, t->begin - 1 );
 
-	parray_for( &rem->ranges, r )
-		pccl_delrange( diff, r->begin, r->end );
+			if( t->end >= r->end )
+				break;
+
+			begin = t->end + 1;
+		}
+
+		if( !( t && t->begin <= r->end && t->end >= r->end ) )
+			pccl_PUSHRANGE( diff, begin, r->end );
+	}
+
+	pccl_remap( diff );
 
 	return diff;
 }
@@ -1545,24 +1648,30 @@ pccl* pccl_intersect( pccl* ccl, pccl* within )
 		/* Incompatible character-classes */
 		return NULL;
 
-	parray_for( &ccl->ranges, r )
+	/* Walk both sorted range lists */
+	r = (pcrange*)parray_first( &ccl->ranges );
+	s = (pcrange*)parray_first( &within->ranges );
+
+	while( r && s )
 	{
-		parray_for( &within->ranges, s )
+		if( s->begin <= r->end && s->end >= r->begin )
 		{
-			if( s->begin <= r->end && s->end >= r->begin )
-			{
-				if( !in )
-					in = pccl_create( ccl->min, ccl->max, (char*)NULL );
+			if( !in )
+				in = pccl_create( ccl->min, ccl->max, (char*)NULL );
 
-				pccl_addrange( in,
-					( r->begin > s->begin ) ? r->begin : s->begin,
-					( r->end > s->end ) ? s->end : r->end );
-			}
+			pccl_PUSHRANGE( in,
+				( r->begin > s->begin ) ? r->begin : s->begin,
+				( r->end > s->end ) ? s->end : r->end );
 		}
+
+		if( r->end < s->end )
+			r = (pcrange*)parray_next( &ccl->ranges, r );
+		else
+			s = (pcrange*)parray_next( &within->ranges, s );
 	}
 
 	if( in )
-		pccl_normalize( in );
+		pccl_remap( in );
 
 	return in;
 }
@@ -1761,10 +1870,9 @@ pboolean pccl_parseshorthand( pccl* ccl, char** str )
 		pccl_negate( sh );
 
 	for( i = 0; pccl_get( &begin, &end, sh, i ); i++ )
-		pccl_ADDRANGE( ccl, begin, end );
+		pccl_addrange( ccl, begin, end );
 
 	pccl_free( sh );
-	pccl_normalize( ccl );
 
 	*str += 2;
 	return TRUE;
@@ -1817,7 +1925,7 @@ pccl* pccl_parse( pccl* ccl, char* ccldef, pboolean extend )
 			cclptr += pccl_parsechar( &end, cclptr, TRUE );
 		}
 
-		if( !pccl_ADDRANGE( ccl, begin, end ) )
+		if( !pccl_addrange( ccl, begin, end ) )
 		{
 			if( own )
 				pccl_free( own );
@@ -1826,8 +1934,6 @@ pccl* pccl_parse( pccl* ccl, char* ccldef, pboolean extend )
 		}
 	}
 
-	pccl_normalize( ccl );
-
 	return ccl;
 }
 
@@ -1840,6 +1946,7 @@ object, use pccl_free().
 void pccl_erase( pccl* ccl )
 {
 	parray_erase( &ccl->ranges );
+	memset( ccl->map, 0, sizeof( ccl->map ) );
 	ccl->str = pfree( ccl->str );
 }
 
@@ -1880,7 +1987,7 @@ char* pccl_to_str( pccl* ccl, pboolean escape )
 
 	/* Examine required size of the resulting string */
 	parray_for( &ccl->ranges, r )
-		len += ( ( r->begin != r->end ? 1 : 2 )			/* Two or one char? */
+		len += ( ( r->begin != r->end ? 2 : 1 )			/* Two or one char? */
 					* ( escape ? 10 : 6 ) ) 			/* Escaped or not? */
 				+ ( ( r->begin != r->end ) ? 1 : 0 );	/* Range-dash? */
 
@@ -2448,6 +2555,7 @@ because they allocate arrays of memory instead of unfixed, linked elements.
 
 /* Local prototypes */
 static pboolean plist_hash_rebuild( plist* list );
+static pboolean plist_ptrhash_rebuild( plist* list );
 
 /* Local variables & defines */
 
@@ -2660,6 +2768,82 @@ static pboolean plist_hash_rebuild( plist* list )
 	return TRUE;
 }
 
+/* Get pointer hash-table index */
+static size_t plist_ptrhash_index( plist* list, void* ptr )
+{
+	return ( (size_t)ptr >> 3 ) % list->ptrhashsize;
+}
+
+/* Insert a plist entry node into the pointer hash-table via its data. */
+static void plist_ptrhash_insert( plist* list, plistel* e )
+{
+	plistel**	bucket;
+
+	if( !list->ptrhash
+		|| ( plist_count( list ) * 100 > list->ptrhashsize * LOAD_FACTOR_HIGH
+				&& list->ptrsize_index + 1 <
+					( sizeof( table_sizes ) / sizeof( *table_sizes ) ) ) )
+	{
+		/* e will be inserted by plist_ptrhash_rebuild()! */
+		plist_ptrhash_rebuild( list );
+		return;
+	}
+
+	/* Chain behind equal pointers, so the first one is found first */
+	for( bucket = &( list->ptrhash[ plist_ptrhash_index(
+										list, plist_access( e ) ) ] );
+			*bucket; bucket = &( ( *bucket )->ptrnext ) )
+		;
+
+	e->ptrnext = (plistel*)NULL;
+	*bucket = e;
+}
+
+/* Remove a plist entry node from the pointer hash-table. */
+static void plist_ptrhash_remove( plist* list, plistel* e )
+{
+	plistel**	he;
+
+	for( he = &( list->ptrhash[ plist_ptrhash_index(
+									list, plist_access( e ) ) ] );
+			*he; he = &( ( *he )->ptrnext ) )
+		if( *he == e )
+		{
+			*he = e->ptrnext;
+			break;
+		}
+}
+
+/* Rebuild pointer hash-table */
+static pboolean plist_ptrhash_rebuild( plist* list )
+{
+	plistel*	e;
+	plistel**	bucket;
+
+	if( list->ptrhash )
+	{
+		list->ptrhash = pfree( list->ptrhash );
+		list->ptrsize_index++;
+	}
+
+	list->ptrhashsize = table_sizes[ list->ptrsize_index ];
+
+	if( !( list->ptrhash = (plistel**)pmalloc(
+									list->ptrhashsize * sizeof( plistel* ) ) ) )
+		return FALSE;
+
+	for( e = plist_last( list ); e; e = plist_prev( e ) )
+	{
+		bucket = &( list->ptrhash[ plist_ptrhash_index(
+										list, plist_access( e ) ) ] );
+
+		e->ptrnext = *bucket;
+		*bucket = e;
+	}
+
+	return TRUE;
+}
+
 /* Drop list element */
 static void plistel_drop( plistel* e )
 {
@@ -2732,6 +2916,9 @@ colliding element rather than __before__.
 - **PLIST_MOD_UNIQUE** to disallow hash-table-key collisions, so elements with \
 a key that already exist in the object will be rejected.
 - **PLIST_MOD_WCHAR** to handle all key values as wide-character strings.
+- **PLIST_MOD_PTRHASH** to maintain a hash-table over the element's data \
+pointers, so plist_get_by_ptr() runs in constant time. The data pointer of an \
+element in pointer-mode must not be changed while it is in the list.
 -
 
 Use plist_free() to erase and release the returned list object. */
@@ -2787,14 +2974,19 @@ void plist_erase( plist* list )
 		pfree( e );
 	}
 
-	/* Resetting hash table */
+	/* Resetting hash tables */
 	if( list->hash )
 		pfree( list->hash );
 
+	if( list->ptrhash )
+		pfree( list->ptrhash );
+
 	/* Resetting list-object pointers */
 	list->first = (plistel*)NULL;
 	list->last = (plistel*)NULL;
 	list->hash = (plistel**)NULL;
+	list->ptrhash = (plistel**)NULL;
+	list->ptrsize_index = 0;
 	list->unused = (plistel*)NULL;
 	list->count = 0;
 }
@@ -2896,6 +3088,9 @@ plistel* plist_insert( plist* list, plistel* pos, char* key, void* src )
 
 	list->count++;
 
+	if( list->flags & PLIST_MOD_PTRHASH )
+		plist_ptrhash_insert( list, e );
+
 	if( key )
 	{
 		/* Key provided, will insert into hash table */
@@ -2988,6 +3183,9 @@ void plist_remove( plist* list, plistel* e )
 		list->free_hash_entries++;
 	}
 
+	if( list->ptrhash )
+		plist_ptrhash_remove( list, e );
+
 	/* Drop element contents */
 	plistel_drop( e );
 
@@ -3193,12 +3391,23 @@ plistel* plist_get_by_nkey( plist* list, char* key, size_t n )
 /** Retrieve list element by pointer.
 
 This function returns the list element of the unit within the list //list//
-that is the pointer //ptr//.
+that is the pointer //ptr//. The lookup runs in constant time on lists
+configured with PLIST_MOD_PTRHASH, else the list is scanned.
 */
 plistel* plist_get_by_ptr( plist* list, void* ptr )
 {
 	plistel*	e;
 
+	if( list->ptrhash )
+	{
+		for( e = list->ptrhash[ plist_ptrhash_index( list, ptr ) ];
+				e; e = e->ptrnext )
+			if( plist_access( e ) == ptr )
+				return e;
+
+		return (plistel*)NULL;
+	}
+
 	for( e = plist_first( list ); e; e = plist_next( e ) )
 		if( plist_access( e ) == ptr )
 			return e;
@@ -6555,26 +6764,47 @@ static pboolean pregex_dfa_collect_ref( pregex_dfa_st* st, plist* nfa_set )
 	RETURN( TRUE );
 }
 
-/* Checks for DFA-states with same NFA-epsilon transitions than the specified
-	one within the DFA-state machine. If an equal item is found, the offset of
-		that DFA-state is returned, else -1. */
-static pregex_dfa_st* pregex_dfa_same_transitions(
-							pregex_dfa* dfa, plist* trans, parray* sets )
+/* Sort NFA-state ids */
+static int pregex_dfa_sort_ids( const void* l, const void* r )
+{
+	return *( (const int*)l ) - *( (const int*)r );
+}
+
+/* Computes the key of a set of NFA-states, which is the sorted sequence of the
+	distinct NFA-state ids. DFA-states are equal if their keys are equal.
+		Returns a newly allocated string, (char*)NULL on error. */
+static char* pregex_dfa_set_key( plist* nfa_set )
 {
 	plistel*		e;
-	pregex_dfa_st*	ptr;
-	plist*			nfa_set;
+	int*			ids;
+	char*			key;
+	char*			pos;
+	int				cnt		= 0;
+	int				i;
 
-	plist_for( dfa->states, e )
-	{
-		ptr = (pregex_dfa_st*)plist_access( e );
+	if( !( ids = (int*)pmalloc( ( plist_count( nfa_set ) + 1 )
+									* sizeof( int ) ) ) )
+		return (char*)NULL;
 
-		nfa_set = *( (plist**)parray_get( sets, plist_offset( e ) ) );
-		if( plist_diff( nfa_set, trans ) == 0 )
-			return ptr;
+	if( !( key = (char*)pmalloc( ( plist_count( nfa_set ) * 12 + 1 )
+									* sizeof( char ) ) ) )
+	{
+		pfree( ids );
+		return (char*)NULL;
 	}
 
-	return (pregex_dfa_st*)NULL;
+	plist_for( nfa_set, e )
+		ids[ cnt++ ] = ( (pregex_nfa_st*)plist_access( e ) )->id;
+
+	qsort( ids, cnt, sizeof( int ), pregex_dfa_sort_ids );
+
+	*( pos = key ) = '\0';
+	for( i = 0; i < cnt; i++ )
+		if( !i || ids[ i ] != ids[ i - 1 ] )
+			pos += sprintf( pos, "%d,", ids[ i ] );
+
+	pfree( ids );
+	return key;
 }
 
 /** Turns a NFA-state machine into a DFA-state machine using the
@@ -6592,14 +6822,17 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 {
 	plist*			transitions;
 	plist*			classes;
-	plist*			done;
+	plist*			keys;
+	parray*			states;
 	parray*			sets;
+	size_t			pending		= 0;
 
 	plist*			nfa_set;
 	plist*			current_nfa_set;
 
 	plistel*		e;
 	plistel*		f;
+	char*			key;
 	pregex_dfa_tr*	trans;
 	pregex_dfa_st*	current;
 	pregex_dfa_st*	st;
@@ -6630,8 +6863,11 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 
 	transitions = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
 
-	done = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
+	/* DFA-states by the keys of their NFA-state sets */
+	keys = plist_create( sizeof( int ), PLIST_MOD_NONE );
 
+	/* DFA-states and their NFA-state sets, by DFA-state index */
+	states = parray_create( sizeof( pregex_dfa_st* ), 0 );
 	sets = parray_create( sizeof( plist* ), 0 );
 
 	/* Starting seed */
@@ -6641,33 +6877,29 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 
 	nfa_set = plist_create( 0, PLIST_MOD_PTR );
 	plist_push( nfa_set, plist_access( plist_first( nfa->states ) ) );
+	parray_push( states, &current );
 	parray_push( sets, &nfa_set );
 
 	pregex_nfa_epsilon_closure( nfa, nfa_set, (unsigned int*)NULL, (int*)NULL );
 	pregex_dfa_collect_ref( current, nfa_set );
 
-	/* Perform algorithm until all states are done */
-	while( TRUE )
+	if( !( key = pregex_dfa_set_key( nfa_set ) )
+		|| !plist_insert( keys, (plistel*)NULL, key, (void*)&state_next ) )
+		RETURN( -1 );
+
+	pfree( key );
+
+	/* Perform algorithm until all states are done; The states are done in
+		the order of their creation */
+	while( pending < parray_count( states ) )
 	{
 		MSG( "WHILE" );
 
-		/* Get next undone state */
-		plist_for( dfa->states, e )
-		{
-			current = (pregex_dfa_st*)plist_access( e );
-			if( !plist_get_by_ptr( done, current ) )
-				break;
-		}
-
-		if( !e )
-		{
-			MSG( "No more undone states found" );
-			break;
-		}
+		current = *( (pregex_dfa_st**)parray_get( states, pending ) );
+		current_nfa_set = *( (plist**)parray_get( sets, pending ) );
+		pending++;
 
-		plist_push( done, current );
 		current->accept = 0;
-		current_nfa_set = *( (plist**)parray_get( sets, plist_offset( e ) ) );
 
 		/* Assemble all character sets in the alphabet list */
 		plist_erase( classes );
@@ -6783,16 +7015,19 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 					MSG( "transition set is empty, will continue" );
 					continue;
 				}
-				else if( ( st = pregex_dfa_same_transitions(
-									dfa, transitions, sets ) ) )
+
+				if( !( key = pregex_dfa_set_key( transitions ) ) )
+					RETURN( -1 );
+
+				if( ( f = plist_get_by_key( keys, key ) ) )
 				{
 					MSG( "State with same transitions exists" );
 					/* This transition is already existing in the DFA
 						- discard the transition table! */
 					plist_erase( transitions );
-					state_next = plist_offset(
-									plist_get_by_ptr( dfa->states, st ) );
+					state_next = *( (int*)plist_access( f ) );
 
+					st = *( (pregex_dfa_st**)parray_get( states, state_next ) );
 					nfa_set = *( (plist**)parray_get( sets, state_next ) );
 					pregex_dfa_collect_ref( st, nfa_set );
 				}
@@ -6803,16 +7038,23 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 					if( !( st = pregex_dfa_create_state( dfa ) ) )
 						RETURN( -1 );
 
-					state_next = plist_count( dfa->states ) - 1;
+					state_next = parray_count( states );
 
 					nfa_set = plist_dup( transitions );
 					plist_erase( transitions );
 
 					pregex_dfa_collect_ref( st, nfa_set );
 
+					parray_push( states, &st );
 					parray_push( sets, &nfa_set );
+
+					if( !plist_insert( keys, (plistel*)NULL, key,
+										(void*)&state_next ) )
+						RETURN( -1 );
 				}
 
+				pfree( key );
+
 				VARS( "state_next", "%d", state_next );
 
 				/* Find transition entry with same follow state */
@@ -6849,13 +7091,14 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 	}
 
 	/* Clear temporary allocated memory */
-	plist_free( done );
+	plist_free( keys );
 	plist_free( classes );
 	plist_free( transitions );
 
 	while( parray_count( sets ) )
 		plist_free( *( (plist**)parray_pop( sets ) ) );
 
+	parray_free( states );
 	parray_free( sets );
 
 	/* Set default transitions */
@@ -6864,70 +7107,25 @@ int pregex_dfa_from_nfa( pregex_dfa* dfa, pregex_nfa* nfa )
 	RETURN( plist_count( dfa->states ) );
 }
 
-/** Checks for transition equality within two dfa states.
-
-//dfa// is the pointer to DFA state machine.
-//groups// is the list of DFA groups
-//first// is the first state to check.
-//second// is the Second state to check.
-
-Returns TRUE if both states are totally equal, FALSE else.
-*/
-static pboolean pregex_dfa_equal_states(
-	pregex_dfa* dfa, plist* groups,
-		pregex_dfa_st* first, pregex_dfa_st* second )
+/* Sort wide characters */
+static int pregex_dfa_sort_chars( const void* l, const void* r )
 {
-	plistel*		e;
-	plistel*		f;
-	plistel*		g;
-	pregex_dfa_tr*	tr	[ 2 ];
-
-	PROC( "pregex_dfa_equal_states" );
-	PARMS( "first", "%p", first );
-	PARMS( "second", "%p", second );
+	wchar_t	lc	= *( (const wchar_t*)l );
+	wchar_t	rc	= *( (const wchar_t*)r );
 
-	if( plist_count( first->trans ) != plist_count( second->trans ) )
-	{
-		MSG( "Number of transitions is different" );
-		RETURN( FALSE );
-	}
-
-	for( e = plist_first( first->trans ), f = plist_first( second->trans );
-			e && f; e = plist_next( e ), f = plist_next( f ) )
-	{
-		tr[0] = (pregex_dfa_tr*)plist_access( e );
-		tr[1] = (pregex_dfa_tr*)plist_access( f );
-
-		/* Equal Character class selection? */
-		if( pccl_compare( tr[0]->ccl, tr[1]->ccl ) )
-		{
-			MSG( "Character classes are not equal" );
-			RETURN( FALSE );
-		}
-
-		/* Search for goto-state group equality */
-		first = (pregex_dfa_st*)plist_access(
-					plist_get( dfa->states, tr[0]->go_to ) );
-		second = (pregex_dfa_st*)plist_access(
-					plist_get( dfa->states, tr[1]->go_to ) );
-
-		plist_for( groups, g )
-		{
-			if( plist_get_by_ptr( (plist*)plist_access( g ), first )
-				&& !plist_get_by_ptr( (plist*)plist_access( g ), second ) )
-			{
-				MSG( "Transition state are in different groups\n" );
-				RETURN( FALSE );
-			}
-		}
-	}
-
-	RETURN( TRUE );
+	return lc < rc ? -1 : ( lc > rc ? 1 : 0 );
 }
 
 /** Minimizes a DFA to lesser states by grouping equivalent states to new
 states, and transforming transitions to them.
 
+The groups are found by Hopcroft's partition refinement. Its alphabet are the
+character ranges between the boundaries of all transition ranges of the DFA,
+so every transition either covers such a range entirely, or not at all.
+States are initially grouped by their accepting id, and missing transitions
+lead to an additional dead state. The groups are numbered in the order of
+their first state, so the start state remains the first state.
+
 //dfa// is the pointer to the DFA-machine that will be minimized. The content of
 //dfa// will be replaced with the reduced machine.
 
@@ -6936,23 +7134,48 @@ of //dfa//. Returns -1 on error.
 */
 int pregex_dfa_minimize( pregex_dfa* dfa )
 {
+	pregex_dfa_st**	states;
 	pregex_dfa_st*	dfa_st;
-	pregex_dfa_st*	grp_dfa_st;
 	pregex_dfa_tr*	ent;
-
+	pregex_dfa_tr*	prev;
 	plist*			min_states;
-	plist*			group;
-	plist*			groups;
-	plist*			newgroup;
-
 	plistel*		e;
 	plistel*		f;
-	plistel*		g;
-	plistel*		first;
-	plistel*		next;
-	plistel*		next_next;
+	plistel*		p;
+	pccl*			ccl;
+	wchar_t*		bounds;
+	wchar_t			begin;
+	wchar_t			end;
+	int*			delta;		/* Transition table, by state and symbol */
+	int*			inv;		/* Predecessors, by symbol and state */
+	int*			inv_first;	/* First predecessor, by symbol and state */
+	int*			elems;		/* States, ordered by group */
+	int*			pos;		/* Position in elems, by state */
+	int*			group;		/* Group, by state */
+	int*			first;		/* First position in elems, by group */
+	int*			last;		/* Last position in elems + 1, by group */
+	int*			marked;		/* Number of marked states, by group */
+	int*			touched;	/* Groups with marked states */
+	int*			splitter;	/* States of the splitting group */
+	int*			worklist;	/* Pending (group, symbol) splitters */
+	char*			pending;	/* Pending flags, by group and symbol */
+	int*			number;		/* New state number, by group */
+	int				n;
+	int				m;
+	int				k;
+	int				groups		= 0;
+	int				dead;
+	int				wcnt		= 0;
+	int				scnt;
+	int				tcnt;
+	int				a;
+	int				c;
+	int				g;
+	int				h;
+	int				s;
+	int				t;
 	int				i;
-	pboolean		changes		= TRUE;
+	int				j;
 
 	PROC( "pregex_dfa_minimize" );
 	PARMS( "dfa", "%p", dfa );
@@ -6963,160 +7186,321 @@ int pregex_dfa_minimize( pregex_dfa* dfa )
 		RETURN( -1 );
 	}
 
-	groups = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
+	if( !( n = plist_count( dfa->states ) ) )
+		RETURN( 0 );
+
+	/* States by index; The dead state gets index n */
+	if( !( states = (pregex_dfa_st**)pmalloc(
+						n * sizeof( pregex_dfa_st* ) ) ) )
+		RETURN( -1 );
 
-	MSG( "First, all states are grouped by accepting id" );
+	m = 0;
+	i = 0;
 	plist_for( dfa->states, e )
 	{
-		dfa_st = (pregex_dfa_st*)plist_access( e );
+		states[ i ] = (pregex_dfa_st*)plist_access( e );
 
-		plist_for( groups, f )
-		{
-			group = (plist*)plist_access( f );
-			grp_dfa_st = (pregex_dfa_st*)plist_access( plist_first( group ) );
+		plist_for( states[ i ]->trans, f )
+			m += pccl_size( ( (pregex_dfa_tr*)plist_access( f ) )->ccl );
 
-			if( grp_dfa_st->accept == dfa_st->accept )
-				break;
-		}
+		i++;
+	}
+
+	MSG( "Collecting the alphabet" );
+	if( !( bounds = (wchar_t*)pmalloc( ( m * 2 + 1 ) * sizeof( wchar_t ) ) ) )
+		RETURN( -1 );
 
-		if( !f )
+	m = 0;
+	for( i = 0; i < n; i++ )
+	{
+		plist_for( states[ i ]->trans, f )
 		{
-			group = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
-			if( !plist_push( group, dfa_st ) )
-				RETURN( -1 );
+			ent = (pregex_dfa_tr*)plist_access( f );
 
-			if( !plist_push( groups, group ) )
-				RETURN( -1 );
+			for( j = 0; pccl_get( &begin, &end, ent->ccl, j ); j++ )
+			{
+				bounds[ m++ ] = begin;
+				bounds[ m++ ] = end + 1;
+			}
 		}
-		else if( !plist_push( group, dfa_st ) )
-			RETURN( -1 );
 	}
 
-	MSG( "Perform the algorithm" );
-	while( changes )
-	{
-		MSG( "LOOP" );
-		VARS( "groups", "%d", plist_count( groups ) );
-		changes = FALSE;
+	qsort( bounds, m, sizeof( wchar_t ), pregex_dfa_sort_chars );
 
-		plist_for( groups, e )
-		{
-			MSG( "Examining group" );
-			newgroup = (plist*)NULL;
+	for( i = j = 0; i < m; i++ )
+		if( !j || bounds[ i ] != bounds[ j - 1 ] )
+			bounds[ j++ ] = bounds[ i ];
 
-			group = (plist*)plist_access( e );
+	/* Symbol c is the range from bounds[ c ] to bounds[ c + 1 ] - 1 */
+	k = j ? j - 1 : 0;
+	VARS( "alphabet", "%d", k );
 
-			first = plist_first( group );
+	MSG( "Constructing the transition table" );
+	if( !( delta = (int*)pmalloc( ( ( n + 1 ) * k + 1 ) * sizeof( int ) ) )
+		|| !( inv = (int*)pmalloc( ( ( n + 1 ) * k + 1 ) * sizeof( int ) ) )
+		|| !( inv_first = (int*)pmalloc(
+								( ( n + 1 ) * k + 2 ) * sizeof( int ) ) ) )
+		RETURN( -1 );
+
+	for( i = 0; i < ( n + 1 ) * k; i++ )
+		delta[ i ] = n;
 
-			dfa_st = (pregex_dfa_st*)plist_access( first );
-			next_next = plist_next( first );
+	for( s = 0; s < n; s++ )
+	{
+		plist_for( states[ s ]->trans, f )
+		{
+			ent = (pregex_dfa_tr*)plist_access( f );
 
-			while( ( next = next_next ) )
+			for( j = 0; pccl_get( &begin, &end, ent->ccl, j ); j++ )
 			{
-				next_next = plist_next( next );
-				grp_dfa_st = (pregex_dfa_st*)plist_access( next );
+				/* Find the symbol starting with begin */
+				for( a = 0, h = k; a < h; )
+				{
+					c = ( a + h ) / 2;
 
-				VARS( "dfa_st", "%d", plist_offset(
-										plist_get_by_ptr(
-											dfa->states, dfa_st ) ) );
-				VARS( "grp_dfa_st", "%d", plist_offset(
-										plist_get_by_ptr(
-											dfa->states, grp_dfa_st ) ) );
-				VARS( "dfa_st->trans", "%p", dfa_st->trans );
-				VARS( "grp_dfa_st->trans", "%p", grp_dfa_st->trans );
+					if( bounds[ c ] < begin )
+						a = c + 1;
+					else
+						h = c;
+				}
 
-				/* Check for state equality */
-				if( !pregex_dfa_equal_states( dfa, groups,
-							dfa_st, grp_dfa_st ) )
-				{
-					MSG( "States aren't equal" );
-					MSG( "Removing state from current group" );
-					plist_remove( group, plist_get_by_ptr(
-											group, grp_dfa_st ) );
+				for( c = a; c < k && bounds[ c ] <= end; c++ )
+					delta[ s * k + c ] = ent->go_to;
+			}
+		}
+	}
 
-					if( !plist_count( group ) )
-						plist_remove( groups,
-							plist_get_by_ptr( groups, first ) );
+	/* Predecessors of state t on symbol c are inv[ inv_first[ c * ( n + 1 )
+		+ t ] ] up to inv[ inv_first[ c * ( n + 1 ) + t + 1 ] - 1 ] */
+	for( s = 0; s <= n; s++ )
+		for( c = 0; c < k; c++ )
+			inv_first[ c * ( n + 1 ) + delta[ s * k + c ] + 1 ]++;
 
-					MSG( "Appending state into new group" );
+	for( i = 0; i < ( n + 1 ) * k; i++ )
+		inv_first[ i + 1 ] += inv_first[ i ];
 
-					if( !newgroup )
-					{
-						if( !( newgroup =
-								plist_create( 0,
-									PLIST_MOD_PTR | PLIST_MOD_RECYCLE ) ) )
-							RETURN( -1 );
-					}
+	for( s = 0; s <= n; s++ )
+		for( c = 0; c < k; c++ )
+			inv[ inv_first[ c * ( n + 1 ) + delta[ s * k + c ] ]++ ] = s;
 
-					if( !plist_push( newgroup, grp_dfa_st ) )
-						RETURN( -1 );
-				}
-			}
+	for( i = ( n + 1 ) * k; i > 0; i-- )
+		inv_first[ i ] = inv_first[ i - 1 ];
 
-			VARS( "newgroup", "%p", newgroup );
-			if( newgroup )
-			{
-				MSG( "Engaging new group into list of groups" );
-				if( !plist_push( groups, newgroup ) )
-					RETURN( -1 );
+	inv_first[ 0 ] = 0;
 
-				changes = TRUE;
-			}
-		}
+	MSG( "First, all states are grouped by accepting id" );
+	if( !( elems = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( pos = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( group = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( first = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( last = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( marked = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( touched = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( splitter = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( number = (int*)pmalloc( ( n + 1 ) * sizeof( int ) ) )
+		|| !( worklist = (int*)pmalloc( ( ( n + 1 ) * k + 1 )
+											* sizeof( int ) ) )
+		|| !( pending = (char*)pmalloc( ( ( n + 1 ) * k + 1 )
+											* sizeof( char ) ) ) )
+		RETURN( -1 );
 
-		VARS( "changes", "%s", BOOLEAN_STR( changes ) );
+	/* number[] temporarily holds the accepting id of each group */
+	for( s = 0; s <= n; s++ )
+	{
+		t = s < n ? (int)states[ s ]->accept : 0;
+
+		for( g = 0; g < groups; g++ )
+			if( number[ g ] == t )
+				break;
+
+		if( g == groups )
+			number[ groups++ ] = t;
+
+		group[ s ] = g;
+		last[ g ]++;
+	}
+
+	for( g = i = 0; g < groups; g++ )
+	{
+		first[ g ] = i;
+		i += last[ g ];
+		last[ g ] = first[ g ];
 	}
 
-	/* Now that we have all groups, reduce each group to one state */
-	plist_for( groups, e )
+	for( s = 0; s <= n; s++ )
 	{
-		group = (plist*)plist_access( e );
-		grp_dfa_st = (pregex_dfa_st*)plist_access( plist_first( group ) );
+		pos[ s ] = last[ group[ s ] ]++;
+		elems[ pos[ s ] ] = s;
+	}
 
-		plist_for( grp_dfa_st->trans, f )
+	for( g = 0; g < groups; g++ )
+		for( c = 0; c < k; c++ )
 		{
-			ent = (pregex_dfa_tr*)plist_access( f );
+			worklist[ wcnt++ ] = g * k + c;
+			pending[ g * k + c ] = TRUE;
+		}
+
+	MSG( "Perform the algorithm" );
+	while( wcnt )
+	{
+		a = worklist[ --wcnt ];
+		pending[ a ] = FALSE;
+
+		c = a % k;
+		a /= k;
 
-			dfa_st = (pregex_dfa_st*)plist_access(
-										plist_get( dfa->states, ent->go_to ) );
+		/* Copy the splitter, as its group may be split itself */
+		for( scnt = 0, i = first[ a ]; i < last[ a ]; i++ )
+			splitter[ scnt++ ] = elems[ i ];
 
-			for( g = plist_first( groups ), i = 0;
-					g; g = plist_next( g ), i++ )
+		/* Mark all predecessors on c, by moving them to the front of their
+			groups */
+		for( tcnt = i = 0; i < scnt; i++ )
+		{
+			t = c * ( n + 1 ) + splitter[ i ];
+
+			for( j = inv_first[ t ]; j < inv_first[ t + 1 ]; j++ )
 			{
-				if( plist_get_by_ptr( (plist*)plist_access( g ), dfa_st ) )
+				s = inv[ j ];
+				g = group[ s ];
+
+				if( !marked[ g ] )
+					touched[ tcnt++ ] = g;
+
+				h = first[ g ] + marked[ g ]++;
+
+				elems[ pos[ s ] ] = elems[ h ];
+				pos[ elems[ h ] ] = pos[ s ];
+				elems[ h ] = s;
+				pos[ s ] = h;
+			}
+		}
+
+		/* Split groups with marked and unmarked states */
+		for( i = 0; i < tcnt; i++ )
+		{
+			g = touched[ i ];
+
+			if( marked[ g ] < last[ g ] - first[ g ] )
+			{
+				h = groups++;
+				VARS( "split group", "%d", g );
+
+				first[ h ] = first[ g ];
+				last[ h ] = first[ g ] = first[ g ] + marked[ g ];
+
+				for( j = first[ h ]; j < last[ h ]; j++ )
+					group[ elems[ j ] ] = h;
+
+				for( t = 0; t < k; t++ )
 				{
-					ent->go_to = i;
-					break;
+					if( pending[ g * k + t ]
+						|| last[ h ] - first[ h ] <= last[ g ] - first[ g ] )
+						s = h;
+					else
+						s = g;
+
+					if( !pending[ s * k + t ] )
+					{
+						worklist[ wcnt++ ] = s * k + t;
+						pending[ s * k + t ] = TRUE;
+					}
 				}
 			}
+
+			marked[ g ] = 0;
 		}
 	}
 
-	/* Put leading group states into new, minimized dfa state machine */
+	VARS( "groups", "%d", groups );
+
+	/* States equivalent to the dead state are dropped, unless the start
+		state is one of them */
+	dead = group[ n ] != group[ 0 ] ? group[ n ] : -1;
+
+	/* Number the groups by their first state; The first state of a group
+		becomes the state of the group in the minimized DFA */
+	for( g = 0; g < groups; g++ )
+		number[ g ] = -1;
+
+	for( s = i = 0; s < n; s++ )
+		if( group[ s ] != dead && number[ group[ s ] ] < 0 )
+			splitter[ ( number[ group[ s ] ] = i++ ) ] = s;
+
+	/* Put group states into new, minimized dfa state machine */
 	min_states = plist_create( sizeof( pregex_dfa_st ), PLIST_MOD_RECYCLE );
 
-	plist_for( groups, e )
+	for( s = 0; s < n; s++ )
 	{
-		group = (plist*)plist_access( e );
-
-		grp_dfa_st = (pregex_dfa_st*)plist_access( plist_first( group ) );
+		dfa_st = states[ s ];
 
-		/* Delete all states except the first one in the group */
-		for( f = plist_next( plist_first( group ) ); f; f = plist_next( f ) )
+		if( group[ s ] == dead || splitter[ number[ group[ s ] ] ] != s )
 		{
-			dfa_st = (pregex_dfa_st*)plist_access( f );
-			grp_dfa_st->refs |= dfa_st->refs;
+			/* Delete all states except the first one in the group */
+			if( group[ s ] != dead )
+				states[ splitter[ number[ group[ s ] ] ] ]->refs
+					|= dfa_st->refs;
+
 			pregex_dfa_delete_state( dfa_st );
+			continue;
 		}
 
-		/* Push the first one into the minimized list */
-		plist_push( min_states, grp_dfa_st );
+		/* Transitions to the same group are joined, transitions to the dead
+			state are removed */
+		for( e = plist_first( dfa_st->trans ); e; e = f )
+		{
+			f = plist_next( e );
 
-		/* Free this group */
-		plist_free( group );
+			ent = (pregex_dfa_tr*)plist_access( e );
+
+			if( group[ ent->go_to ] == dead )
+			{
+				pccl_free( ent->ccl );
+				plist_remove( dfa_st->trans, e );
+				continue;
+			}
+
+			ent->go_to = number[ group[ ent->go_to ] ];
+
+			for( p = plist_first( dfa_st->trans ); p != e; p = plist_next( p ) )
+				if( ( prev = (pregex_dfa_tr*)plist_access( p ) )->go_to
+						== ent->go_to )
+					break;
+
+			if( p != e )
+			{
+				if( !( ccl = pccl_union( prev->ccl, ent->ccl ) ) )
+					RETURN( -1 );
+
+				pccl_free( prev->ccl );
+				prev->ccl = ccl;
+
+				pccl_free( ent->ccl );
+				plist_remove( dfa_st->trans, e );
+			}
+		}
 	}
 
-	plist_free( groups );
+	for( s = 0; s < n; s++ )
+		if( group[ s ] != dead && splitter[ number[ group[ s ] ] ] == s )
+			plist_push( min_states, states[ s ] );
+
+	pfree( states );
+	pfree( bounds );
+	pfree( delta );
+	pfree( inv );
+	pfree( inv_first );
+	pfree( elems );
+	pfree( pos );
+	pfree( group );
+	pfree( first );
+	pfree( last );
+	pfree( marked );
+	pfree( touched );
+	pfree( splitter );
+	pfree( worklist );
+	pfree( pending );
+	pfree( number );
 
 	/* Replace states by minimized list */
 	plist_free( dfa->states );
@@ -8519,6 +8903,13 @@ pboolean pregex_check_anchors( char* all, char* str, size_t len,
 /*NO_DOC*/
 /* No documentation for the entire module, all here is only interally used. */
 
+/* Bitsets of NFA-states, by NFA-state id */
+#define NFA_SET_BITS			( sizeof( unsigned int ) * 8 )
+#define NFA_SET_ADD( set, st )	( (set)[ (st)->id / NFA_SET_BITS ] \
+									|= 1U << ( (st)->id % NFA_SET_BITS ) )
+#define NFA_SET_TEST( set, st )	( (set)[ (st)->id / NFA_SET_BITS ] \
+									& 1U << ( (st)->id % NFA_SET_BITS ) )
+
 /** Creates a new NFA-state within an NFA state machine. The function first
 checks if there are recyclable states in //nfa//. If so, the state is re-used
 and re-configured, else a new state is allocated in memory.
@@ -8542,6 +8933,7 @@ pregex_nfa_st* pregex_nfa_create_state(
 
 	/* Get new element */
 	ptr = plist_malloc( nfa->states );
+	ptr->id = nfa->ids++;
 
 	/* Define character edge? */
 	if( chardef )
@@ -8668,7 +9060,8 @@ pregex_nfa* pregex_nfa_create( void )
 	pregex_nfa*		nfa;
 
 	nfa = (pregex_nfa*)pmalloc( sizeof( pregex_nfa ) );
-	nfa->states = plist_create( sizeof( pregex_nfa_st ), PLIST_MOD_RECYCLE );
+	nfa->states = plist_create( sizeof( pregex_nfa_st ),
+						PLIST_MOD_RECYCLE | PLIST_MOD_PTRHASH );
 
 	return nfa;
 }
@@ -8698,6 +9091,8 @@ pboolean pregex_nfa_reset( pregex_nfa* nfa )
 		plist_remove( nfa->states, plist_first( nfa->states ) );
 	}
 
+	nfa->ids = 0;
+
 	RETURN( TRUE );
 }
 
@@ -8812,6 +9207,8 @@ int pregex_nfa_epsilon_closure( pregex_nfa* nfa, plist* closure,
 	pregex_nfa_st*	next;
 	pregex_nfa_st*	last_accept	= (pregex_nfa_st*)NULL;
 	plist*			stack;
+	plistel*		e;
+	unsigned int*	done;
 	short			i;
 
 	PROC( "pregex_nfa_epsilon_closure" );
@@ -8830,6 +9227,14 @@ int pregex_nfa_epsilon_closure( pregex_nfa* nfa, plist* closure,
 	if( flags )
 		*flags = 0;
 
+	/* Bitset of the states in the closure, by NFA-state id */
+	if( !( done = (unsigned int*)pmalloc( ( nfa->ids / NFA_SET_BITS + 1 )
+											* sizeof( unsigned int ) ) ) )
+		RETURN( -1 );
+
+	plist_for( closure, e )
+		NFA_SET_ADD( done, (pregex_nfa_st*)plist_access( e ) );
+
 	stack = plist_dup( closure );
 
 	/* Loop through the items */
@@ -8845,8 +9250,10 @@ int pregex_nfa_epsilon_closure( pregex_nfa* nfa, plist* closure,
 			for( i = 0; i < 2; i++ )
 			{
 				next = ( !i ? top->next : top->next2 );
-				if( next && !plist_get_by_ptr( closure, next ) )
+				if( next && !NFA_SET_TEST( done, next ) )
 				{
+					NFA_SET_ADD( done, next );
+
 					plist_push( closure, next );
 					plist_push( stack, next );
 				}
@@ -8863,6 +9270,7 @@ int pregex_nfa_epsilon_closure( pregex_nfa* nfa, plist* closure,
 	}
 
 	stack = plist_free( stack );
+	pfree( done );
 
 	if( accept && last_accept )
 	{
@@ -9865,6 +10273,7 @@ static pboolean pregex_ptn_to_NFA( pregex_nfa* nfa, pregex_ptn* pattern,
 	pregex_nfa_st*	n_start	= (pregex_nfa_st*)NULL;
 	pregex_nfa_st*	n_end	= (pregex_nfa_st*)NULL;
 	int				ref		= 0;
+	int				id;
 
 	if( !( pattern && nfa && start && end ) )
 	{
@@ -10012,7 +10421,9 @@ static pboolean pregex_ptn_to_NFA( pregex_nfa* nfa, pregex_ptn* pattern,
 			*/
 			if( !( (*end)->refs ) )
 			{
+				id = (*end)->id;
 				memcpy( *end, n_start, sizeof( pregex_nfa_st ) );
+				(*end)->id = id;
 
 				plist_remove( nfa->states,
 					plist_get_by_ptr( nfa->states, n_start ) );
@@ -281,6 +281,8 @@ struct Plistel
 
 	plistel*				hashnext;
 	plistel*				hashprev;
+
+	plistel*				ptrnext;
 };
 
 
@@ -296,6 +298,7 @@ struct Plist
 #define PLIST_MOD_KEEPKEYS	32	
 #define PLIST_MOD_UNIQUE	64	
 #define PLIST_MOD_WCHAR		128	
+#define PLIST_MOD_PTRHASH	256	
 
 	size_t					size;
 	size_t					count;
@@ -313,6 +316,10 @@ struct Plist
 	plistel*				last;
 	plistel**				hash;
 
+	plistel**				ptrhash;
+	int						ptrhashsize;
+	int						ptrsize_index;
+
 	
 	int						load_factor;
 	int						free_hash_entries;
@@ -351,6 +358,7 @@ typedef struct
 	wchar_t			max;		
 
 	parray			ranges;		
+	unsigned char	map[ 32 ];	
 
 	char*			str;		
 } pccl;
@@ -432,6 +440,8 @@ struct _regex_nfa_st
 	unsigned int	accept;		
 	int				flags;		
 	int				refs;		
+
+	int				id;			
 };
 
 
@@ -439,6 +449,8 @@ struct _regex_nfa
 {
 	plist*			states;		
 	int				modifiers;	
+
+	int				ids;		
 };
 
 
@@ -0,0 +1,208 @@
+/* Region allocator for objects living as long as the parser information
+structure, e.g. closure items and symbol names. */
+
+#include "unicc.h"
+
+/* Alignment of arena objects */
+#define ARENA_ALIGN			sizeof( double )
+
+/* Memory block of an arena; The objects follow the header. */
+struct _arena_block
+{
+    ARENA_BLOCK*	next;			/* Previously allocated block */
+    size_t			size;			/* Usable size of the block */
+};
+
+#define ARENA_HEADER		( ( sizeof( ARENA_BLOCK ) + ARENA_ALIGN - 1 ) \
+                                / ARENA_ALIGN * ARENA_ALIGN )
+
+/** Initializes an empty arena.
+
+//a// is the arena to be initialized.
+//name// is the arena's name, used by arena_stats().
+//chunk// is the minimum size of the memory blocks to be allocated.
+//objsize// is the size of the objects that can be given back to the arena by
+arena_recycle(), or 0 if objects are only released with the whole arena. */
+void arena_init( ARENA* a, char* name, size_t chunk, size_t objsize )
+{
+    memset( a, 0, sizeof( ARENA ) );
+
+    a->name = name;
+    a->chunk = chunk;
+    a->objsize = objsize;
+}
+
+/** Takes //size// bytes from the current block of arena //a//, aligned to
+//align//. A new block is allocated when the current one is exhausted. */
+static void* arena_take( ARENA* a, size_t size, size_t align )
+{
+    ARENA_BLOCK*	block;
+    char*			ptr;
+    size_t			bsize;
+
+    ptr = a->ptr + ( ( align - (size_t)a->ptr % align ) % align );
+
+    if( !a->ptr || ptr + size > a->end )
+    {
+        bsize = size > a->chunk ? size : a->chunk;
+
+        if( !( block = (ARENA_BLOCK*)pmalloc( ARENA_HEADER + bsize ) ) )
+        {
+            OUTOFMEM;
+            return (void*)NULL;
+        }
+
+        block->next = a->blocks;
+        block->size = bsize;
+
+        a->blocks = block;
+        a->reserved += ARENA_HEADER + bsize;
+
+        ptr = (char*)block + ARENA_HEADER;
+        a->end = ptr + bsize;
+    }
+
+    a->ptr = ptr + size;
+
+    if( ( a->used += size ) > a->peak )
+        a->peak = a->used;
+
+    a->allocs++;
+    return (void*)ptr;
+}
+
+/** Allocates //size// bytes of zero-initialized memory from arena //a//.
+
+The memory stays valid until the arena is released by arena_free(), or until
+it is given back to the arena by arena_recycle().
+
+Returns a pointer to the memory, (void*)NULL in error case. */
+void* arena_malloc( ARENA* a, size_t size )
+{
+    void*	ptr;
+
+    if( a->objsize && size == a->objsize && a->recycled )
+    {
+        ptr = a->recycled;
+        a->recycled = *( (void**)ptr );
+
+        if( ( a->used += size ) > a->peak )
+            a->peak = a->used;
+
+        a->allocs++;
+    }
+    else if( !( ptr = arena_take( a, size, ARENA_ALIGN ) ) )
+        return (void*)NULL;
+
+    memset( ptr, 0, size );
+    return ptr;
+}
+
+/** Gives object //ptr// back to arena //a//, where it is re-used by the next
+arena_malloc() of the arena's object size. Arenas without an object size
+ignore this call. */
+void arena_recycle( ARENA* a, void* ptr )
+{
+    if( !ptr || !a->objsize || a->objsize < sizeof( void* ) )
+        return;
+
+    *( (void**)ptr ) = a->recycled;
+    a->recycled = ptr;
+
+    a->used -= a->objsize;
+}
+
+/** Duplicates string //str// into arena //a//.
+
+Returns the copy of the string, (char*)NULL in error case. */
+char* arena_strdup( ARENA* a, char* str )
+{
+    return arena_strcat( a, str, (char*)NULL );
+}
+
+/** Duplicates the concatenation of the strings //str// and //append// into
+arena //a//. Both strings can be (char*)NULL.
+
+Returns the concatenated string, (char*)NULL in error case. */
+char* arena_strcat( ARENA* a, char* str, char* append )
+{
+    char*	ret;
+    size_t	len;
+    size_t	alen;
+
+    len = str ? strlen( str ) : 0;
+    alen = append ? strlen( append ) : 0;
+
+    if( !( ret = (char*)arena_take( a, len + alen + 1, 1 ) ) )
+        return (char*)NULL;
+
+    if( len )
+        memcpy( ret, str, len );
+
+    if( alen )
+        memcpy( ret + len, append, alen );
+
+    ret[ len + alen ] = '\0';
+    return ret;
+}
+
+/** Moves all memory of arena //from// into arena //a//, which must have the
+same object size. //from// is empty afterwards, and its high-water mark is
+added to the one of //a//. */
+void arena_merge( ARENA* a, ARENA* from )
+{
+    ARENA_BLOCK*	block;
+    void**			last;
+
+    if( ( block = from->blocks ) )
+    {
+        while( block->next )
+            block = block->next;
+
+        block->next = a->blocks;
+        a->blocks = from->blocks;
+    }
+
+    if( from->recycled )
+    {
+        for( last = (void**)from->recycled; *last; last = (void**)*last )
+            ;
+
+        *last = a->recycled;
+        a->recycled = from->recycled;
+    }
+
+    a->used += from->used;
+    a->peak += from->peak;
+    a->reserved += from->reserved;
+    a->allocs += from->allocs;
+
+    arena_init( from, from->name, from->chunk, from->objsize );
+}
+
+/** Releases all memory of arena //a// at once. The arena can be used again
+afterwards. */
+void arena_free( ARENA* a )
+{
+    ARENA_BLOCK*	block;
+
+    while( ( block = a->blocks ) )
+    {
+        a->blocks = block->next;
+        pfree( block );
+    }
+
+    a->ptr = a->end = (char*)NULL;
+    a->recycled = (void*)NULL;
+    a->used = a->reserved = 0;
+}
+
+/** Prints the high-water mark and the current usage of arena //a// to
+//stream//. */
+void arena_stats( FILE* stream, ARENA* a )
+{
+    fprintf( stream, "%s arena: %ld bytes peak, %ld bytes used, "
+                "%ld bytes reserved, %ld allocations\n",
+                    a->name, (long)a->peak, (long)a->used,
+                        (long)a->reserved, a->allocs );
+}
@@ -0,0 +1,199 @@
+/* Dense bitsets, used for FIRST- and lookahead-sets of terminal symbol ids. */
+
+#include "unicc.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+
+/* Number of bitset words processed in one SSE2 register */
+#define BITSET_VECWORDS		( sizeof( __m128i ) / sizeof( BITWORD ) )
+#endif
+
+#define BITSET_WORD( bit )	( (bit) / BITSET_WORDBITS )
+#define BITSET_MASK( bit )	( (BITWORD)1 << ( (bit) % BITSET_WORDBITS ) )
+
+/** Counts the bits set in a single bitset word.
+
+//w// is the word to be examined.
+
+Returns the number of bits set in //w//. */
+static int bitset_popcount( BITWORD w )
+{
+#ifdef __GNUC__
+    return __builtin_popcountl( w );
+#else
+    int		cnt;
+
+    for( cnt = 0; w; cnt++ )
+        w &= w - 1;
+
+    return cnt;
+#endif
+}
+
+/** Enlarges the bitset //set// to hold at least //words// words. New words are
+initialized to zero. */
+static void bitset_grow( BITSET* set, int words )
+{
+    if( set->words >= words )
+        return;
+
+    if( !( set->bits = (BITWORD*)prealloc( set->bits,
+                            words * sizeof( BITWORD ) ) ) )
+    {
+        OUTOFMEM;
+        return;
+    }
+
+    memset( set->bits + set->words, 0,
+                ( words - set->words ) * sizeof( BITWORD ) );
+    set->words = words;
+}
+
+/** Initializes an empty bitset.
+
+//set// is the bitset to be initialized. */
+void bitset_init( BITSET* set )
+{
+    set->words = 0;
+    set->bits = (BITWORD*)NULL;
+}
+
+/** Frees the memory used by a bitset, and resets it to an empty bitset.
+
+//set// is the bitset to be reset. */
+void bitset_reset( BITSET* set )
+{
+    pfree( set->bits );
+    bitset_init( set );
+}
+
+/** Clears all bits of a bitset, but keeps its memory for further use.
+
+//set// is the bitset to be erased. */
+void bitset_erase( BITSET* set )
+{
+    if( set->words )
+        memset( set->bits, 0, set->words * sizeof( BITWORD ) );
+}
+
+/** Sets bit //bit// in //set//; The bitset grows as required.
+
+Returns TRUE if the bit was newly set, FALSE if it was already set. */
+BOOLEAN bitset_set( BITSET* set, int bit )
+{
+    bitset_grow( set, BITSET_WORD( bit ) + 1 );
+
+    if( set->bits[ BITSET_WORD( bit ) ] & BITSET_MASK( bit ) )
+        return FALSE;
+
+    set->bits[ BITSET_WORD( bit ) ] |= BITSET_MASK( bit );
+    return TRUE;
+}
+
+/** Tests for bit //bit// in //set//.
+
+Returns TRUE if the bit is set, FALSE otherwise. */
+BOOLEAN bitset_get( BITSET* set, int bit )
+{
+    if( BITSET_WORD( bit ) >= set->words )
+        return FALSE;
+
+    return ( set->bits[ BITSET_WORD( bit ) ] & BITSET_MASK( bit ) )
+                ? TRUE : FALSE;
+}
+
+/** Returns the number of bits set in //set//. */
+int bitset_count( BITSET* set )
+{
+    int		i;
+    int		cnt		= 0;
+
+    for( i = 0; i < set->words; i++ )
+        cnt += bitset_popcount( set->bits[ i ] );
+
+    return cnt;
+}
+
+/** Unites the bitset //from// into //set//, so that //set// contains all bits
+of both sets afterwards. The union is performed word-parallel, and with SSE2
+on two or four words at once, where available.
+
+Returns the number of bits that have been newly set in //set//. A return value
+of 0 means that //set// was not changed. */
+int bitset_union( BITSET* set, BITSET* from )
+{
+    BITWORD	add;
+    int		cnt		= 0;
+    int		i		= 0;
+#ifdef __SSE2__
+    __m128i	vset;
+    __m128i	vadd;
+    BITWORD	words	[ BITSET_VECWORDS ];
+    int		j;
+#endif
+
+    bitset_grow( set, from->words );
+
+#ifdef __SSE2__
+    for( ; i + (int)BITSET_VECWORDS <= from->words; i += BITSET_VECWORDS )
+    {
+        vset = _mm_loadu_si128( (__m128i*)( set->bits + i ) );
+        vadd = _mm_andnot_si128( vset,
+                    _mm_loadu_si128( (__m128i*)( from->bits + i ) ) );
+
+        /* Skip the store when no new bits are added */
+        if( _mm_movemask_epi8( _mm_cmpeq_epi8( vadd, _mm_setzero_si128() ) )
+                == 0xFFFF )
+            continue;
+
+        _mm_storeu_si128( (__m128i*)( set->bits + i ),
+                            _mm_or_si128( vset, vadd ) );
+        _mm_storeu_si128( (__m128i*)words, vadd );
+
+        for( j = 0; j < (int)BITSET_VECWORDS; j++ )
+            cnt += bitset_popcount( words[ j ] );
+    }
+#endif
+
+    for( ; i < from->words; i++ )
+    {
+        if( ( add = from->bits[ i ] & ~set->bits[ i ] ) )
+        {
+            set->bits[ i ] |= add;
+            cnt += bitset_popcount( add );
+        }
+    }
+
+    return cnt;
+}
+
+/** Returns the next bit set in //set// starting at bit //bit//, or -1 if there
+is no further bit set. Iterating over all bits of a set is done with
+
+``` for( i = bitset_next( set, 0 ); i >= 0; i = bitset_next( set, i + 1 ) )
+*/
+int bitset_next( BITSET* set, int bit )
+{
+    BITWORD	w;
+    int		i;
+
+    if( bit < 0 || BITSET_WORD( bit ) >= set->words )
+        return -1;
+
+    i = BITSET_WORD( bit );
+    w = set->bits[ i ] & ~( BITSET_MASK( bit ) - 1 );
+
+    while( !w )
+    {
+        if( ++i >= set->words )
+            return -1;
+
+        w = set->bits[ i ];
+    }
+
+    for( bit = i * BITSET_WORDBITS; !( w & 1 ); w >>= 1 )
+        bit++;
+
+    return bit;
+}
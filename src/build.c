@@ -12,6 +12,134 @@ extern FILE*	status;
 static plex*	action_lex;
 static plex*	scan_lex;
 
+/* Generated tables with a value range; Tables which name extends the name of
+another table must come first, so its expansion macros are replaced first. */
+enum
+{
+    TAB_ACTION,
+    TAB_GOTO,
+    TAB_DEF_PROD,
+    TAB_DFA_SELECT,
+    TAB_DFA_INDEX,
+    TAB_DFA_CHAR,
+    TAB_DFA_TRANS,
+    TAB_DFA_ACCEPT,
+    TAB_DFA_DENSE,
+    TAB_CHAR_MAP_INDEX,
+    TAB_CHAR_MAP,
+    TAB_ACTION_BASE,
+    TAB_ACTION_CHECK,
+    TAB_ACTION_NEXT,
+    TAB_GOTO_BASE,
+    TAB_GOTO_CHECK,
+    TAB_GOTO_NEXT,
+    TAB_COUNT
+};
+
+/* Names of the tables, as used by their expansion macros */
+static char*	table_names[ TAB_COUNT ] =
+{
+    "action-table",
+    "goto-table",
+    "default-productions",
+    "dfa-select",
+    "dfa-index",
+    "dfa-char",
+    "dfa-trans",
+    "dfa-accept",
+    "dfa-dense",
+    "character-map-index",
+    "character-map",
+    "action-base",
+    "action-check",
+    "action-next",
+    "goto-base",
+    "goto-check",
+    "goto-next"
+};
+
+/* Value range of a generated table */
+typedef struct
+{
+    long		min;			/* Smallest value */
+    long		max;			/* Largest value */
+} TABRANGE;
+
+/* Character range of a DFA transition */
+typedef struct
+{
+    wchar_t		from;			/* First character or class */
+    wchar_t		to;				/* Last character or class */
+    int			go_to;			/* Target state */
+} DFARANGE;
+
+/* Compares two DFA transition ranges by their first character */
+static int sort_dfa_ranges( const void* l, const void* r )
+{
+    wchar_t	lc	= ( (const DFARANGE*)l )->from;
+    wchar_t	rc	= ( (const DFARANGE*)r )->from;
+
+    return lc < rc ? -1 : ( lc > rc ? 1 : 0 );
+}
+
+/** Extends range //r// by //value//. */
+static void range_add( TABRANGE* r, long value )
+{
+    if( value < r->min )
+        r->min = value;
+
+    if( value > r->max )
+        r->max = value;
+}
+
+/** Expands the value range of table //tab// in the template //tpl//, which is
+freed. The expansion macros @@type-of-<name>, @@minimum-of-<name> and
+@@maximum-of-<name> are replaced, where <name> is the name of the expansion
+macro of the table. The type is the first <int-type> of the generator //g//
+that holds the range, or the last one if none holds it.
+
+Returns the expanded template. */
+static char* build_range( GENERATOR* g, char* tpl, int tab, TABRANGE* r )
+{
+    XML_T		t;
+    char*		type	= "";
+    char*		min;
+    char*		max;
+    char*		ret;
+    char*		wild	[ 3 ];
+
+    for( t = xml_child( g->xml, "int-type" ); t; t = xml_next( t ) )
+    {
+        type = (char*)xml_txt( t );
+
+        if( ( min = (char*)xml_attr( t, "min" ) ) && atol( min ) <= r->min
+            && ( max = (char*)xml_attr( t, "max" ) ) && atol( max ) >= r->max )
+            break;
+    }
+
+    if( !( wild[ 0 ] = pasprintf( GEN_WILD_PREFIX "type-of-%s",
+                                    table_names[ tab ] ) )
+        || !( wild[ 1 ] = pasprintf( GEN_WILD_PREFIX "minimum-of-%s",
+                                    table_names[ tab ] ) )
+        || !( wild[ 2 ] = pasprintf( GEN_WILD_PREFIX "maximum-of-%s",
+                                    table_names[ tab ] ) ) )
+        OUTOFMEM;
+
+    if( !( ret = pstrrender( tpl,
+                    wild[ 0 ], type, FALSE,
+                    wild[ 1 ], long_to_str( r->min ), TRUE,
+                    wild[ 2 ], long_to_str( r->max ), TRUE,
+                    (char*)NULL ) ) )
+        OUTOFMEM;
+
+    pfree( wild[ 0 ] );
+    pfree( wild[ 1 ] );
+    pfree( wild[ 2 ] );
+    pfree( tpl );
+
+    return ret;
+}
+
 /** Escapes the input-string according to the parser templates
 escaping-sequence definitions. This function is used to print identifiers and
 character-class definitions to the target parser without getting trouble with
@@ -191,7 +319,7 @@ char* build_action( PARSER* parser, GENERATOR* g, PROD* p,
 
             case 4:
                 MSG( "Left-hand side" );
-                if( p->lhs->vtype && list_count( parser->vtypes ) > 1 )
+                if( p->lhs->vtype && parray_count( parser->vtypes ) > 1 )
                     ret = pstrcatstr( ret,
                             pstrrender( g->action_lhs_union,
                                 GEN_WILD_PREFIX "attribute",
@@ -275,7 +403,7 @@ char* build_action( PARSER* parser, GENERATOR* g, PROD* p,
 
             if( sym && !( sym->keyword ) )
             {
-                if( list_count( parser->vtypes ) > 1 )
+                if( parray_count( parser->vtypes ) > 1 )
                 {
                     if( sym->vtype )
                     {
@@ -430,7 +558,7 @@ char* build_scan_action( PARSER* parser, GENERATOR* g, SYMBOL* s, char* base )
 
             case 3:
                 MSG( "@@" );
-                if( s->vtype && list_count( parser->vtypes ) > 1 )
+                if( s->vtype && parray_count( parser->vtypes ) > 1 )
                     ret = pstrcatstr( ret,
                             pstrrender( g->scan_action_ret_union,
                                 GEN_WILD_PREFIX "attribute",
@@ -555,6 +683,164 @@ char* mkproduction_str( PROD* p )
     return ret;
 }
 
+/** Constructs the comb-vector form of the action or goto table, where the
+rows of all states are overlaid into one vector. Every state gets a base
+offset, so the entry for a symbol is found at the base offset of the state plus
+the symbol id, if the check vector holds the state number at this position.
+The rows are placed first-fit, the most populated rows first.
+
+//parser// is the parser information structure,
+//g// is the generator template structure,
+//go// selects the goto table instead of the action table,
+//base//, //check// and //next// receive the rendered tables, which must be
+freed by the caller, and //ranges// the value ranges of these tables.
+
+Returns the size of the check and next vectors. */
+static int build_comb( PARSER* parser, GENERATOR* g, BOOLEAN go,
+                        char** base, char** check, char** next,
+                        TABRANGE* ranges )
+{
+    _1D_TABLE*	base_tab	= go ? &g->go_base : &g->act_base;
+    _1D_TABLE*	check_tab	= go ? &g->go_check : &g->act_check;
+    _1D_TABLE*	next_tab	= go ? &g->go_next : &g->act_next;
+    int*		bases;
+    int*		states		= (int*)NULL;
+    TABCOL**	cols		= (TABCOL**)NULL;
+    int			size		= 0;
+    int			alloc		= 0;
+    int			lowest		= 0;
+    int			max			= 0;
+    int			cnt;
+    int			min;
+    int			b;
+    int			i;
+    int			j;
+    parray*		row;
+    STATE*		st;
+    TABCOL*		col;
+
+    if( !( bases = (int*)pmalloc( parray_count( parser->states )
+                                    * sizeof( int ) ) ) )
+        OUTOFMEM;
+
+    parray_for( parser->states, st )
+    {
+        bases[ st->state_id ] = 0;
+
+        row = go ? st->gotos : st->actions;
+        if( max < parray_count( row ) )
+            max = parray_count( row );
+    }
+
+    for( cnt = max; cnt > 0; cnt-- )
+        parray_for( parser->states, st )
+        {
+            row = go ? st->gotos : st->actions;
+            if( parray_count( row ) != cnt )
+                continue;
+
+            min = -1;
+            parray_for( row, col )
+                if( min < 0 || col->symbol->id < min )
+                    min = col->symbol->id;
+
+            /* The lowest symbol must fit into a free slot */
+            for( b = lowest - min; ; b++ )
+            {
+                parray_for( row, col )
+                    if( b + col->symbol->id < size
+                            && states[ b + col->symbol->id ] >= 0 )
+                        break;
+
+                if( !col )
+                    break;
+            }
+
+            bases[ st->state_id ] = b;
+
+            parray_for( row, col )
+            {
+                i = b + col->symbol->id;
+
+                if( i >= alloc )
+                {
+                    alloc = i + 1 + alloc;
+
+                    if( !( states = (int*)prealloc( states,
+                                            alloc * sizeof( int ) ) )
+                        || !( cols = (TABCOL**)prealloc( cols,
+                                            alloc * sizeof( TABCOL* ) ) ) )
+                        OUTOFMEM;
+                }
+
+                for( ; size <= i; size++ )
+                    states[ size ] = -1;
+
+                states[ i ] = st->state_id;
+                cols[ i ] = col;
+            }
+
+            while( lowest < size && states[ lowest ] >= 0 )
+                lowest++;
+        }
+
+    /* Base offsets */
+    for( j = 0; j < parray_count( parser->states ); j++ )
+    {
+        if( j )
+            *base = pstrcatstr( *base, base_tab->col_sep, FALSE );
+
+        *base = pstrcatstr( *base,
+            pstrrender( base_tab->col,
+                GEN_WILD_PREFIX "state-number", int_to_str( j ), TRUE,
+                GEN_WILD_PREFIX "base", int_to_str( bases[ j ] ), TRUE,
+                (char*)NULL ), TRUE );
+
+        range_add( &ranges[ 0 ], bases[ j ] );
+    }
+
+    /* Check and next vectors; Unused slots belong to no state */
+    for( i = 0; i < size || !i; i++ )
+    {
+        if( i )
+        {
+            *check = pstrcatstr( *check, check_tab->col_sep, FALSE );
+            *next = pstrcatstr( *next, next_tab->col_sep, FALSE );
+        }
+
+        col = i < size && states[ i ] >= 0 ? cols[ i ] : (TABCOL*)NULL;
+
+        *check = pstrcatstr( *check,
+            pstrrender( check_tab->col,
+                GEN_WILD_PREFIX "state-number",
+                    int_to_str( col ? states[ i ] : -1 ), TRUE,
+                (char*)NULL ), TRUE );
+
+        *next = pstrcatstr( *next,
+            pstrrender( next_tab->col,
+                GEN_WILD_PREFIX "action",
+                    int_to_str( col ? col->action : 0 ), TRUE,
+                GEN_WILD_PREFIX "index",
+                    int_to_str( col ? col->index : 0 ), TRUE,
+                (char*)NULL ), TRUE );
+
+        if( col )
+        {
+            range_add( &ranges[ 1 ], states[ i ] );
+            range_add( &ranges[ 2 ], col->action );
+            range_add( &ranges[ 2 ], col->index );
+        }
+        else
+            range_add( &ranges[ 1 ], -1 );
+    }
+
+    pfree( bases );
+    pfree( states );
+    pfree( cols );
+
+    return size ? size : 1;
+}
+
 /** Loads a XML-defined code generator into an adequate GENERATOR structure.
 Pointers are only set to the values mapped to the XML-structure, so no memory
 is wasted.
@@ -660,6 +946,34 @@ BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile )
     GET_XML_TAB_1D( g->dfa_char, "dfa_char" )
     GET_XML_TAB_1D( g->dfa_trans, "dfa_trans" )
 
+    /* Targets with a character map run their lexers on character classes */
+    if( xml_child( g->xml, "char_map" ) )
+    {
+        GET_XML_TAB_1D( g->char_map, "char_map" )
+        GET_XML_TAB_1D( g->char_map_idx, "char_map_idx" )
+
+        /* Targets with dense DFA rows look up the ASCII classes directly */
+        if( xml_child( g->xml, "dfa_dense" ) )
+        {
+            GET_XML_TAB_1D( g->dfa_dense, "dfa_dense" )
+        }
+    }
+    /* Dense DFA rows are indexed by character class, not by character */
+    else if( xml_child( g->xml, "dfa_dense" ) )
+        print_error( parser, ERR_TAG_REQUIRES_TAG, ERRSTYLE_WARNING,
+            genfile, "dfa_dense", "char_map" );
+
+    /* Targets with comb-vectors support compressed parse tables */
+    if( xml_child( g->xml, "act_base" ) )
+    {
+        GET_XML_TAB_1D( g->act_base, "act_base" )
+        GET_XML_TAB_1D( g->act_check, "act_check" )
+        GET_XML_TAB_1D( g->act_next, "act_next" )
+        GET_XML_TAB_1D( g->go_base, "go_base" )
+        GET_XML_TAB_1D( g->go_check, "go_check" )
+        GET_XML_TAB_1D( g->go_next, "go_next" )
+    }
+
     GET_XML_TAB_2D( g->acttab, "acttab" )
     GET_XML_TAB_2D( g->gotab, "gotab" )
     GET_XML_TAB_2D( g->dfa_idx, "dfa_idx" )
@@ -757,6 +1071,7 @@ void build_code( PARSER* parser )
     char			tlt_file			[ BUFSIZ + 1 ];
     char*			tlt_path;
     char*			option;
+    char*			tpl;
     char*			complete			= (char*)NULL;
     char*			all					= (char*)NULL;
     char*			action_table		= (char*)NULL;
@@ -764,7 +1079,14 @@ void build_code( PARSER* parser )
     char*			goto_table			= (char*)NULL;
     char*			goto_table_row		= (char*)NULL;
     char*			def_prod			= (char*)NULL;
+    char*			act_base			= (char*)NULL;
+    char*			act_check			= (char*)NULL;
+    char*			act_next			= (char*)NULL;
+    char*			go_base				= (char*)NULL;
+    char*			go_check			= (char*)NULL;
+    char*			go_next				= (char*)NULL;
     char*			char_map			= (char*)NULL;
+    char*			char_map_idx		= (char*)NULL;
     char*			char_map_sym		= (char*)NULL;
     char*			symbols				= (char*)NULL;
     char*			productions			= (char*)NULL;
@@ -775,6 +1097,8 @@ void build_code( PARSER* parser )
     char*			dfa_trans			= (char*)NULL;
     char*			dfa_accept			= (char*)NULL;
     char*			dfa_accept_row		= (char*)NULL;
+    char*			dfa_dense			= (char*)NULL;
+    char*			dense_row			= (char*)NULL;
     char*			type_def			= (char*)NULL;
     char*			actions				= (char*)NULL;
     char*			scan_actions		= (char*)NULL;
@@ -785,15 +1109,28 @@ void build_code( PARSER* parser )
 
     int				max_action			= 0;
     int				max_goto			= 0;
+    int				act_size			= 0;
+    int				go_size				= 0;
     int				max_dfa_idx			= 0;
     int				max_dfa_accept		= 0;
+    int				dense_classes		= 0;
+    int				dense_count			= 0;
+    int				dense;
+    int*			dense_st			= (int*)NULL;
     int				max_symbol_name		= 0;
     int				column;
     int				charmap_count		= 0;
+    int				charmap_blocks		= 0;
+    int*			blocks				= (int*)NULL;
+    int				block[ 256 ];
+    int				j;
     int				row;
     pregex_dfa*		dfa;
     pregex_dfa_st*	dfa_st;
     pregex_dfa_tr*	dfa_ent;
+    parray*			dfa_ranges;
+    DFARANGE*		rng;
+    plist*			dense_rows			= (plist*)NULL;
     SYMBOL*			sym;
     STATE*			st;
     TABCOL*			col;
@@ -802,18 +1139,22 @@ void build_code( PARSER* parser )
     VTYPE*			vt;
     wchar_t			beg;
     wchar_t			end;
+    pccl*			ccl;
     int				i;
     BOOLEAN			is_default_code;
+    BOOLEAN			compressed;
+    TABRANGE		ranges				[ TAB_COUNT ];
     plistel*		e;
     plistel*		f;
-    LIST*			l;
-    LIST*			m;
+    pregex_dfa**	l;
+    VTYPE**			vtp;
 
     PROC( "build_code" );
     PARMS( "parser", "%p", parser );
 
     gen = &generator;
     memset( gen, 0, sizeof( GENERATOR ) );
+    memset( ranges, 0, sizeof( ranges ) );
 
     sprintf( tlt_file, "%s%s", parser->p_template, UNICC_TLT_EXTENSION );
     pstrlwr( tlt_file );
@@ -841,6 +1182,14 @@ void build_code( PARSER* parser )
     if( !load_generator( parser, gen, tlt_path ) )
         VOIDRET;
 
+    /* Compressed tables are only generated for targets supporting them */
+    if( ( compressed = parser->p_compressed ) && !gen->act_base.col )
+    {
+        print_error( parser, ERR_DIRECTIVE_UNSUPPORTED, ERRSTYLE_WARNING,
+            "compressed tables", tlt_path );
+        compressed = FALSE;
+    }
+
     /* Now that we have the generator, do some code generation-related
         integrity preparatories on the grammar */
 
@@ -863,7 +1212,7 @@ void build_code( PARSER* parser )
 
     /* Create piece of code for the value at the top of the value stack
         (e.g. used to store the next terminal character onto the value stack) */
-    if( list_count( parser->vtypes ) <= 1 )
+    if( parray_count( parser->vtypes ) <= 1 )
         top_value = pstrrender( gen->action_single,
             GEN_WILD_PREFIX "offset", int_to_str( 0 ), TRUE,
                 (char*)NULL );
@@ -882,7 +1231,7 @@ void build_code( PARSER* parser )
 
     /* Create piece of code for the value that is associated with the
      * 	goal symbol, to e.g. return it from the parser function */
-    if( list_count( parser->vtypes ) <= 1 )
+    if( parray_count( parser->vtypes ) <= 1 )
         goal_value = pstrrender( gen->action_single,
             GEN_WILD_PREFIX "offset", int_to_str( 0 ), TRUE,
                 (char*)NULL );
@@ -902,94 +1251,111 @@ void build_code( PARSER* parser )
     i = 0;
     parray_for( parser->states, st )
     {
-        /* Action table */
-        action_table_row = pstrrender( gen->acttab.row_start,
-                GEN_WILD_PREFIX "number-of-columns",
-                    int_to_str( list_count( st->actions ) ), TRUE,
-                GEN_WILD_PREFIX "state-number",
-                    int_to_str( st->state_id ), TRUE,
-                        (char*)NULL );
+        /* Uncompressed action and goto tables */
+        if( !compressed )
+        {
+            /* Action table */
+            action_table_row = pstrrender( gen->acttab.row_start,
+                    GEN_WILD_PREFIX "number-of-columns",
+                        int_to_str( parray_count( st->actions ) ), TRUE,
+                    GEN_WILD_PREFIX "state-number",
+                        int_to_str( st->state_id ), TRUE,
+                            (char*)NULL );
 
-        if( max_action < list_count( st->actions ) )
-            max_action = list_count( st->actions );
+            if( max_action < parray_count( st->actions ) )
+                max_action = parray_count( st->actions );
 
-        for( m = st->actions, column = 0; m; m = m->next, column++ )
-        {
-            col = (TABCOL*)(m->pptr);
+            range_add( &ranges[ TAB_ACTION ], parray_count( st->actions ) );
+
+            column = 0;
+            parray_for( st->actions, col )
+            {
+                range_add( &ranges[ TAB_ACTION ], col->symbol->id );
+                range_add( &ranges[ TAB_ACTION ], col->action );
+                range_add( &ranges[ TAB_ACTION ], col->index );
+
+                action_table_row = pstrcatstr( action_table_row,
+                    pstrrender( gen->acttab.col,
+                        GEN_WILD_PREFIX "symbol",
+                                int_to_str( col->symbol->id ), TRUE,
+                        GEN_WILD_PREFIX "action",
+                            int_to_str( col->action ), TRUE,
+                        GEN_WILD_PREFIX "index",
+                            int_to_str( col->index ), TRUE,
+                        GEN_WILD_PREFIX "column",
+                            int_to_str( column ), TRUE,
+                            (char*)NULL ), TRUE );
+
+                if( ++column < parray_count( st->actions ) )
+                    action_table_row = pstrcatstr( action_table_row,
+                        gen->acttab.col_sep, FALSE );
+            }
 
             action_table_row = pstrcatstr( action_table_row,
-                pstrrender( gen->acttab.col,
-                    GEN_WILD_PREFIX "symbol",
-                            int_to_str( col->symbol->id ), TRUE,
-                    GEN_WILD_PREFIX "action", int_to_str( col->action ), TRUE,
-                    GEN_WILD_PREFIX "index", int_to_str( col->index ), TRUE,
-                    GEN_WILD_PREFIX "column", int_to_str( column ), TRUE,
-                        (char*)NULL ), TRUE );
+                    pstrrender( gen->acttab.row_end,
+                        GEN_WILD_PREFIX "number-of-columns",
+                            int_to_str( parray_count( st->actions ) ), TRUE,
+                        GEN_WILD_PREFIX "state-number",
+                            int_to_str( st->state_id ), TRUE,
+                                (char*)NULL ), TRUE );
 
-            if( m->next )
+            if( parray_next( parser->states, st ) )
                 action_table_row = pstrcatstr( action_table_row,
-                    gen->acttab.col_sep, FALSE );
-        }
+                    gen->acttab.row_sep, FALSE );
 
-        action_table_row = pstrcatstr( action_table_row,
-                pstrrender( gen->acttab.row_end,
+            action_table = pstrcatstr( action_table, action_table_row, TRUE );
+
+            /* Goto table */
+            goto_table_row = pstrrender( gen->gotab.row_start,
                     GEN_WILD_PREFIX "number-of-columns",
-                        int_to_str( list_count( st->actions ) ), TRUE,
+                        int_to_str( parray_count( st->gotos ) ), TRUE,
                     GEN_WILD_PREFIX "state-number",
                         int_to_str( st->state_id ), TRUE,
-                            (char*)NULL ), TRUE );
+                            (char*)NULL );
 
-        if( parray_next( parser->states, st ) )
-            action_table_row = pstrcatstr( action_table_row,
-                gen->acttab.row_sep, FALSE );
+            if( max_goto < parray_count( st->gotos ) )
+                max_goto = parray_count( st->gotos );
 
-        action_table = pstrcatstr( action_table, action_table_row, TRUE );
+            range_add( &ranges[ TAB_GOTO ], parray_count( st->gotos ) );
 
-        /* Goto table */
-        goto_table_row = pstrrender( gen->gotab.row_start,
-                GEN_WILD_PREFIX "number-of-columns",
-                    int_to_str( list_count( st->gotos ) ), TRUE,
-                GEN_WILD_PREFIX "state-number",
-                    int_to_str( st->state_id ), TRUE,
-                        (char*)NULL );
+            column = 0;
+            parray_for( st->gotos, col )
+            {
+                range_add( &ranges[ TAB_GOTO ], col->symbol->id );
+                range_add( &ranges[ TAB_GOTO ], col->action );
+                range_add( &ranges[ TAB_GOTO ], col->index );
 
-        if( max_goto < list_count( st->gotos ) )
-            max_goto = list_count( st->gotos );
+                goto_table_row = pstrcatstr( goto_table_row,
+                    pstrrender( gen->gotab.col,
+                        GEN_WILD_PREFIX "symbol",
+                            int_to_str( col->symbol->id ), TRUE,
+                        GEN_WILD_PREFIX "action",
+                            int_to_str( col->action ), TRUE,
+                        GEN_WILD_PREFIX "index",
+                            int_to_str( col->index ), TRUE,
+                        GEN_WILD_PREFIX "column",
+                            int_to_str( column ), TRUE,
+                        (char*)NULL ), TRUE );
 
-        for( m = st->gotos, column = 0; m; m = m->next, column++ )
-        {
-            col = (TABCOL*)(m->pptr);
+                if( ++column < parray_count( st->gotos ) )
+                    goto_table_row = pstrcatstr( goto_table_row,
+                        gen->gotab.col_sep, FALSE );
+            }
 
             goto_table_row = pstrcatstr( goto_table_row,
-                pstrrender( gen->gotab.col,
-                    GEN_WILD_PREFIX "symbol",
-                        int_to_str( col->symbol->id ), TRUE,
-                    GEN_WILD_PREFIX "action",
-                        int_to_str( col->action ), TRUE,
-                    GEN_WILD_PREFIX "index",
-                        int_to_str( col->index ), TRUE,
-                    GEN_WILD_PREFIX "column",
-                        int_to_str( column ), TRUE,
-                    (char*)NULL ), TRUE );
+                    pstrrender( gen->gotab.row_end,
+                        GEN_WILD_PREFIX "number-of-columns",
+                            int_to_str( parray_count( st->actions ) ), TRUE,
+                        GEN_WILD_PREFIX "state-number",
+                            int_to_str( st->state_id ), TRUE,
+                        (char*)NULL ), TRUE );
 
-            if( m->next )
+            if( parray_next( parser->states, st ) )
                 goto_table_row = pstrcatstr( goto_table_row,
-                    gen->gotab.col_sep, FALSE );
-        }
+                    gen->gotab.row_sep, FALSE );
 
-        goto_table_row = pstrcatstr( goto_table_row,
-                pstrrender( gen->gotab.row_end,
-                    GEN_WILD_PREFIX "number-of-columns",
-                        int_to_str( list_count( st->actions ) ), TRUE,
-                    GEN_WILD_PREFIX "state-number",
-                        int_to_str( st->state_id ), TRUE,
-                    (char*)NULL ), TRUE );
-
-        if( parray_next( parser->states, st ) )
-            goto_table_row = pstrcatstr( goto_table_row,
-                gen->gotab.row_sep, FALSE );
-
-        goto_table = pstrcatstr( goto_table, goto_table_row, TRUE );
+            goto_table = pstrcatstr( goto_table, goto_table_row, TRUE );
+        }
 
         /* Only in scannerless mode */
         if( parser->p_mode == MODE_SCANNERLESS )
@@ -998,12 +1364,14 @@ void build_code( PARSER* parser )
             dfa_select = pstrcatstr( dfa_select,
                 pstrrender( gen->dfa_select.col,
                     GEN_WILD_PREFIX "machine",
-                        int_to_str( list_find( parser->dfas, st->dfa ) ), TRUE,
+                        int_to_str( find_dfa( parser, st->dfa ) ), TRUE,
                             (char*)NULL ), TRUE );
 
             if( parray_next( parser->states, st ) )
                 dfa_select = pstrcatstr( dfa_select,
                                 gen->dfa_select.col_sep, FALSE );
+
+            range_add( &ranges[ TAB_DFA_SELECT ], find_dfa( parser, st->dfa ) );
         }
 
         /* Default production table */
@@ -1019,14 +1387,47 @@ void build_code( PARSER* parser )
         if( parray_next( parser->states, st ) )
             def_prod = pstrcatstr( def_prod, gen->defprod.col_sep, FALSE );
 
+        range_add( &ranges[ TAB_DEF_PROD ],
+                    st->def_prod ? st->def_prod->id : -1 );
+
         i++;
     }
 
-    /* Lexical recognition machine table composition */
+    if( compressed )
+    {
+        MSG( "Compressed action and goto tables" );
+
+        act_size = build_comb( parser, gen, FALSE,
+                                &act_base, &act_check, &act_next,
+                                &ranges[ TAB_ACTION_BASE ] );
+        go_size = build_comb( parser, gen, TRUE,
+                                &go_base, &go_check, &go_next,
+                                &ranges[ TAB_GOTO_BASE ] );
+    }
+
+    /* Lexical recognition machine table composition; Targets with dense DFA
+        rows get the next states on the classes of the ASCII characters for
+        every state, where equal rows are stored once. The ranges of each
+        state are then sorted, for a binary search on any other class. */
     MSG( "Lexical recognition machine" );
-    for( l = parser->dfas, row = 0, column = 0; l; l = list_next( l ), row++ )
+
+    if( gen->dfa_dense.col )
     {
-        dfa = (pregex_dfa*)list_access( l );
+        for( i = 0; i < 128; i++ )
+            if( dense_classes <= charmap_class( &parser->charmap, i ) )
+                dense_classes = charmap_class( &parser->charmap, i ) + 1;
+
+        if( !( dense_st = (int*)pmalloc( dense_classes * sizeof( int ) ) )
+            || !( dense_rows = plist_create( sizeof( int ), PLIST_MOD_NONE ) ) )
+            OUTOFMEM;
+    }
+
+    dfa_ranges = parray_create( sizeof( DFARANGE ), 0 );
+
+    row = column = 0;
+    parray_for( parser->dfas, l )
+    {
+        dfa = *l;
 
         /* Row start */
         dfa_idx_row = pstrrender( gen->dfa_idx.row_start,
@@ -1060,10 +1461,106 @@ void build_code( PARSER* parser )
                         gen->dfa_trans.col_sep, FALSE );
             }
 
+            /* Collect the ranges of all transitions */
+            MSG( "Iterating to transitions of DFA" );
+            parray_erase( dfa_ranges );
+
+            plist_for( dfa_st->trans, f )
+            {
+                dfa_ent = (pregex_dfa_tr*)plist_access( f );
+
+                /* The lexers are constructed on character classes; Targets
+                    without character map get the characters of the classes */
+                if( gen->char_map.col )
+                    ccl = dfa_ent->ccl;
+                else
+                    ccl = charmap_to_chars( &parser->charmap, dfa_ent->ccl );
+
+                for( i = 0; pccl_get( &beg, &end, ccl, i ); i++ )
+                {
+                    if( !( rng = (DFARANGE*)parray_malloc( dfa_ranges ) ) )
+                        OUTOFMEM;
+
+                    rng->from = beg;
+                    rng->to = end;
+                    rng->go_to = dfa_ent->go_to;
+                }
+
+                if( ccl != dfa_ent->ccl )
+                    pccl_free( ccl );
+            }
+
+            /* Dense row on the ASCII classes for hot states, which are the
+                start state and states looping on themselves */
+            dense = -1;
+
+            if( gen->dfa_dense.col )
+            {
+                qsort( parray_first( dfa_ranges ), parray_count( dfa_ranges ),
+                        sizeof( DFARANGE ), sort_dfa_ranges );
+
+                parray_for( dfa_ranges, rng )
+                    if( rng->go_to == plist_offset( e ) )
+                        break;
+            }
+
+            if( gen->dfa_dense.col
+                && ( e == plist_first( dfa->states ) || rng ) )
+            {
+                for( i = 0; i < dense_classes; i++ )
+                    dense_st[ i ] = -1;
+
+                /* The ranges hold classes, as dense rows need a char_map */
+                parray_for( dfa_ranges, rng )
+                    for( j = rng->from; j <= rng->to && j < dense_classes; j++ )
+                        dense_st[ j ] = rng->go_to;
+
+                for( i = 0; i < dense_classes; i++ )
+                {
+                    if( i )
+                        dense_row = pstrcatstr( dense_row,
+                                        gen->dfa_dense.col_sep, FALSE );
+
+                    dense_row = pstrcatstr( dense_row,
+                        pstrrender( gen->dfa_dense.col,
+                            GEN_WILD_PREFIX "goto",
+                                int_to_str( dense_st[ i ] ), TRUE,
+                            (char*)NULL ), TRUE );
+
+                    range_add( &ranges[ TAB_DFA_DENSE ], dense_st[ i ] );
+                }
+
+                if( ( f = plist_get_by_key( dense_rows, dense_row ) ) )
+                    dense = *( (int*)plist_access( f ) );
+                else
+                {
+                    dense = dense_count++ * dense_classes;
+
+                    if( dfa_dense )
+                        dfa_dense = pstrcatstr( dfa_dense,
+                                        gen->dfa_dense.col_sep, FALSE );
+
+                    dfa_dense = pstrcatstr( dfa_dense, dense_row, FALSE );
+
+                    if( !plist_insert( dense_rows, (plistel*)NULL,
+                                        dense_row, &dense ) )
+                        OUTOFMEM;
+                }
+
+                dense_row = pfree( dense_row );
+            }
+
+            if( gen->dfa_dense.col )
+                range_add( &ranges[ TAB_DFA_INDEX ], dense );
+
             dfa_idx_row = pstrcatstr( dfa_idx_row,
                 pstrrender( gen->dfa_idx.col,
                     GEN_WILD_PREFIX "index",
                         int_to_str( column ), TRUE,
+                    GEN_WILD_PREFIX "ranges",
+                        int_to_str( parray_count( dfa_ranges ) ), TRUE,
+                    GEN_WILD_PREFIX "dense",
+                        int_to_str( dense ), TRUE,
                     (char*)NULL ), TRUE );
 
             dfa_accept_row = pstrcatstr( dfa_accept_row,
@@ -1072,38 +1569,39 @@ void build_code( PARSER* parser )
                         int_to_str( dfa_st->accept ), TRUE,
                     (char*)NULL ), TRUE );
 
-            /* Iterate trough all transitions */
-            MSG( "Iterating to transitions of DFA" );
-            plist_for( dfa_st->trans, f )
+            range_add( &ranges[ TAB_DFA_INDEX ], column );
+            range_add( &ranges[ TAB_DFA_INDEX ], parray_count( dfa_ranges ) );
+            range_add( &ranges[ TAB_DFA_ACCEPT ], dfa_st->accept );
+
+            /* Transitions */
+            parray_for( dfa_ranges, rng )
             {
-                dfa_ent = (pregex_dfa_tr*)plist_access( f );
+                dfa_char = pstrcatstr( dfa_char,
+                            pstrrender( gen->dfa_char.col,
+                            GEN_WILD_PREFIX "from",
+                                int_to_str( rng->from ), TRUE,
+                            GEN_WILD_PREFIX "to",
+                                int_to_str( rng->to ), TRUE,
+                            GEN_WILD_PREFIX "goto",
+                                int_to_str( dfa_st->accept ), TRUE,
+                            (char*)NULL ), TRUE );
 
-                for( i = 0; pccl_get( &beg, &end, dfa_ent->ccl, i ); i++ )
-                {
-                    dfa_char = pstrcatstr( dfa_char,
-                                pstrrender( gen->dfa_char.col,
-                                GEN_WILD_PREFIX "from",
-                                    int_to_str( beg ), TRUE,
-                                GEN_WILD_PREFIX "to",
-                                    int_to_str( end ), TRUE,
+                dfa_trans = pstrcatstr( dfa_trans,
+                            pstrrender( gen->dfa_trans.col,
                                 GEN_WILD_PREFIX "goto",
-                                    int_to_str( dfa_st->accept ), TRUE,
-                                (char*)NULL ), TRUE );
-
-                    dfa_trans = pstrcatstr( dfa_trans,
-                                pstrrender( gen->dfa_trans.col,
-                                    GEN_WILD_PREFIX "goto",
-                                    int_to_str( dfa_ent->go_to ), TRUE,
-                                (char*)NULL ), TRUE );
+                                int_to_str( rng->go_to ), TRUE,
+                            (char*)NULL ), TRUE );
 
+                range_add( &ranges[ TAB_DFA_CHAR ], rng->from );
+                range_add( &ranges[ TAB_DFA_CHAR ], rng->to );
+                range_add( &ranges[ TAB_DFA_TRANS ], rng->go_to );
 
-                    dfa_char = pstrcatstr( dfa_char,
-                                    gen->dfa_char.col_sep, FALSE );
-                    dfa_trans = pstrcatstr( dfa_trans,
-                                    gen->dfa_trans.col_sep, FALSE );
+                dfa_char = pstrcatstr( dfa_char,
+                                gen->dfa_char.col_sep, FALSE );
+                dfa_trans = pstrcatstr( dfa_trans,
+                                gen->dfa_trans.col_sep, FALSE );
 
-                    column++;
-                }
+                column++;
             }
 
             /* DFA transition end marker */
@@ -1122,6 +1620,9 @@ void build_code( PARSER* parser )
                             int_to_str( -1 ),
                     TRUE, (char*)NULL ), TRUE );
 
+            range_add( &ranges[ TAB_DFA_CHAR ], -1 );
+            range_add( &ranges[ TAB_DFA_TRANS ], -1 );
+
             column++;
 
             if( plist_next( e ) )
@@ -1149,7 +1650,7 @@ void build_code( PARSER* parser )
                     GEN_WILD_PREFIX "row", int_to_str( row ), TRUE,
                     (char*)NULL ), TRUE );
 
-        if( list_next( l ) )
+        if( ++row < parray_count( parser->dfas ) )
         {
             dfa_idx_row = pstrcatstr( dfa_idx_row,
                 gen->dfa_idx.row_sep, FALSE );
@@ -1161,6 +1662,68 @@ void build_code( PARSER* parser )
         dfa_accept = pstrcatstr( dfa_accept, dfa_accept_row, TRUE );
     }
 
+    parray_free( dfa_ranges );
+    plist_free( dense_rows );
+    pfree( dense_st );
+
+    /* Character map, as two-level table; The classes of the characters are
+        stored in blocks of 256 characters, where equal blocks are stored
+        once, and the index holds the offset of the block of each character
+        by its upper bits. */
+    if( gen->char_map.col )
+    {
+        MSG( "Character map" );
+
+        for( row = 0; row <= parser->p_universe >> 8; row++ )
+        {
+            for( i = 0; i < 256; i++ )
+                block[ i ] = charmap_class( &parser->charmap,
+                                ( row << 8 ) + i );
+
+            for( j = 0; j < charmap_blocks; j++ )
+                if( !memcmp( blocks + j * 256, block, sizeof( block ) ) )
+                    break;
+
+            if( j == charmap_blocks )
+            {
+                if( !( blocks = (int*)prealloc( blocks,
+                                ++charmap_blocks * sizeof( block ) ) ) )
+                    OUTOFMEM;
+
+                memcpy( blocks + j * 256, block, sizeof( block ) );
+
+                for( i = 0; i < 256; i++ )
+                {
+                    if( charmap_count++ )
+                        char_map = pstrcatstr( char_map,
+                                    gen->char_map.col_sep, FALSE );
+
+                    char_map = pstrcatstr( char_map,
+                        pstrrender( gen->char_map.col,
+                            GEN_WILD_PREFIX "class",
+                                int_to_str( block[ i ] ), TRUE,
+                            (char*)NULL ), TRUE );
+
+                    range_add( &ranges[ TAB_CHAR_MAP ], block[ i ] );
+                }
+            }
+
+            if( row )
+                char_map_idx = pstrcatstr( char_map_idx,
+                                    gen->char_map_idx.col_sep, FALSE );
+
+            char_map_idx = pstrcatstr( char_map_idx,
+                pstrrender( gen->char_map_idx.col,
+                    GEN_WILD_PREFIX "index",
+                        int_to_str( j * 256 ), TRUE,
+                    (char*)NULL ), TRUE );
+
+            range_add( &ranges[ TAB_CHAR_MAP_INDEX ], j * 256 );
+        }
+
+        pfree( blocks );
+    }
+
     MSG( "Construct symbol information table" );
 
     /* Whitespace identification table and symbol-information-table */
@@ -1201,9 +1764,9 @@ void build_code( PARSER* parser )
     }
 
     /* Type definition union */
-    if( list_count( parser->vtypes ) == 1 )
+    if( parray_count( parser->vtypes ) == 1 )
     {
-        vt = (VTYPE*)( parser->vtypes->pptr );
+        vt = *( (VTYPE**)parray_first( parser->vtypes ) );
         type_def = pstrrender( gen->vstack_single,
                 GEN_WILD_PREFIX "value-type", vt->real_def, FALSE,
                     (char*)NULL );
@@ -1212,12 +1775,12 @@ void build_code( PARSER* parser )
     {
         type_def = pstrrender( gen->vstack_union_start,
                 GEN_WILD_PREFIX "number-of-value-types",
-                    int_to_str( list_count( parser->vtypes ) ),
+                    int_to_str( parray_count( parser->vtypes ) ),
                         TRUE, (char*)NULL );
 
-        for( l = parser->vtypes; l; l = l->next )
+        parray_for( parser->vtypes, vtp )
         {
-            vt = (VTYPE*)(l->pptr);
+            vt = *vtp;
 
             type_def = pstrcatstr( type_def,
                 pstrrender( gen->vstack_union_def,
@@ -1235,7 +1798,7 @@ void build_code( PARSER* parser )
         type_def = pstrcatstr( type_def,
                     pstrrender( gen->vstack_union_end,
                         GEN_WILD_PREFIX "number-of-value-types",
-                            int_to_str( list_count( parser->vtypes ) ),
+                            int_to_str( parray_count( parser->vtypes ) ),
                                 TRUE, (char*)NULL ), TRUE );
     }
 
@@ -1391,10 +1954,17 @@ void build_code( PARSER* parser )
                         (char*)NULL );
         }
 
+        /* Value ranges and integer types of the tables */
+        if( !( tpl = pstrdup( xml_txt( file ) ) ) )
+            OUTOFMEM;
+
+        for( i = 0; i < TAB_COUNT; i++ )
+            tpl = build_range( gen, tpl, i, &ranges[ i ] );
+
         /* Assembling all together - Warning, this is
             ONE single function call! */
 
-        all = pstrrender( xml_txt( file ),
+        all = pstrrender( tpl,
 
             /* Lengths of names and Prologue/Epilogue codes */
             GEN_WILD_PREFIX "prologue" LEN_EXT,
@@ -1417,7 +1987,7 @@ void build_code( PARSER* parser )
             GEN_WILD_PREFIX "number-of-productions",
                 int_to_str( plist_count( parser->productions ) ), TRUE,
             GEN_WILD_PREFIX "number-of-dfa-machines",
-                int_to_str( list_count( parser->dfas ) ), TRUE,
+                int_to_str( parray_count( parser->dfas ) ), TRUE,
             GEN_WILD_PREFIX "deepest-action-row",
                 int_to_str( max_action ), TRUE,
             GEN_WILD_PREFIX "deepest-goto-row",
@@ -1428,12 +1998,34 @@ void build_code( PARSER* parser )
                 int_to_str( max_dfa_accept ), TRUE,
             GEN_WILD_PREFIX "size-of-dfa-characters",
                 int_to_str( column ), TRUE,
+            GEN_WILD_PREFIX "number-of-dense-classes",
+                int_to_str( dense_classes ), TRUE,
+            GEN_WILD_PREFIX "size-of-dfa-dense",
+                int_to_str( dense_count ? dense_count * dense_classes : 1 ),
+                    TRUE,
+            GEN_WILD_PREFIX "number-of-character-map-index",
+                int_to_str( ( parser->p_universe >> 8 ) + 1 ), TRUE,
             GEN_WILD_PREFIX "number-of-character-map",
                 int_to_str( charmap_count ), TRUE,
+            GEN_WILD_PREFIX "number-of-character-classes",
+                int_to_str( parser->charmap.count ), TRUE,
             GEN_WILD_PREFIX "action-table", action_table, FALSE,
             GEN_WILD_PREFIX "goto-table", goto_table, FALSE,
             GEN_WILD_PREFIX "default-productions", def_prod, FALSE,
+            GEN_WILD_PREFIX "compressed-tables",
+                int_to_str( compressed ), TRUE,
+            GEN_WILD_PREFIX "size-of-action-vector",
+                int_to_str( act_size ), TRUE,
+            GEN_WILD_PREFIX "size-of-goto-vector",
+                int_to_str( go_size ), TRUE,
+            GEN_WILD_PREFIX "action-base", act_base, FALSE,
+            GEN_WILD_PREFIX "action-check", act_check, FALSE,
+            GEN_WILD_PREFIX "action-next", act_next, FALSE,
+            GEN_WILD_PREFIX "goto-base", go_base, FALSE,
+            GEN_WILD_PREFIX "goto-check", go_check, FALSE,
+            GEN_WILD_PREFIX "goto-next", go_next, FALSE,
             GEN_WILD_PREFIX "character-map-symbols", char_map_sym, FALSE,
+            GEN_WILD_PREFIX "character-map-index", char_map_idx, FALSE,
             GEN_WILD_PREFIX "character-map", char_map, FALSE,
             GEN_WILD_PREFIX "character-universe",
                 int_to_str( parser->p_universe ), TRUE,
@@ -1446,6 +2038,7 @@ void build_code( PARSER* parser )
             GEN_WILD_PREFIX "dfa-char", dfa_char, FALSE,
             GEN_WILD_PREFIX "dfa-trans", dfa_trans, FALSE,
             GEN_WILD_PREFIX "dfa-accept", dfa_accept, FALSE,
+            GEN_WILD_PREFIX "dfa-dense", dfa_dense, FALSE,
             GEN_WILD_PREFIX "value-type-definition", type_def, FALSE,
             GEN_WILD_PREFIX "actions", actions, FALSE,
             GEN_WILD_PREFIX "scan_actions", scan_actions, FALSE,
@@ -1470,6 +2063,8 @@ void build_code( PARSER* parser )
             (char*)NULL
         );
 
+        pfree( tpl );
+
         /* Replace all top-level options */
         plist_for( parser->options, e )
         {
@@ -1552,7 +2147,14 @@ void build_code( PARSER* parser )
     pfree( action_table );
     pfree( goto_table );
     pfree( def_prod );
+    pfree( act_base );
+    pfree( act_check );
+    pfree( act_next );
+    pfree( go_base );
+    pfree( go_check );
+    pfree( go_next );
     pfree( char_map );
+    pfree( char_map_idx );
     pfree( char_map_sym );
     pfree( symbols );
     pfree( productions );
@@ -1561,6 +2163,7 @@ void build_code( PARSER* parser )
     pfree( dfa_char );
     pfree( dfa_trans );
     pfree( dfa_accept );
+    pfree( dfa_dense );
     pfree( type_def );
     pfree( actions );
     pfree( scan_actions );
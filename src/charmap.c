@@ -0,0 +1,256 @@
+/* Character classes, partitioning the character universe into classes of
+characters that are equivalent for all lexers of a grammar. */
+
+#include "unicc.h"
+
+/* Compares two characters */
+static int sort_chars( const void* l, const void* r )
+{
+    wchar_t	lc	= *( (const wchar_t*)l );
+    wchar_t	rc	= *( (const wchar_t*)r );
+
+    return lc < rc ? -1 : ( lc > rc ? 1 : 0 );
+}
+
+/** Calls //fn// for every character-class of pattern //ptn// and its
+sub-patterns, with //arg// as second argument. */
+static void ptn_for_ccls( pregex_ptn* ptn, void (*fn)( pccl*, void* ),
+                            void* arg )
+{
+    for( ; ptn; ptn = ptn->next )
+    {
+        if( ptn->ccl )
+            (*fn)( ptn->ccl, arg );
+
+        ptn_for_ccls( ptn->child[ 0 ], fn, arg );
+        ptn_for_ccls( ptn->child[ 1 ], fn, arg );
+    }
+}
+
+/* Collects the range bounds of a character-class */
+static void collect_bounds( pccl* ccl, void* arg )
+{
+    parray*	bounds	= (parray*)arg;
+    wchar_t	beg;
+    wchar_t	end;
+    int		i;
+
+    for( i = 0; pccl_get( &beg, &end, ccl, i ); i++ )
+    {
+        parray_push( bounds, &beg );
+
+        end++;
+        parray_push( bounds, &end );
+    }
+}
+
+/** Returns the range of character map //map// that contains character //ch//,
+or -1 if //ch// is not within the map. */
+static int charmap_range( CHARMAP* map, wchar_t ch )
+{
+    int		lo		= 0;
+    int		hi;
+    int		mid;
+
+    if( !map->ranges || ch < map->bounds[ 0 ] || ch > map->universe )
+        return -1;
+
+    hi = map->ranges - 1;
+
+    while( lo < hi )
+    {
+        mid = ( lo + hi + 1 ) / 2;
+
+        if( map->bounds[ mid ] <= ch )
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return lo;
+}
+
+/* Splits the character classes of the map by a character-class */
+static void split_classes( pccl* ccl, void* arg )
+{
+    CHARMAP*	map		= (CHARMAP*)arg;
+    char*		in;
+    int*		remap;
+    int			count	= 0;
+    int			r;
+    int			i;
+    wchar_t		beg;
+    wchar_t		end;
+
+    if( !( in = (char*)pmalloc( map->ranges * sizeof( char ) ) )
+        || !( remap = (int*)pmalloc( map->count * 2 * sizeof( int ) ) ) )
+    {
+        OUTOFMEM;
+        return;
+    }
+
+    memset( in, 0, map->ranges * sizeof( char ) );
+
+    for( i = 0; pccl_get( &beg, &end, ccl, i ); i++ )
+        for( r = charmap_range( map, beg );
+                r >= 0 && r < map->ranges && map->bounds[ r ] <= end; r++ )
+            in[ r ] = 1;
+
+    /* Every class is split into the ranges inside and outside of ccl; The
+        classes are re-numbered in the order of their first range. */
+    for( i = 0; i < map->count * 2; i++ )
+        remap[ i ] = -1;
+
+    for( r = 0; r < map->ranges; r++ )
+    {
+        i = map->classes[ r ] * 2 + in[ r ];
+
+        if( remap[ i ] < 0 )
+            remap[ i ] = count++;
+
+        map->classes[ r ] = remap[ i ];
+    }
+
+    map->count = count;
+
+    pfree( in );
+    pfree( remap );
+}
+
+/** Computes the character classes of all terminals of //parser// with a
+pattern. Two characters are within the same class if every character-class
+used by the patterns contains either both or none of them, so the lexers can
+be constructed on the classes instead of the characters.
+
+The ranges of the map are the intervals between the sorted bounds of all
+character-classes. The classes are then refined by every character-class, and
+numbered in the order of their first range.
+
+//parser// is the pointer to parser information structure. */
+void build_charmap( PARSER* parser )
+{
+    CHARMAP*	map		= &parser->charmap;
+    parray*		bounds;
+    plistel*	e;
+    SYMBOL*		sym;
+    wchar_t*	ch;
+    wchar_t		zero	= 0;
+
+    PROC( "build_charmap" );
+    PARMS( "parser", "%p", parser );
+
+    free_charmap( map );
+    map->universe = parser->p_universe;
+
+    bounds = parray_create( sizeof( wchar_t ), 0 );
+    parray_push( bounds, &zero );
+
+    plist_for( parser->symbols, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+        ptn_for_ccls( sym->ptn, collect_bounds, (void*)bounds );
+    }
+
+    qsort( parray_first( bounds ), parray_count( bounds ), sizeof( wchar_t ),
+            sort_chars );
+
+    if( !( map->bounds = (wchar_t*)pmalloc(
+                            parray_count( bounds ) * sizeof( wchar_t ) ) )
+        || !( map->classes = (int*)pmalloc(
+                            parray_count( bounds ) * sizeof( int ) ) ) )
+    {
+        OUTOFMEM;
+        VOIDRET;
+    }
+
+    parray_for( bounds, ch )
+    {
+        if( *ch > map->universe
+                || ( map->ranges && map->bounds[ map->ranges - 1 ] == *ch ) )
+            continue;
+
+        map->classes[ map->ranges ] = 0;
+        map->bounds[ map->ranges++ ] = *ch;
+    }
+
+    parray_free( bounds );
+
+    map->count = 1;
+
+    plist_for( parser->symbols, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+        ptn_for_ccls( sym->ptn, split_classes, (void*)map );
+    }
+
+    VARS( "map->ranges", "%d", map->ranges );
+    VARS( "map->count", "%d", map->count );
+    VOIDRET;
+}
+
+/** Frees the ranges of character map //map//, which is empty afterwards. */
+void free_charmap( CHARMAP* map )
+{
+    pfree( map->bounds );
+    pfree( map->classes );
+
+    memset( map, 0, sizeof( CHARMAP ) );
+}
+
+/** Returns the character class of character //ch// in map //map//, or
+map->count if //ch// is outside the character universe. */
+int charmap_class( CHARMAP* map, wchar_t ch )
+{
+    int		r;
+
+    if( ( r = charmap_range( map, ch ) ) < 0 )
+        return map->count;
+
+    return map->classes[ r ];
+}
+
+/** Converts the character-class //ccl// into the character-class of the
+classes of character map //map// it consists of. //ccl// must be a union of
+character classes of the map, which is the case for all character-classes used
+by the patterns the map was built from.
+
+Returns a newly allocated character-class. */
+pccl* charmap_to_classes( CHARMAP* map, pccl* ccl )
+{
+    pccl*	cls;
+    int		r;
+    int		i;
+    wchar_t	beg;
+    wchar_t	end;
+
+    cls = pccl_create( -1, -1, (char*)NULL );
+
+    for( i = 0; pccl_get( &beg, &end, ccl, i ); i++ )
+        for( r = charmap_range( map, beg );
+                r >= 0 && r < map->ranges && map->bounds[ r ] <= end; r++ )
+            if( !pccl_add( cls, map->classes[ r ] ) )
+                OUTOFMEM;
+
+    return cls;
+}
+
+/** Converts the character-class //cls// of classes of character map //map//
+back into the characters of these classes.
+
+Returns a newly allocated character-class. */
+pccl* charmap_to_chars( CHARMAP* map, pccl* cls )
+{
+    pccl*	ccl;
+    int		r;
+
+    ccl = pccl_create( -1, -1, (char*)NULL );
+
+    for( r = 0; r < map->ranges; r++ )
+        if( pccl_test( cls, map->classes[ r ] )
+            && !pccl_addrange( ccl, map->bounds[ r ],
+                    r + 1 < map->ranges ? map->bounds[ r + 1 ] - 1
+                                        : map->universe ) )
+            OUTOFMEM;
+
+    return ccl;
+}
@@ -4,6 +4,32 @@
 
 extern	BOOLEAN		first_progress;
 
+/* Materializes the bitset //set// of symbol ids as a list of symbol pointers,
+ordered by symbol id. The returned list must be freed by the caller. */
+static plist* symbol_set( PARSER* parser, BITSET* set )
+{
+    plist*		lst;
+    plistel*	e;
+    int			id;
+
+    lst = plist_create( 0, PLIST_MOD_PTR );
+    e = plist_first( parser->symbols );
+
+    /* Symbols are listed in order of their ids */
+    BITSETFOR( set, id )
+    {
+        while( e && ( (SYMBOL*)plist_access( e ) )->id < id )
+            e = plist_next( e );
+
+        if( !e )
+            break;
+
+        plist_push( lst, plist_access( e ) );
+    }
+
+    return lst;
+}
+
 /** Prints a single symbol.
 
 //stream// is the stream where to dump the grammar to. If this is
@@ -38,6 +64,7 @@ void dump_grammar( FILE* stream, PARSER* parser )
 {
     plistel*	e;
     plistel*	f;
+    plist*		first;
 
     SYMBOL*		s		= (SYMBOL*)NULL;
     SYMBOL*		sym		= (SYMBOL*)NULL;
@@ -64,7 +91,9 @@ void dump_grammar( FILE* stream, PARSER* parser )
             /* Printing the FIRST-set */
             fprintf( stream, "[ " );
 
-            plist_for( s->first, f )
+            first = symbol_set( parser, &s->first );
+
+            plist_for( first, f )
             {
                 sym = (SYMBOL*)plist_access( f );
 
@@ -72,6 +101,8 @@ void dump_grammar( FILE* stream, PARSER* parser )
                 fprintf( stream, " " );
             }
 
+            plist_free( first );
+
             if( s->type == SYM_NON_TERMINAL )
             {
                 fprintf( stream, "] lexem:%d prec:%d assoc:%c v:%s\n", s->lexem,
@@ -183,21 +214,23 @@ void dump_symbols( FILE* stream, PARSER* parser )
 
 //stream// is the stream where to dump the grammar to. If this is (FILE*)NULL,
 output is written to stderr.
+//parser// is the parser information structure pointer.
 //title// is the title of the item set.
-//list// is the item set linked-list itself.
+//items// is the item set itself, an array of ITEM*.
 */
-void dump_item_set( FILE* stream, char* title, LIST* list )
+void dump_item_set( FILE* stream, PARSER* parser, char* title, parray* items )
 {
     ITEM*		it		= (ITEM*)NULL;
-    LIST*		i		= (LIST*)NULL;
+    ITEM**		i;
     plistel*	e;
+    plist*		lookahead;
     SYMBOL*		sym		= (SYMBOL*)NULL;
     int			cnt		= 0;
 
     if( !stream )
         stream = stderr;
 
-    if( list != (LIST*)NULL )
+    if( items && parray_count( items ) )
     {
         /* if( first_progress )
             fprintf( stream, "\n\n" ); */
@@ -205,9 +238,9 @@ void dump_item_set( FILE* stream, char* title, LIST* list )
         if( title )
             fprintf( stream, "\n%s\n", title );
 
-        for( i = list; i; i = i->next )
+        parray_for( items, i )
         {
-            it = i->pptr;
+            it = *i;
 
 
             fprintf( stream, "    (%d) %s -> ",
@@ -232,13 +265,18 @@ void dump_item_set( FILE* stream, char* title, LIST* list )
             {
                 fprintf( stream, "." );
                 fprintf( stream, "      { " );
-                plist_for( &it->lookahead, e )
+
+                lookahead = symbol_set( parser, &it->lookahead );
+
+                plist_for( lookahead, e )
                 {
                     sym = (SYMBOL*)plist_access( e );
 
                     print_symbol( stream, sym );
                     fprintf( stream, " " );
                 }
+
+                plist_free( lookahead );
                 fprintf( stream, "}" );
             }
 
@@ -273,8 +311,8 @@ void dump_lalr_states( FILE* stream, PARSER* parser )
     parray_for( parser->states, st )
     {
         fprintf( stream, "  State %d:\n", st->state_id );
-        dump_item_set( stream, "Kernel:", st->kernel );
-        dump_item_set( stream, "Epsilon:", st->epsilon );
+        dump_item_set( stream, parser, "Kernel:", st->kernel );
+        dump_item_set( stream, parser, "Epsilon:", st->epsilon );
         fprintf( stream, "\n" );
     }
 }
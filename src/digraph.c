@@ -0,0 +1,308 @@
+/* LALR(1) lookahead computation on the LR(0) automaton by the digraph method
+of DeRemer and Pennello. */
+
+#include "unicc.h"
+
+/* Nonterminal transition of the LR(0) automaton */
+typedef struct
+{
+    STATE*		from;			/* State the transition leaves */
+    SYMBOL*		sym;			/* Nonterminal symbol */
+    STATE*		to;				/* Target state, NULL on shift-reduce */
+
+    BITSET		set;			/* Read set, and later on Follow set */
+    parray*		reads;			/* Transitions this transition reads */
+    parray*		includes;		/* Transitions this transition includes */
+    int			depth;			/* Traversal depth; 0 = not visited */
+} NTTRANS;
+
+/* Digraph traversal state */
+typedef struct
+{
+    NTTRANS*	trans;			/* Nonterminal transitions */
+    int			count;			/* Number of transitions */
+    int*		first;			/* First transition index by state id */
+    parray*		stack;			/* Transition stack */
+    BOOLEAN		reads;			/* Traverse reads- or includes-relation */
+} DIGRAPH;
+
+/** Returns the state reached from //st// by a transition on //sym//, or
+(STATE*)NULL if there is no such transition or if it is a shift-reduce. */
+static STATE* goto_state( PARSER* parser, STATE* st, SYMBOL* sym )
+{
+    TABCOL*		col;
+
+    if( !( col = find_tabcol( IS_TERMINAL( sym ) ? st->actions : st->gotos,
+                                sym ) ) || col->action != SHIFT )
+        return (STATE*)NULL;
+
+    return (STATE*)parray_get( parser->states, col->index );
+}
+
+/** Finds the nonterminal transition on //sym// leaving state //st//.
+
+Returns the index of the transition, or -1 if there is none. */
+static int find_trans( DIGRAPH* dg, STATE* st, SYMBOL* sym )
+{
+    TABCOL*		col;
+
+    if( !( col = find_tabcol( st->gotos, sym ) ) )
+        return -1;
+
+    return dg->first[ st->state_id ] + parray_offset( st->gotos, col );
+}
+
+/** Finds the item of production //prod// with the dot at the end in state
+//st//, or (ITEM*)NULL if there is no such item. */
+static ITEM* find_reduction( STATE* st, PROD* prod )
+{
+    ITEM**		it;
+
+    parray_for( plist_count( prod->rhs ) ? st->kernel : st->epsilon, it )
+        if( ( *it )->prod == prod && !( *it )->next_symbol )
+            return *it;
+
+    return (ITEM*)NULL;
+}
+
+/** Adds transition //to// to the relation //rel//, creating it on demand. */
+static void relate( parray** rel, int to )
+{
+    if( !*rel )
+        *rel = parray_create( sizeof( int ), 8 );
+
+    parray_push( *rel, (void*)&to );
+}
+
+/** Traverses the reads- or includes-relation from transition //x//, uniting
+the sets of all reachable transitions into the set of //x//. Transitions of a
+strongly connected component all get the same set.
+
+//dg// is the digraph traversal state.
+//x// is the transition index. */
+static void traverse( DIGRAPH* dg, int x )
+{
+    NTTRANS*	tx		= dg->trans + x;
+    NTTRANS*	ty;
+    NTTRANS*	tz;
+    parray*		rel;
+    int*		y;
+    int			depth;
+
+    parray_push( dg->stack, (void*)&x );
+    tx->depth = depth = parray_count( dg->stack );
+
+    if( ( rel = dg->reads ? tx->reads : tx->includes ) )
+    {
+        parray_for( rel, y )
+        {
+            ty = dg->trans + *y;
+
+            if( !ty->depth )
+                traverse( dg, *y );
+
+            if( ty->depth < tx->depth )
+                tx->depth = ty->depth;
+
+            bitset_union( &tx->set, &ty->set );
+        }
+    }
+
+    if( tx->depth == depth )
+    {
+        do
+        {
+            tz = dg->trans + *( (int*)parray_pop( dg->stack ) );
+            tz->depth = INT_MAX;
+
+            if( tz != tx )
+            {
+                bitset_erase( &tz->set );
+                bitset_union( &tz->set, &tx->set );
+            }
+        }
+        while( tz != tx );
+    }
+}
+
+/** Solves the reads- or includes-relation over all transitions of //dg//. */
+static void digraph( DIGRAPH* dg, BOOLEAN reads )
+{
+    int			x;
+
+    dg->reads = reads;
+
+    for( x = 0; x < dg->count; x++ )
+        dg->trans[ x ].depth = 0;
+
+    for( x = 0; x < dg->count; x++ )
+        if( !dg->trans[ x ].depth )
+            traverse( dg, x );
+}
+
+/** Computes the LALR(1) lookaheads of all reduction items of the LR(0)
+automaton in //parser//, which must have been built without lookaheads before.
+
+The direct read sets of the nonterminal transitions are propagated over the
+reads-relation into read sets, which are propagated over the includes-relation
+into follow sets. A reduction item gets the follow sets of the transitions it
+looks back to. The goal symbol is entered by an additional pseudo transition
+from the start state, which is followed by the end_of_input symbol.
+
+//parser// is the pointer to the parser information structure. */
+void compute_lookaheads( PARSER* parser )
+{
+    DIGRAPH		dg;
+    NTTRANS*	t;
+    STATE*		st;
+    STATE*		p;
+    PROD*		prod;
+    ITEM*		it;
+    SYMBOL*		sym;
+    TABCOL*		col;
+    TABCOL*		tcol;
+    plistel*	e;
+    int			last;
+    int			x;
+    int			y;
+    int			i;
+
+    memset( &dg, 0, sizeof( DIGRAPH ) );
+
+    /* Enumerate the nonterminal transitions */
+    if( !( dg.first = (int*)pmalloc( ( parray_count( parser->states ) + 1 )
+                                        * sizeof( int ) ) ) )
+    {
+        OUTOFMEM;
+        return;
+    }
+
+    parray_for( parser->states, st )
+    {
+        dg.first[ st->state_id ] = dg.count;
+        dg.count += parray_count( st->gotos );
+    }
+
+    if( !( dg.trans = (NTTRANS*)pmalloc( ( dg.count + 1 )
+                                            * sizeof( NTTRANS ) ) ) )
+    {
+        OUTOFMEM;
+        return;
+    }
+
+    memset( dg.trans, 0, ( dg.count + 1 ) * sizeof( NTTRANS ) );
+
+    x = 0;
+    parray_for( parser->states, st )
+    {
+        parray_for( st->gotos, col )
+        {
+            t = dg.trans + x++;
+
+            t->from = st;
+            t->sym = col->symbol;
+            t->to = goto_state( parser, st, col->symbol );
+
+            if( !t->to )
+                continue;
+
+            /* Direct reads; These are the FIRST sets of the symbols
+                following the transition, as taken by the closure method */
+            parray_for( t->to->actions, tcol )
+                bitset_set( &t->set, tcol->symbol->id );
+
+            /* Reads-relation */
+            parray_for( t->to->gotos, tcol )
+            {
+                sym = tcol->symbol;
+                bitset_union( &t->set, &sym->first );
+
+                if( sym->nullable )
+                    relate( &t->reads, find_trans( &dg, t->to, sym ) );
+            }
+        }
+    }
+
+    /* The goal is entered by a pseudo transition from the start state,
+        which is followed by the end_of_input symbol */
+    t = dg.trans + dg.count;
+    t->from = (STATE*)parray_get( parser->states, 0 );
+    t->sym = parser->goal;
+    bitset_set( &t->set, parser->end_of_input->id );
+    dg.count++;
+
+    /* Includes-relation */
+    for( x = 0; x < dg.count; x++ )
+    {
+        t = dg.trans + x;
+
+        plist_for( t->sym->productions, e )
+        {
+            prod = (PROD*)plist_access( e );
+
+            if( prod->lhs != t->sym )
+                continue;
+
+            /* Find the last symbol that is not nullable */
+            for( last = -1, i = 0; i < plist_count( prod->rhs ); i++ )
+            {
+                sym = (SYMBOL*)plist_access( plist_get( prod->rhs, i ) );
+
+                if( IS_TERMINAL( sym ) || !sym->nullable )
+                    last = i;
+            }
+
+            for( p = t->from, i = 0; p && i < plist_count( prod->rhs ); i++ )
+            {
+                sym = (SYMBOL*)plist_access( plist_get( prod->rhs, i ) );
+
+                if( i >= last && !IS_TERMINAL( sym )
+                        && ( y = find_trans( &dg, p, sym ) ) >= 0 )
+                    relate( &dg.trans[ y ].includes, x );
+
+                p = goto_state( parser, p, sym );
+            }
+        }
+    }
+
+    /* Solve the relations */
+    dg.stack = parray_create( sizeof( int ), 64 );
+
+    digraph( &dg, TRUE );
+    digraph( &dg, FALSE );
+
+    parray_free( dg.stack );
+
+    /* Lookback: Reductions get the follow sets of their transitions */
+    for( x = 0; x < dg.count; x++ )
+    {
+        t = dg.trans + x;
+
+        plist_for( t->sym->productions, e )
+        {
+            prod = (PROD*)plist_access( e );
+
+            if( prod->lhs != t->sym )
+                continue;
+
+            for( p = t->from, i = 0; p && i < plist_count( prod->rhs ); i++ )
+                p = goto_state( parser, p,
+                        (SYMBOL*)plist_access( plist_get( prod->rhs, i ) ) );
+
+            if( p && ( it = find_reduction( p, prod ) ) )
+                bitset_union( &it->lookahead, &t->set );
+        }
+    }
+
+    for( x = 0; x < dg.count; x++ )
+    {
+        t = dg.trans + x;
+
+        bitset_reset( &t->set );
+        parray_free( t->reads );
+        parray_free( t->includes );
+    }
+
+    pfree( dg.trans );
+    pfree( dg.first );
+}
@@ -30,6 +30,7 @@ char* error_txt[128] =
     "Can't find tag <%s> in %s",
     "XML parse errors %s:\n\t%s",
     "In %s: tag <%s> is incomplete, and requires for %s-attribute",
+    "In %s: tag <%s> requires tag <%s>, and is ignored",
     "Duplicate escape sequence definition for \'%s\' in %s",
     "Circular definition",
     "Empty recursion",
@@ -43,7 +44,9 @@ char* error_txt[128] =
     "Left-hand side '%s' not known",
     "Terminal '%s' not known",
     "Ignoring semantic code: `#!language´ must explicitly be specified.",
-    "Multiple use of directive '#%s' ignored; It has already been defined."
+    "Multiple use of directive '#%s' ignored; It has already been defined.",
+    "Directive '#%s' ignored; It is not supported by %s",
+    "Invalid parameter \'%s\' for command-line option \'%s\'"
 };
 
 int					error_count		= 0;
@@ -179,8 +182,8 @@ void print_error( PARSER* parser, ERRORCODE err_id, int err_style, ... )
 
         if( err_style & ERRSTYLE_STATEINFO )
         {
-            dump_item_set( stderr, (char*)NULL, state->kernel );
-            dump_item_set( stderr, (char*)NULL, state->epsilon );
+            dump_item_set( stderr, parser, (char*)NULL, state->kernel );
+            dump_item_set( stderr, parser, (char*)NULL, state->epsilon );
         }
         else if( err_style & ERRSTYLE_PRODUCTION )
         {
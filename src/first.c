@@ -2,100 +2,263 @@
 
 #include "unicc.h"
 
-/** Computes the FIRST()-set for all symbols that are within the global table
-of symbols.
+/** Computes the FIRST()-set and the nullability of every suffix of the
+right-hand side of production //p//, so that the lookaheads within a LR(1)
+closure can be taken by the dot offset of an item, without seeking the
+right-hand side again.
 
-//symbols// is the list of symbols where the first computation should be done
-for.
+The suffix starting at the end of the right-hand side is empty and nullable.
 */
-void compute_first( PARSER* parser )
+static void compute_suffix_first( PROD* p )
+{
+    SYMBOL*		sym;
+    int			cnt;
+    int			i;
+
+    cnt = plist_count( p->rhs );
+
+    if( !( p->suffix_first = (BITSET*)pmalloc(
+                                ( cnt + 1 ) * sizeof( BITSET ) ) )
+        || !( p->suffix_nullable = (BOOLEAN*)pmalloc(
+                                    ( cnt + 1 ) * sizeof( BOOLEAN ) ) ) )
+    {
+        OUTOFMEM;
+        return;
+    }
+
+    bitset_init( &p->suffix_first[ cnt ] );
+    p->suffix_nullable[ cnt ] = TRUE;
+
+    for( i = cnt - 1; i >= 0; i-- )
+    {
+        sym = (SYMBOL*)plist_access( plist_get( p->rhs, i ) );
+
+        bitset_init( &p->suffix_first[ i ] );
+        bitset_union( &p->suffix_first[ i ], &sym->first );
+        p->suffix_nullable[ i ] = FALSE;
+
+        if( !IS_TERMINAL( sym ) && sym->nullable )
+        {
+            bitset_union( &p->suffix_first[ i ], &p->suffix_first[ i + 1 ] );
+            p->suffix_nullable[ i ] = p->suffix_nullable[ i + 1 ];
+        }
+    }
+}
+
+/* Strongly connected component search over the nonterminal dependencies */
+typedef struct
+{
+    int*		index;			/* Discovery index by symbol id; 0 = none */
+    int*		low;			/* Lowest reachable index by symbol id */
+    BOOLEAN*	stacked;		/* Symbol is on the stack, by symbol id */
+    parray*		stack;			/* Stack of SYMBOL* */
+    int			count;			/* Discovery counter */
+} FIRSTSCC;
+
+/** Unites the FIRST-sets of the right-hand sides of the productions of //s//
+into the FIRST-set of //s//, and determines if //s// is nullable.
+
+Returns the number of FIRST-set bits newly added, increased by one if //s//
+became nullable; 0 means that //s// was not changed. */
+static int first_of_productions( SYMBOL* s )
 {
-    plistel*	e;
     plistel*	f;
     plistel*	g;
     PROD*		p			= (PROD*)NULL;
     SYMBOL* 	sym			= (SYMBOL*)NULL;
-    SYMBOL*		s			= (SYMBOL*)NULL;
     int			nullable	= FALSE;
     int			cnt			= 0;
-    int			prev_cnt;
+
+    plist_for( s->productions, f )
+    {
+        nullable = FALSE;
+
+        p = (PROD*)plist_access( f );
+
+        if( plist_count( p->rhs ) > 0 )
+        {
+            plist_for( p->rhs, g )
+            {
+                sym = (SYMBOL*)plist_access( g );
+
+                cnt += bitset_union( &s->first, &sym->first );
+                nullable = sym->nullable;
+
+                if( !nullable )
+                    break;
+            }
+        }
+        else
+            nullable = TRUE;
+
+        if( nullable && !s->nullable )
+        {
+            s->nullable = TRUE;
+            cnt++;
+        }
+    }
+
+    return cnt;
+}
+
+/** Solves the FIRST-sets of one strongly connected component of
+nonterminals. All components the symbols depend on are already solved, so a
+component consisting of a single, not self-dependent symbol is solved in one
+pass; Otherwise, the passes are repeated until nothing changes.
+
+//parser// is the pointer to the parser information structure.
+//comp// is the array of the component's SYMBOL*.
+*/
+static void first_of_component( PARSER* parser, parray* comp )
+{
+    SYMBOL**	s;
+    plistel*	f;
+    plistel*	g;
+    BOOLEAN		cyclic		= FALSE;
+    int			cnt;
+
+    if( parray_count( comp ) > 1 )
+        cyclic = TRUE;
+    else
+    {
+        s = (SYMBOL**)parray_get( comp, 0 );
+
+        plist_for( ( *s )->productions, f )
+            plist_for( ( (PROD*)plist_access( f ) )->rhs, g )
+                if( (SYMBOL*)plist_access( g ) == *s )
+                    cyclic = TRUE;
+    }
 
     do
     {
-        prev_cnt = cnt;
         cnt = 0;
 
-        plist_for( parser->symbols, e )
+        parray_for( comp, s )
+            cnt += first_of_productions( *s );
+
+        parser->first_passes++;
+    }
+    while( cyclic && cnt );
+
+    parser->first_components++;
+}
+
+/** Visits nonterminal //s// in the strongly connected component search of
+Tarjan, following the symbols of the right-hand sides of its productions.
+Every component is solved as soon as it is complete, which is after all
+components it depends on.
+
+//parser// is the pointer to the parser information structure.
+//scc// is the search state.
+//s// is the nonterminal to be visited. */
+static void first_visit( PARSER* parser, FIRSTSCC* scc, SYMBOL* s )
+{
+    plistel*	f;
+    plistel*	g;
+    SYMBOL*		sym;
+    SYMBOL**	top;
+    parray*		comp;
+
+    scc->index[ s->id ] = scc->low[ s->id ] = ++scc->count;
+    scc->stacked[ s->id ] = TRUE;
+    parray_push( scc->stack, (void*)&s );
+
+    plist_for( s->productions, f )
+    {
+        plist_for( ( (PROD*)plist_access( f ) )->rhs, g )
         {
-            s = (SYMBOL*)plist_access( e );
+            sym = (SYMBOL*)plist_access( g );
+
+            if( IS_TERMINAL( sym ) )
+                continue;
 
-            if( s->type == SYM_NON_TERMINAL )
+            if( !scc->index[ sym->id ] )
             {
-                plist_for( s->productions, f )
-                {
-                    nullable = FALSE;
-
-                    p = (PROD*)plist_access( f );
-
-                    if( plist_count( p->rhs ) > 0 )
-                    {
-                        plist_for( p->rhs, g )
-                        {
-                            sym = (SYMBOL*)plist_access( g );
-
-                            plist_union( s->first, sym->first );
-                            nullable = sym->nullable;
-
-                            if( !nullable )
-                                break;
-                        }
-                    }
-                    else
-                        nullable = TRUE;
-
-                    s->nullable |= nullable;
-                }
-            }
+                first_visit( parser, scc, sym );
 
-            cnt += plist_count( s->first );
+                if( scc->low[ sym->id ] < scc->low[ s->id ] )
+                    scc->low[ s->id ] = scc->low[ sym->id ];
+            }
+            else if( scc->stacked[ sym->id ]
+                        && scc->index[ sym->id ] < scc->low[ s->id ] )
+                scc->low[ s->id ] = scc->index[ sym->id ];
         }
     }
-    while( prev_cnt != cnt );
-}
 
+    if( scc->low[ s->id ] != scc->index[ s->id ] )
+        return;
 
-/** Performs a right-hand side FIRST()-set seek. This is an individual
-FIRST()-set to be created within a LR(1) closure as lookahead set.
+    /* s is the root of a component; Pop and solve it */
+    comp = parray_create( sizeof( SYMBOL* ), 16 );
 
-//first// is where the individual FIRST() set is stored to.
-//rhs// is the right-hand side to be processed; This is a pointer to an
-element on the right-hand side, and is used as starting point.
+    do
+    {
+        top = (SYMBOL**)parray_pop( scc->stack );
+        scc->stacked[ ( *top )->id ] = FALSE;
+        parray_push( comp, (void*)top );
+    }
+    while( *top != s );
 
-Returns TRUE if the whole right-hand side is possibly nullable, FALSE else.
+    first_of_component( parser, comp );
+    parray_free( comp );
+}
+
+/** Computes the FIRST()-set for all symbols that are within the global table
+of symbols.
+
+The nonterminals are solved in topological order of the strongly connected
+components of their dependency graph, where a nonterminal depends on every
+nonterminal on the right-hand sides of its productions. The number of passes
+and components is recorded in //parser// for the statistics.
+
+//parser// is the pointer to the parser information structure.
 */
-int seek_rhs_first( plist* first, plistel* rhs )
+void compute_first( PARSER* parser )
 {
-    SYMBOL*		sym		= (SYMBOL*)NULL;
+    plistel*	e;
+    SYMBOL*		s			= (SYMBOL*)NULL;
+    FIRSTSCC	scc;
+    int			cnt;
 
-    for( ; rhs; rhs = plist_next( rhs ) )
+    /* Terminal symbols have always theirself in the FIRST-set... */
+    plist_for( parser->symbols, e )
     {
-        sym = (SYMBOL*)plist_access( rhs );
+        s = (SYMBOL*)plist_access( e );
 
-        if( IS_TERMINAL( sym ) )
-        {
-            if( !plist_get_by_ptr( first, sym ) )
-                plist_push( first, sym );
+        if( IS_TERMINAL( s ) )
+            bitset_set( &s->first, s->id );
+    }
 
-            break;
-        }
-        else
-        {
-            plist_union( first, sym->first );
+    cnt = plist_count( parser->symbols );
 
-            if( !( sym->nullable ) )
-                break;
-        }
+    if( !( scc.index = (int*)pmalloc( ( cnt + 1 ) * sizeof( int ) ) )
+        || !( scc.low = (int*)pmalloc( ( cnt + 1 ) * sizeof( int ) ) )
+        || !( scc.stacked = (BOOLEAN*)pmalloc(
+                                ( cnt + 1 ) * sizeof( BOOLEAN ) ) ) )
+    {
+        OUTOFMEM;
+        return;
     }
 
-    return sym->nullable;
+    memset( scc.index, 0, ( cnt + 1 ) * sizeof( int ) );
+    memset( scc.stacked, 0, ( cnt + 1 ) * sizeof( BOOLEAN ) );
+    scc.stack = parray_create( sizeof( SYMBOL* ), 64 );
+    scc.count = 0;
+
+    plist_for( parser->symbols, e )
+    {
+        s = (SYMBOL*)plist_access( e );
+
+        if( s->type == SYM_NON_TERMINAL && !scc.index[ s->id ] )
+            first_visit( parser, &scc, s );
+    }
+
+    parray_free( scc.stack );
+    pfree( scc.index );
+    pfree( scc.low );
+    pfree( scc.stacked );
+
+    /* FIRST-sets of all right-hand side suffixes */
+    plist_for( parser->productions, e )
+        compute_suffix_first( (PROD*)plist_access( e ) );
 }
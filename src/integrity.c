@@ -129,7 +129,6 @@ static BOOLEAN check_nfa_matches_parser(
     plist*			res;
     plistel*		e;
     BOOLEAN			ret				= TRUE;
-    LIST*			l;
 
     /*
         06.03.2008	Jan Max Meyer
@@ -165,9 +164,8 @@ static BOOLEAN check_nfa_matches_parser(
         idx = 0;
         st = (STATE*)parray_get( parser->states, stack[ tos ] );
 
-        for( l = st->actions; l; l = l->next )
+        parray_for( st->actions, col )
         {
-            col = (TABCOL*)l->pptr;
             if( col->symbol->type == SYM_CCL_TERMINAL )
             {
                 plist_erase( res );
@@ -229,10 +227,8 @@ static BOOLEAN check_nfa_matches_parser(
 
             st = (STATE*)parray_get( parser->states, stack[ tos - 1 ] );
 
-            for( l = st->gotos; l; l = l->next )
+            parray_for( st->gotos, col )
             {
-                col = (TABCOL*)l->pptr;
-
                 if( col->symbol == rprod->lhs )
                 {
                     act = col->action;
@@ -280,8 +276,7 @@ Returns TRUE if regex anomalies where found, FALSE otherwise. */
 BOOLEAN check_regex_anomalies( PARSER* parser )
 {
     STATE*			st;
-    LIST*			m;
-    LIST*			n;
+    ITEM**			it;
     plistel*		e;
     plistel*		f;
     PROD*			p;
@@ -324,17 +319,15 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
     parray_for( parser->states, st )
     {
         /* First of all, count all possible reduces in the current state. */
-        for( m = st->actions, cnt = 0; m; m = m->next )
+        cnt = 0;
+        parray_for( st->actions, col )
         {
-            col = (TABCOL*)m->pptr;
             if( col->action & REDUCE )
                 cnt++;
         }
 
-        for( m = st->actions; m; m = m->next )
+        parray_for( st->actions, col )
         {
-            col = (TABCOL*)m->pptr;
-
             /* Regular expression to be reduced? */
             if( col->symbol->type == SYM_REGEX_TERMINAL
                     && col->action & REDUCE )
@@ -343,9 +336,15 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                     Table columns not derived from the kernel set
                     of the state are ignored
                 */
-                if( col->derived_from && list_find( st->epsilon,
-                        col->derived_from ) >= 0 )
-                    continue;
+                if( col->derived_from )
+                {
+                    parray_for( st->epsilon, it )
+                        if( *it == col->derived_from )
+                            break;
+
+                    if( it )
+                        continue;
+                }
 
                 /*
                     Generate NFA from pattern
@@ -363,10 +362,8 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                     the existing parse tables. This will even be more
                     faster, I think.
                 */
-                for( n = st->actions; n; n = n->next )
+                parray_for( st->actions, ccol )
                 {
-                    ccol = (TABCOL*)n->pptr;
-
                     /* Character class to be shifted? */
                     if( ccol->symbol->type == SYM_CCL_TERMINAL
                             && ccol->action & SHIFT )
@@ -393,8 +390,10 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                         {
                             /*
                             printf( "state %d\n", st->state_id );
-                            dump_item_set( stderr, (char*)NULL, st->kernel );
-                            dump_item_set( stderr, (char*)NULL, st->epsilon );
+                            dump_item_set( stderr, parser, (char*)NULL,
+                                            st->kernel );
+                            dump_item_set( stderr, parser, (char*)NULL,
+                                            st->epsilon );
                             getchar();
                             */
 
@@ -444,9 +443,9 @@ BOOLEAN check_regex_anomalies( PARSER* parser )
                                                         col->symbol ),
                                                             sym->nullable );
                                                 */
-                                                if( !plist_get_by_ptr(
-                                                        sym->first,
-                                                        col->symbol )
+                                                if( !bitset_get(
+                                                        &sym->first,
+                                                        col->symbol->id )
                                                     && !sym->nullable )
                                                 {
                                                     print_error( parser,
@@ -502,7 +501,6 @@ BOOLEAN check_stupid_productions( PARSER* parser )
     SYMBOL*		sym;
     BOOLEAN		stupid		= FALSE;
     BOOLEAN		possible	= FALSE;
-    plist*		first_check	= (plist*)NULL;
 
     plist_for( parser->productions, e )
     {
@@ -545,15 +543,7 @@ BOOLEAN check_stupid_productions( PARSER* parser )
             this can't be possible */
         if( plist_count( p->rhs ) > 0 )
         {
-            if( !first_check )
-                first_check = plist_create( 0,
-                                    PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
-            else
-                plist_erase( first_check );
-
-            seek_rhs_first( first_check, plist_first( p->rhs ) );
-
-            if( plist_count( first_check ) == 0 )
+            if( bitset_count( &p->suffix_first[ 0 ] ) == 0 )
             {
                 print_error( parser, ERR_USELESS_RULE,
                     ERRSTYLE_WARNING | ERRSTYLE_PRODUCTION | ERRSTYLE_FILEINFO,
@@ -562,7 +552,6 @@ BOOLEAN check_stupid_productions( PARSER* parser )
         }
     }
 
-    plist_free( first_check );
 
     return stupid;
 }
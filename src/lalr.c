@@ -2,76 +2,185 @@
 
 #include "unicc.h"
 
+#ifdef HAVE_LIBPTHREAD
+#include <pthread.h>
+#endif
+
 #define ON_ALGORITHM_DEBUG 0
 
-/** Performs a test on two kernel item sets if they are equal.
+/* Bookkeeping of the closure algorithm during one table construction */
+typedef struct
+{
+    parray*		worklist;		/* Ids of states pending for closure */
+    ITEM**		prod_item;		/* Closure set item by production id */
+    int*		prod_stamp;		/* Closure stamp by production id */
+    parray**	sym_part;		/* Partition by next symbol id */
+    int*		sym_stamp;		/* Partition stamp by symbol id */
+    int			stamp;			/* Stamp of the current closure */
+    BOOLEAN		lr0;			/* Build LR(0) item sets only */
+    ARENA*		items;			/* Item arena */
+} CLOSURE;
+
+#ifdef HAVE_LIBPTHREAD
+/* Closure round; The states of a round are closed concurrently */
+typedef struct
+{
+    PARSER*		parser;
+    parray*		states;			/* Ids of the states to be closed */
+    parray**	partitions;		/* Closure partitions by round position */
+    CLOSURE**	closed_by;		/* Closing bookkeeping by round position */
+    size_t		next;			/* Next round position to be closed */
+    pthread_mutex_t	lock;		/* Lock on next */
+} ROUND;
+
+/* Closure worker thread */
+typedef struct
+{
+    ROUND*		round;			/* Current round */
+    CLOSURE		cl;				/* Bookkeeping of the worker */
+    ARENA		items;			/* Item arena of the worker */
+    pthread_t	thread;			/* Thread handle */
+} WORKER;
+#endif
 
-//kernel1// is the The first kernel item set.
-//kernel2// is the The second kernel item set.
+/* Compares two symbol ids of closure partitions. */
+static int sort_partition_ids( const void* l, const void* r )
+{
+    return *( (const int*)l ) - *( (const int*)r );
+}
 
-Returns a int TRUE if the item sets are equal, else FALSE. */
-static int test_same_kernel( LIST* kernel1, LIST* kernel2 )
+/* Compares two (production, dot offset) tuples of a kernel signature. */
+static int sort_kernel_tuples( const void* l, const void* r )
 {
-    int		ret			= FALSE;
-    LIST*	checklist	= (LIST*)NULL;
-    LIST*	i			= (LIST*)NULL;
-    LIST*	j			= (LIST*)NULL;
-    ITEM*	item1		= (ITEM*)NULL;
-    ITEM*	item2		= (ITEM*)NULL;
-
-    if( list_count( kernel1 ) == list_count( kernel2 ) )
-    {
-        for( i = kernel1; i; i = i->next )
-        {
-            item1 = i->pptr;
+    const int*	lt	= (const int*)l;
+    const int*	rt	= (const int*)r;
 
-            for( j = kernel2; j; j = j->next )
-            {
-                item2 = j->pptr;
+    if( lt[0] != rt[0] )
+        return lt[0] < rt[0] ? -1 : 1;
 
-                if( item1->prod == item2->prod
-                    && item1->dot_offset == item2->dot_offset
-                        && item1->next_symbol == item2->next_symbol )
-                {
-                    checklist = list_push( checklist, j->pptr );
-                }
-            }
-        }
+    return lt[1] - rt[1];
+}
+
+/** Computes the canonical signature of a kernel item set. The signature is
+the sequence of the kernel's (production, dot offset) tuples in sorted order,
+so two kernels are equal if, and only if, their signatures are equal.
 
-        if( list_count( kernel1 ) == list_count( checklist ) )
-            ret = TRUE;
+//kernel// is the kernel item set.
 
-        list_free( checklist );
+Returns a newly allocated string that must be freed by the caller. */
+static char* kernel_signature( parray* kernel )
+{
+    ITEM**	l;
+    ITEM*	it;
+    int*	tuples;
+    char*	signature;
+    char*	pos;
+    int		cnt;
+    int		i;
+
+    cnt = parray_count( kernel );
+
+    if( !( tuples = (int*)pmalloc( ( cnt + 1 ) * 2 * sizeof( int ) ) )
+        || !( signature = (char*)pmalloc(
+                ( cnt * 2 * ( ONE_LINE / 4 ) + 1 ) * sizeof( char ) ) ) )
+    {
+        OUTOFMEM;
+        return (char*)NULL;
     }
 
-    return ret;
+    i = 0;
+    parray_for( kernel, l )
+    {
+        it = *l;
+
+        tuples[ i ] = it->prod->id;
+        tuples[ i + 1 ] = it->dot_offset;
+        i += 2;
+    }
+
+    qsort( tuples, cnt, 2 * sizeof( int ), sort_kernel_tuples );
+
+    *( pos = signature ) = '\0';
+    for( i = 0; i < cnt * 2; i += 2 )
+        pos += sprintf( pos, "%d.%d;", tuples[ i ], tuples[ i + 1 ] );
+
+    pfree( tuples );
+    return signature;
+}
+
+/** Registers the kernel of state //st// in the kernel index of //parser//, so
+that it can be found by find_state() later on.
+
+//signature// is the kernel signature of //st// as computed by
+kernel_signature(). */
+static void index_state( PARSER* parser, STATE* st, char* signature )
+{
+    if( !plist_insert( parser->kernels, (plistel*)NULL,
+            signature, (void*)&st->state_id ) )
+        OUTOFMEM;
+}
+
+/** Finds an existing state by its kernel signature.
+
+//parser// is the pointer to the parser information structure.
+//signature// is the kernel signature to be searched for.
+
+Returns the matching state, or (STATE*)NULL if no state with such a kernel
+exists. */
+static STATE* find_state( PARSER* parser, char* signature )
+{
+    plistel*	e;
+
+    if( !( e = plist_get_by_key( parser->kernels, signature ) ) )
+        return (STATE*)NULL;
+
+    return (STATE*)parray_get( parser->states, *( (int*)plist_access( e ) ) );
+}
+
+/** Puts state //st// onto the //worklist// of states that need to be closed,
+unless it is already queued.
+
+//worklist// is the array of pending state ids.
+//st// is the state to be queued. */
+static void queue_state( parray* worklist, STATE* st )
+{
+    if( st->queued )
+        return;
+
+    st->queued = TRUE;
+    parray_push( worklist, (void*)&st->state_id );
 }
 
 /** This is the key function which performs the major closure from one kernel
 item seed to a closure set.
 
-//productions// is the list of all available productions.
+//parser// is the pointer to the parser information structure.
+//cl// is the closure bookkeeping; Its production stamps tell which
+productions already have an item in //closure_set//. No lookaheads are passed
+when it is set to build LR(0) item sets.
 //it// is the item to be closed.
-//closure_set// is the pointer to the closure set list which can possibly
-be enhanced.
+//closure_set// is the closure item set, which can possibly be enhanced.
+
+Returns the number of items and lookaheads added to //closure_set//; 0 means
+that //closure_set// was not changed.
 */
-static void close_item( plist* productions, ITEM* it, LIST** closure_set )
+static int close_item( PARSER* parser, CLOSURE* cl, ITEM* it,
+                            parray* closure_set )
 {
-    LIST*		l		= (LIST*)NULL;
-    plistel*	e;
     plistel*	f;
     ITEM*		cit		= (ITEM*)NULL;
     PROD*		prod	= (PROD*)NULL;
-    plist*		first	= (plist*)NULL;
+    int			cnt		= 0;
 
     /* Only perform closure if the symbol right to the dot
         of the current kernel item is a non-terminal */
+
     if( it->next_symbol )
     {
         if( it->next_symbol->type == SYM_NON_TERMINAL )
         {
             /* Find all right-hand sides of this non-terminal */
-            plist_for( productions, f )
+            plist_for( it->next_symbol->productions, f )
             {
                 prod = (PROD*)plist_access( f );
 
@@ -79,33 +188,35 @@ static void close_item( plist* productions, ITEM* it, LIST** closure_set )
                 {
                     /* Check if there is not already such an item
                         that uses this production! */
-                    for( l = *closure_set; l; l = l->next )
-                    {
-                        cit = l->pptr;
-                        if( cit->prod == prod )
-                            break;
-                    }
+                    if( cl->prod_stamp[ prod->id ] == cl->stamp )
+                        cit = cl->prod_item[ prod->id ];
+                    else
+                        cit = (ITEM*)NULL;
 
                     /* Add new item! */
-                    if( !l )
+                    if( !cit )
                     {
 #if ON_ALGORITHM_DEBUG
                         fprintf( stderr, "\n===> Closure: Creating new "
                                             "item\n");
-                        dump_item_set( (FILE*)NULL, "Partial closure:",
-                            *closure_set );
+                        dump_item_set( (FILE*)NULL, parser, "Partial closure:",
+                            closure_set );
 #endif
-                        cit = create_item( prod );
+                        cit = create_item( cl->items, prod );
 
-                        *closure_set = list_push( *closure_set, cit );
+                        parray_push( closure_set, (void*)&cit );
+                        cnt++;
+
+                        cl->prod_item[ prod->id ] = cit;
+                        cl->prod_stamp[ prod->id ] = cl->stamp;
                     }
 #if ON_ALGORITHM_DEBUG
                     else
                     {
                         fprintf( stderr, "\n===> Closure: Using existing "
                                             "item\n");
-                        dump_item_set( (FILE*)NULL, "Partial closure:",
-                            *closure_set );
+                        dump_item_set( (FILE*)NULL, parser, "Partial closure:",
+                            closure_set );
                     }
 #endif
 
@@ -118,7 +229,7 @@ static void close_item( plist* productions, ITEM* it, LIST** closure_set )
                     /* --- Passing the lookaheads ... --- */
 
                     /* If this is the last symbol... */
-                    if( plist_count( it->prod->rhs ) > 0 )
+                    if( !cl->lr0 && plist_count( it->prod->rhs ) > 0 )
                     {
 #if ON_ALGORITHM_DEBUG
                         fprintf( stderr, "\n===> Closure: dot %d, "
@@ -127,101 +238,82 @@ static void close_item( plist* productions, ITEM* it, LIST** closure_set )
                                         plist_count( it->prod->rhs ) );
 #endif
 
-                        if( !( e = plist_get( it->prod->rhs,
-                                                it->dot_offset + 1 ) ) )
-                        {
-                            plist_union( &cit->lookahead, &it->lookahead );
-#if ON_ALGORITHM_DEBUG
-                            fprintf( stderr, "\n===> Closure: Dot at the end, "
-                                                "taking lookahead \n");
-                            dump_item_set( (FILE*)NULL, "Partial closure:",
-                                *closure_set );
-#endif
-                        }
-                        else
-                        {
-                            if( !first )
-                                first = plist_create( 0,
-                                            PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
-                            else
-                                plist_erase( first );
-
-                            if( seek_rhs_first( first, e ) )
-                                plist_union( first, &it->lookahead );
+                        /* FIRST-set of the rest behind the symbol, and the
+                            item's own lookahead if the rest is nullable */
+                        cnt += bitset_union( &cit->lookahead,
+                                    &it->prod->suffix_first[
+                                        it->dot_offset + 1 ] );
 
-                            plist_union( &cit->lookahead, first );
+                        if( it->prod->suffix_nullable[ it->dot_offset + 1 ] )
+                            cnt += bitset_union( &cit->lookahead,
+                                                    &it->lookahead );
 
 #if ON_ALGORITHM_DEBUG
-                            fprintf( stderr, "\n===> Closure: "
-                                                "Calculated lookahead\n");
-                            dump_item_set( (FILE*)NULL, "Partial closure:",
-                                *closure_set );
+                        fprintf( stderr, "\n===> Closure: "
+                                            "Calculated lookahead\n");
+                        dump_item_set( (FILE*)NULL, parser, "Partial closure:",
+                            closure_set );
 #endif
-                        }
                     }
                 }
             }
         }
     }
 
-    plist_free( first );
+    return cnt;
 }
 
-/** Drops and frees a list of items.
+/** Drops and frees an item set and its items.
 
-//list// is the item list.
+//arena// is the item arena the items are given back to.
+//items// is the item set.
 
-Returns LIST*(NULL) always.
+Returns (parray*)NULL always.
 */
-static LIST* drop_item_list( LIST* list )
+static parray* drop_item_set( ARENA* arena, parray* items )
 {
-    LIST*		l;
-    ITEM*		it;
+    ITEM**		it;
 
-    for( l = list; l; l = list_next( l ) )
-    {
-        it = (ITEM*)list_access( l );
+    parray_for( items, it )
+        free_item( arena, *it );
 
-        free_item( it );
-    }
-
-    list_free( list );
-
-    return (LIST*)NULL;
+    return parray_free( items );
 }
 
-/** Performs an LR(1) closure and merges the lookahead-symbols of items with the
-same right-hand side, dot position, and lookahead-subset, making it a LALR(1)
-closure.
+/** Performs an LR(1) closure on the kernel of state //st//, and partitions
+the closure items by the symbols right to their dots. Items of epsilon
+productions are merged into the epsilon item set of //st//.
+
+The function only changes //st// and the bookkeeping //cl//, so different
+states can be closed concurrently with different bookkeepings.
 
 //parser// is the pointer to the parser information structure.
-//st// is the state to be closed. */
-static void lalr1_closure( PARSER* parser, int state_id )
+//cl// is the closure bookkeeping.
+//st// is the state to be closed.
+
+Returns an array of partitions (parray*), ordered by the symbols right to
+their dots; Each partition is an item set (ITEM*), ordered by production. */
+static parray* close_state( PARSER* parser, CLOSURE* cl, STATE* st )
 {
-    STATE*		st;
-    LIST*		closure_start;
-    LIST*		closure_set			= (LIST*)NULL;
-    LIST*		i					= (LIST*)NULL;
-    LIST*		j					= (LIST*)NULL;
-    LIST*		k					= (LIST*)NULL;
+    parray*		closure_start;
+    parray*		closure_set;
+    parray*		partitions;
+    parray*		part				= (parray*)NULL;
+    parray*		sym_ids;
+    int*		sym_id;
+    int			id;
+    ITEM**		j;
+    ITEM**		k;
     ITEM*		it					= (ITEM*)NULL;
     ITEM*		cit					= (ITEM*)NULL;
-    SYMBOL*		sym_before_move		= (SYMBOL*)NULL;
-    STATE*		nstate				= (STATE*)NULL;
+    size_t		n;
+    size_t		m;
 
-    LIST*		part_symbols		= (LIST*)NULL;
-    LIST*		partitions			= (LIST*)NULL;
-
-    int			prev_cnt			= 0;
     int			cnt					= 0;
 
-    if( !( st = parray_get( parser->states, state_id ) ) )
-    {
-        WRONGPARAM;
-        return;
-    }
-
     closure_start = st->kernel;
+    closure_set = parray_create( sizeof( ITEM* ), 64 );
+    cl->stamp++;
 
     /*
         03.03.2008	Jan Max Meyer
@@ -233,8 +325,8 @@ static void lalr1_closure( PARSER* parser, int state_id )
     fprintf( stderr, "================\n");
     fprintf( stderr, "=== State % 2d ===\n", st->state_id );
     fprintf( stderr, "================\n");
-    dump_item_set( (FILE*)NULL, "Kernel:", st->kernel );
-    dump_item_set( (FILE*)NULL, "Epsilon:", st->epsilon );
+    dump_item_set( (FILE*)NULL, parser, "Kernel:", st->kernel );
+    dump_item_set( (FILE*)NULL, parser, "Epsilon:", st->epsilon );
 #endif
 
     /*
@@ -244,38 +336,35 @@ static void lalr1_closure( PARSER* parser, int state_id )
         all following closures are done on the closure-set
         resulting from the kernel closure.
 
-        The closure is finished when no more items are added
-        to closure_set.
+        The closure is finished when neither items nor lookaheads are
+        added to closure_set anymore. Items added during a pass are
+        closed within the same pass.
     */
     do
     {
-        prev_cnt = cnt;
         cnt = 0;
 
         /* Iterating trough the kernel items */
-        for( i = closure_start; i; i = i->next )
+        for( n = 0; n < parray_count( closure_start ); n++ )
         {
-            it = i->pptr;
-            close_item( parser->productions, it, &closure_set );
+            it = *( (ITEM**)parray_get( closure_start, n ) );
+            cnt += close_item( parser, cl, it, closure_set );
         }
 
         closure_start = closure_set;
-        cnt = list_count( closure_set );
-
-        /* fprintf( stderr, "prev_cnt = %d, cnt = %d\n", prev_cnt, cnt ); */
     }
-    while( prev_cnt != cnt );
+    while( cnt );
 
-    /*dump_item_set( (FILE*)NULL, "Closure:", closure_set );*/
+    /*dump_item_set( (FILE*)NULL, parser, "Closure:", closure_set );*/
 
     /*
         Adding all kernel items with outgoing transitions
         to the closure item set now! These are all items
         where next_symbol is not (SYMBOL*)NULL...
     */
-    for( i = st->kernel; i; i = i->next )
+    parray_for( st->kernel, j )
     {
-        it = i->pptr;
+        it = *j;
 
         if( it->next_symbol != (SYMBOL*)NULL )
         {
@@ -284,15 +373,15 @@ static void lalr1_closure( PARSER* parser, int state_id )
                 The complete memory must be mirrored and re-allocated to
                 create a single, independend item!
             */
-            cit = create_item( it->prod );
+            cit = create_item( cl->items, it->prod );
 
             cit->prod = it->prod;
             cit->dot_offset = it->dot_offset;
             cit->next_symbol = it->next_symbol;
 
-            plist_concat( &cit->lookahead, &it->lookahead );
+            bitset_union( &cit->lookahead, &it->lookahead );
 
-            closure_set = list_push( closure_set, cit );
+            parray_push( closure_set, (void*)&cit );
         }
     }
 
@@ -300,123 +389,147 @@ static void lalr1_closure( PARSER* parser, int state_id )
         Moving all epsilon items (items with an epsilon production!)
         to the epsilon item set of this state!
     */
-    for( i = closure_set; i; )
+    for( n = m = 0; n < parray_count( closure_set ); n++ )
     {
-        it = i->pptr;
+        it = *( (ITEM**)parray_get( closure_set, n ) );
+
         if( !plist_count( it->prod->rhs ) )
         {
             /* For all items with the same epsilon transitions,
                 merge the lookaheads! */
-            for( j = st->epsilon; j; j = j->next )
-            {
-                cit = j->pptr;
-                if( cit->prod == it->prod )
+            parray_for( st->epsilon, k )
+                if( ( *k )->prod == it->prod )
                     break;
-            }
 
-            if( !j )
-            {
-                st->epsilon = list_push( st->epsilon, it );
-            }
+            if( !k )
+                parray_push( st->epsilon, (void*)&it );
             else
             {
-                plist_union( &cit->lookahead, &it->lookahead );
-                free_item( it );
+                bitset_union( &( *k )->lookahead, &it->lookahead );
+                free_item( cl->items, it );
             }
-
-            i = i->next;
-            closure_set = list_remove( closure_set, it );
         }
         else
-        {
-            i = i->next;
-        }
+            parray_put( closure_set, m++, (void*)&it );
     }
 
+    while( parray_count( closure_set ) > m )
+        parray_pop( closure_set );
+
 #if 0
     fprintf( stderr, "\n--- State %d ---\n", st->state_id );
-    dump_item_set( (FILE*)NULL, "Kernel:", st->kernel );
-    dump_item_set( (FILE*)NULL, "Closure:", closure_set );
-    dump_item_set( (FILE*)NULL, "Epsilon:", st->epsilon );
+    dump_item_set( (FILE*)NULL, parser, "Kernel:", st->kernel );
+    dump_item_set( (FILE*)NULL, parser, "Closure:", closure_set );
+    dump_item_set( (FILE*)NULL, parser, "Epsilon:", st->epsilon );
 #endif
 
     /*
-        Sorting the closure set by the symbols next to the dot.
+        Partitioning all items with the same symbol right to the dot
+        (all items that share the symbol where next_symbol points to...)
+        into buckets indexed by the symbol id.
     */
-    do
+    sym_ids = parray_create( sizeof( int ), 16 );
+
+    parray_for( closure_set, j )
     {
-        /* cnt will act as an "I had done something"-flag in this case! */
-        cnt = 0;
-        for( i = closure_set; i; i = i->next )
-        {
-            it = i->pptr;
-            if( i->next )
-                cit = i->next->pptr;
-            else
-                cit = (ITEM*)NULL;
+        it = *j;
+        id = it->next_symbol->id;
 
-            if( it && cit )
-            {
-                if( it->next_symbol && cit->next_symbol )
-                {
-                    if( it->next_symbol > cit->next_symbol
-                        || ( it->next_symbol == cit->next_symbol
-                            && it->prod->id > cit->prod->id ) )
-                    {
-                        cnt = 1;
-                        i->pptr = cit;
-                        i->next->pptr = it;
-                    }
-                }
-            }
+        if( cl->sym_stamp[ id ] != cl->stamp )
+        {
+            cl->sym_stamp[ id ] = cl->stamp;
+            cl->sym_part[ id ] = parray_create( sizeof( ITEM* ), 8 );
+            parray_push( sym_ids, (void*)&id );
         }
-    }
-    while( cnt > 0 );
 
-#if ON_ALGORITHM_DEBUG
-    fprintf( stderr, "\n--- State %d ---\n", st->state_id );
-    dump_item_set( (FILE*)NULL, "Kernel:", st->kernel );
-    dump_item_set( (FILE*)NULL, "Closure:", closure_set );
-    dump_item_set( (FILE*)NULL, "Epsilon:", st->epsilon );
-#endif
+        parray_push( cl->sym_part[ id ], (void*)&it );
+    }
 
     /*
-        Partitioning all items with the same symbol right to the dot
-        (all items that share the symbol where next_symbol points to...)
+        The partitions are ordered by their symbol ids, and the items of
+        a partition by their production ids, keeping the closure order of
+        equal productions. So the resulting state numbering does not depend
+        on the memory addresses of the symbols.
     */
-    for( i = closure_set; i; i = i->next )
+    qsort( parray_first( sym_ids ), parray_count( sym_ids ),
+                sizeof( int ), sort_partition_ids );
+
+    partitions = parray_create( sizeof( parray* ), 16 );
+
+    parray_for( sym_ids, sym_id )
     {
-        it = i->pptr;
+        part = cl->sym_part[ *sym_id ];
 
-        if( it->next_symbol != (SYMBOL*)NULL )
-        {
-            if( ( cnt = list_find( part_symbols, it->next_symbol ) ) == -1 )
-            {
-                part_symbols = list_push( part_symbols, it->next_symbol );
-                partitions = list_push( partitions,
-                    list_push( (LIST*)NULL, it ) );
-            }
-            else
+        for( n = 1; n < parray_count( part ); n++ )
+            for( m = n; m > 0; m-- )
             {
-                for( j = partitions; j && cnt > 0; j = j->next, cnt-- )
-                        ;
-                j->pptr = list_push( (LIST*)(j->pptr), it );
+                it = *( (ITEM**)parray_get( part, m - 1 ) );
+                cit = *( (ITEM**)parray_get( part, m ) );
+
+                if( it->prod->id <= cit->prod->id )
+                    break;
+
+                parray_swap( part, m - 1, m );
             }
-        }
+
+        parray_push( partitions, (void*)&part );
     }
 
+    parray_free( sym_ids );
+
+#if ON_ALGORITHM_DEBUG
+    fprintf( stderr, "\n--- State %d ---\n", st->state_id );
+    dump_item_set( (FILE*)NULL, parser, "Kernel:", st->kernel );
+    dump_item_set( (FILE*)NULL, parser, "Closure:", closure_set );
+    dump_item_set( (FILE*)NULL, parser, "Epsilon:", st->epsilon );
+#endif
+
+    parray_free( closure_set );
+    return partitions;
+}
+
+/** Creates the transitions of state //state_id// from the //partitions// of
+its closure, as computed by close_state(). The partitions become the kernels
+of new states, or their lookaheads are merged into the kernels of existing
+states. Transition table entries are only created on the first closure of a
+state.
+
+//parser// is the pointer to the parser information structure.
+//cl// is the closure bookkeeping; New states and states which got new
+lookaheads are queued on its worklist, and the partition items are given back
+to its item arena.
+//state_id// is the id of the closed state.
+//partitions// is the array of partitions, which is freed. */
+static void goto_partitions( PARSER* parser, CLOSURE* cl, int state_id,
+                                parray* partitions )
+{
+    STATE*		st;
+    parray*		part;
+    parray**	i;
+    ITEM**		j;
+    ITEM*		it					= (ITEM*)NULL;
+    ITEM*		cit					= (ITEM*)NULL;
+    SYMBOL*		sym_before_move		= (SYMBOL*)NULL;
+    STATE*		nstate				= (STATE*)NULL;
+    char*		signature;
+    size_t		n;
+
+    int			cnt					= 0;
+
+    st = (STATE*)parray_get( parser->states, state_id );
 
     /*
         Creating new states from the partitions
     */
-    for( i = partitions; i; i = i->next )
+    parray_for( partitions, i )
     {
+        part = *i;
         sym_before_move = (SYMBOL*)NULL;
 
         /* Move the dot in this partition one to the right! */
-        for( j = i->pptr; j; j = j->next )
+        parray_for( part, j )
         {
-            it = j->pptr;
+            it = *j;
 
             /* Remember the symbol to the right of the dot
                 before the dot is moved...*/
@@ -448,56 +561,47 @@ static void lalr1_closure( PARSER* parser, int state_id )
         */
         if( parser->optimize_states
                 /* && ( IS_TERMINAL( sym_before_move ) & SYM_TERMINAL ) */
-                    && list_count( (LIST*)(i->pptr) ) == 1
+                    && parray_count( part ) == 1
                         && it->next_symbol == (SYMBOL*)NULL )
         {
 #if 0
     fprintf( stderr, "\nAdding SHIFT_REDUCE entry\n", st->state_id );
-    dump_item_set( (FILE*)NULL, "Partition:", (LIST*)(i->pptr) );
+    dump_item_set( (FILE*)NULL, parser, "Partition:", part );
 #endif
             /*
                 Add a shift-reduce entry
             */
             if( !( st->closed ) )
-            {
-                if( IS_TERMINAL( sym_before_move ) )
-                {
-                    st->actions = list_push( st->actions, create_tabcol(
-                        sym_before_move, SHIFT_REDUCE,
-                            it->prod->id, (ITEM*)NULL ) );
-                }
-                else
-                {
-                    st->gotos = list_push( st->gotos, create_tabcol(
-                        sym_before_move, SHIFT_REDUCE,
-                            it->prod->id, (ITEM*)NULL ) );
-                }
-            }
+                create_tabcol( IS_TERMINAL( sym_before_move ) ?
+                                    st->actions : st->gotos,
+                                sym_before_move, SHIFT_REDUCE,
+                                    it->prod->id, (ITEM*)NULL );
 
-            drop_item_list( (LIST*)( i->pptr ) );
+            drop_item_set( cl->items, part );
         }
         else
         {
             /*
                 Proceed normally
             */
-            parray_for( parser->states, nstate )
-                if( test_same_kernel( nstate->kernel, i->pptr ) )
-                    break;
+            signature = kernel_signature( part );
 
-            if( !nstate )
+            if( !( nstate = find_state( parser, signature ) ) )
             {
                 nstate = create_state( parser );
-                nstate->kernel = i->pptr;
+                parray_concat( nstate->kernel, part );
                 nstate->derived_from = state_id;
 
+                index_state( parser, nstate, signature );
+                queue_state( cl->worklist, nstate );
+
                 /* Re-get current state due possibly heap re-allocation */
                 st = (STATE*)parray_get( parser->states, state_id );
 
 #if ON_ALGORITHM_DEBUG
                 fprintf( stderr, "\n===> Creating new State %d...\n",
                     nstate->state_id );
-                dump_item_set( (FILE*)NULL, "Kernel:", nstate->kernel );
+                dump_item_set( (FILE*)NULL, parser, "Kernel:", nstate->kernel );
 #endif
             }
             else
@@ -505,87 +609,250 @@ static void lalr1_closure( PARSER* parser, int state_id )
 #if ON_ALGORITHM_DEBUG
                 fprintf( stderr, "\n===> Updating existing State %d...\n",
                     nstate->state_id );
-                dump_item_set( (FILE*)NULL, "Kernel:", nstate->kernel );
+                dump_item_set( (FILE*)NULL, parser, "Kernel:", nstate->kernel );
                 fprintf( stderr, "\n...from partition set...\n" );
-                dump_item_set( (FILE*)NULL, "Partition:", i->pptr );
+                dump_item_set( (FILE*)NULL, parser, "Partition:", part );
 #endif
 
                 /* Merging the lookaheads */
                 cnt = 0;
-                prev_cnt = 0;
-
-#if 0
-    if( nstate->state_id == 96 && st->state_id == 260 )
-    {
-        fprintf( stderr, "\n--- NEW/UPDATE STATE %d from STATE %d ---\n",
-            nstate->state_id, st->state_id );
-        dump_item_set( (FILE*)NULL, "Partition:", i->pptr );
-        dump_item_set( (FILE*)NULL, "Kernel:", nstate->kernel );
-        getchar();
-    }
-#endif
 
-                for( j = nstate->kernel, k = i->pptr; j;
-                        j = j->next, k = k->next )
+                for( n = 0; n < parray_count( part ); n++ )
                 {
-                    it = j->pptr;
-                    prev_cnt += plist_count( &it->lookahead );
+                    it = *( (ITEM**)parray_get( nstate->kernel, n ) );
+                    cit = *( (ITEM**)parray_get( part, n ) );
 
-                    plist_union( &it->lookahead, &((ITEM*)(k->pptr))->lookahead );
-
-                    cnt += plist_count( &it->lookahead );
-
-                    free_item( k->pptr );
+                    cnt += bitset_union( &it->lookahead, &cit->lookahead );
+                    free_item( cl->items, cit );
                 }
 
                 /* Had new lookaheads been added? */
-                if( cnt > prev_cnt )
-                    nstate->done = FALSE;
+                if( cnt )
+                    queue_state( cl->worklist, nstate );
 
 #if ON_ALGORITHM_DEBUG
                 fprintf( stderr, "\n...it's now...\n" );
-                dump_item_set( (FILE*)NULL, "Kernel:", nstate->kernel );
+                dump_item_set( (FILE*)NULL, parser, "Kernel:", nstate->kernel );
 #endif
-
-                /* drop_item_list( (LIST*)( i->pptr ) ); */
-                list_free( (LIST*)( i->pptr ) );
             }
 
+            parray_free( part );
+            pfree( signature );
+
             /* Performing some table creation */
             if( !( st->closed ) )
-            {
-                if( IS_TERMINAL( sym_before_move ) )
-                {
-                    st->actions = list_push( st->actions, create_tabcol(
-                        sym_before_move, SHIFT,
-                            nstate->state_id, (ITEM*)NULL ) );
-                }
-                else
-                {
-                    st->gotos = list_push( st->gotos, create_tabcol(
-                        sym_before_move, SHIFT,
-                            nstate->state_id, (ITEM*)NULL ) );
-                }
-            }
+                create_tabcol( IS_TERMINAL( sym_before_move ) ?
+                                    st->actions : st->gotos,
+                                sym_before_move, SHIFT,
+                                    nstate->state_id, (ITEM*)NULL );
         }
     }
 
     st->closed = 1;
 
-    list_free( closure_set );
-    list_free( part_symbols );
-    list_free( partitions );
+    parray_free( partitions );
 
 #if ON_ALGORITHM_DEBUG
     fprintf( stderr, "\n\n" );
 #endif
+}
 
-    /*
-    if( debug )
-        printf( "\n" );
-    */
+/** Performs an LR(1) closure and merges the lookahead-symbols of items with the
+same right-hand side, dot position, and lookahead-subset, making it a LALR(1)
+closure.
+
+//parser// is the pointer to the parser information structure.
+//cl// is the closure bookkeeping; New states and states which got new
+lookaheads are queued on its worklist.
+//state_id// is the id of the state to be closed. */
+static void lalr1_closure( PARSER* parser, CLOSURE* cl, int state_id )
+{
+    STATE*		st;
+
+    if( !( st = parray_get( parser->states, state_id ) ) )
+    {
+        WRONGPARAM;
+        return;
+    }
+
+    goto_partitions( parser, cl, state_id, close_state( parser, cl, st ) );
+}
+
+
+/** Initializes the closure bookkeeping //cl// for the grammar of //parser//.
+
+//items// is the arena where closure items are allocated from. */
+static void init_closure( PARSER* parser, CLOSURE* cl, ARENA* items )
+{
+    memset( cl, 0, sizeof( CLOSURE ) );
+
+    cl->prod_item = (ITEM**)pmalloc( plist_count( parser->productions )
+                                        * sizeof( ITEM* ) );
+    cl->prod_stamp = (int*)pmalloc( plist_count( parser->productions )
+                                        * sizeof( int ) );
+    cl->sym_part = (parray**)pmalloc( plist_count( parser->symbols )
+                                        * sizeof( parray* ) );
+    cl->sym_stamp = (int*)pmalloc( plist_count( parser->symbols )
+                                        * sizeof( int ) );
+
+    /* The digraph method closes every state once without any lookaheads,
+        and computes them afterwards. */
+    cl->lr0 = parser->digraph;
+    cl->items = items;
+}
+
+/** Frees the members of the closure bookkeeping //cl//. */
+static void free_closure( CLOSURE* cl )
+{
+    pfree( cl->prod_item );
+    pfree( cl->prod_stamp );
+    pfree( cl->sym_part );
+    pfree( cl->sym_stamp );
 }
 
+#ifdef HAVE_LIBPTHREAD
+/** Thread function of a closure worker; Closes states of the current round
+until all states of the round are taken.
+
+//arg// is the WORKER.
+
+Returns (void*)NULL always. */
+static void* close_states( void* arg )
+{
+    WORKER*		w		= (WORKER*)arg;
+    ROUND*		r		= w->round;
+    STATE*		st;
+    size_t		n;
+
+    while( TRUE )
+    {
+        pthread_mutex_lock( &r->lock );
+        n = r->next++;
+        pthread_mutex_unlock( &r->lock );
+
+        if( n >= parray_count( r->states ) )
+            break;
+
+        st = (STATE*)parray_get( r->parser->states,
+                                    *( (int*)parray_get( r->states, n ) ) );
+
+        r->partitions[ n ] = close_state( r->parser, &w->cl, st );
+        r->closed_by[ n ] = &w->cl;
+    }
+
+    return (void*)NULL;
+}
+
+/** Performs the closure of all states queued on the worklist of //cl// with
+parser->threads worker threads.
+
+The closure runs in rounds; All states queued for a round are closed
+concurrently, because the closure of a state only changes the state itself.
+Then, the transitions of the closed states are created one after another in
+the order the states were queued, queuing new states and states with new
+lookaheads for the next round. As only the first closure of a state creates
+new states, and first closures are performed in the order the states were
+created, the states get the same numbers and lookaheads as with a serial
+closure in first-in, first-out order.
+
+//parser// is the pointer to the parser information structure.
+//cl// is the closure bookkeeping of the calling thread. */
+static void parallel_closure( PARSER* parser, CLOSURE* cl )
+{
+    ROUND		r;
+    WORKER*		w;
+    STATE*		st;
+    int*		state_id;
+    int			workers;
+    int			i;
+    size_t		n;
+    size_t		cnt;
+
+    if( !( w = (WORKER*)pmalloc( parser->threads * sizeof( WORKER ) ) ) )
+    {
+        OUTOFMEM;
+        return;
+    }
+
+    memset( &r, 0, sizeof( ROUND ) );
+    r.parser = parser;
+    pthread_mutex_init( &r.lock, (pthread_mutexattr_t*)NULL );
+
+    for( i = 0; i < parser->threads; i++ )
+    {
+        arena_init( &w[ i ].items, parser->items.name,
+                        parser->items.chunk, parser->items.objsize );
+        init_closure( parser, &w[ i ].cl, &w[ i ].items );
+        w[ i ].round = &r;
+    }
+
+    while( ( cnt = parray_count( cl->worklist ) ) )
+    {
+        r.states = cl->worklist;
+        r.next = 0;
+
+        cl->worklist = parray_create( sizeof( int ), 64 );
+
+        r.partitions = (parray**)pmalloc( cnt * sizeof( parray* ) );
+        r.closed_by = (CLOSURE**)pmalloc( cnt * sizeof( CLOSURE* ) );
+
+        if( !r.partitions || !r.closed_by )
+        {
+            OUTOFMEM;
+
+            pfree( r.partitions );
+            pfree( r.closed_by );
+            parray_free( r.states );
+            break;
+        }
+
+        parray_for( r.states, state_id )
+        {
+            st = (STATE*)parray_get( parser->states, *state_id );
+            st->queued = FALSE;
+        }
+
+        /* Close the states of this round */
+        workers = (size_t)parser->threads < cnt ? parser->threads : (int)cnt;
+
+        for( i = 1; i < workers; i++ )
+            if( pthread_create( &w[ i ].thread, (pthread_attr_t*)NULL,
+                                    close_states, (void*)&w[ i ] ) )
+                break;
+
+        workers = i;
+        close_states( (void*)&w[ 0 ] );
+
+        for( i = 1; i < workers; i++ )
+            pthread_join( w[ i ].thread, (void**)NULL );
+
+        /* Create the transitions in queuing order */
+        for( n = 0; n < cnt; n++ )
+        {
+            r.closed_by[ n ]->worklist = cl->worklist;
+
+            goto_partitions( parser, r.closed_by[ n ],
+                                *( (int*)parray_get( r.states, n ) ),
+                                    r.partitions[ n ] );
+            parser->closures++;
+        }
+
+        pfree( r.partitions );
+        pfree( r.closed_by );
+        parray_free( r.states );
+    }
+
+    /* Workers and the round are released on success and failure alike */
+    for( i = 0; i < parser->threads; i++ )
+    {
+        free_closure( &w[ i ].cl );
+        arena_merge( &parser->items, &w[ i ].items );
+    }
+
+    pthread_mutex_destroy( &r.lock );
+    pfree( w );
+}
+#endif
 
 /** Performs reduction entries into the parse-table and determines shift-reduce
 or reduce-reduce conflicts. The reduction-entries can only be added when all
@@ -593,15 +860,16 @@ states are closed completely, so this operations must be called as the last
 step on creating the parse-tables.
 
 //parser// is the pointer to parser structure.
+//syms// are the symbols of the parser, indexed by their id.
 //st// is the state pointer, defining the state where reduce-entries should be
 created for.
 //it// is the item where the reduce-entries should be created for. */
-static void reduce_item( PARSER* parser, STATE* st, ITEM* it )
+static void reduce_item( PARSER* parser, SYMBOL** syms, STATE* st, ITEM* it )
 {
-    plistel* 	e;
     SYMBOL*		sym		= (SYMBOL*)NULL;
     TABCOL*		act		= (TABCOL*)NULL;
     int			resolved;
+    int			id;
 
     /*
     02.03.2011	Jan Max Meyer
@@ -613,17 +881,16 @@ static void reduce_item( PARSER* parser, STATE* st, ITEM* it )
 
     if( it->next_symbol == (SYMBOL*)NULL )
     {
-        plist_for( &it->lookahead, e )
+        BITSETFOR( &it->lookahead, id )
         {
-            sym = (SYMBOL*)plist_access( e );
+            sym = syms[ id ];
 
             /*
                 Check out if there is already an action!
             */
             if( ( act = find_tabcol( st->actions, sym ) ) == (TABCOL*)NULL )
             {
-                st->actions = list_push( st->actions,
-                    create_tabcol( sym, REDUCE, it->prod->id, it ) );
+                create_tabcol( st->actions, sym, REDUCE, it->prod->id, it );
             }
             else
             {
@@ -648,9 +915,7 @@ static void reduce_item( PARSER* parser, STATE* st, ITEM* it )
 
                     if( sym->assoc == ASSOC_NOASSOC )
                     {
-                        st->actions = list_remove( st->actions,
-                                        (void*)act );
-                        free_tabcol( act );
+                        remove_tabcol( st->actions, act );
                     }
                 }
                 else if( act->action & SHIFT )
@@ -704,18 +969,19 @@ static void reduce_item( PARSER* parser, STATE* st, ITEM* it )
 creation. This must be called as the last step on computing the parse tables.
 
 //parser// is the pointer to parser structure
+//syms// are the symbols of the parser, indexed by their id.
 //st// is the state pointer, defining the state where reduce-entries should be
 created for. */
-static void perform_reductions( PARSER* parser, STATE* st )
+static void perform_reductions( PARSER* parser, SYMBOL** syms, STATE* st )
 {
-    LIST*	i;
+    ITEM**	it;
 
     /* First, perform the reductions */
-    for( i = st->kernel; i; i = i->next )
-        reduce_item( parser, st, i->pptr );
+    parray_for( st->kernel, it )
+        reduce_item( parser, syms, st, *it );
 
-    for( i = st->epsilon; i; i = i->next )
-        reduce_item( parser, st, i->pptr );
+    parray_for( st->epsilon, it )
+        reduce_item( parser, syms, st, *it );
 }
 
 /** This is the entry function for generating the LALR(1) parse tables for a
@@ -724,8 +990,13 @@ parsed grammar definition.
 //parser// is the pointer to the parser information structure. */
 void generate_tables( PARSER* parser )
 {
-    STATE*	st		= (STATE*)NULL;
-    ITEM*	it		= (ITEM*)NULL;
+    STATE*		st		= (STATE*)NULL;
+    ITEM*		it		= (ITEM*)NULL;
+    SYMBOL**	syms;
+    plistel*	e;
+    CLOSURE		cl;
+    int			state_id;
+    char*		signature;
 
     if( !( parser->symbols || parser->productions ) )
         return;
@@ -737,31 +1008,64 @@ void generate_tables( PARSER* parser )
     }
 
     st = create_state( parser );
-    it = create_item( (PROD*)plist_access( plist_first(
+    it = create_item( &parser->items, (PROD*)plist_access( plist_first(
                             parser->goal->productions ) ) );
-    st->kernel = list_push( st->kernel, it );
+    parray_push( st->kernel, (void*)&it );
+
+    signature = kernel_signature( st->kernel );
+    index_state( parser, st, signature );
+    pfree( signature );
+
+    /* Perform closure algorithm until the worklist runs empty */
+    init_closure( parser, &cl, &parser->items );
+    cl.worklist = parray_create( sizeof( int ), 64 );
 
     /* The goal item's lookahead is the end_of_input symbol */
-    plist_push( &it->lookahead, parser->end_of_input );
+    if( !cl.lr0 )
+        bitset_set( &it->lookahead, parser->end_of_input->id );
 
-    /* Perform closure algorithm until no more undone states are found */
-    do
+    queue_state( cl.worklist, st );
+
+#ifdef HAVE_LIBPTHREAD
+    if( parser->threads > 1 && parser->schedule == SCHEDULE_FIFO )
+        parallel_closure( parser, &cl );
+#endif
+
+    while( parray_count( cl.worklist ) )
     {
-        parray_for( parser->states, st )
-        {
-            if( !st->done )
-            {
-                st->done = TRUE;
-                lalr1_closure( parser, st->state_id );
-                break;
-            }
-        }
+        if( parser->schedule == SCHEDULE_LIFO )
+            state_id = *( (int*)parray_pop( cl.worklist ) );
+        else
+            state_id = *( (int*)parray_shift( cl.worklist ) );
+
+        st = (STATE*)parray_get( parser->states, state_id );
+        st->queued = FALSE;
+
+        lalr1_closure( parser, &cl, state_id );
+        parser->closures++;
+    }
+
+    parray_free( cl.worklist );
+    free_closure( &cl );
+
+    if( parser->digraph )
+        compute_lookaheads( parser );
+
+    /* Perform parse table generation; Lookaheads are walked by symbol id */
+    if( !( syms = (SYMBOL**)pmalloc( plist_count( parser->symbols )
+                                        * sizeof( SYMBOL* ) ) ) )
+    {
+        OUTOFMEM;
+        return;
     }
-    while( st );
 
-    /* Perform parse table generation. */
+    plist_for( parser->symbols, e )
+        syms[ ( (SYMBOL*)plist_access( e ) )->id ] = (SYMBOL*)plist_access( e );
+
     parray_for( parser->states, st )
-        perform_reductions( parser, st );
+        perform_reductions( parser, syms, st );
+
+    pfree( syms );
 }
 
 /** Performs a default production detection. This must be done immediatelly
@@ -774,10 +1078,9 @@ void detect_default_productions( PARSER* parser )
     STATE*		st;
     PROD*		cur;
     TABCOL*		act;
+    parray*		actions;
 
     plistel*	e;
-    LIST*		a_list;
-    LIST*		n_list;
 
     int			max;
     int			count;
@@ -792,14 +1095,10 @@ void detect_default_productions( PARSER* parser )
         {
             cur = (PROD*)plist_access( e );
 
-            for( a_list = st->actions, count = 0; a_list;
-                    a_list = list_next( a_list ) )
-            {
-                act = (TABCOL*)list_access( a_list );
-
+            count = 0;
+            parray_for( st->actions, act )
                 if( act->action == REDUCE && act->index == cur->id )
                     count++;
-            }
 
             if( count > max )
             {
@@ -811,22 +1110,15 @@ void detect_default_productions( PARSER* parser )
         /* Remove all entries that already match the default production */
         if( st->def_prod )
         {
-            n_list = (LIST*)NULL;
-
-            for( a_list = st->actions; a_list;
-                    a_list = list_next( a_list ) )
-            {
-                act = (TABCOL*)list_access( a_list );
+            actions = parray_create( sizeof( TABCOL ), 16 );
 
-                if( act->action == REDUCE &&
-                        act->index == st->def_prod->id )
-                    free_tabcol( act );
-                else
-                    n_list = list_push( n_list, act );
-            }
+            parray_for( st->actions, act )
+                if( !( act->action == REDUCE &&
+                        act->index == st->def_prod->id ) )
+                    parray_push( actions, (void*)act );
 
-            list_free( st->actions );
-            st->actions = n_list;
+            parray_free( st->actions );
+            st->actions = actions;
         }
     }
 }
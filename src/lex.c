@@ -3,83 +3,311 @@ by using the libphorward regular expression tools. */
 
 #include "unicc.h"
 
+#ifdef HAVE_LIBPTHREAD
+#include <pthread.h>
+#endif
+
+/* Compares two terminal symbol ids of a lexer signature. */
+static int sort_terminal_ids( const void* l, const void* r )
+{
+    return *( (const int*)l ) - *( (const int*)r );
+}
+
+/** Computes the signature of the lexer required by state //s//. The signature
+is the sorted sequence of the ids of the terminals with a pattern in the
+state's actions, so states with equal signatures have equal lexers.
+
+Returns a newly allocated string that must be freed by the caller, or
+(char*)NULL if the state requires no lexer. */
+static char* lexer_signature( STATE* s )
+{
+    TABCOL*	col;
+    int*	ids;
+    char*	signature;
+    char*	pos;
+    int		cnt		= 0;
+    int		i;
+
+    if( !( ids = (int*)pmalloc( ( parray_count( s->actions ) + 1 )
+                                    * sizeof( int ) ) ) )
+    {
+        OUTOFMEM;
+        return (char*)NULL;
+    }
+
+    parray_for( s->actions, col )
+        if( col->symbol->ptn )
+            ids[ cnt++ ] = col->symbol->id;
+
+    if( !cnt )
+    {
+        pfree( ids );
+        return (char*)NULL;
+    }
+
+    qsort( ids, cnt, sizeof( int ), sort_terminal_ids );
+
+    if( !( signature = (char*)pmalloc(
+            ( cnt * ( ONE_LINE / 4 ) + 1 ) * sizeof( char ) ) ) )
+    {
+        OUTOFMEM;
+        return (char*)NULL;
+    }
+
+    for( pos = signature, i = 0; i < cnt; i++ )
+        pos += sprintf( pos, "%d ", ids[ i ] );
+
+    pfree( ids );
+    return signature;
+}
+
+/* Lexer construction job; The DFA is constructed from the NFA, which may be
+done concurrently to other jobs. */
+typedef struct
+{
+    pregex_nfa*	nfa;			/* NFA of the lexer's terminals */
+    pregex_dfa*	dfa;			/* Minimized DFA constructed from nfa */
+} LEXJOB;
+
+/* Batch of lexer construction jobs */
+typedef struct
+{
+    parray*		jobs;			/* Lexer construction jobs */
+    size_t		next;			/* Next job to be performed */
+#ifdef HAVE_LIBPTHREAD
+    pthread_mutex_t	lock;		/* Lock on next */
+#endif
+} LEXBATCH;
+
+/** Thread function of a lexer construction worker; Constructs and minimizes
+the DFAs of the jobs in batch //arg// until all jobs are taken.
+
+Returns (void*)NULL always. */
+static void* construct_lexers( void* arg )
+{
+    LEXBATCH*	b		= (LEXBATCH*)arg;
+    LEXJOB*		job;
+    size_t		n;
+
+    while( TRUE )
+    {
+#ifdef HAVE_LIBPTHREAD
+        pthread_mutex_lock( &b->lock );
+#endif
+        n = b->next++;
+#ifdef HAVE_LIBPTHREAD
+        pthread_mutex_unlock( &b->lock );
+#endif
+
+        if( n >= parray_count( b->jobs ) )
+            break;
+
+        job = (LEXJOB*)parray_get( b->jobs, n );
+        job->dfa = pregex_dfa_create();
+
+        if( !pregex_dfa_from_nfa( job->dfa, job->nfa ) )
+            OUTOFMEM;
+
+        job->nfa = pregex_nfa_free( job->nfa );
+
+        if( !pregex_dfa_minimize( job->dfa ) )
+            OUTOFMEM;
+    }
+
+    return (void*)NULL;
+}
+
+/** Replaces the character-classes of all states of //nfa// by the character
+classes of //parser// they consist of, so the DFA is constructed on character
+classes. */
+static void nfa_to_classes( PARSER* parser, pregex_nfa* nfa )
+{
+    pregex_nfa_st*	nfa_st;
+    plistel*		e;
+    pccl*			cls;
+
+    plist_for( nfa->states, e )
+    {
+        nfa_st = (pregex_nfa_st*)plist_access( e );
+
+        if( nfa_st->ccl )
+        {
+            cls = charmap_to_classes( &parser->charmap, nfa_st->ccl );
+            pccl_free( nfa_st->ccl );
+            nfa_st->ccl = cls;
+        }
+    }
+}
+
 /** Converts the terminal symbols within the states into a DFA, and maybe
 re-uses state machines matching the same pool of terminals.
 
+States with the same set of terminals share one DFA, which is looked up by
+the lexer signature of the state before any NFA or DFA is constructed.
+
+The NFAs of the distinct lexers are constructed first. Their DFAs are then
+constructed and minimized by parser->threads worker threads, and finally
+merged into parser->dfas in the order of the states requiring them, so the
+lexers get the same numbers as with a serial construction.
+
+All DFAs are constructed on the character classes of the grammar, which are
+computed once before.
+
 //parser// is the pointer to parser information structure. */
 void merge_symbols_to_dfa( PARSER* parser )
 {
+    LEXBATCH	b;
+    LEXJOB*		job;
     pregex_nfa*	nfa;
-    pregex_dfa*	dfa;
     pregex_dfa*	ex_dfa;
-    LIST*	m;
-    STATE*	s;
-    TABCOL*	col;
+    STATE*		s;
+    STATE*		first;
+    TABCOL*		col;
+    plist*		cache;
+    plistel*	e;
+    char*		signature;
+    int*		job_of;
+#ifdef HAVE_LIBPTHREAD
+    pthread_t*	threads;
+    int			workers;
+    int			i;
+#endif
 
     PROC( "merge_symbols_to_dfa" );
     PARMS( "parser", "%p", parser );
 
+    if( !( job_of = (int*)pmalloc( ( parray_count( parser->states ) + 1 )
+                                        * sizeof( int ) ) ) )
+    {
+        OUTOFMEM;
+        VOIDRET;
+    }
+
+    memset( &b, 0, sizeof( LEXBATCH ) );
+    b.jobs = parray_create( sizeof( LEXJOB ), 64 );
+
+    cache = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_UNIQUE );
+
+    build_charmap( parser );
+
+    /* Construct the NFAs of the distinct lexers */
     parray_for( parser->states, s )
     {
         VARS( "s->state_id", "%d", s->state_id );
+        job_of[ s->state_id ] = -1;
+
+        if( !( signature = lexer_signature( s ) ) )
+            continue;
+
+        parser->lexer_lookups++;
+
+        if( ( e = plist_get_by_key( cache, signature ) ) )
+        {
+            MSG( "A lexer for this set of terminals exists" );
+            first = (STATE*)plist_access( e );
+            job_of[ s->state_id ] = job_of[ first->state_id ];
+            parser->lexer_hits++;
+
+            pfree( signature );
+            continue;
+        }
+
+        if( !plist_insert( cache, (plistel*)NULL, signature, (void*)s ) )
+            OUTOFMEM;
+
+        pfree( signature );
+
         nfa = pregex_nfa_create();
 
         /* Construct NFAs from symbols */
-        LISTFOR( s->actions, m )
-        {
-            col = (TABCOL*)list_access( m );
+        parray_for( s->actions, col )
             nfa_from_symbol( parser, nfa, col->symbol );
-        }
 
-        /* Construct DFA, if NFA has been constructed */
         VARS( "plist_count( nfa->states )", "%d", plist_count( nfa->states ) );
-        if( plist_count( nfa->states ) )
+        if( !plist_count( nfa->states ) )
         {
-            dfa = pregex_dfa_create();
+            pregex_nfa_free( nfa );
+            continue;
+        }
 
-            MSG( "Constructing DFA from NFA" );
-            if( !pregex_dfa_from_nfa( dfa, nfa ) )
-                OUTOFMEM;
+        nfa_to_classes( parser, nfa );
+        job_of[ s->state_id ] = parray_count( b.jobs );
 
-            VARS( "plist_count( dfa->states )", "%d",
-                    plist_count( dfa->states ) );
+        if( !( job = (LEXJOB*)parray_malloc( b.jobs ) ) )
+            OUTOFMEM;
 
-            MSG( "Freeing NFA" );
-            nfa = pregex_nfa_free( nfa );
+        job->nfa = nfa;
+    }
 
-            MSG( "Minimizing DFA" );
-            if( !pregex_dfa_minimize( dfa ) )
-                OUTOFMEM;
+    plist_free( cache );
 
-            VARS( "plist_count( dfa->states )", "%d",
-                    plist_count( dfa->states ) );
+    /* Construct and minimize the DFAs */
+    MSG( "Constructing DFAs from NFAs" );
+#ifdef HAVE_LIBPTHREAD
+    pthread_mutex_init( &b.lock, (pthread_mutexattr_t*)NULL );
 
-            if( ( ex_dfa = find_equal_dfa( parser, dfa ) ) )
-            {
-                MSG( "An equal DFA exists; Freeing temporary one!" );
-                dfa = pregex_dfa_free( dfa );
-            }
-            else
-            {
-                MSG( "This DFA does not exist in pool yet - integrating!" );
-                ex_dfa = dfa;
+    workers = (size_t)parser->threads < parray_count( b.jobs )
+                ? parser->threads : (int)parray_count( b.jobs );
 
-                if( !( parser->dfas = list_push(
-                        parser->dfas, (void*)ex_dfa ) ) )
-                    OUTOFMEM;
-            }
+    if( workers > 1
+            && ( threads = (pthread_t*)pmalloc(
+                                        workers * sizeof( pthread_t ) ) ) )
+    {
+        for( i = 1; i < workers; i++ )
+            if( pthread_create( &threads[ i ], (pthread_attr_t*)NULL,
+                                    construct_lexers, (void*)&b ) )
+                break;
 
-            VARS( "ex_dfa", "%p", ex_dfa );
-            s->dfa = ex_dfa;
+        workers = i;
+        construct_lexers( (void*)&b );
+
+        for( i = 1; i < workers; i++ )
+            pthread_join( threads[ i ], (void**)NULL );
+
+        pfree( threads );
+    }
+    else
+#endif
+    construct_lexers( (void*)&b );
+
+#ifdef HAVE_LIBPTHREAD
+    pthread_mutex_destroy( &b.lock );
+#endif
+
+    /* Merge the DFAs into the pool in job order */
+    parray_for( b.jobs, job )
+    {
+        VARS( "plist_count( job->dfa->states )", "%d",
+                plist_count( job->dfa->states ) );
+
+        if( ( ex_dfa = find_equal_dfa( parser, job->dfa ) ) )
+        {
+            MSG( "An equal DFA exists; Freeing temporary one!" );
+            pregex_dfa_free( job->dfa );
+            job->dfa = ex_dfa;
         }
         else
-            pregex_nfa_free( nfa );
+        {
+            MSG( "This DFA does not exist in pool yet - integrating!" );
+
+            if( !parray_push( parser->dfas, (void*)&job->dfa ) )
+                OUTOFMEM;
+        }
     }
 
+    parray_for( parser->states, s )
+        if( job_of[ s->state_id ] >= 0 )
+            s->dfa = ( (LEXJOB*)parray_get( b.jobs,
+                                            job_of[ s->state_id ] ) )->dfa;
+
+    parray_free( b.jobs );
+    pfree( job_of );
+
     VOIDRET;
 }
 
-/** Constructs a single DFA for a general token lexer.
+/** Constructs a single DFA for a general token lexer, on the character
+classes of the grammar.
 
 //parser// is the pointer to parser information structure. */
 void construct_single_lexer( PARSER* parser )
@@ -93,6 +321,8 @@ void construct_single_lexer( PARSER* parser )
     PARMS( "parser", "%p", parser );
 
     MSG( "Constructing NFA" );
+    build_charmap( parser );
+
     nfa = pregex_nfa_create();
     dfa = pregex_dfa_create();
 
@@ -109,6 +339,8 @@ void construct_single_lexer( PARSER* parser )
     if( plist_count( nfa->states ) )
     {
         MSG( "Constructing DFA from NFA" );
+        nfa_to_classes( parser, nfa );
+
         if( !pregex_dfa_from_nfa( dfa, nfa ) )
             OUTOFMEM;
 
@@ -125,16 +357,120 @@ void construct_single_lexer( PARSER* parser )
         VARS( "plist_count( dfa->states )", "%d",
                 plist_count( dfa->states ) );
 
-        if( !( parser->dfas = list_push( parser->dfas, (void*)dfa ) ) )
+        if( !parray_push( parser->dfas, (void*)&dfa ) )
             OUTOFMEM;
     }
 
     VOIDRET;
 }
 
-/** Walks trough the DFA machines of the current parser definition and tests if
-the temporary generated DFA contains the same states than a one already defined
-in the parser.
+/** Computes the canonical form of DFA //dfa//. The states are numbered in
+breadth-first order from the start state, following their transitions in
+order, and each state is written with its accepting id and its transitions,
+given by their character class ranges and the number of their target state. So two
+DFAs are equal if, and only if, their canonical forms are equal.
+
+Returns a newly allocated string that must be freed by the caller. */
+static char* dfa_signature( pregex_dfa* dfa )
+{
+    pregex_dfa_st**	states;
+    pregex_dfa_st*	dfa_st;
+    pregex_dfa_tr*	dfa_ent;
+    plistel*		e;
+    int*			order;
+    int*			number;
+    int				cnt;
+    int				ranges	= 0;
+    int				n;
+    int				i;
+    int				j;
+    wchar_t			beg;
+    wchar_t			end;
+    char*			signature;
+    char*			pos;
+
+    cnt = plist_count( dfa->states );
+
+    if( !( states = (pregex_dfa_st**)pmalloc(
+                        ( cnt + 1 ) * sizeof( pregex_dfa_st* ) ) )
+        || !( order = (int*)pmalloc( ( cnt + 1 ) * sizeof( int ) ) )
+        || !( number = (int*)pmalloc( ( cnt + 1 ) * sizeof( int ) ) ) )
+    {
+        OUTOFMEM;
+        return (char*)NULL;
+    }
+
+    i = 0;
+    plist_for( dfa->states, e )
+    {
+        states[ i ] = (pregex_dfa_st*)plist_access( e );
+        number[ i++ ] = -1;
+    }
+
+    /* Number the states in breadth-first order; States that can't be reached
+        from the start state, if any, follow in their original order. */
+    for( n = i = 0; i < cnt; i++ )
+    {
+        if( n == i )
+        {
+            for( j = 0; number[ j ] >= 0; j++ )
+                ;
+
+            number[ j ] = n;
+            order[ n++ ] = j;
+        }
+
+        plist_for( states[ order[ i ] ]->trans, e )
+        {
+            dfa_ent = (pregex_dfa_tr*)plist_access( e );
+            ranges += pccl_count( dfa_ent->ccl ) + 1;
+
+            if( number[ dfa_ent->go_to ] < 0 )
+            {
+                number[ dfa_ent->go_to ] = n;
+                order[ n++ ] = dfa_ent->go_to;
+            }
+        }
+    }
+
+    if( !( signature = (char*)pmalloc(
+            ( ( cnt + ranges * 2 ) * ( ONE_LINE / 4 ) + 1 )
+                * sizeof( char ) ) ) )
+    {
+        OUTOFMEM;
+        return (char*)NULL;
+    }
+
+    *( pos = signature ) = '\0';
+    for( i = 0; i < cnt; i++ )
+    {
+        dfa_st = states[ order[ i ] ];
+        pos += sprintf( pos, "%d:", dfa_st->accept );
+
+        plist_for( dfa_st->trans, e )
+        {
+            dfa_ent = (pregex_dfa_tr*)plist_access( e );
+
+            for( j = 0; pccl_get( &beg, &end, dfa_ent->ccl, j ); j++ )
+                pos += sprintf( pos, "%d-%d,", (int)beg, (int)end );
+
+            pos += sprintf( pos, ">%d,", number[ dfa_ent->go_to ] );
+        }
+
+        *pos++ = ';';
+        *pos = '\0';
+    }
+
+    pfree( states );
+    pfree( order );
+    pfree( number );
+
+    return signature;
+}
+
+/** Finds a DFA machine of the current parser definition that is equal to the
+temporary generated DFA. The machines are looked up by their canonical forms,
+which are indexed in the lexer index of the parser on demand.
 
 //parser// is the parser information structure.
 //ndfa// is the pointer to DFA that is compared with the other machine already
@@ -144,92 +480,57 @@ Returns the pointer to a matching DFA, else (pregex_dfa*)NULL.
 */
 pregex_dfa* find_equal_dfa( PARSER* parser, pregex_dfa* ndfa )
 {
-    LIST*			l;
     plistel*		e;
-    plistel*		f;
-    plistel*		g;
-    plistel*		h;
-
-    pregex_dfa*		tdfa;
-    pregex_dfa_st*	dfa_st		[2];
-    pregex_dfa_tr*	dfa_ent		[2];
-    BOOLEAN			match;
-
-    /*
-    19.11.2009	Jan Max Meyer
-    Revision of entire function, to work with structures of the new
-    regex-library.
-
-    16.01.2014	Jan Max Meyer
-    Fixed sources to run with libphorward v0.18 (current development version).
-    */
+    char*			signature;
+    int				i;
 
     PROC( "find_equal_dfa" );
     PARMS( "parser", "%p", parser );
     PARMS( "ndfa", "%p", ndfa );
 
-    LISTFOR( parser->dfas, l )
+    /* Index the lexers integrated since the last call */
+    while( ( i = plist_count( parser->lexers ) )
+                < parray_count( parser->dfas ) )
     {
-        tdfa = (pregex_dfa*)list_access( l );
+        signature = dfa_signature( *( (pregex_dfa**)parray_get(
+                                                    parser->dfas, i ) ) );
 
-        VARS( "plist_count( tdfa->states )", "%d",
-                plist_count( tdfa->states ) );
-        VARS( "plist_count( ndfa->states )", "%d",
-                plist_count( ndfa->states ) );
+        if( !plist_insert( parser->lexers, (plistel*)NULL,
+                            signature, (void*)&i ) )
+            OUTOFMEM;
 
-        if( plist_count( tdfa->states ) != plist_count( ndfa->states ) )
-        {
-            MSG( "Number of states does already not match - test next" );
-            continue;
-        }
+        pfree( signature );
+    }
 
-        for( e = plist_first( tdfa->states ),
-                f = plist_first( ndfa->states );
-                    e && f; e = plist_next( e ), f = plist_next( f ) )
-        {
-            match = TRUE;
+    signature = dfa_signature( ndfa );
+    VARS( "signature", "%s", signature );
 
-            dfa_st[0] = (pregex_dfa_st*)plist_access( e );
-            dfa_st[1] = (pregex_dfa_st*)plist_access( f );
+    e = plist_get_by_key( parser->lexers, signature );
+    pfree( signature );
 
-            if( !( dfa_st[0]->accept == dfa_st[1]->accept
-                    && plist_count( dfa_st[0]->trans )
-                            == plist_count( dfa_st[1]->trans ) ) )
-            {
-                MSG( "Number of transitions or accepting ID does not match" );
-                match = FALSE;
-                break;
-            }
+    if( !e )
+    {
+        MSG( "No DFA matches!" );
+        RETURN( (pregex_dfa*)NULL );
+    }
 
-            for( g = plist_first( dfa_st[0]->trans ),
-                    h = plist_first( dfa_st[1]->trans ); g && h;
-                        g = plist_next( g ), h = plist_next( h ) )
-            {
-                dfa_ent[0] = (pregex_dfa_tr*)plist_access( g );
-                dfa_ent[1] = (pregex_dfa_tr*)plist_access( h );
-
-                if( !( pccl_compare( dfa_ent[0]->ccl, dfa_ent[1]->ccl )
-                            == 0
-                        && dfa_ent[0]->go_to == dfa_ent[1]->go_to ) )
-                {
-                    MSG( "Deep scan of transitions not equal" );
-                    match = FALSE;
-                    break;
-                }
-            }
-        }
+    MSG( "DFA matches!" );
+    RETURN( *( (pregex_dfa**)parray_get( parser->dfas,
+                                    *( (int*)plist_access( e ) ) ) ) );
+}
 
-        VARS( "match", "%d", match );
-        if( match )
-        {
-            MSG( "DFA matches!" );
-            VARS( "tdfa", "%p", tdfa );
-            RETURN( tdfa );
-        }
-    }
+/** Returns the index of //dfa// within the lexers of //parser//, or -1 if
+//dfa// is (pregex_dfa*)NULL or not part of the parser. */
+int find_dfa( PARSER* parser, pregex_dfa* dfa )
+{
+    pregex_dfa**	l;
+
+    if( dfa )
+        parray_for( parser->dfas, l )
+            if( *l == dfa )
+                return (int)parray_offset( parser->dfas, l );
 
-    MSG( "No DFA matches!" );
-    RETURN( (pregex_dfa*)NULL );
+    return -1;
 }
 
 /** Converts a symbols regular expression pattern defininition into a
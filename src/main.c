@@ -99,12 +99,20 @@ void print_usage( FILE* stream, char* progname )
     fprintf( stream, "Usage: %s [OPTION]... FILE\n\n"
         "  -a    --all             Print all warnings\n"
         "  -b/-o --basename NAME   Use basename NAME for output files\n"
+        "        --digraph         Compute LALR(1) lookaheads by the\n"
+        "                          DeRemer/Pennello digraph method\n"
         "  -G    --grammar         Dump final (rewritten) grammar\n"
         "  -h    --help            Print this help and exit\n"
+        "  -j    --jobs N          Close LALR(1) states in N threads\n"
+        "                          (with fifo scheduling order only),\n"
+        "                          and construct lexers in N threads\n"
         "  -l    --language TARGET Specify target language (default: %s)\n"
+        "        --mem-stats       Print memory arena high-water marks\n"
         "  -n    --no-opt          Disables state optimization\n"
         "                          (this will cause more states)\n"
         "  -P    --productions     Dump final productions\n"
+        "        --schedule ORDER  State scheduling order, fifo (default)\n"
+        "                          or lifo\n"
         "  -s    --stats           Print statistics message\n"
         "  -S    --states          Dump LALR(1) states\n"
         "  -t    --stdout          Print output to stdout instead of files\n"
@@ -141,9 +149,10 @@ BOOLEAN get_command_line( int argc, char** argv, char** filename,
 
     for( i = 0;
             ( rc = pgetopt( opt, &param, &next, argc, argv,
-                        "ab:Ghl:no:PsStTvVw",
-                        "all grammar help language: no-opt output: basename: "
-                            "productions stats states stdout symbols verbose "
+                        "ab:Ghj:l:no:PsStTvVw",
+                        "all digraph grammar help jobs: language: mem-stats no-opt "
+                            "output: basename: "
+                            "productions schedule: stats states stdout symbols verbose "
                                 "version warnings", i ) ) == 0; i++ )
     {
         if( !strcmp( opt, "output" ) || !strcmp( opt, "o" )
@@ -161,6 +170,30 @@ BOOLEAN get_command_line( int argc, char** argv, char** filename,
             else
                 parser->target = param;
         }
+        else if( !strcmp( opt, "jobs" ) || !strcmp( opt, "j" ) )
+        {
+            if( !param )
+                print_error( parser, ERR_CMD_LINE, ERRSTYLE_FATAL, opt );
+            else if( ( parser->threads = atoi( param ) ) < 1 )
+                print_error( parser, ERR_CMD_PARAM, ERRSTYLE_FATAL,
+                                param, opt );
+        }
+        else if( !strcmp( opt, "schedule" ) )
+        {
+            if( !param )
+                print_error( parser, ERR_CMD_LINE, ERRSTYLE_FATAL, opt );
+            else if( !strcmp( param, "fifo" ) )
+                parser->schedule = SCHEDULE_FIFO;
+            else if( !strcmp( param, "lifo" ) )
+                parser->schedule = SCHEDULE_LIFO;
+            else
+                print_error( parser, ERR_CMD_PARAM, ERRSTYLE_FATAL,
+                                param, opt );
+        }
+        else if( !strcmp( opt, "digraph" ) )
+            parser->digraph = TRUE;
+        else if( !strcmp( opt, "mem-stats" ) )
+            parser->mem_stats = TRUE;
         else if( !strcmp( opt, "verbose" ) || !strcmp( opt, "v" ) )
         {
             parser->verbose = TRUE;
@@ -409,6 +442,40 @@ int main( int argc, char** argv )
                         warning_count, ( warning_count == 1 ) ? "" : "s",
                         parser->files_count,
                             ( parser->files_count == 1 ) ? "" : "s" );
+
+            if( parser->stats )
+                fprintf( status, "%d FIRST-set passes over %d components\n",
+                    parser->first_passes, parser->first_components );
+
+            if( parser->stats )
+            {
+                fprintf( status, "%d state closures performed (%s%s",
+                    parser->closures,
+                        parser->schedule == SCHEDULE_LIFO ? "lifo" : "fifo",
+                            parser->digraph ? ", digraph" : "" );
+
+                if( parser->threads > 1 )
+                    fprintf( status, ", %d threads", parser->threads );
+
+                fprintf( status, ")\n" );
+            }
+
+            if( parser->stats && parser->lexer_lookups )
+                fprintf( status, "%d of %d state lexers re-used (%d%%), "
+                                    "%ld lexers constructed\n",
+                    parser->lexer_hits, parser->lexer_lookups,
+                        parser->lexer_hits * 100 / parser->lexer_lookups,
+                            parray_count( parser->dfas ) );
+
+            if( parser->stats && parser->charmap.ranges )
+                fprintf( status, "%d character classes over %d ranges\n",
+                    parser->charmap.count, parser->charmap.ranges );
+
+            if( parser->mem_stats )
+            {
+                arena_stats( status, &parser->items );
+                arena_stats( status, &parser->strings );
+            }
         }
         else
         {
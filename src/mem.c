@@ -18,6 +18,7 @@ Returns a SYMBOL*-pointer to the SYMBOL structure representing the symbol. */
 SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
 {
     char*		keyname;
+    char*		name_key;
     char		keych;
     char*		name		= (char*)dfn;
     SYMBOL*		sym			= (SYMBOL*)NULL;
@@ -94,12 +95,20 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
 
     if( !( e = plist_get_by_key( p->symbols, keyname ) ) && create )
     {
-        /* Create symbol */
+        /* Create symbol; The key is held by the string arena */
+        if( !( name_key = arena_strdup( &p->strings, keyname ) ) )
+        {
+            OUTOFMEM;
+            return (SYMBOL*)NULL;
+        }
+
         if( !( sym = (SYMBOL*)plist_access( plist_insert( p->symbols,
-                                        (plistel*)NULL, keyname,
+                                        (plistel*)NULL, name_key,
                                             (void*)NULL ) ) ) )
             RETURN( sym );
 
+        sym->keyname = name_key;
+
         /* Set up attributes */
         sym->id = plist_count( p->symbols ) - 1;
         sym->type = type;
@@ -107,14 +116,10 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
         sym->nullable = FALSE;
         sym->greedy = TRUE;
 
-        sym->first = plist_create( 0, PLIST_MOD_PTR );
+        bitset_init( &sym->first );
 
-        /* Terminal symbols have always theirself in the FIRST-set... */
         if( IS_TERMINAL( sym ) )
-        {
-            plist_push( sym->first, sym );
             sym->all_sym = plist_create( 0, PLIST_MOD_PTR );
-        }
         else
             sym->productions = plist_create( 0, PLIST_MOD_PTR );
 
@@ -125,10 +130,7 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
         if( type == SYM_CCL_TERMINAL )
             sym->ccl = (pccl*)dfn;
 
-        sym->keyname = keyname;
-        keyname = (char*)NULL;
-
-        if( !( sym->name = pstrdup( name ) ) )
+        if( !( sym->name = arena_strdup( &p->strings, name ) ) )
         {
             OUTOFMEM;
             RETURN( (SYMBOL*)NULL );
@@ -159,7 +161,6 @@ SYMBOL* get_symbol( PARSER* p, void* dfn, int type, BOOLEAN create )
 void free_symbol( SYMBOL* sym )
 {
     pfree( sym->code );
-    pfree( sym->name );
     pfree( sym->emit );
 
     if( sym->ptn )
@@ -167,7 +168,7 @@ void free_symbol( SYMBOL* sym )
     else
         sym->ccl = pccl_free( sym->ccl );
 
-    plist_free( sym->first );
+    bitset_reset( &sym->first );
     plist_free( sym->productions );
     plist_free( sym->all_sym );
 
@@ -255,6 +256,17 @@ void append_to_production( PROD* p, SYMBOL* sym, char* name )
 //prod// is the production to be freed. */
 void free_production( PROD* prod )
 {
+    int		i;
+
+    if( prod->suffix_first )
+    {
+        for( i = 0; i <= plist_count( prod->rhs ); i++ )
+            bitset_reset( &prod->suffix_first[ i ] );
+
+        pfree( prod->suffix_first );
+        pfree( prod->suffix_nullable );
+    }
+
     plist_free( prod->rhs );
     plist_free( prod->sem_rhs );
     plist_free( prod->all_lhs );
@@ -268,33 +280,35 @@ void free_production( PROD* prod )
 
 /** Creates a new state item to be used for performing the closure.
 
+//arena// is the item arena the item is allocated from; This is the item
+arena of the parser, or of a closure worker thread.
 //p// is the pointer to the production that should be associated by the item.
 
-//lookahead// is a possible list of lookahead terminal symbol pointers
-This can also be filled later.
-
 Returns an ITEM*-pointer to the newly created item, (ITEM*)NULL in error case.
 */
-ITEM* create_item( PROD* p )
+ITEM* create_item( ARENA* arena, PROD* p )
 {
     ITEM*		i		= (ITEM*)NULL;
 
-    i = (ITEM*)pmalloc( sizeof( ITEM ) );
+    if( !( i = (ITEM*)arena_malloc( arena, sizeof( ITEM ) ) ) )
+        return (ITEM*)NULL;
+
     i->prod = p;
     i->next_symbol = (SYMBOL*)plist_access( plist_first( p->rhs ) );
 
-    plist_init( &i->lookahead, 0, PLIST_MOD_PTR );
+    bitset_init( &i->lookahead );
 
     return i;
 }
 
-/** Frees an item structure and all its members.
+/** Frees an item structure and all its members, and gives it back to the
+item //arena// it was allocated from.
 
 //it// is the pointer to item structure to be freed. */
-void free_item( ITEM* it )
+void free_item( ARENA* arena, ITEM* it )
 {
-    plist_erase( &it->lookahead );
-    pfree( it );
+    bitset_reset( &it->lookahead );
+    arena_recycle( arena, it );
 }
 
 /** Creates a new state.
@@ -318,37 +332,37 @@ STATE* create_state( PARSER* p )
     /* Set state unique key */
     st->state_id = parray_count( p->states ) - 1;
 
+    st->kernel = parray_create( sizeof( ITEM* ), 8 );
+    st->epsilon = parray_create( sizeof( ITEM* ), 8 );
+    st->actions = parray_create( sizeof( TABCOL ), 16 );
+    st->gotos = parray_create( sizeof( TABCOL ), 16 );
+
     return st;
 }
 
-/** Frees a state structure and all its members.
+/** Frees a state structure and all its members. The items themselves are
+released with the item arena of the parser.
 
 //st// is the Pointer to state structure to be freed. */
 void free_state( STATE* st )
 {
-    LIST*	li;
-
-    for( li = st->kernel; li; li = li->next )
-        free_item( li->pptr );
+    ITEM**	it;
 
-    for( li = st->epsilon; li; li = li->next )
-        free_item( li->pptr );
+    parray_for( st->kernel, it )
+        bitset_reset( &( *it )->lookahead );
 
-    for( li = st->actions; li; li = li->next )
-        free_tabcol( li->pptr );
+    parray_for( st->epsilon, it )
+        bitset_reset( &( *it )->lookahead );
 
-    for( li = st->gotos; li; li = li->next )
-        free_tabcol( li->pptr );
-
-    list_free( st->kernel );
-    list_free( st->epsilon );
-    list_free( st->actions );
-    list_free( st->gotos );
+    parray_free( st->kernel );
+    parray_free( st->epsilon );
+    parray_free( st->actions );
+    parray_free( st->gotos );
 }
 
-/** Creates a table column to be added to a state's goto-table or action-table
-row.
+/** Appends a table column to a state's goto-table or action-table row.
 
+//row// is the row the column is appended to.
 //sym// is the pointer to the symbol on which the desired action or goto is
 performed on.
 //action// is the action to be performed in context of the symbol.
@@ -357,14 +371,14 @@ and SHIFT_REDUCE the index of the rule to be reduced.
 //item// is the item, which caused the tab entry. This is only required for
 reductions.
 
-Returns a TABCOL* Pointer to the new action item. On error, (TABCOL*)NULL is
-returned. */
-TABCOL* create_tabcol( SYMBOL* sym, short action, int idx, ITEM* item )
+Returns a TABCOL* Pointer to the new action item, which stays valid until the
+next column is appended to //row//. On error, (TABCOL*)NULL is returned. */
+TABCOL* create_tabcol( parray* row, SYMBOL* sym, short action, int idx,
+                        ITEM* item )
 {
     TABCOL*		act		= (TABCOL*)NULL;
 
-    act = (TABCOL*)pmalloc( sizeof( TABCOL ) );
-    if( act )
+    if( ( act = (TABCOL*)parray_malloc( row ) ) )
     {
         memset( act, 0, sizeof( TABCOL ) );
 
@@ -379,13 +393,11 @@ TABCOL* create_tabcol( SYMBOL* sym, short action, int idx, ITEM* item )
     return act;
 }
 
-/** Frees an TABCOL-structure and all its members.
-
-//act// is the pointer to action element to be freed.
-*/
-void free_tabcol( TABCOL* act )
+/** Removes the table column //act// from the goto-table or action-table row
+//row//; The columns behind //act// move up. */
+void remove_tabcol( parray* row, TABCOL* act )
 {
-    pfree( act );
+    parray_remove( row, parray_offset( row, act ), (void**)NULL );
 }
 
 /** Tries to find the entry for a specified symbol within a state's action- or
@@ -398,16 +410,13 @@ will be returned.
 Returns a TABCOL* Pointer to the action item. If no action item was found when
 searching on the row, (TABCOL*)NULL is returned.
 */
-TABCOL* find_tabcol( LIST* row, SYMBOL* sym )
+TABCOL* find_tabcol( parray* row, SYMBOL* sym )
 {
     TABCOL*		act		= (TABCOL*)NULL;
 
-    for( ; row; row = row->next )
-    {
-        act = row->pptr;
+    parray_for( row, act )
         if( act->symbol == sym )
             return act;
-    }
 
     return (TABCOL*)NULL;
 }
@@ -517,6 +526,14 @@ PARSER* create_parser( void )
     pptr->productions = plist_create( sizeof( PROD ), PLIST_MOD_NONE );
 
     pptr->states = parray_create( sizeof( STATE ), 32 );
+    pptr->kernels = plist_create( sizeof( int ), PLIST_MOD_UNIQUE );
+
+    pptr->dfas = parray_create( sizeof( pregex_dfa* ), 16 );
+    pptr->lexers = plist_create( sizeof( int ), PLIST_MOD_NONE );
+    pptr->vtypes = parray_create( sizeof( VTYPE* ), 16 );
+
+    arena_init( &pptr->items, "item", 64 * 1024, sizeof( ITEM ) );
+    arena_init( &pptr->strings, "string", 16 * 1024, 0 );
 
     /* Setup defaults */
     pptr->p_mode = MODE_SCANNERLESS;
@@ -539,18 +556,15 @@ PARSER* create_parser( void )
 //parser// is the Parser structure to be freed. */
 void free_parser( PARSER* parser )
 {
-    LIST*		it			= (LIST*)NULL;
+    VTYPE**		vt;
     STATE*		st;
-    pregex_dfa*	dfa;
+    pregex_dfa**	dfa;
 
-    for( it = parser->vtypes; it; it = it->next )
-        free_vtype( it->pptr );
+    parray_for( parser->vtypes, vt )
+        free_vtype( *vt );
 
-    for( it = parser->dfas; it; it = it->next )
-    {
-        dfa = (pregex_dfa*)list_access( it );
-        pregex_dfa_free( dfa );
-    }
+    parray_for( parser->dfas, dfa )
+        pregex_dfa_free( *dfa );
 
     plist_iter_access( parser->symbols, (plistfn)free_symbol );
     plist_free( parser->symbols );
@@ -561,9 +575,15 @@ void free_parser( PARSER* parser )
         free_state( st );
 
     parray_free( parser->states );
+    plist_free( parser->kernels );
 
-    list_free( parser->vtypes );
-    list_free( parser->dfas );
+    parray_free( parser->vtypes );
+    parray_free( parser->dfas );
+    plist_free( parser->lexers );
+    free_charmap( &parser->charmap );
+
+    arena_free( &parser->items );
+    arena_free( &parser->strings );
 
     if( parser->p_template != parser->target )
         pfree( parser->p_template );
@@ -595,8 +615,7 @@ a matching type has been found.
 */
 VTYPE* find_vtype( PARSER* p, char* name )
 {
-    VTYPE*	vt;
-    LIST*	l;
+    VTYPE**	vt;
     char*	test_name;
 
     test_name = pstrdup( name );
@@ -605,13 +624,12 @@ VTYPE* find_vtype( PARSER* p, char* name )
 
     str_no_whitespace( test_name );
 
-    for( l = p->vtypes; l; l = l->next )
+    parray_for( p->vtypes, vt )
     {
-        vt = (VTYPE*)(l->pptr);
-        if( !strcmp( vt->int_name, test_name ) )
+        if( !strcmp( ( *vt )->int_name, test_name ) )
         {
             pfree( test_name );
-            return vt;
+            return *vt;
         }
     }
 
@@ -636,7 +654,7 @@ VTYPE* create_vtype( PARSER* p, char* name )
         if( !vt )
             OUTOFMEM;
 
-        vt->id = list_count( p->vtypes );
+        vt->id = parray_count( p->vtypes );
 
         vt->int_name = pstrdup( name );
         if( !( vt->int_name ) )
@@ -653,7 +671,8 @@ VTYPE* create_vtype( PARSER* p, char* name )
             name, vt->int_name, vt->real_def );
         */
 
-        p->vtypes = list_push( p->vtypes, (void*)vt );
+        if( !parray_push( p->vtypes, (void*)&vt ) )
+            OUTOFMEM;
     }
 
     return vt;
@@ -105,9890 +105,8902 @@ static void parse_error();
 /* Include parser control block definitions */
 #include "parse.h"
 
+#if 0
+/* Action Table, as comb-vector */
+UNICC_STATIC unsigned char _act_base[ 160 ] =
+{
+
+};
+
+UNICC_STATIC unsigned char _act_check[ 0 ] =
+{
+
+};
+
+UNICC_STATIC unsigned char _act_next[ 0 ][ 2 ] =
+{
+
+};
+
+/* GoTo Table, as comb-vector */
+UNICC_STATIC unsigned char _go_base[ 160 ] =
+{
+
+};
+
+UNICC_STATIC unsigned char _go_check[ 0 ] =
+{
+
+};
+
+UNICC_STATIC unsigned char _go_next[ 0 ][ 2 ] =
+{
+
+};
+#else
 /* Action Table */
-UNICC_STATIC int _act[ 158 ][ 27 * 3 + 1 ] =
+UNICC_STATIC unsigned short _act[ 160 ][ 27 * 3 + 1 ] =
 {
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
-    },
-    {
-        6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
+        40, 3, 228,
+        41, 3, 227,
         42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
-    },
-    {
-        26,
-        65, 3, 413,
-        64, 3, 405,
-        63, 3, 397,
-        62, 3, 389,
-        61, 3, 381,
-        60, 3, 373,
-        59, 3, 365,
-        58, 3, 357,
-        57, 3, 349,
-        56, 3, 341,
-        55, 3, 333,
-        54, 3, 325,
-        53, 3, 317,
-        52, 3, 309,
-        51, 3, 301,
-        50, 3, 297,
-        49, 3, 289,
-        48, 3, 285,
-        47, 3, 436,
-        46, 3, 273,
-        45, 3, 435,
-        44, 3, 255,
-        43, 3, 431,
-        41, 3, 239,
-        40, 3, 425,
-        39, 3, 426
-    },
-    {
-        2,
-        38, 2, 12,
-        37, 2, 13
+        44, 3, 229,
+        45, 3, 231,
+        46, 3, 242,
+        47, 3, 250,
+        48, 3, 247,
+        49, 3, 245,
+        50, 3, 233,
+        51, 3, 251,
+        52, 3, 236,
+        53, 3, 232,
+        54, 3, 241,
+        55, 3, 248,
+        56, 3, 240,
+        57, 3, 239,
+        58, 3, 238,
+        59, 3, 237,
+        60, 3, 246,
+        61, 3, 252,
+        62, 3, 235,
+        63, 3, 249,
+        64, 3, 243,
+        65, 3, 234,
+        66, 3, 244
     },
     {
         26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        40, 3, 306,
+        42, 3, 309,
+        43, 3, 308,
+        44, 3, 307,
+        45, 3, 310,
+        46, 3, 321,
+        47, 3, 329,
+        48, 3, 326,
+        49, 3, 324,
+        50, 3, 312,
+        51, 3, 330,
+        52, 3, 315,
+        53, 3, 311,
+        54, 3, 320,
+        55, 3, 327,
+        56, 3, 319,
+        57, 3, 318,
+        58, 3, 317,
+        59, 3, 316,
+        60, 3, 325,
+        61, 3, 331,
+        62, 3, 314,
+        63, 3, 328,
+        64, 3, 322,
+        65, 3, 313,
+        66, 3, 323
     },
     {
-        1,
-        2, 3, 150
+        2,
+        38, 2, 9,
+        39, 2, 10
     },
     {
-        26,
-        65, 3, 413,
-        64, 3, 405,
-        63, 3, 397,
-        62, 3, 389,
-        61, 3, 381,
-        60, 3, 373,
-        59, 3, 365,
-        58, 3, 357,
-        57, 3, 349,
-        56, 3, 341,
-        55, 3, 333,
-        54, 3, 325,
-        53, 3, 317,
-        52, 3, 309,
-        51, 3, 301,
-        50, 3, 297,
-        49, 3, 289,
-        48, 3, 285,
-        47, 3, 436,
-        46, 3, 273,
-        45, 3, 435,
-        44, 3, 255,
-        43, 3, 431,
-        41, 3, 239,
-        40, 3, 425,
-        39, 3, 426
+        6,
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         1,
-        42, 3, 153
+        43, 3, 154
     },
     {
-        1,
-        0, 3, 164
+        26,
+        40, 3, 228,
+        41, 3, 227,
+        42, 3, 230,
+        44, 3, 229,
+        45, 3, 231,
+        46, 3, 242,
+        47, 3, 250,
+        48, 3, 247,
+        49, 3, 245,
+        50, 3, 233,
+        51, 3, 251,
+        52, 3, 236,
+        53, 3, 232,
+        54, 3, 241,
+        55, 3, 248,
+        56, 3, 240,
+        57, 3, 239,
+        58, 3, 238,
+        59, 3, 237,
+        60, 3, 246,
+        61, 3, 252,
+        62, 3, 235,
+        63, 3, 249,
+        64, 3, 243,
+        65, 3, 234,
+        66, 3, 244
     },
     {
-        2,
-        38, 2, 12,
-        37, 2, 13
+        1,
+        2, 3, 151
     },
     {
-        4,
-        64, 2, 21,
-        62, 2, 23,
-        46, 3, 132,
-        4, 3, 143
+        26,
+        40, 3, 306,
+        42, 3, 309,
+        43, 3, 308,
+        44, 3, 307,
+        45, 3, 310,
+        46, 3, 321,
+        47, 3, 329,
+        48, 3, 326,
+        49, 3, 324,
+        50, 3, 312,
+        51, 3, 330,
+        52, 3, 315,
+        53, 3, 311,
+        54, 3, 320,
+        55, 3, 327,
+        56, 3, 319,
+        57, 3, 318,
+        58, 3, 317,
+        59, 3, 316,
+        60, 3, 325,
+        61, 3, 331,
+        62, 3, 314,
+        63, 3, 328,
+        64, 3, 322,
+        65, 3, 313,
+        66, 3, 323
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         2,
-        36, 2, 29,
-        35, 2, 30
+        36, 2, 16,
+        37, 2, 17
     },
     {
         2,
-        36, 2, 29,
-        35, 2, 30
-    },
-    {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
-    },
-    {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        36, 2, 16,
+        37, 2, 17
     },
     {
         4,
-        64, 2, 21,
-        62, 2, 23,
-        46, 3, 132,
-        4, 3, 143
+        4, 3, 144,
+        47, 3, 133,
+        63, 2, 22,
+        65, 2, 23
     },
     {
-        1,
-        65, 2, 34
+        2,
+        38, 2, 9,
+        39, 2, 10
     },
     {
         1,
-        65, 2, 34
+        0, 3, 165
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
-    },
-    {
-        1,
-        61, 2, 36
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
-    },
-    {
-        0
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        3,
+        47, 3, 133,
+        50, 2, 34,
+        52, 2, 35
     },
     {
-        17,
-        32, 2, 40,
-        31, 2, 41,
-        30, 2, 42,
-        29, 2, 43,
-        28, 2, 44,
-        27, 2, 45,
-        26, 2, 46,
-        25, 2, 47,
-        24, 2, 48,
-        22, 2, 49,
-        23, 2, 50,
-        21, 2, 51,
-        20, 2, 52,
-        19, 2, 53,
-        18, 2, 54,
-        17, 2, 55,
-        16, 2, 56
+        2,
+        34, 2, 39,
+        35, 2, 40
     },
     {
         1,
-        46, 3, 132
+        66, 2, 41
     },
     {
         1,
-        65, 2, 34
+        66, 2, 41
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        2,
-        34, 2, 75,
-        33, 2, 76
+        1,
+        47, 3, 133
     },
     {
-        3,
-        51, 2, 80,
-        49, 2, 81,
-        46, 3, 132
+        18,
+        16, 2, 43,
+        17, 2, 44,
+        18, 2, 45,
+        19, 2, 46,
+        20, 2, 47,
+        21, 2, 48,
+        22, 2, 49,
+        23, 2, 50,
+        24, 2, 51,
+        25, 2, 52,
+        26, 2, 53,
+        27, 2, 54,
+        28, 2, 55,
+        29, 2, 56,
+        30, 2, 57,
+        31, 2, 58,
+        32, 2, 59,
+        33, 2, 60
+    },
+    {
+        26,
+        40, 3, 306,
+        42, 3, 309,
+        43, 3, 308,
+        44, 3, 307,
+        45, 3, 310,
+        46, 3, 321,
+        47, 3, 329,
+        48, 3, 326,
+        49, 3, 324,
+        50, 3, 312,
+        51, 3, 330,
+        52, 3, 315,
+        53, 3, 311,
+        54, 3, 320,
+        55, 3, 327,
+        56, 3, 319,
+        57, 3, 318,
+        58, 3, 317,
+        59, 3, 316,
+        60, 3, 325,
+        61, 3, 331,
+        62, 3, 314,
+        63, 3, 328,
+        64, 3, 322,
+        65, 3, 313,
+        66, 3, 323
+    },
+    {
+        0
     },
     {
         1,
-        65, 2, 34
+        62, 2, 82
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        1,
+        66, 2, 41
     },
     {
         1,
-        46, 3, 132
+        66, 2, 41
+    },
+    {
+        4,
+        4, 3, 144,
+        47, 3, 133,
+        63, 2, 22,
+        65, 2, 23
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        2,
-        46, 3, 266,
-        45, 3, 265
+        6,
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         1,
-        5, 3, 142
+        50, 2, 84
     },
     {
-        26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        0
+    },
+    {
+        2,
+        50, 2, 34,
+        52, 2, 35
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
+    },
+    {
+        2,
+        47, 3, 133,
+        49, 2, 87
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         2,
-        51, 2, 80,
-        49, 2, 81
+        50, 2, 34,
+        52, 2, 35
     },
     {
         1,
-        4, 3, 143
+        4, 3, 144
     },
     {
         1,
-        4, 3, 143
+        4, 3, 144
     },
     {
         1,
-        48, 2, 89
+        4, 3, 144
     },
     {
         2,
-        15, 2, 96,
-        14, 2, 97
+        14, 2, 90,
+        15, 2, 91
     },
     {
         2,
-        15, 2, 96,
-        14, 2, 97
+        14, 2, 90,
+        15, 2, 91
     },
     {
         2,
-        15, 2, 96,
-        14, 2, 97
+        14, 2, 90,
+        15, 2, 91
+    },
+    {
+        2,
+        14, 2, 90,
+        15, 2, 91
     },
     {
         1,
-        4, 3, 143
+        49, 2, 87
     },
     {
         1,
-        4, 3, 143
+        4, 3, 144
     },
     {
         1,
-        4, 3, 143
+        4, 3, 144
     },
     {
         2,
-        51, 2, 80,
-        49, 2, 81
+        50, 2, 34,
+        52, 2, 35
     },
     {
-        2,
-        48, 2, 89,
-        46, 3, 132
+        6,
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93
+    },
+    {
+        6,
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93
+    },
+    {
+        6,
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93
+    },
+    {
+        26,
+        40, 3, 306,
+        42, 3, 309,
+        43, 3, 308,
+        44, 3, 307,
+        45, 3, 310,
+        46, 3, 321,
+        47, 3, 329,
+        48, 3, 326,
+        49, 3, 324,
+        50, 3, 312,
+        51, 3, 330,
+        52, 3, 315,
+        53, 3, 311,
+        54, 3, 320,
+        55, 3, 327,
+        56, 3, 319,
+        57, 3, 318,
+        58, 3, 317,
+        59, 3, 316,
+        60, 3, 325,
+        61, 3, 331,
+        62, 3, 314,
+        63, 3, 328,
+        64, 3, 322,
+        65, 3, 313,
+        66, 3, 323
+    },
+    {
+        1,
+        5, 3, 143
+    },
+    {
+        2,
+        46, 3, 253,
+        47, 3, 254
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        2,
-        51, 2, 80,
-        49, 2, 81
+        1,
+        47, 3, 133
     },
     {
         0
     },
     {
-        1,
-        49, 2, 100
+        27,
+        40, 3, 282,
+        41, 3, 281,
+        42, 3, 285,
+        43, 3, 284,
+        44, 3, 283,
+        45, 3, 286,
+        46, 3, 296,
+        47, 3, 304,
+        48, 3, 301,
+        49, 3, 299,
+        50, 3, 123,
+        51, 2, 105,
+        52, 3, 290,
+        53, 3, 287,
+        54, 3, 295,
+        55, 3, 302,
+        56, 3, 294,
+        57, 3, 293,
+        58, 3, 292,
+        59, 3, 291,
+        60, 3, 300,
+        61, 3, 305,
+        62, 3, 289,
+        63, 3, 303,
+        64, 3, 297,
+        65, 3, 288,
+        66, 3, 298
     },
     {
-        1,
-        46, 3, 132
+        27,
+        40, 3, 333,
+        41, 3, 332,
+        42, 3, 336,
+        43, 3, 335,
+        44, 3, 334,
+        45, 3, 337,
+        46, 3, 347,
+        47, 3, 355,
+        48, 3, 352,
+        49, 3, 350,
+        50, 3, 339,
+        51, 2, 106,
+        52, 3, 117,
+        53, 3, 338,
+        54, 3, 346,
+        55, 3, 353,
+        56, 3, 345,
+        57, 3, 344,
+        58, 3, 343,
+        59, 3, 342,
+        60, 3, 351,
+        61, 3, 356,
+        62, 3, 341,
+        63, 3, 354,
+        64, 3, 348,
+        65, 3, 340,
+        66, 3, 349
     },
     {
-        1,
-        48, 2, 89
+        0
+    },
+    {
+        5,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        54, 2, 108,
+        59, 2, 109
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 19
+        6,
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         1,
-        46, 3, 132
+        52, 2, 35
     },
     {
         1,
-        51, 2, 80
-    },
-    {
-        0
+        47, 3, 133
     },
     {
         1,
-        58, 2, 104
+        59, 2, 109
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 20
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93,
+        66, 1, 24
     },
     {
-        7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 21
+        6,
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 22
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93,
+        66, 1, 23
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 23
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93,
+        66, 1, 22
     },
     {
         7,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        65, 1, 24
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93,
+        66, 1, 21
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        7,
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93,
+        66, 1, 20
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        7,
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93,
+        66, 1, 19
     },
     {
-        5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        1,
+        49, 2, 87
     },
     {
-        27,
-        65, 3, 466,
-        64, 3, 409,
-        63, 3, 465,
-        62, 3, 393,
-        61, 3, 461,
-        60, 3, 377,
-        59, 3, 457,
-        58, 3, 361,
-        57, 3, 453,
-        56, 3, 345,
-        55, 3, 449,
-        54, 3, 329,
-        53, 3, 445,
-        52, 3, 313,
-        51, 3, 116,
-        50, 2, 113,
-        49, 3, 293,
-        48, 3, 439,
-        47, 3, 279,
-        46, 3, 437,
-        45, 3, 263,
-        44, 3, 433,
-        43, 3, 247,
-        42, 3, 232,
-        41, 3, 429,
-        40, 3, 425,
-        39, 3, 426
+        1,
+        47, 3, 133
     },
     {
-        0
+        27,
+        40, 3, 282,
+        41, 3, 281,
+        42, 3, 285,
+        43, 3, 284,
+        44, 3, 283,
+        45, 3, 286,
+        46, 3, 296,
+        47, 3, 304,
+        48, 3, 301,
+        49, 3, 299,
+        50, 2, 118,
+        51, 2, 105,
+        52, 3, 290,
+        53, 3, 287,
+        54, 3, 295,
+        55, 3, 302,
+        56, 3, 294,
+        57, 3, 293,
+        58, 3, 292,
+        59, 3, 291,
+        60, 3, 300,
+        61, 3, 305,
+        62, 3, 289,
+        63, 3, 303,
+        64, 3, 297,
+        65, 3, 288,
+        66, 3, 298
     },
     {
-        27,
-        65, 3, 417,
-        64, 3, 467,
-        63, 3, 401,
-        62, 3, 463,
-        61, 3, 385,
-        60, 3, 459,
-        59, 3, 369,
-        58, 3, 455,
-        57, 3, 353,
-        56, 3, 451,
-        55, 3, 337,
-        54, 3, 447,
-        53, 3, 321,
-        52, 3, 443,
-        51, 3, 305,
-        50, 2, 115,
-        49, 3, 122,
-        48, 3, 283,
-        47, 3, 275,
-        46, 3, 269,
-        45, 3, 259,
-        44, 3, 251,
-        43, 3, 243,
-        42, 3, 228,
-        41, 3, 235,
-        40, 3, 427,
-        39, 3, 468
+        26,
+        40, 3, 306,
+        42, 3, 309,
+        43, 3, 308,
+        44, 3, 307,
+        45, 3, 310,
+        46, 3, 321,
+        47, 3, 329,
+        48, 3, 326,
+        49, 3, 324,
+        50, 3, 312,
+        51, 3, 330,
+        52, 3, 315,
+        53, 3, 311,
+        54, 3, 320,
+        55, 3, 327,
+        56, 3, 319,
+        57, 3, 318,
+        58, 3, 317,
+        59, 3, 316,
+        60, 3, 325,
+        61, 3, 331,
+        62, 3, 314,
+        63, 3, 328,
+        64, 3, 322,
+        65, 3, 313,
+        66, 3, 323
     },
     {
-        4,
-        13, 2, 117,
-        63, 2, 118,
-        12, 2, 119,
-        11, 2, 120
+        26,
+        40, 3, 306,
+        42, 3, 309,
+        43, 3, 308,
+        44, 3, 307,
+        45, 3, 310,
+        46, 3, 321,
+        47, 3, 329,
+        48, 3, 326,
+        49, 3, 324,
+        50, 3, 312,
+        51, 3, 330,
+        52, 3, 315,
+        53, 3, 311,
+        54, 3, 320,
+        55, 3, 327,
+        56, 3, 319,
+        57, 3, 318,
+        58, 3, 317,
+        59, 3, 316,
+        60, 3, 325,
+        61, 3, 331,
+        62, 3, 314,
+        63, 3, 328,
+        64, 3, 322,
+        65, 3, 313,
+        66, 3, 323
     },
     {
         27,
-        65, 3, 411,
-        64, 3, 407,
-        63, 3, 395,
-        62, 3, 391,
-        61, 3, 379,
-        60, 3, 375,
-        59, 3, 363,
-        58, 3, 359,
-        57, 3, 347,
-        56, 3, 343,
-        55, 3, 331,
-        54, 3, 327,
-        53, 3, 315,
-        52, 3, 311,
-        51, 3, 442,
-        50, 3, 299,
-        49, 3, 441,
-        48, 3, 287,
-        47, 3, 127,
+        40, 3, 256,
+        41, 3, 255,
+        42, 3, 259,
+        43, 3, 258,
+        44, 3, 257,
+        45, 3, 260,
         46, 3, 271,
-        45, 3, 257,
-        44, 3, 253,
-        43, 3, 241,
-        42, 3, 226,
-        41, 3, 237,
-        40, 3, 425,
-        39, 3, 426
+        47, 3, 278,
+        48, 3, 128,
+        49, 3, 274,
+        50, 3, 262,
+        51, 3, 279,
+        52, 3, 265,
+        53, 3, 261,
+        54, 3, 270,
+        55, 3, 276,
+        56, 3, 269,
+        57, 3, 268,
+        58, 3, 267,
+        59, 3, 266,
+        60, 3, 275,
+        61, 3, 280,
+        62, 3, 264,
+        63, 3, 277,
+        64, 3, 272,
+        65, 3, 263,
+        66, 3, 273
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
-    },
-    {
-        0
-    },
-    {
-        1,
-        4, 3, 143
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        1,
-        60, 2, 123
+        5,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        54, 2, 108,
+        59, 2, 109
+    },
+    {
+        3,
+        55, 2, 120,
+        56, 2, 121,
+        57, 2, 122
     },
     {
         5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        54, 2, 108,
+        59, 2, 109
     },
     {
-        3,
-        56, 2, 125,
-        55, 2, 126,
-        54, 2, 127
+        1,
+        61, 2, 123
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        1,
+        4, 3, 144
     },
     {
-        26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        0
     },
     {
-        27,
-        65, 3, 417,
-        64, 3, 467,
-        63, 3, 401,
-        62, 3, 463,
-        61, 3, 385,
-        60, 3, 459,
-        59, 3, 369,
-        58, 3, 455,
-        57, 3, 353,
-        56, 3, 451,
-        55, 3, 337,
-        54, 3, 447,
-        53, 3, 321,
-        52, 3, 443,
-        51, 3, 305,
-        50, 2, 115,
-        49, 2, 129,
-        48, 3, 283,
-        47, 3, 275,
-        46, 3, 269,
-        45, 3, 259,
-        44, 3, 251,
-        43, 3, 243,
-        42, 3, 228,
-        41, 3, 235,
-        40, 3, 427,
-        39, 3, 468
+        4,
+        11, 2, 127,
+        12, 2, 128,
+        13, 2, 129,
+        64, 2, 130
     },
     {
-        26,
-        65, 3, 415,
-        64, 3, 403,
-        63, 3, 399,
-        62, 3, 387,
-        61, 3, 383,
-        60, 3, 371,
-        59, 3, 367,
-        58, 3, 355,
-        57, 3, 351,
-        56, 3, 339,
-        55, 3, 335,
-        54, 3, 323,
-        53, 3, 319,
-        52, 3, 307,
-        51, 3, 303,
-        50, 3, 295,
-        49, 3, 291,
-        48, 3, 281,
-        47, 3, 277,
-        46, 3, 267,
-        45, 3, 261,
-        44, 3, 249,
-        43, 3, 245,
-        42, 3, 230,
-        41, 3, 233,
-        40, 3, 416
+        1,
+        50, 3, 122
     },
     {
-        0
+        1,
+        58, 2, 132
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        0
+        5,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        54, 2, 108,
+        59, 2, 109
     },
     {
         1,
-        59, 2, 134
+        60, 2, 134
+    },
+    {
+        0
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        6,
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
+    },
+    {
+        0
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        1,
-        57, 2, 137
+        5,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        54, 2, 108,
+        59, 2, 109
     },
     {
-        1,
-        49, 3, 121
+        6,
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
+    },
+    {
+        3,
+        47, 3, 133,
+        50, 2, 34,
+        52, 2, 35
     },
     {
         1,
-        60, 2, 123
+        65, 2, 23
     },
     {
         14,
-        62, 2, 87,
+        6, 2, 142,
         7, 2, 143,
-        6, 2, 144,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        4, 1, 75,
-        59, 1, 75,
-        64, 1, 75,
-        65, 1, 75,
-        60, 1, 75,
-        57, 1, 75
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93,
+        4, 1, 76,
+        58, 1, 76,
+        60, 1, 76,
+        61, 1, 76,
+        65, 1, 76,
+        66, 1, 76
     },
     {
         2,
-        60, 2, 123,
-        57, 2, 137
+        58, 2, 132,
+        61, 2, 123
     },
     {
         1,
-        64, 2, 21
+        61, 2, 123
     },
     {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        2,
+        9, 2, 149,
+        10, 2, 150
     },
     {
-        3,
-        51, 2, 80,
-        49, 2, 81,
-        46, 3, 132
+        1,
+        65, 2, 23
     },
     {
-        5,
-        58, 2, 104,
-        53, 2, 111,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        6,
+        1, 2, 1,
+        3, 2, 2,
+        42, 3, 157,
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        0
+        1,
+        64, 2, 130
     },
     {
-        3,
-        56, 3, 89,
-        55, 3, 90,
-        54, 3, 91
+        14,
+        6, 2, 142,
+        7, 2, 143,
+        47, 3, 133,
+        49, 2, 87,
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93,
+        4, 1, 75,
+        58, 1, 75,
+        60, 1, 75,
+        61, 1, 75,
+        65, 1, 75,
+        66, 1, 75
     },
     {
         1,
-        4, 3, 143
+        4, 3, 144
     },
     {
-        14,
-        62, 2, 87,
-        7, 2, 143,
-        6, 2, 144,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81,
-        48, 2, 89,
-        46, 3, 132,
-        4, 1, 74,
-        59, 1, 74,
-        64, 1, 74,
-        65, 1, 74,
-        60, 1, 74,
-        57, 1, 74
+        3,
+        55, 3, 92,
+        56, 3, 91,
+        57, 3, 90
     },
     {
-        1,
-        63, 2, 118
+        0
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
-        1,
-        64, 2, 21
-    },
-    {
-        2,
-        10, 2, 151,
-        9, 2, 152
-    },
-    {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        3,
+        47, 3, 133,
+        50, 2, 34,
+        52, 2, 35
     },
     {
         1,
-        59, 2, 134
+        64, 2, 130
     },
     {
         1,
-        63, 2, 118
-    },
-    {
-        3,
-        51, 2, 80,
-        49, 2, 81,
-        46, 3, 132
-    },
-    {
-        6,
-        44, 3, 148,
-        43, 3, 149,
-        3, 2, 2,
-        1, 2, 3,
-        42, 3, 157,
-        41, 3, 156
+        60, 2, 134
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         1,
-        64, 2, 21
+        65, 2, 23
     },
     {
         1,
-        64, 2, 21
+        8, 2, 158
     },
     {
         1,
-        8, 2, 156
+        65, 2, 23
     },
     {
         6,
-        44, 3, 148,
-        43, 3, 149,
+        1, 2, 1,
         3, 2, 2,
-        1, 2, 3,
         42, 3, 157,
-        41, 3, 156
+        43, 3, 158,
+        44, 3, 150,
+        45, 3, 149
     },
     {
         4,
-        62, 2, 87,
-        52, 2, 88,
-        51, 2, 80,
-        49, 2, 81
+        50, 2, 34,
+        52, 2, 35,
+        53, 2, 92,
+        63, 2, 93
     }
 };
 
 /* GoTo Table */
-UNICC_STATIC int _go[ 158 ][ 28 * 3 + 1 ] =
+UNICC_STATIC unsigned char _go[ 160 ][ 19 * 3 + 1 ] =
 {
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 2, 4
-    },
-    {
-        2,
-        320, 3, 165,
-        239, 3, 166
+        123, 2, 3,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        28,
-        259, 3, 160,
-        246, 3, 159,
-        245, 2, 5,
-        244, 2, 6,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        3,
+        127, 3, 163,
+        128, 2, 5,
+        129, 2, 6
     },
     {
-        27,
-        243, 2, 7,
-        242, 2, 8,
-        241, 3, 162,
-        174, 3, 240,
-        166, 3, 256,
-        158, 3, 274,
-        152, 3, 286,
-        150, 3, 290,
-        146, 3, 298,
-        144, 3, 302,
-        140, 3, 310,
-        136, 3, 318,
-        132, 3, 326,
-        128, 3, 334,
-        124, 3, 342,
-        120, 3, 350,
-        116, 3, 358,
-        112, 3, 366,
-        108, 3, 374,
-        104, 3, 382,
-        100, 3, 390,
-        96, 3, 398,
-        92, 3, 406,
-        88, 3, 414,
-        86, 3, 419,
-        85, 3, 420,
-        80, 3, 432
+        4,
+        130, 2, 7,
+        131, 2, 8,
+        132, 3, 160,
+        145, 3, 161
     },
     {
         7,
-        312, 2, 9,
-        311, 3, 1,
-        310, 2, 10,
-        309, 2, 11,
-        240, 3, 224,
-        188, 2, 14,
-        187, 2, 15
+        72, 2, 11,
+        73, 2, 12,
+        126, 3, 226,
+        195, 2, 13,
+        196, 2, 14,
+        197, 3, 1,
+        198, 2, 15
     },
     {
-        26,
-        259, 3, 160,
-        246, 3, 158,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        2,
+        125, 3, 167,
+        206, 3, 166
     },
     {
         0
     },
     {
-        25,
-        241, 3, 161,
-        174, 3, 240,
-        166, 3, 256,
-        158, 3, 274,
-        152, 3, 286,
-        150, 3, 290,
-        146, 3, 298,
-        144, 3, 302,
-        140, 3, 310,
-        136, 3, 318,
-        132, 3, 326,
-        128, 3, 334,
-        124, 3, 342,
-        120, 3, 350,
-        116, 3, 358,
-        112, 3, 366,
-        108, 3, 374,
-        104, 3, 382,
-        100, 3, 390,
-        96, 3, 398,
-        92, 3, 406,
-        88, 3, 414,
-        86, 3, 419,
-        85, 3, 420,
-        80, 3, 432
-    },
-    {
-        0
+        1,
+        127, 3, 162
     },
     {
         0
     },
     {
-        3,
-        311, 3, 0,
-        188, 2, 14,
-        187, 2, 15
+        2,
+        132, 3, 159,
+        145, 3, 161
     },
     {
-        14,
-        318, 2, 16,
-        316, 2, 17,
-        308, 3, 6,
-        307, 2, 18,
-        306, 3, 4,
-        302, 2, 19,
-        301, 2, 20,
-        293, 2, 22,
-        253, 2, 24,
-        249, 2, 25,
-        236, 3, 15,
-        234, 2, 26,
-        210, 3, 42,
-        200, 2, 27
+        4,
+        123, 3, 221,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 218
+        123, 3, 220,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 219
+        3,
+        70, 2, 18,
+        71, 2, 19,
+        191, 2, 20
     },
     {
         3,
-        305, 2, 28,
-        186, 2, 31,
-        185, 2, 32
+        70, 2, 18,
+        71, 2, 19,
+        191, 2, 21
+    },
+    {
+        14,
+        85, 2, 24,
+        95, 3, 43,
+        120, 2, 25,
+        122, 3, 15,
+        135, 2, 26,
+        139, 2, 27,
+        179, 2, 28,
+        187, 2, 29,
+        188, 2, 30,
+        192, 3, 4,
+        193, 2, 31,
+        194, 3, 6,
+        202, 2, 32,
+        204, 2, 33
     },
     {
         3,
-        305, 2, 33,
-        186, 2, 31,
-        185, 2, 32
+        72, 2, 11,
+        73, 2, 12,
+        197, 3, 0
+    },
+    {
+        0
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 196
+        123, 3, 223,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 170
+        123, 3, 222,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        12,
-        318, 2, 16,
-        316, 2, 17,
-        308, 3, 5,
-        302, 2, 19,
-        301, 2, 20,
-        293, 2, 22,
-        253, 2, 24,
-        249, 2, 25,
-        236, 3, 15,
-        234, 2, 26,
-        210, 3, 42,
-        200, 2, 27
+        11,
+        95, 3, 137,
+        97, 3, 114,
+        98, 3, 113,
+        139, 2, 27,
+        149, 2, 36,
+        154, 3, 111,
+        184, 3, 136,
+        189, 3, 12,
+        200, 2, 37,
+        201, 2, 38,
+        204, 2, 33
+    },
+    {
+        3,
+        68, 3, 14,
+        69, 3, 13,
+        190, 3, 11
     },
     {
         1,
-        235, 3, 16
+        121, 3, 10
     },
     {
         1,
-        235, 3, 17
+        121, 3, 9
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 172
+        123, 3, 208,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        2,
-        288, 2, 35,
-        189, 3, 62
+        4,
+        123, 3, 173,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
+    },
+    {
+        5,
+        95, 3, 48,
+        139, 2, 27,
+        176, 3, 47,
+        177, 2, 42,
+        204, 2, 33
+    },
+    {
+        19,
+        101, 2, 61,
+        102, 2, 62,
+        103, 2, 63,
+        104, 2, 64,
+        105, 2, 65,
+        106, 2, 66,
+        107, 2, 67,
+        108, 2, 68,
+        110, 2, 69,
+        111, 2, 70,
+        112, 2, 71,
+        113, 2, 72,
+        114, 2, 73,
+        115, 2, 74,
+        116, 2, 75,
+        117, 2, 76,
+        118, 2, 77,
+        119, 2, 78,
+        186, 3, 18
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 206
+        132, 3, 148,
+        133, 2, 79,
+        134, 2, 80,
+        145, 3, 161
     },
     {
         1,
-        252, 2, 37
+        138, 2, 81
     },
     {
-        28,
-        259, 3, 160,
-        248, 2, 38,
-        247, 2, 39,
-        246, 3, 147,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        2,
+        74, 3, 63,
+        174, 2, 83
     },
     {
-        18,
-        300, 3, 18,
-        233, 2, 57,
-        232, 2, 58,
-        231, 2, 59,
-        230, 2, 60,
-        229, 2, 61,
-        228, 2, 62,
-        227, 2, 63,
-        226, 2, 64,
-        225, 2, 65,
-        224, 2, 66,
-        222, 2, 67,
-        221, 2, 68,
-        220, 2, 69,
-        219, 2, 70,
-        218, 2, 71,
-        217, 2, 72,
-        216, 2, 73
+        1,
+        121, 3, 17
     },
     {
-        5,
-        318, 2, 16,
-        291, 2, 74,
-        290, 3, 46,
-        253, 2, 24,
-        210, 3, 47
+        1,
+        121, 3, 16
     },
     {
-        1,
-        235, 3, 9
+        12,
+        85, 2, 24,
+        95, 3, 43,
+        120, 2, 25,
+        122, 3, 15,
+        135, 2, 26,
+        139, 2, 27,
+        179, 2, 28,
+        187, 2, 29,
+        188, 2, 30,
+        194, 3, 5,
+        202, 2, 32,
+        204, 2, 33
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 220
+        123, 3, 171,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 221
+        123, 3, 198,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        3,
-        304, 3, 11,
-        184, 3, 13,
-        183, 3, 14
+        1,
+        144, 2, 85
     },
     {
-        11,
-        318, 2, 16,
-        315, 2, 77,
-        314, 2, 78,
-        303, 3, 12,
-        298, 3, 135,
-        268, 3, 110,
-        263, 2, 79,
-        253, 2, 24,
-        213, 3, 112,
-        212, 3, 113,
-        210, 3, 136
+        1,
+        148, 2, 86
     },
     {
-        1,
-        235, 3, 10
+        5,
+        97, 3, 114,
+        98, 3, 113,
+        154, 3, 110,
+        200, 2, 37,
+        201, 2, 38
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 171
+        123, 3, 196,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        6,
-        318, 2, 16,
-        293, 3, 44,
-        292, 2, 82,
-        287, 2, 83,
-        253, 2, 24,
-        210, 3, 42
+        4,
+        123, 3, 195,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 217
+        123, 3, 225,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        1,
-        251, 3, 133
+        4,
+        123, 3, 224,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        0
+        4,
+        123, 3, 172,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        26,
-        259, 3, 160,
-        246, 3, 146,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        6,
+        95, 3, 48,
+        109, 2, 88,
+        139, 2, 27,
+        176, 3, 46,
+        199, 2, 89,
+        204, 2, 33
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 173
+        123, 3, 192,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 174
+        123, 3, 191,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 175
+        123, 3, 190,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 176
+        123, 3, 189,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 177
+        123, 3, 188,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 178
+        123, 3, 187,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 179
+        123, 3, 186,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 180
+        123, 3, 185,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 181
+        123, 3, 183,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 184
+        123, 3, 182,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 182
+        123, 3, 181,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 185
+        123, 3, 180,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 186
+        123, 3, 179,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 187
+        123, 3, 178,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 188
+        123, 3, 177,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 189
+        123, 3, 176,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 190
+        123, 3, 175,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 86,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        4,
+        123, 3, 174,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 91,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        7,
+        97, 3, 114,
+        98, 3, 113,
+        149, 2, 36,
+        154, 3, 111,
+        184, 3, 36,
+        200, 2, 37,
+        201, 2, 38
     },
     {
-        12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 92,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        3,
+        122, 3, 35,
+        135, 2, 26,
+        202, 2, 32
     },
     {
-        12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 93,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        3,
+        122, 3, 34,
+        135, 2, 26,
+        202, 2, 32
     },
     {
-        12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 94,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        3,
+        122, 3, 33,
+        135, 2, 26,
+        202, 2, 32
     },
     {
-        12,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        299, 2, 95,
-        294, 3, 41,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        4,
+        99, 3, 40,
+        100, 3, 39,
+        181, 3, 37,
+        182, 3, 32
     },
     {
-        7,
-        315, 2, 77,
-        314, 2, 78,
-        298, 3, 25,
-        268, 3, 110,
-        263, 2, 79,
-        213, 3, 112,
-        212, 3, 113
+        4,
+        99, 3, 40,
+        100, 3, 39,
+        181, 3, 37,
+        182, 3, 31
     },
     {
         4,
-        316, 2, 17,
-        297, 3, 26,
-        249, 2, 25,
-        236, 3, 140
+        99, 3, 40,
+        100, 3, 39,
+        181, 3, 37,
+        182, 3, 30
     },
     {
         4,
-        316, 2, 17,
-        297, 3, 27,
-        249, 2, 25,
-        236, 3, 140
+        99, 3, 40,
+        100, 3, 39,
+        181, 3, 37,
+        182, 3, 29
     },
     {
         2,
-        313, 2, 85,
-        223, 3, 28
+        109, 3, 28,
+        199, 2, 89
     },
     {
         4,
-        296, 3, 29,
-        295, 3, 36,
-        215, 3, 38,
-        214, 3, 39
+        122, 3, 141,
+        135, 2, 26,
+        183, 3, 27,
+        202, 2, 32
     },
     {
         4,
-        296, 3, 30,
-        295, 3, 36,
-        215, 3, 38,
-        214, 3, 39
+        122, 3, 141,
+        135, 2, 26,
+        183, 3, 26,
+        202, 2, 32
     },
     {
-        4,
-        296, 3, 31,
-        295, 3, 36,
-        215, 3, 38,
-        214, 3, 39
+        7,
+        97, 3, 114,
+        98, 3, 113,
+        149, 2, 36,
+        154, 3, 111,
+        184, 3, 25,
+        200, 2, 37,
+        201, 2, 38
     },
     {
-        3,
-        316, 2, 17,
-        249, 2, 25,
-        236, 3, 32
+        12,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 42,
+        185, 2, 95,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        3,
-        316, 2, 17,
-        249, 2, 25,
-        236, 3, 33
+        12,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 42,
+        185, 2, 97,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        3,
-        316, 2, 17,
-        249, 2, 25,
-        236, 3, 34
+        12,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 42,
+        185, 2, 98,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        7,
-        315, 2, 77,
-        314, 2, 78,
-        298, 3, 35,
-        268, 3, 110,
-        263, 2, 79,
-        213, 3, 112,
-        212, 3, 113
+        12,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 42,
+        185, 2, 99,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        6,
-        318, 2, 16,
-        313, 2, 85,
-        290, 3, 45,
-        253, 2, 24,
-        223, 2, 98,
-        210, 3, 47
+        12,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 42,
+        185, 2, 100,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 222
+        12,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 42,
+        185, 2, 101,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 223
+        2,
+        132, 3, 147,
+        145, 3, 161
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 193
+        0
+    },
+    {
+        1,
+        137, 3, 134
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 194
+        123, 3, 219,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        5,
-        315, 2, 77,
-        314, 2, 78,
-        268, 3, 109,
-        213, 3, 112,
-        212, 3, 113
+        6,
+        95, 3, 43,
+        139, 2, 27,
+        173, 2, 102,
+        178, 2, 103,
+        179, 3, 45,
+        204, 2, 33
     },
     {
         1,
-        262, 2, 99
+        144, 2, 104
+    },
+    {
+        2,
+        142, 3, 126,
+        143, 3, 124
+    },
+    {
+        2,
+        146, 3, 120,
+        147, 3, 118
     },
     {
         1,
-        258, 2, 101
+        141, 2, 107
     },
     {
-        4,
-        318, 2, 16,
-        293, 3, 43,
-        253, 2, 24,
-        210, 3, 42
+        12,
+        78, 3, 108,
+        79, 3, 106,
+        94, 2, 110,
+        97, 3, 107,
+        150, 2, 111,
+        151, 3, 101,
+        152, 2, 112,
+        153, 2, 113,
+        155, 2, 114,
+        171, 2, 115,
+        200, 2, 37,
+        201, 3, 115
     },
     {
-        2,
-        313, 2, 85,
-        223, 2, 102
+        4,
+        123, 3, 184,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 195
+        123, 3, 194,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 183
+        123, 3, 193,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        1,
+        201, 3, 116
     },
     {
         2,
-        318, 3, 88,
-        253, 2, 24
+        139, 2, 27,
+        204, 3, 89
     },
     {
         1,
-        315, 3, 115
+        94, 2, 116
     },
     {
-        1,
-        255, 2, 103
+        11,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 41,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        1,
-        209, 2, 105
+        4,
+        123, 3, 197,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 41,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 41,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 41,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 41,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
         11,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 3, 40,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        180, 3, 41,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 191
+        2,
+        109, 2, 117,
+        199, 2, 89
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 192
-    },
-    {
-        12,
-        315, 3, 114,
-        314, 2, 78,
-        285, 2, 106,
-        269, 2, 107,
-        267, 2, 108,
-        266, 2, 109,
-        265, 3, 100,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        95, 3, 43,
+        139, 2, 27,
+        179, 3, 44,
+        204, 2, 33
     },
     {
-        25,
-        261, 3, 117,
-        260, 3, 119,
-        178, 3, 231,
-        170, 3, 248,
-        162, 3, 264,
-        155, 3, 280,
-        148, 3, 294,
-        138, 3, 314,
-        130, 3, 330,
-        122, 3, 346,
-        114, 3, 362,
-        106, 3, 378,
-        98, 3, 394,
-        90, 3, 410,
-        86, 3, 423,
-        83, 3, 424,
-        81, 3, 430,
-        79, 3, 434,
-        78, 3, 438,
-        77, 3, 440,
-        75, 3, 446,
-        73, 3, 450,
-        71, 3, 454,
-        69, 3, 458,
-        67, 3, 462
-    },
-    {
-        1,
-        258, 2, 114
+        2,
+        142, 3, 126,
+        143, 3, 124
     },
     {
-        25,
-        257, 3, 123,
-        256, 3, 125,
-        180, 3, 227,
-        176, 3, 236,
-        172, 3, 244,
-        168, 3, 252,
-        164, 3, 260,
-        160, 3, 270,
-        157, 3, 276,
-        153, 3, 284,
-        142, 3, 306,
-        134, 3, 322,
-        126, 3, 338,
-        118, 3, 354,
-        110, 3, 370,
-        102, 3, 386,
-        94, 3, 402,
-        87, 3, 418,
-        82, 3, 428,
-        76, 3, 444,
-        74, 3, 448,
-        72, 3, 452,
-        70, 3, 456,
-        68, 3, 460,
-        66, 3, 464
+        1,
+        145, 3, 127
     },
     {
-        5,
-        289, 2, 116,
-        204, 3, 49,
-        192, 3, 48,
-        191, 3, 50,
-        190, 3, 51
+        1,
+        145, 3, 121
     },
     {
-        25,
-        254, 3, 129,
-        181, 3, 225,
-        175, 3, 238,
-        173, 3, 242,
-        167, 3, 254,
-        165, 3, 258,
-        159, 3, 272,
-        151, 3, 288,
-        145, 3, 300,
-        139, 3, 312,
-        137, 3, 316,
-        131, 3, 328,
-        129, 3, 332,
-        123, 3, 344,
-        121, 3, 348,
-        115, 3, 360,
-        113, 3, 364,
-        107, 3, 376,
-        105, 3, 380,
-        99, 3, 392,
-        97, 3, 396,
-        91, 3, 408,
-        89, 3, 412,
-        86, 3, 421,
-        84, 3, 422
+        1,
+        140, 3, 130
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 197
-    },
-    {
-        1,
-        270, 2, 121
+        123, 3, 215,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        316, 2, 17,
-        297, 2, 122,
-        249, 2, 25,
-        236, 3, 140
+        123, 3, 199,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 212
+        12,
+        78, 3, 108,
+        79, 3, 106,
+        94, 2, 110,
+        97, 3, 107,
+        150, 2, 111,
+        151, 3, 101,
+        152, 2, 112,
+        153, 2, 113,
+        155, 2, 114,
+        171, 2, 119,
+        200, 2, 37,
+        201, 3, 115
     },
     {
-        1,
-        207, 2, 124
+        3,
+        80, 3, 104,
+        81, 3, 103,
+        82, 3, 102
     },
     {
         9,
-        315, 3, 114,
-        314, 2, 78,
-        269, 2, 107,
-        265, 3, 99,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        78, 3, 108,
+        79, 3, 106,
+        94, 2, 110,
+        97, 3, 107,
+        150, 2, 111,
+        151, 3, 100,
+        155, 2, 114,
+        200, 2, 37,
+        201, 3, 115
     },
     {
-        3,
-        197, 3, 101,
-        196, 3, 102,
-        195, 3, 103
+        1,
+        92, 2, 124
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 213
+        123, 3, 214,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        12,
-        315, 3, 114,
-        314, 2, 78,
-        285, 2, 128,
-        269, 2, 107,
-        267, 2, 108,
-        266, 2, 109,
-        265, 3, 100,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        4,
+        122, 3, 141,
+        135, 2, 26,
+        183, 2, 125,
+        202, 2, 32
     },
     {
-        25,
-        259, 3, 120,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        1,
+        156, 2, 126
     },
     {
-        25,
-        257, 3, 123,
-        256, 3, 125,
-        180, 3, 227,
-        176, 3, 236,
-        172, 3, 244,
-        168, 3, 252,
-        164, 3, 260,
-        160, 3, 270,
-        157, 3, 276,
-        153, 3, 284,
-        142, 3, 306,
-        134, 3, 322,
-        126, 3, 338,
-        118, 3, 354,
-        110, 3, 370,
-        102, 3, 386,
-        94, 3, 402,
-        87, 3, 418,
-        82, 3, 428,
-        76, 3, 444,
-        74, 3, 448,
-        72, 3, 452,
-        70, 3, 456,
-        68, 3, 460,
-        66, 3, 464
+        5,
+        75, 3, 52,
+        76, 3, 51,
+        77, 3, 49,
+        89, 3, 50,
+        175, 2, 131
     },
     {
-        25,
-        259, 3, 126,
-        179, 3, 229,
-        177, 3, 234,
-        171, 3, 246,
-        169, 3, 250,
-        163, 3, 262,
-        161, 3, 268,
-        156, 3, 278,
-        154, 3, 282,
-        149, 3, 292,
-        147, 3, 296,
-        143, 3, 304,
-        141, 3, 308,
-        135, 3, 320,
-        133, 3, 324,
-        127, 3, 336,
-        125, 3, 340,
-        119, 3, 352,
-        117, 3, 356,
-        111, 3, 368,
-        109, 3, 372,
-        103, 3, 384,
-        101, 3, 388,
-        95, 3, 400,
-        93, 3, 404
+        0
     },
     {
-        3,
-        286, 2, 130,
-        280, 3, 65,
-        279, 2, 131
+        1,
+        93, 3, 109
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 214
+        123, 3, 213,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 202
+        123, 3, 212,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 215
+        123, 3, 211,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 216
+        123, 3, 201,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        3,
-        286, 2, 132,
-        280, 3, 65,
-        279, 2, 131
+        10,
+        78, 3, 108,
+        79, 3, 106,
+        94, 2, 110,
+        97, 3, 107,
+        150, 2, 111,
+        151, 3, 101,
+        152, 2, 133,
+        155, 2, 114,
+        200, 2, 37,
+        201, 3, 115
     },
     {
         2,
-        284, 2, 133,
-        205, 2, 135
-    },
-    {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 199
+        90, 2, 135,
+        170, 2, 136
     },
     {
-        10,
-        315, 3, 114,
-        314, 2, 78,
-        269, 2, 107,
-        266, 2, 136,
-        265, 3, 100,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        3,
+        165, 2, 137,
+        166, 3, 66,
+        172, 2, 138
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 209
+        123, 3, 218,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 210
+        123, 3, 217,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 211
+        123, 3, 216,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        1,
-        208, 3, 108
+        4,
+        123, 3, 204,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        0
+        3,
+        165, 2, 137,
+        166, 3, 66,
+        172, 2, 139
     },
     {
-        1,
-        207, 2, 138
+        4,
+        123, 3, 200,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        16,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 2, 139,
-        278, 2, 140,
-        273, 2, 141,
-        272, 2, 142,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83,
-        202, 3, 80,
-        201, 3, 81
+        9,
+        78, 3, 108,
+        79, 3, 106,
+        94, 2, 110,
+        97, 3, 107,
+        150, 2, 111,
+        151, 3, 100,
+        155, 2, 114,
+        200, 2, 37,
+        201, 3, 115
     },
     {
-        2,
-        208, 3, 84,
-        207, 2, 138
+        4,
+        123, 3, 203,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        4,
-        283, 3, 57,
-        282, 2, 145,
-        281, 3, 55,
-        234, 2, 146
+        10,
+        95, 3, 67,
+        97, 3, 114,
+        98, 3, 113,
+        139, 2, 27,
+        149, 2, 36,
+        154, 3, 111,
+        184, 3, 68,
+        200, 2, 37,
+        201, 2, 38,
+        204, 2, 33
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 201
+        120, 2, 140,
+        167, 3, 56,
+        168, 2, 141,
+        169, 3, 58
     },
     {
-        10,
-        318, 2, 16,
-        315, 2, 77,
-        314, 2, 78,
-        298, 3, 67,
-        268, 3, 110,
-        263, 2, 79,
-        253, 2, 24,
-        213, 3, 112,
-        212, 3, 113,
-        210, 3, 66
+        16,
+        86, 3, 82,
+        87, 3, 81,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        158, 2, 144,
+        159, 2, 145,
+        164, 2, 146,
+        180, 2, 147,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        9,
-        315, 3, 114,
-        314, 2, 78,
-        269, 2, 107,
-        265, 3, 99,
-        264, 2, 110,
-        212, 3, 106,
-        209, 2, 112,
-        194, 3, 105,
-        193, 3, 107
+        2,
+        92, 2, 148,
+        93, 3, 85
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 198
+        1,
+        92, 2, 148
     },
     {
         2,
-        280, 3, 64,
-        279, 2, 131
+        83, 3, 62,
+        84, 3, 61
     },
     {
         2,
-        317, 2, 147,
-        203, 3, 79
+        120, 2, 140,
+        169, 3, 57
     },
     {
-        5,
-        316, 2, 17,
-        297, 3, 139,
-        277, 2, 148,
-        249, 2, 25,
-        236, 3, 140
+        4,
+        123, 3, 207,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        14,
-        319, 2, 84,
-        318, 2, 16,
-        315, 3, 114,
-        314, 3, 87,
-        313, 2, 85,
-        294, 2, 139,
-        272, 2, 149,
-        269, 3, 86,
-        253, 2, 24,
-        223, 2, 90,
-        211, 3, 82,
-        210, 3, 83,
-        202, 3, 80,
-        201, 3, 81
+        4,
+        123, 3, 206,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         2,
-        271, 3, 78,
-        204, 2, 150
+        89, 2, 151,
+        157, 3, 79
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 204
+        14,
+        86, 3, 82,
+        87, 3, 81,
+        95, 3, 84,
+        96, 3, 83,
+        109, 2, 94,
+        139, 2, 27,
+        155, 3, 87,
+        158, 2, 152,
+        180, 2, 147,
+        199, 2, 89,
+        200, 3, 88,
+        201, 3, 115,
+        204, 2, 33,
+        205, 2, 96
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 205
+        5,
+        122, 3, 141,
+        135, 2, 26,
+        163, 2, 153,
+        183, 3, 140,
+        202, 2, 32
     },
     {
         2,
-        283, 3, 56,
-        234, 2, 146
+        88, 3, 80,
+        203, 2, 154
     },
     {
         2,
-        199, 3, 60,
-        198, 3, 61
+        165, 2, 137,
+        166, 3, 65
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 203
+        123, 3, 210,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        2,
-        284, 2, 153,
-        205, 2, 135
+        4,
+        123, 3, 209,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
-        2,
-        271, 3, 77,
-        204, 2, 150
+        8,
+        95, 3, 94,
+        97, 3, 114,
+        98, 3, 113,
+        139, 2, 27,
+        154, 3, 95,
+        200, 2, 37,
+        201, 2, 38,
+        204, 2, 33
     },
     {
-        8,
-        318, 2, 16,
-        315, 2, 77,
-        314, 2, 78,
-        268, 3, 94,
-        253, 2, 24,
-        213, 3, 112,
-        212, 3, 113,
-        210, 3, 93
+        2,
+        89, 2, 151,
+        157, 3, 78
     },
     {
-        4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 207
+        2,
+        90, 2, 135,
+        170, 2, 155
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 208
+        123, 3, 205,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         4,
-        276, 3, 71,
-        275, 2, 154,
-        274, 3, 69,
-        234, 2, 155
+        120, 2, 156,
+        160, 3, 70,
+        161, 2, 157,
+        162, 3, 72
     },
     {
-        2,
-        276, 3, 70,
-        234, 2, 155
+        1,
+        91, 2, 159
     },
     {
-        1,
-        206, 2, 157
+        2,
+        120, 2, 156,
+        162, 3, 71
     },
     {
         4,
-        320, 3, 165,
-        238, 2, 1,
-        239, 3, 167,
-        237, 3, 200
+        123, 3, 202,
+        124, 2, 4,
+        125, 3, 168,
+        206, 3, 166
     },
     {
         5,
-        319, 2, 84,
-        315, 3, 114,
-        314, 3, 87,
-        269, 3, 86,
-        211, 3, 76
+        96, 3, 77,
+        155, 3, 87,
+        200, 3, 88,
+        201, 3, 115,
+        205, 2, 96
     }
 };
+#endif
 
 /* Default productions per state */
-UNICC_STATIC int _def_prod[ 158 ] =
+UNICC_STATIC short _def_prod[ 160 ] =
 {
+    170,
+    156,
+    153,
+    3,
     169,
-    168,
-    152,
+    -1,
     155,
-    3,
-    151,
     -1,
-    154,
+    152,
+    170,
+    170,
     -1,
     -1,
-    2,
     8,
-    169,
-    169,
+    2,
+    -1,
+    170,
+    170,
+    -1,
+    -1,
+    -1,
+    -1,
+    170,
+    170,
+    -1,
+    -1,
+    146,
+    135,
+    64,
     -1,
     -1,
-    169,
-    169,
     7,
+    170,
+    170,
+    125,
+    119,
+    112,
+    170,
+    170,
+    170,
+    170,
+    170,
+    129,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
+    170,
     -1,
     -1,
-    169,
-    63,
-    169,
-    134,
-    145,
     -1,
     -1,
+    38,
+    38,
+    38,
+    38,
+    129,
+    142,
+    142,
     -1,
-    169,
-    169,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    145,
     -1,
+    132,
+    170,
+    55,
+    125,
     -1,
     -1,
-    169,
-    54,
-    169,
     131,
     -1,
-    144,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    169,
-    128,
-    128,
-    128,
-    128,
-    128,
-    128,
+    170,
+    170,
+    170,
     -1,
-    141,
-    141,
-    128,
-    37,
-    37,
-    37,
     -1,
     -1,
+    129,
+    170,
+    129,
+    129,
+    129,
+    129,
+    129,
+    129,
+    54,
     -1,
     -1,
-    128,
-    169,
-    169,
-    169,
-    169,
-    111,
-    118,
-    124,
-    53,
-    128,
-    169,
-    169,
-    128,
     -1,
     -1,
-    130,
-    -1,
-    128,
-    128,
-    128,
-    128,
-    128,
-    169,
-    169,
+    170,
+    170,
     -1,
+    105,
+    99,
+    97,
+    170,
+    142,
+    86,
     -1,
-    124,
     -1,
     -1,
+    170,
+    170,
+    170,
+    170,
     -1,
-    169,
-    85,
-    141,
-    169,
-    96,
+    69,
+    164,
+    170,
+    170,
+    170,
+    170,
+    164,
+    170,
     98,
-    104,
-    169,
-    -1,
-    -1,
+    170,
     -1,
+    60,
+    129,
     -1,
-    163,
-    169,
-    169,
-    169,
-    169,
-    163,
-    68,
-    169,
-    -1,
-    169,
-    169,
-    169,
-    -1,
-    -1,
-    52,
-    128,
+    53,
     -1,
     59,
-    169,
-    -1,
-    97,
-    169,
-    163,
-    92,
-    141,
-    128,
-    95,
-    169,
-    169,
-    58,
+    170,
+    170,
+    96,
+    129,
+    142,
+    93,
+    164,
+    170,
+    170,
     -1,
-    169,
-    68,
-    95,
+    96,
+    69,
+    170,
+    74,
     -1,
-    169,
-    169,
     73,
-    72,
-    -1,
-    169,
+    170,
     -1
 };
 
 #if !0
 /* DFA selection table */
-UNICC_STATIC int _dfa_select[ 158 ] =
+UNICC_STATIC signed char _dfa_select[ 160 ] =
 {
         0,
         1,
         2,
         3,
         4,
-        2,
         5,
-        3,
+        1,
         6,
-        -1,
-        4,
+        2,
+        7,
         7,
         8,
         8,
         9,
-        9,
+        3,
+        -1,
         10,
         11,
-        7,
-        12,
         12,
         13,
         14,
+        14,
         15,
         16,
         17,
         18,
         19,
-        12,
         20,
         21,
+        14,
+        14,
+        9,
         22,
         23,
-        12,
+        1,
+        1,
         24,
         25,
         26,
         27,
+        27,
+        0,
         28,
-        17,
-        29,
-        29,
-        29,
-        29,
-        29,
         29,
         30,
+        30,
+        30,
+        31,
+        31,
         31,
         31,
         32,
         33,
-        32,
-        32,
+        33,
+        29,
+        34,
+        34,
+        34,
         34,
         34,
         34,
-        30,
-        35,
-        35,
-        35,
-        35,
-        35,
         35,
         36,
+        36,
+        36,
         37,
         37,
-        33,
-        38,
+        37,
+        37,
+        32,
         38,
         38,
+        35,
+        34,
+        34,
+        34,
+        34,
+        34,
+        34,
+        19,
         39,
-        39,
-        39,
-        36,
+        20,
         40,
-        41,
+        40,
+        1,
+        1,
+        1,
+        1,
         41,
         42,
+        27,
+        27,
         43,
+        17,
         44,
         45,
         46,
-        25,
+        45,
+        45,
+        45,
+        45,
+        45,
         47,
+        40,
+        1,
         48,
+        48,
+        1,
         49,
         50,
-        19,
+        41,
         51,
         52,
         53,
-        50,
-        50,
-        50,
-        50,
-        50,
-        41,
-        41,
+        49,
         54,
-        3,
-        46,
-        3,
         55,
-        3,
         56,
         57,
         58,
         59,
+        59,
+        59,
         60,
+        41,
         61,
+        55,
+        62,
+        62,
+        62,
+        62,
         62,
-        59,
-        54,
-        63,
-        3,
         63,
+        52,
+        10,
+        12,
         64,
-        65,
-        65,
-        65,
+        26,
         65,
         66,
         67,
+        64,
         68,
-        54,
-        69,
+        68,
+        68,
+        26,
+        53,
+        46,
+        26,
         69,
         69,
+        12,
+        68,
         70,
+        68,
         71,
         72,
+        71,
         73,
-        74,
-        75,
-        21,
-        23,
-        61,
-        76,
-        77,
-        78,
-        60,
-        73,
-        79,
-        80,
-        80,
-        75,
-        81,
-        80,
-        82,
-        79,
-        23,
-        83,
-        83,
-        84,
-        84,
-        85,
-        86,
-        87
+        74
 };
 #endif
 
-#if 88
-/* DFA index table */
-UNICC_STATIC int _dfa_idx[ 88 ][ 244 ] =
+#if 75
+/* Character class map index */
+UNICC_STATIC unsigned short _char_map_idx[ 256 ] =
 {
-    {
-        0 * 2,
-        13 * 2,
-        15 * 2,
-        16 * 2,
-        17 * 2,
-        18 * 2,
-        19 * 2,
-        20 * 2,
-        21 * 2,
-        22 * 2,
-        23 * 2,
-        24 * 2,
-        25 * 2,
-        26 * 2,
-        29 * 2,
-        31 * 2
-    },
-    {
-        33 * 2,
-        80 * 2,
-        82 * 2,
-        83 * 2,
-        85 * 2,
-        86 * 2,
-        87 * 2,
-        89 * 2,
-        91 * 2,
-        92 * 2,
-        93 * 2,
-        94 * 2,
-        95 * 2,
-        96 * 2,
-        97 * 2,
-        98 * 2,
-        99 * 2,
-        100 * 2,
-        101 * 2,
-        102 * 2,
-        103 * 2,
-        104 * 2,
-        105 * 2,
-        106 * 2,
-        107 * 2,
-        108 * 2,
-        109 * 2,
-        110 * 2,
-        111 * 2,
-        112 * 2,
-        113 * 2,
-        114 * 2,
-        115 * 2,
-        116 * 2,
-        117 * 2,
-        118 * 2,
-        119 * 2,
-        120 * 2,
-        121 * 2,
-        122 * 2,
-        124 * 2,
-        125 * 2,
-        126 * 2,
-        127 * 2,
-        128 * 2,
-        130 * 2,
-        131 * 2,
-        132 * 2,
-        133 * 2,
-        134 * 2,
-        135 * 2,
-        136 * 2,
-        137 * 2,
-        138 * 2,
-        139 * 2,
-        140 * 2,
-        141 * 2,
-        142 * 2,
-        143 * 2,
-        144 * 2,
-        147 * 2,
-        149 * 2,
-        151 * 2,
-        153 * 2,
-        155 * 2,
-        157 * 2,
-        160 * 2,
-        162 * 2,
-        164 * 2,
-        166 * 2,
-        169 * 2,
-        171 * 2,
-        173 * 2,
-        175 * 2,
-        178 * 2,
-        180 * 2,
-        182 * 2,
-        184 * 2,
-        187 * 2,
-        189 * 2,
-        191 * 2,
-        193 * 2,
-        196 * 2,
-        199 * 2,
-        200 * 2,
-        202 * 2,
-        204 * 2,
-        206 * 2,
-        208 * 2,
-        211 * 2,
-        214 * 2,
-        216 * 2,
-        218 * 2,
-        220 * 2,
-        223 * 2,
-        225 * 2,
-        227 * 2,
-        229 * 2,
-        231 * 2,
-        234 * 2,
-        236 * 2,
-        238 * 2,
-        240 * 2,
-        242 * 2,
-        244 * 2,
-        246 * 2,
-        248 * 2,
-        250 * 2,
-        252 * 2,
-        254 * 2,
-        256 * 2,
-        258 * 2,
-        260 * 2,
-        262 * 2,
-        264 * 2,
-        266 * 2,
-        268 * 2,
-        270 * 2,
-        272 * 2,
-        274 * 2,
-        278 * 2,
-        280 * 2,
-        282 * 2,
-        284 * 2,
-        286 * 2,
-        288 * 2,
-        290 * 2,
-        292 * 2,
-        294 * 2,
-        296 * 2,
-        298 * 2,
-        300 * 2,
-        302 * 2,
-        304 * 2,
-        306 * 2,
-        308 * 2,
-        310 * 2,
-        312 * 2,
-        314 * 2,
-        316 * 2,
-        318 * 2,
-        320 * 2,
-        322 * 2,
-        324 * 2,
-        326 * 2,
-        328 * 2,
-        330 * 2,
-        332 * 2,
-        334 * 2,
-        336 * 2,
-        338 * 2,
-        340 * 2,
-        342 * 2,
-        344 * 2,
-        346 * 2,
-        348 * 2,
-        350 * 2,
-        352 * 2,
-        354 * 2,
-        356 * 2,
-        358 * 2,
-        360 * 2,
-        362 * 2,
-        364 * 2,
-        366 * 2,
-        368 * 2,
-        370 * 2,
-        372 * 2,
-        374 * 2,
-        376 * 2,
-        378 * 2,
-        380 * 2,
-        382 * 2,
-        384 * 2,
-        386 * 2,
-        388 * 2,
-        390 * 2,
-        392 * 2,
-        394 * 2,
-        396 * 2,
-        398 * 2,
-        400 * 2,
-        402 * 2,
-        404 * 2,
-        406 * 2,
-        408 * 2,
-        410 * 2,
-        412 * 2,
-        414 * 2,
-        416 * 2,
-        418 * 2,
-        420 * 2,
-        422 * 2,
-        424 * 2,
-        426 * 2,
-        428 * 2,
-        430 * 2,
-        432 * 2,
-        434 * 2,
-        436 * 2,
-        438 * 2,
-        440 * 2,
-        442 * 2,
-        444 * 2,
-        446 * 2,
-        448 * 2,
-        450 * 2,
-        452 * 2,
-        454 * 2,
-        456 * 2,
-        458 * 2,
-        460 * 2,
-        462 * 2,
-        464 * 2,
-        466 * 2,
-        468 * 2,
-        470 * 2,
-        472 * 2,
-        474 * 2,
-        476 * 2,
-        478 * 2,
-        480 * 2,
-        482 * 2,
-        484 * 2,
-        486 * 2,
-        488 * 2,
-        490 * 2,
-        492 * 2,
-        494 * 2,
-        496 * 2,
-        498 * 2,
-        500 * 2,
-        502 * 2,
-        504 * 2,
-        506 * 2,
-        508 * 2,
-        510 * 2,
-        512 * 2,
-        514 * 2,
-        516 * 2,
-        518 * 2,
-        520 * 2,
-        522 * 2,
-        524 * 2
-    },
-    {
-        526 * 2,
-        566 * 2,
-        567 * 2,
-        568 * 2,
-        569 * 2,
-        570 * 2,
-        571 * 2,
-        572 * 2,
-        573 * 2,
-        574 * 2,
-        575 * 2,
-        576 * 2,
-        577 * 2,
-        578 * 2,
-        579 * 2,
-        580 * 2,
-        581 * 2,
-        583 * 2,
-        584 * 2,
-        585 * 2,
-        586 * 2,
-        587 * 2,
-        588 * 2,
-        589 * 2,
-        590 * 2,
-        591 * 2,
-        592 * 2,
-        593 * 2
-    },
-    {
-        594 * 2,
-        635 * 2,
-        636 * 2,
-        637 * 2,
-        638 * 2,
-        639 * 2,
-        640 * 2,
-        641 * 2,
-        642 * 2,
-        643 * 2,
-        644 * 2,
-        645 * 2,
-        646 * 2,
-        647 * 2,
-        648 * 2,
-        649 * 2,
-        650 * 2,
-        651 * 2,
-        652 * 2,
-        653 * 2,
-        654 * 2,
-        655 * 2,
-        656 * 2,
-        657 * 2,
-        658 * 2,
-        659 * 2,
-        660 * 2,
-        661 * 2
-    },
-    {
-        662 * 2,
-        670 * 2,
-        672 * 2,
-        673 * 2,
-        674 * 2,
-        675 * 2,
-        676 * 2,
-        677 * 2,
-        679 * 2
-    },
-    {
-        681 * 2,
-        683 * 2,
-        684 * 2
-    },
-    {
-        686 * 2,
-        688 * 2
-    },
-    {
-        689 * 2,
-        697 * 2,
-        698 * 2,
-        699 * 2,
-        700 * 2,
-        701 * 2
-    },
-    {
-        703 * 2,
-        711 * 2,
-        712 * 2,
-        713 * 2,
-        714 * 2,
-        715 * 2,
-        716 * 2,
-        717 * 2,
-        718 * 2,
-        719 * 2,
-        722 * 2,
-        724 * 2,
-        726 * 2,
-        728 * 2,
-        730 * 2,
-        732 * 2,
-        734 * 2,
-        736 * 2,
-        738 * 2,
-        740 * 2
-    },
-    {
-        742 * 2,
-        745 * 2,
-        746 * 2,
-        747 * 2,
-        749 * 2,
-        751 * 2,
-        753 * 2,
-        755 * 2,
-        757 * 2,
-        759 * 2,
-        761 * 2,
-        763 * 2,
-        765 * 2
-    },
-    {
-        767 * 2,
-        797 * 2,
-        798 * 2,
-        799 * 2,
-        800 * 2,
-        802 * 2,
-        804 * 2,
-        805 * 2,
-        806 * 2,
-        807 * 2,
-        808 * 2,
-        809 * 2,
-        810 * 2,
-        811 * 2,
-        812 * 2,
-        813 * 2,
-        814 * 2,
-        815 * 2,
-        816 * 2,
-        817 * 2,
-        818 * 2,
-        819 * 2,
-        820 * 2,
-        821 * 2,
-        822 * 2,
-        823 * 2,
-        824 * 2,
-        825 * 2,
-        826 * 2,
-        827 * 2,
-        828 * 2,
-        829 * 2,
-        832 * 2,
-        834 * 2,
-        836 * 2,
-        838 * 2,
-        841 * 2,
-        843 * 2,
-        845 * 2,
-        847 * 2
-    },
-    {
-        849 * 2,
-        866 * 2,
-        867 * 2,
-        868 * 2,
-        869 * 2,
-        870 * 2,
-        871 * 2,
-        872 * 2,
-        873 * 2,
-        874 * 2,
-        875 * 2,
-        876 * 2,
-        877 * 2,
-        878 * 2,
-        879 * 2,
-        880 * 2,
-        883 * 2
-    },
-    {
-        885 * 2,
-        887 * 2
-    },
-    {
-        888 * 2,
-        904 * 2,
-        905 * 2,
-        906 * 2,
-        907 * 2,
-        908 * 2,
-        909 * 2,
-        910 * 2,
-        911 * 2,
-        912 * 2,
-        913 * 2,
-        914 * 2,
-        916 * 2,
-        917 * 2,
-        918 * 2,
-        919 * 2,
-        920 * 2,
-        921 * 2,
-        922 * 2,
-        923 * 2,
-        924 * 2,
-        925 * 2,
-        926 * 2,
-        927 * 2,
-        928 * 2,
-        929 * 2,
-        930 * 2,
-        931 * 2,
-        934 * 2,
-        936 * 2,
-        938 * 2,
-        941 * 2,
-        943 * 2,
-        945 * 2,
-        947 * 2,
-        950 * 2,
-        952 * 2,
-        955 * 2,
-        957 * 2,
-        959 * 2,
-        961 * 2,
-        963 * 2,
-        965 * 2,
-        968 * 2,
-        970 * 2,
-        973 * 2,
-        975 * 2,
-        978 * 2,
-        980 * 2,
-        982 * 2,
-        985 * 2,
-        987 * 2,
-        989 * 2,
-        991 * 2,
-        993 * 2,
-        995 * 2,
-        997 * 2,
-        999 * 2,
-        1001 * 2,
-        1003 * 2,
-        1005 * 2,
-        1007 * 2,
-        1009 * 2,
-        1011 * 2,
-        1013 * 2,
-        1015 * 2,
-        1017 * 2,
-        1019 * 2,
-        1021 * 2,
-        1023 * 2,
-        1025 * 2,
-        1027 * 2,
-        1031 * 2,
-        1033 * 2,
-        1035 * 2,
-        1037 * 2,
-        1039 * 2,
-        1041 * 2,
-        1043 * 2,
-        1045 * 2,
-        1047 * 2,
-        1049 * 2,
-        1051 * 2,
-        1053 * 2,
-        1055 * 2,
-        1057 * 2,
-        1059 * 2,
-        1061 * 2,
-        1063 * 2,
-        1065 * 2,
-        1067 * 2,
-        1069 * 2,
-        1071 * 2,
-        1073 * 2,
-        1075 * 2,
-        1077 * 2,
-        1079 * 2,
-        1081 * 2,
-        1083 * 2,
-        1085 * 2,
-        1087 * 2,
-        1089 * 2,
-        1091 * 2,
-        1093 * 2,
-        1095 * 2,
-        1097 * 2,
-        1099 * 2,
-        1101 * 2,
-        1103 * 2,
-        1105 * 2,
-        1107 * 2,
-        1109 * 2,
-        1111 * 2,
-        1113 * 2,
-        1115 * 2,
-        1117 * 2,
-        1119 * 2,
-        1121 * 2,
-        1123 * 2,
-        1125 * 2,
-        1127 * 2,
-        1129 * 2,
-        1131 * 2,
-        1133 * 2,
-        1135 * 2,
-        1137 * 2,
-        1139 * 2,
-        1141 * 2,
-        1143 * 2,
-        1145 * 2,
-        1147 * 2,
-        1149 * 2,
-        1151 * 2,
-        1153 * 2,
-        1155 * 2,
-        1157 * 2,
-        1159 * 2,
-        1161 * 2,
-        1163 * 2,
-        1165 * 2,
-        1167 * 2,
-        1169 * 2,
-        1171 * 2,
-        1173 * 2,
-        1175 * 2,
-        1177 * 2,
-        1179 * 2,
-        1181 * 2,
-        1183 * 2,
-        1185 * 2,
-        1187 * 2,
-        1189 * 2,
-        1191 * 2,
-        1193 * 2,
-        1195 * 2,
-        1197 * 2,
-        1199 * 2,
-        1201 * 2,
-        1203 * 2,
-        1205 * 2,
-        1207 * 2,
-        1209 * 2,
-        1211 * 2,
-        1213 * 2,
-        1215 * 2,
-        1217 * 2,
-        1219 * 2,
-        1221 * 2,
-        1223 * 2,
-        1225 * 2,
-        1227 * 2,
-        1229 * 2,
-        1231 * 2,
-        1233 * 2,
-        1235 * 2,
-        1237 * 2,
-        1239 * 2,
-        1241 * 2,
-        1243 * 2,
-        1245 * 2,
-        1247 * 2,
-        1249 * 2,
-        1251 * 2
-    },
-    {
-        1253 * 2,
-        1267 * 2,
-        1268 * 2,
-        1269 * 2,
-        1271 * 2,
-        1272 * 2,
-        1273 * 2,
-        1274 * 2,
-        1275 * 2,
-        1276 * 2,
-        1277 * 2,
-        1278 * 2,
-        1279 * 2,
-        1280 * 2,
-        1281 * 2,
-        1284 * 2,
-        1286 * 2
-    },
-    {
-        1288 * 2,
-        1297 * 2,
-        1298 * 2,
-        1299 * 2,
-        1300 * 2,
-        1301 * 2,
-        1302 * 2,
-        1303 * 2,
-        1304 * 2
-    },
-    {
-        1307 * 2,
-        1338 * 2,
-        1339 * 2,
-        1340 * 2,
-        1341 * 2,
-        1343 * 2,
-        1345 * 2,
-        1346 * 2,
-        1347 * 2,
-        1348 * 2,
-        1349 * 2,
-        1350 * 2,
-        1351 * 2,
-        1352 * 2,
-        1353 * 2,
-        1354 * 2,
-        1355 * 2,
-        1356 * 2,
-        1357 * 2,
-        1358 * 2,
-        1359 * 2,
-        1360 * 2,
-        1361 * 2,
-        1362 * 2,
-        1363 * 2,
-        1364 * 2,
-        1365 * 2,
-        1366 * 2,
-        1367 * 2,
-        1368 * 2,
-        1369 * 2,
-        1370 * 2,
-        1371 * 2,
-        1374 * 2,
-        1376 * 2,
-        1378 * 2,
-        1380 * 2,
-        1383 * 2,
-        1385 * 2,
-        1387 * 2,
-        1389 * 2
-    },
-    {
-        1391 * 2,
-        1431 * 2,
-        1432 * 2,
-        1433 * 2,
-        1434 * 2,
-        1435 * 2,
-        1436 * 2,
-        1437 * 2,
-        1438 * 2,
-        1439 * 2,
-        1440 * 2,
-        1441 * 2,
-        1442 * 2,
-        1443 * 2,
-        1444 * 2,
-        1445 * 2,
-        1446 * 2,
-        1448 * 2,
-        1449 * 2,
-        1450 * 2,
-        1451 * 2,
-        1452 * 2,
-        1453 * 2,
-        1454 * 2,
-        1455 * 2,
-        1456 * 2,
-        1457 * 2,
-        1458 * 2
-    },
-    {
-        1459 * 2,
-        1469 * 2,
-        1470 * 2,
-        1471 * 2,
-        1472 * 2,
-        1473 * 2,
-        1475 * 2,
-        1476 * 2,
-        1477 * 2,
-        1478 * 2,
-        1479 * 2,
-        1480 * 2,
-        1481 * 2,
-        1482 * 2,
-        1483 * 2,
-        1484 * 2,
-        1485 * 2,
-        1486 * 2,
-        1487 * 2,
-        1489 * 2,
-        1492 * 2,
-        1495 * 2,
-        1497 * 2,
-        1499 * 2,
-        1501 * 2,
-        1504 * 2,
-        1506 * 2,
-        1508 * 2,
-        1510 * 2,
-        1513 * 2,
-        1515 * 2,
-        1517 * 2,
-        1520 * 2,
-        1522 * 2,
-        1524 * 2,
-        1526 * 2,
-        1528 * 2,
-        1530 * 2,
-        1532 * 2,
-        1534 * 2,
-        1536 * 2,
-        1538 * 2,
-        1540 * 2,
-        1542 * 2,
-        1544 * 2,
-        1546 * 2,
-        1548 * 2,
-        1550 * 2,
-        1552 * 2,
-        1554 * 2,
-        1556 * 2,
-        1558 * 2,
-        1560 * 2,
-        1562 * 2,
-        1564 * 2,
-        1566 * 2,
-        1568 * 2,
-        1570 * 2,
-        1574 * 2,
-        1576 * 2,
-        1578 * 2,
-        1580 * 2,
-        1582 * 2,
-        1584 * 2,
-        1586 * 2,
-        1588 * 2,
-        1590 * 2,
-        1592 * 2,
-        1594 * 2,
-        1596 * 2,
-        1598 * 2,
-        1600 * 2,
-        1602 * 2,
-        1604 * 2,
-        1606 * 2,
-        1608 * 2,
-        1610 * 2,
-        1612 * 2,
-        1614 * 2,
-        1616 * 2,
-        1618 * 2,
-        1620 * 2,
-        1622 * 2,
-        1624 * 2,
-        1626 * 2,
-        1628 * 2,
-        1630 * 2,
-        1632 * 2,
-        1634 * 2,
-        1636 * 2,
-        1638 * 2,
-        1640 * 2,
-        1642 * 2,
-        1644 * 2,
-        1646 * 2,
-        1648 * 2,
-        1650 * 2,
-        1652 * 2,
-        1654 * 2,
-        1656 * 2,
-        1658 * 2,
-        1660 * 2,
-        1662 * 2,
-        1664 * 2,
-        1666 * 2,
-        1668 * 2,
-        1670 * 2,
-        1672 * 2,
-        1674 * 2,
-        1676 * 2,
-        1678 * 2,
-        1680 * 2,
-        1682 * 2,
-        1684 * 2,
-        1686 * 2,
-        1688 * 2,
-        1690 * 2,
-        1692 * 2,
-        1694 * 2,
-        1696 * 2,
-        1698 * 2,
-        1700 * 2,
-        1702 * 2,
-        1704 * 2,
-        1706 * 2,
-        1708 * 2,
-        1710 * 2,
-        1712 * 2,
-        1714 * 2,
-        1716 * 2,
-        1718 * 2,
-        1720 * 2,
-        1722 * 2,
-        1724 * 2,
-        1726 * 2,
-        1728 * 2,
-        1730 * 2,
-        1732 * 2,
-        1734 * 2,
-        1736 * 2,
-        1738 * 2,
-        1740 * 2,
-        1742 * 2,
-        1744 * 2,
-        1746 * 2,
-        1748 * 2,
-        1750 * 2,
-        1752 * 2,
-        1754 * 2,
-        1756 * 2,
-        1758 * 2,
-        1760 * 2,
-        1762 * 2,
-        1764 * 2,
-        1766 * 2,
-        1768 * 2
-    },
-    {
-        1770 * 2,
-        1774 * 2
-    },
-    {
-        1775 * 2,
-        1782 * 2,
-        1783 * 2,
-        1784 * 2,
-        1785 * 2,
-        1786 * 2,
-        1787 * 2,
-        1788 * 2,
-        1790 * 2,
-        1791 * 2,
-        1794 * 2,
-        1796 * 2,
-        1798 * 2,
-        1800 * 2,
-        1802 * 2,
-        1804 * 2,
-        1806 * 2,
-        1808 * 2,
-        1810 * 2
-    },
-    {
-        1812 * 2,
-        1823 * 2,
-        1824 * 2,
-        1825 * 2,
-        1826 * 2,
-        1827 * 2,
-        1828 * 2,
-        1829 * 2,
-        1830 * 2,
-        1831 * 2,
-        1832 * 2
-    },
-    {
-        1835 * 2,
-        1837 * 2,
-        1839 * 2,
-        1840 * 2,
-        1842 * 2,
-        1844 * 2,
-        1846 * 2,
-        1848 * 2,
-        1850 * 2,
-        1852 * 2,
-        1854 * 2,
-        1856 * 2
-    },
-    {
-        1858 * 2,
-        1864 * 2,
-        1865 * 2,
-        1866 * 2
-    },
-    {
-        1867 * 2,
-        1880 * 2,
-        1881 * 2,
-        1882 * 2,
-        1884 * 2,
-        1885 * 2,
-        1886 * 2,
-        1887 * 2,
-        1888 * 2,
-        1889 * 2,
-        1890 * 2,
-        1891 * 2,
-        1892 * 2,
-        1893 * 2,
-        1896 * 2,
-        1898 * 2
-    },
-    {
-        1900 * 2,
-        1913 * 2,
-        1914 * 2,
-        1915 * 2,
-        1916 * 2,
-        1917 * 2,
-        1918 * 2,
-        1920 * 2,
-        1921 * 2,
-        1922 * 2,
-        1923 * 2,
-        1924 * 2,
-        1925 * 2,
-        1926 * 2,
-        1929 * 2,
-        1931 * 2
-    },
-    {
-        1933 * 2,
-        1946 * 2,
-        1947 * 2,
-        1948 * 2,
-        1950 * 2,
-        1951 * 2,
-        1952 * 2,
-        1953 * 2,
-        1954 * 2,
-        1955 * 2,
-        1956 * 2,
-        1957 * 2,
-        1958 * 2,
-        1959 * 2,
-        1962 * 2,
-        1964 * 2
-    },
-    {
-        1966 * 2,
-        1997 * 2,
-        1998 * 2,
-        1999 * 2,
-        2000 * 2,
-        2001 * 2,
-        2002 * 2,
-        2003 * 2,
-        2004 * 2,
-        2006 * 2,
-        2008 * 2,
-        2009 * 2,
-        2010 * 2,
-        2011 * 2,
-        2012 * 2,
-        2013 * 2,
-        2014 * 2,
-        2015 * 2,
-        2016 * 2,
-        2017 * 2,
-        2018 * 2,
-        2019 * 2,
-        2020 * 2,
-        2021 * 2,
-        2022 * 2,
-        2023 * 2,
-        2024 * 2,
-        2025 * 2,
-        2026 * 2,
-        2027 * 2,
-        2028 * 2,
-        2029 * 2,
-        2030 * 2,
-        2033 * 2,
-        2035 * 2,
-        2037 * 2,
-        2039 * 2,
-        2042 * 2,
-        2044 * 2,
-        2046 * 2,
-        2048 * 2
-    },
-    {
-        2050 * 2,
-        2052 * 2,
-        2053 * 2
-    },
-    {
-        2055 * 2,
-        2070 * 2,
-        2071 * 2,
-        2072 * 2,
-        2073 * 2,
-        2074 * 2,
-        2075 * 2,
-        2076 * 2,
-        2077 * 2,
-        2078 * 2,
-        2079 * 2,
-        2080 * 2,
-        2081 * 2,
-        2082 * 2,
-        2083 * 2
-    },
-    {
-        2086 * 2,
-        2094 * 2,
-        2095 * 2,
-        2096 * 2,
-        2097 * 2,
-        2098 * 2,
-        2099 * 2,
-        2100 * 2,
-        2101 * 2,
-        2102 * 2
-    },
-    {
-        2105 * 2,
-        2113 * 2,
-        2114 * 2,
-        2115 * 2,
-        2116 * 2,
-        2117 * 2,
-        2118 * 2,
-        2119 * 2,
-        2120 * 2,
-        2121 * 2,
-        2124 * 2
-    },
-    {
-        2126 * 2,
-        2134 * 2,
-        2135 * 2,
-        2136 * 2,
-        2137 * 2,
-        2138 * 2,
-        2139 * 2,
-        2140 * 2,
-        2141 * 2,
-        2142 * 2,
-        2143 * 2,
-        2146 * 2,
-        2149 * 2
-    },
-    {
-        2151 * 2,
-        2159 * 2,
-        2160 * 2,
-        2161 * 2,
-        2162 * 2,
-        2163 * 2,
-        2164 * 2,
-        2165 * 2,
-        2166 * 2,
-        2167 * 2
-    },
-    {
-        2170 * 2,
-        2177 * 2,
-        2178 * 2,
-        2179 * 2,
-        2180 * 2,
-        2181 * 2,
-        2182 * 2,
-        2183 * 2,
-        2184 * 2,
-        2187 * 2
-    },
-    {
-        2189 * 2,
-        2204 * 2,
-        2205 * 2,
-        2206 * 2,
-        2207 * 2,
-        2208 * 2,
-        2209 * 2,
-        2210 * 2,
-        2211 * 2,
-        2212 * 2,
-        2213 * 2,
-        2214 * 2,
-        2215 * 2,
-        2216 * 2,
-        2217 * 2
-    },
-    {
-        2220 * 2,
-        2223 * 2,
-        2224 * 2
-    },
-    {
-        2225 * 2,
-        2228 * 2,
-        2229 * 2,
-        2230 * 2
-    },
-    {
-        2232 * 2,
-        2235 * 2,
-        2236 * 2,
-        2237 * 2,
-        2238 * 2,
-        2241 * 2
-    },
-    {
-        2243 * 2,
-        2245 * 2,
-        2246 * 2
-    },
-    {
-        2248 * 2,
-        2263 * 2,
-        2264 * 2,
-        2265 * 2,
-        2266 * 2,
-        2267 * 2,
-        2268 * 2,
-        2269 * 2,
-        2270 * 2,
-        2271 * 2,
-        2272 * 2,
-        2273 * 2,
-        2274 * 2,
-        2275 * 2,
-        2276 * 2
-    },
-    {
-        2279 * 2,
-        2286 * 2,
-        2287 * 2,
-        2288 * 2,
-        2289 * 2,
-        2290 * 2,
-        2291 * 2,
-        2292 * 2,
-        2293 * 2
-    },
-    {
-        2296 * 2,
-        2319 * 2,
-        2320 * 2,
-        2321 * 2,
-        2322 * 2,
-        2323 * 2,
-        2324 * 2,
-        2325 * 2,
-        2326 * 2,
-        2327 * 2,
-        2328 * 2,
-        2329 * 2,
-        2330 * 2,
-        2331 * 2,
-        2332 * 2,
-        2333 * 2,
-        2334 * 2,
-        2335 * 2,
-        2336 * 2,
-        2337 * 2,
-        2338 * 2,
-        2339 * 2,
-        2340 * 2,
-        2343 * 2,
-        2345 * 2,
-        2347 * 2,
-        2350 * 2,
-        2352 * 2,
-        2354 * 2,
-        2356 * 2
-    },
-    {
-        2358 * 2,
-        2385 * 2,
-        2386 * 2,
-        2387 * 2,
-        2388 * 2,
-        2389 * 2,
-        2390 * 2,
-        2391 * 2,
-        2392 * 2,
-        2393 * 2,
-        2394 * 2,
-        2395 * 2,
-        2396 * 2,
-        2397 * 2,
-        2398 * 2,
-        2399 * 2,
-        2400 * 2,
-        2401 * 2,
-        2402 * 2,
-        2403 * 2,
-        2404 * 2,
-        2405 * 2,
-        2406 * 2,
-        2407 * 2,
-        2408 * 2,
-        2409 * 2,
-        2410 * 2,
-        2413 * 2,
-        2415 * 2,
-        2417 * 2,
-        2420 * 2,
-        2422 * 2,
-        2424 * 2,
-        2426 * 2
-    },
-    {
-        2428 * 2,
-        2436 * 2,
-        2437 * 2,
-        2438 * 2,
-        2439 * 2,
-        2440 * 2,
-        2441 * 2
-    },
-    {
-        2442 * 2,
-        2483 * 2,
-        2484 * 2,
-        2485 * 2,
-        2486 * 2,
-        2487 * 2,
-        2488 * 2,
-        2489 * 2,
-        2490 * 2,
-        2491 * 2,
-        2492 * 2,
-        2493 * 2,
-        2494 * 2,
-        2495 * 2,
-        2496 * 2,
-        2497 * 2,
-        2498 * 2,
-        2499 * 2,
-        2500 * 2,
-        2501 * 2,
-        2502 * 2,
-        2503 * 2,
-        2504 * 2,
-        2505 * 2,
-        2506 * 2,
-        2507 * 2,
-        2508 * 2,
-        2509 * 2
-    },
-    {
-        2510 * 2,
-        2551 * 2,
-        2552 * 2,
-        2553 * 2,
-        2554 * 2,
-        2555 * 2,
-        2556 * 2,
-        2557 * 2,
-        2558 * 2,
-        2559 * 2,
-        2560 * 2,
-        2561 * 2,
-        2562 * 2,
-        2563 * 2,
-        2564 * 2,
-        2565 * 2,
-        2566 * 2,
-        2567 * 2,
-        2568 * 2,
-        2569 * 2,
-        2570 * 2,
-        2571 * 2,
-        2572 * 2,
-        2573 * 2,
-        2574 * 2,
-        2575 * 2,
-        2576 * 2,
-        2577 * 2
-    },
-    {
-        2578 * 2,
-        2588 * 2,
-        2589 * 2,
-        2591 * 2,
-        2592 * 2,
-        2593 * 2,
-        2594 * 2,
-        2595 * 2,
-        2596 * 2,
-        2597 * 2,
-        2598 * 2,
-        2599 * 2,
-        2600 * 2,
-        2602 * 2,
-        2605 * 2
-    },
-    {
-        2607 * 2,
-        2634 * 2,
-        2635 * 2,
-        2636 * 2,
-        2637 * 2,
-        2638 * 2,
-        2639 * 2,
-        2640 * 2,
-        2641 * 2,
-        2642 * 2,
-        2643 * 2,
-        2644 * 2,
-        2645 * 2,
-        2646 * 2,
-        2647 * 2,
-        2648 * 2,
-        2649 * 2,
-        2650 * 2,
-        2651 * 2,
-        2652 * 2,
-        2653 * 2,
-        2654 * 2,
-        2655 * 2,
-        2656 * 2,
-        2657 * 2,
-        2658 * 2,
-        2659 * 2,
-        2662 * 2,
-        2664 * 2,
-        2666 * 2,
-        2669 * 2,
-        2671 * 2,
-        2673 * 2,
-        2675 * 2
-    },
-    {
-        2677 * 2,
-        2692 * 2,
-        2693 * 2,
-        2694 * 2,
-        2695 * 2,
-        2696 * 2,
-        2697 * 2,
-        2698 * 2,
-        2700 * 2,
-        2701 * 2,
-        2702 * 2,
-        2703 * 2,
-        2704 * 2,
-        2705 * 2,
-        2706 * 2,
-        2707 * 2,
-        2708 * 2,
-        2709 * 2,
-        2712 * 2,
-        2714 * 2
-    },
-    {
-        2716 * 2,
-        2732 * 2,
-        2733 * 2,
-        2734 * 2,
-        2735 * 2,
-        2736 * 2,
-        2737 * 2,
-        2738 * 2,
-        2739 * 2,
-        2740 * 2,
-        2741 * 2,
-        2742 * 2,
-        2743 * 2,
-        2744 * 2,
-        2745 * 2,
-        2746 * 2
-    },
-    {
-        2749 * 2,
-        2751 * 2
-    },
-    {
-        2752 * 2,
-        2793 * 2,
-        2794 * 2,
-        2795 * 2,
-        2796 * 2,
-        2797 * 2,
-        2798 * 2,
-        2799 * 2,
-        2800 * 2,
-        2801 * 2,
-        2802 * 2,
-        2803 * 2,
-        2804 * 2,
-        2805 * 2,
-        2806 * 2,
-        2807 * 2,
-        2808 * 2,
-        2809 * 2,
-        2810 * 2,
-        2811 * 2,
-        2812 * 2,
-        2813 * 2,
-        2814 * 2,
-        2815 * 2,
-        2816 * 2,
-        2817 * 2,
-        2818 * 2,
-        2819 * 2
-    },
-    {
-        2820 * 2,
-        2822 * 2
-    },
-    {
-        2823 * 2,
-        2829 * 2,
-        2830 * 2,
-        2831 * 2,
-        2832 * 2,
-        2833 * 2
-    },
-    {
-        2834 * 2,
-        2838 * 2,
-        2840 * 2,
-        2841 * 2,
-        2842 * 2,
-        2843 * 2,
-        2845 * 2
-    },
-    {
-        2847 * 2,
-        2870 * 2,
-        2871 * 2,
-        2872 * 2,
-        2873 * 2,
-        2874 * 2,
-        2875 * 2,
-        2876 * 2,
-        2877 * 2,
-        2878 * 2,
-        2879 * 2,
-        2880 * 2,
-        2881 * 2,
-        2882 * 2,
-        2883 * 2,
-        2884 * 2,
-        2885 * 2,
-        2886 * 2,
-        2887 * 2,
-        2888 * 2,
-        2889 * 2,
-        2890 * 2,
-        2891 * 2,
-        2894 * 2,
-        2896 * 2,
-        2898 * 2,
-        2901 * 2,
-        2903 * 2,
-        2905 * 2,
-        2907 * 2
-    },
-    {
-        2909 * 2,
-        2931 * 2,
-        2932 * 2,
-        2933 * 2,
-        2934 * 2,
-        2935 * 2,
-        2936 * 2,
-        2937 * 2,
-        2938 * 2,
-        2939 * 2,
-        2940 * 2,
-        2941 * 2,
-        2942 * 2,
-        2943 * 2,
-        2944 * 2,
-        2945 * 2,
-        2946 * 2,
-        2947 * 2,
-        2948 * 2,
-        2949 * 2,
-        2950 * 2,
-        2951 * 2,
-        2953 * 2,
-        2956 * 2,
-        2958 * 2,
-        2961 * 2,
-        2963 * 2,
-        2965 * 2,
-        2967 * 2
-    },
-    {
-        2969 * 2,
-        2975 * 2,
-        2976 * 2,
-        2977 * 2,
-        2978 * 2,
-        2979 * 2
-    },
-    {
-        2981 * 2,
-        3002 * 2,
-        3003 * 2,
-        3004 * 2,
-        3005 * 2,
-        3006 * 2,
-        3007 * 2,
-        3008 * 2,
-        3009 * 2,
-        3010 * 2,
-        3011 * 2,
-        3012 * 2,
-        3013 * 2,
-        3014 * 2,
-        3015 * 2,
-        3016 * 2,
-        3017 * 2,
-        3018 * 2,
-        3019 * 2,
-        3020 * 2,
-        3021 * 2,
-        3022 * 2,
-        3025 * 2
-    },
-    {
-        3027 * 2,
-        3035 * 2,
-        3036 * 2,
-        3037 * 2,
-        3038 * 2,
-        3039 * 2,
-        3040 * 2,
-        3041 * 2
-    },
-    {
-        3043 * 2,
-        3056 * 2,
-        3057 * 2,
-        3058 * 2,
-        3059 * 2,
-        3060 * 2,
-        3061 * 2,
-        3062 * 2,
-        3063 * 2,
-        3064 * 2,
-        3065 * 2,
-        3066 * 2,
-        3067 * 2
-    },
-    {
-        3069 * 2,
-        3085 * 2,
-        3086 * 2,
-        3087 * 2,
-        3088 * 2,
-        3089 * 2,
-        3090 * 2,
-        3091 * 2,
-        3092 * 2,
-        3093 * 2,
-        3094 * 2,
-        3095 * 2,
-        3096 * 2,
-        3097 * 2,
-        3098 * 2,
-        3099 * 2
-    },
-    {
-        3101 * 2,
-        3141 * 2,
-        3142 * 2,
-        3143 * 2,
-        3144 * 2,
-        3145 * 2,
-        3146 * 2,
-        3147 * 2,
-        3148 * 2,
-        3149 * 2,
-        3150 * 2,
-        3151 * 2,
-        3152 * 2,
-        3153 * 2,
-        3154 * 2,
-        3155 * 2,
-        3156 * 2,
-        3157 * 2,
-        3158 * 2,
-        3159 * 2,
-        3160 * 2,
-        3161 * 2,
-        3162 * 2,
-        3163 * 2,
-        3164 * 2,
-        3165 * 2,
-        3166 * 2
-    },
-    {
-        3167 * 2,
-        3189 * 2,
-        3190 * 2,
-        3191 * 2,
-        3192 * 2,
-        3193 * 2,
-        3194 * 2,
-        3195 * 2,
-        3196 * 2,
-        3197 * 2,
-        3198 * 2,
-        3199 * 2,
-        3200 * 2,
-        3201 * 2,
-        3202 * 2,
-        3203 * 2,
-        3204 * 2,
-        3205 * 2,
-        3206 * 2,
-        3207 * 2,
-        3208 * 2,
-        3209 * 2,
-        3212 * 2,
-        3214 * 2,
-        3216 * 2,
-        3219 * 2,
-        3221 * 2,
-        3223 * 2,
-        3225 * 2
-    },
-    {
-        3227 * 2,
-        3249 * 2,
-        3250 * 2,
-        3251 * 2,
-        3252 * 2,
-        3253 * 2,
-        3254 * 2,
-        3255 * 2,
-        3256 * 2,
-        3257 * 2,
-        3258 * 2,
-        3259 * 2,
-        3260 * 2,
-        3261 * 2,
-        3262 * 2,
-        3263 * 2,
-        3264 * 2,
-        3265 * 2,
-        3266 * 2,
-        3267 * 2,
-        3268 * 2,
-        3269 * 2,
-        3272 * 2,
-        3274 * 2,
-        3276 * 2,
-        3279 * 2,
-        3281 * 2,
-        3283 * 2,
-        3285 * 2
-    },
-    {
-        3287 * 2,
-        3309 * 2,
-        3310 * 2,
-        3311 * 2,
-        3312 * 2,
-        3313 * 2,
-        3314 * 2,
-        3315 * 2,
-        3316 * 2,
-        3317 * 2,
-        3318 * 2,
-        3319 * 2,
-        3320 * 2,
-        3321 * 2,
-        3322 * 2,
-        3323 * 2,
-        3324 * 2,
-        3325 * 2,
-        3326 * 2,
-        3327 * 2,
-        3328 * 2,
-        3329 * 2,
-        3332 * 2,
-        3334 * 2,
-        3336 * 2,
-        3339 * 2,
-        3341 * 2,
-        3343 * 2,
-        3345 * 2
-    },
-    {
-        3347 * 2,
-        3352 * 2,
-        3353 * 2,
-        3354 * 2
-    },
-    {
-        3355 * 2,
-        3379 * 2,
-        3380 * 2,
-        3381 * 2,
-        3382 * 2,
-        3383 * 2,
-        3384 * 2,
-        3385 * 2,
-        3386 * 2,
-        3387 * 2,
-        3388 * 2,
-        3389 * 2,
-        3390 * 2,
-        3391 * 2,
-        3392 * 2,
-        3393 * 2,
-        3394 * 2,
-        3395 * 2,
-        3396 * 2,
-        3397 * 2,
-        3398 * 2,
-        3399 * 2,
-        3400 * 2,
-        3401 * 2,
-        3404 * 2,
-        3406 * 2,
-        3408 * 2,
-        3411 * 2,
-        3413 * 2,
-        3415 * 2,
-        3417 * 2
-    },
-    {
-        3419 * 2,
-        3437 * 2,
-        3438 * 2,
-        3439 * 2,
-        3440 * 2,
-        3441 * 2,
-        3442 * 2,
-        3443 * 2,
-        3444 * 2,
-        3445 * 2,
-        3446 * 2,
-        3447 * 2,
-        3448 * 2,
-        3449 * 2,
-        3450 * 2,
-        3451 * 2,
-        3452 * 2,
-        3453 * 2,
-        3454 * 2,
-        3457 * 2
-    },
-    {
-        3459 * 2,
-        3461 * 2
-    },
-    {
-        3462 * 2,
-        3464 * 2
-    },
-    {
-        3465 * 2,
-        3468 * 2,
-        3469 * 2
-    },
-    {
-        3470 * 2,
-        3493 * 2,
-        3494 * 2,
-        3495 * 2,
-        3496 * 2,
-        3497 * 2,
-        3498 * 2,
-        3499 * 2,
-        3500 * 2,
-        3501 * 2,
-        3502 * 2,
-        3503 * 2,
-        3504 * 2,
-        3505 * 2,
-        3506 * 2,
-        3507 * 2,
-        3508 * 2,
-        3509 * 2,
-        3510 * 2,
-        3511 * 2,
-        3512 * 2,
-        3513 * 2,
-        3514 * 2,
-        3516 * 2,
-        3519 * 2,
-        3521 * 2,
-        3524 * 2,
-        3526 * 2,
-        3528 * 2,
-        3530 * 2
-    },
-    {
-        3532 * 2,
-        3535 * 2,
-        3536 * 2
-    },
-    {
-        3537 * 2,
-        3541 * 2,
-        3542 * 2
-    },
-    {
-        3543 * 2,
-        3571 * 2,
-        3572 * 2,
-        3573 * 2,
-        3574 * 2,
-        3575 * 2,
-        3576 * 2,
-        3577 * 2,
-        3578 * 2,
-        3579 * 2,
-        3580 * 2,
-        3581 * 2,
-        3582 * 2,
-        3583 * 2,
-        3584 * 2,
-        3585 * 2,
-        3586 * 2,
-        3587 * 2,
-        3588 * 2,
-        3589 * 2,
-        3590 * 2,
-        3591 * 2,
-        3592 * 2,
-        3593 * 2,
-        3594 * 2,
-        3595 * 2,
-        3596 * 2,
-        3597 * 2,
-        3600 * 2,
-        3602 * 2,
-        3604 * 2,
-        3607 * 2,
-        3609 * 2,
-        3611 * 2,
-        3613 * 2
-    },
-    {
-        3615 * 2,
-        3638 * 2,
-        3639 * 2,
-        3640 * 2,
-        3641 * 2,
-        3642 * 2,
-        3643 * 2,
-        3644 * 2,
-        3645 * 2,
-        3646 * 2,
-        3647 * 2,
-        3648 * 2,
-        3649 * 2,
-        3650 * 2,
-        3651 * 2,
-        3652 * 2,
-        3653 * 2,
-        3654 * 2,
-        3655 * 2,
-        3656 * 2,
-        3657 * 2,
-        3658 * 2,
-        3659 * 2,
-        3662 * 2,
-        3664 * 2,
-        3666 * 2,
-        3669 * 2,
-        3671 * 2,
-        3673 * 2,
-        3675 * 2
-    },
-    {
-        3677 * 2,
-        3704 * 2,
-        3705 * 2,
-        3706 * 2,
-        3707 * 2,
-        3708 * 2,
-        3709 * 2,
-        3710 * 2,
-        3711 * 2,
-        3712 * 2,
-        3713 * 2,
-        3714 * 2,
-        3715 * 2,
-        3716 * 2,
-        3717 * 2,
-        3718 * 2,
-        3719 * 2,
-        3720 * 2,
-        3721 * 2,
-        3722 * 2,
-        3723 * 2,
-        3724 * 2,
-        3725 * 2,
-        3726 * 2,
-        3727 * 2,
-        3728 * 2,
-        3729 * 2,
-        3732 * 2,
-        3734 * 2,
-        3736 * 2,
-        3739 * 2,
-        3741 * 2,
-        3743 * 2,
-        3745 * 2
-    },
-    {
-        3747 * 2,
-        3771 * 2,
-        3772 * 2,
-        3773 * 2,
-        3774 * 2,
-        3775 * 2,
-        3776 * 2,
-        3777 * 2,
-        3778 * 2,
-        3779 * 2,
-        3780 * 2,
-        3781 * 2,
-        3782 * 2,
-        3783 * 2,
-        3784 * 2,
-        3785 * 2,
-        3786 * 2,
-        3787 * 2,
-        3788 * 2,
-        3789 * 2,
-        3790 * 2,
-        3791 * 2,
-        3792 * 2,
-        3793 * 2,
-        3795 * 2,
-        3798 * 2,
-        3800 * 2,
-        3803 * 2,
-        3805 * 2,
-        3807 * 2,
-        3809 * 2
-    },
-    {
-        3811 * 2,
-        3835 * 2,
-        3836 * 2,
-        3837 * 2,
-        3838 * 2,
-        3839 * 2,
-        3840 * 2,
-        3841 * 2,
-        3842 * 2,
-        3843 * 2,
-        3844 * 2,
-        3845 * 2,
-        3846 * 2,
-        3847 * 2,
-        3848 * 2,
-        3849 * 2,
-        3850 * 2,
-        3851 * 2,
-        3852 * 2,
-        3853 * 2,
-        3854 * 2,
-        3855 * 2,
-        3856 * 2,
-        3857 * 2,
-        3860 * 2,
-        3862 * 2,
-        3864 * 2,
-        3867 * 2,
-        3869 * 2,
-        3871 * 2,
-        3873 * 2
-    },
-    {
-        3875 * 2,
-        3878 * 2,
-        3879 * 2,
-        3880 * 2,
-        3882 * 2,
-        3884 * 2,
-        3886 * 2,
-        3888 * 2,
-        3890 * 2,
-        3892 * 2,
-        3894 * 2,
-        3896 * 2,
-        3898 * 2,
-        3900 * 2,
-        3902 * 2,
-        3904 * 2,
-        3906 * 2
-    },
-    {
-        3908 * 2,
-        3915 * 2,
-        3916 * 2,
-        3917 * 2,
-        3918 * 2,
-        3919 * 2
-    },
-    {
-        3920 * 2,
-        3929 * 2,
-        3930 * 2,
-        3931 * 2,
-        3932 * 2,
-        3933 * 2,
-        3934 * 2,
-        3935 * 2,
-        3936 * 2,
-        3937 * 2
-    },
-    {
-        3940 * 2,
-        3946 * 2,
-        3947 * 2,
-        3948 * 2,
-        3949 * 2
-    },
-    {
-        3950 * 2,
-        3952 * 2,
-        3953 * 2,
-        3955 * 2,
-        3957 * 2,
-        3959 * 2,
-        3961 * 2,
-        3963 * 2,
-        3965 * 2,
-        3967 * 2,
-        3969 * 2
-    },
-    {
-        3971 * 2,
-        3981 * 2,
-        3982 * 2,
-        3983 * 2,
-        3984 * 2,
-        3985 * 2,
-        3986 * 2,
-        3987 * 2,
-        3988 * 2,
-        3989 * 2,
-        3990 * 2,
-        3991 * 2
-    },
-    {
-        3994 * 2,
-        3999 * 2,
-        4000 * 2,
-        4001 * 2,
-        4002 * 2
-    }
+        0,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256,
+        256
 };
 
-/* DFA transition chars */
-UNICC_STATIC int _dfa_chars[ 4003 * 2 ] =
+/* Character class map */
+UNICC_STATIC unsigned char _char_map[ 512 ] =
 {
-        91, 91,
-        65, 90,
-        95, 95,
-        97, 122,
-        64, 64,
-        47, 47,
-        37, 37,
-        35, 35,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        91, 91,
-        109, 109,
-        119, 119,
-        102, 102,
-        114, 114,
-        110, 110,
-        100, 100,
-        108, 108,
-        99, 99,
-        101, 101,
-        115, 115,
-        111, 111,
-        124, 124,
-        103, 103,
-        112, 112,
-        65, 90,
-        95, 95,
-        97, 98,
-        104, 107,
-        113, 113,
-        116, 118,
-        120, 122,
-        64, 64,
-        63, 63,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        47, 47,
-        46, 46,
-        45, 45,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        37, 37,
-        36, 36,
-        35, 35,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        104, 104,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        105, 105,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        101, 101,
-        97, 97,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        120, 120,
-        -1, -1,
-        120, 120,
-        112, 112,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        102, 102,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        114, 114,
-        99, 99,
-        -1, -1,
-        120, 120,
-        102, 102,
-        -1, -1,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        111, 111,
-        101, 101,
-        -1, -1,
-        98, 98,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        104, 104,
-        -1, -1,
-        97, 97,
-        45, 45,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        99, 99,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        109, 109,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        118, 118,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        118, 118,
-        101, 101,
-        97, 97,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        109, 109,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        120, 120,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        118, 118,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        124, 124,
-        92, 92,
-        65, 90,
-        95, 95,
-        97, 122,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        35, 35,
-        37, 37,
-        64, 64,
-        63, 63,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        124, 124,
-        92, 92,
-        65, 90,
-        95, 95,
-        97, 122,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        35, 35,
-        37, 37,
-        64, 64,
-        63, 63,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        0, 0,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        91, 91,
-        65, 90,
-        95, 95,
-        97, 122,
-        64, 64,
-        37, 37,
-        35, 35,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        -1, -1,
-        10, 10,
-        -1, -1,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        109, 109,
-        108, 108,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        109, 109,
-        108, 108,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        60, 60,
-        58, 58,
-        61, 61,
-        59, 59,
-        64, 64,
-        63, 63,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        47, 47,
-        46, 46,
-        45, 45,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        35, 35,
-        37, 37,
-        91, 91,
-        65, 90,
-        95, 95,
-        97, 122,
-        124, 124,
-        64, 64,
-        61, 61,
-        59, 59,
-        47, 47,
-        41, 41,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        59, 59,
-        -1, -1,
-        -1, -1,
-        119, 119,
-        114, 114,
-        112, 112,
-        110, 110,
-        108, 108,
-        103, 103,
-        102, 102,
-        101, 101,
-        100, 100,
-        99, 99,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        104, 104,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        105, 105,
-        101, 101,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        120, 120,
-        112, 112,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        114, 114,
-        99, 99,
-        -1, -1,
-        120, 120,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        120, 120,
-        102, 102,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        111, 111,
-        101, 101,
-        -1, -1,
-        98, 98,
-        -1, -1,
-        97, 97,
-        45, 45,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        102, 102,
-        99, 99,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        109, 109,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        118, 118,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        120, 120,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        118, 118,
-        101, 101,
-        97, 97,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        109, 109,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        104, 104,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        118, 118,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        61, 61,
-        65, 90,
-        95, 95,
-        97, 122,
-        60, 60,
-        58, 58,
-        47, 47,
-        45, 45,
-        36, 36,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        60, 60,
-        58, 58,
-        61, 61,
-        48, 57,
-        59, 59,
-        64, 64,
-        63, 63,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        47, 47,
-        46, 46,
-        45, 45,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        124, 124,
-        92, 92,
-        65, 90,
-        95, 95,
-        97, 122,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        35, 35,
-        37, 37,
-        64, 64,
-        63, 63,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        93, 93,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        119, 119,
-        114, 114,
-        112, 112,
-        110, 110,
-        108, 108,
-        102, 102,
-        101, 101,
-        100, 100,
-        99, 99,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        104, 104,
-        -1, -1,
-        105, 105,
-        101, 101,
-        -1, -1,
-        114, 114,
-        99, 99,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        120, 120,
-        112, 112,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        111, 111,
-        101, 101,
-        -1, -1,
-        98, 98,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        120, 120,
-        102, 102,
-        -1, -1,
-        120, 120,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        109, 109,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        118, 118,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        120, 120,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        118, 118,
-        101, 101,
-        97, 97,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        109, 109,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        104, 104,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        32, 32,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        118, 118,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        117, 117,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        105, 105,
-        -1, -1,
-        116, 116,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        115, 115,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        47, 47,
-        39, 39,
-        34, 34,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        108, 108,
-        -1, -1,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        97, 97,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        115, 115,
-        -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
-        39, 39,
-        34, 34,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        91, 91,
-        65, 90,
-        95, 95,
-        97, 122,
-        64, 64,
-        47, 47,
-        37, 37,
-        35, 35,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        33, 33,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
-        61, 61,
-        60, 60,
-        58, 58,
-        47, 47,
-        45, 45,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        60, 60,
-        58, 58,
-        61, 61,
-        47, 47,
-        45, 45,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        61, 61,
-        64, 64,
-        63, 63,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        65, 90,
-        95, 95,
-        97, 122,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        47, 47,
-        46, 46,
-        45, 45,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        -1, -1,
-        93, 93,
-        -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
-        64, 64,
-        60, 60,
-        47, 47,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        47, 47,
-        39, 39,
-        34, 34,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        91, 91,
-        59, 59,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        111, 111,
-        59, 59,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        110, 110,
-        102, 102,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        60, 60,
-        59, 59,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        91, 91,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
-        64, 64,
-        60, 60,
-        47, 47,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        39, 39,
-        34, 34,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        91, 91,
-        59, 59,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        111, 111,
-        59, 59,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        110, 110,
-        102, 102,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        91, 91,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
-        60, 60,
-        47, 47,
-        46, 46,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        59, 59,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        35, 35,
-        37, 37,
-        124, 124,
-        91, 91,
-        61, 61,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        60, 60,
-        59, 59,
-        47, 47,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        63, 63,
-        91, 91,
-        61, 61,
-        35, 35,
-        37, 37,
-        124, 124,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        60, 60,
-        59, 59,
-        47, 47,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        124, 124,
-        59, 59,
-        41, 41,
-        39, 39,
-        34, 34,
-        35, 35,
-        37, 37,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        63, 63,
-        124, 124,
-        64, 64,
-        35, 35,
-        37, 37,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        65, 90,
-        95, 95,
-        97, 122,
-        92, 92,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        0, 0,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        62, 62,
-        60, 60,
-        61, 61,
-        58, 58,
-        59, 59,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        63, 63,
-        124, 124,
-        64, 64,
-        35, 35,
-        37, 37,
-        92, 92,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        0, 0,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        60, 60,
-        58, 58,
-        47, 47,
-        45, 45,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        60, 60,
-        63, 63,
-        91, 91,
-        61, 61,
-        35, 35,
-        37, 37,
-        124, 124,
-        59, 59,
-        58, 58,
-        47, 47,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        61, 61,
-        59, 59,
-        58, 58,
-        47, 47,
-        46, 46,
-        45, 45,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
-        64, 64,
-        60, 60,
-        59, 59,
-        47, 47,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        39, 39,
-        -1, -1,
-        -1, -1,
-        124, 124,
-        35, 35,
-        37, 37,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        65, 90,
-        95, 95,
-        97, 122,
-        92, 92,
-        64, 64,
-        63, 63,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        0, 0,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        40, 40,
-        -1, -1,
-        -1, -1,
-        46, 46,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        61, 61,
-        58, 58,
-        45, 45,
-        -1, -1,
-        61, 61,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        62, 62,
-        -1, -1,
-        124, 124,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        91, 91,
-        35, 35,
-        37, 37,
-        61, 61,
-        60, 60,
-        47, 47,
-        46, 46,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        65, 90,
-        95, 95,
-        97, 122,
-        35, 35,
-        37, 37,
-        124, 124,
-        91, 91,
-        64, 64,
-        61, 61,
-        60, 60,
-        47, 47,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        35, 35,
-        37, 37,
-        91, 91,
-        61, 61,
-        59, 59,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        63, 63,
-        61, 61,
-        59, 59,
-        47, 47,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        35, 35,
-        37, 37,
-        124, 124,
-        91, 91,
-        61, 61,
-        59, 59,
-        41, 41,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        35, 35,
-        37, 37,
-        124, 124,
-        91, 91,
-        61, 61,
-        59, 59,
-        46, 46,
-        41, 41,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        63, 63,
-        61, 61,
-        59, 59,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        124, 124,
-        92, 92,
-        65, 90,
-        95, 95,
-        97, 122,
-        1, 8,
-        11, 12,
-        14, 31,
-        38, 38,
-        44, 45,
-        47, 47,
-        91, 91,
-        93, 94,
-        96, 96,
-        123, 123,
-        125, 65535,
-        35, 35,
-        37, 37,
-        64, 64,
-        63, 63,
-        62, 62,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        48, 57,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        36, 36,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        64, 64,
-        61, 61,
-        60, 60,
-        59, 59,
-        47, 47,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        124, 124,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        91, 91,
-        35, 35,
-        37, 37,
-        61, 61,
-        60, 60,
-        59, 59,
-        47, 47,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        64, 64,
-        61, 61,
-        60, 60,
-        47, 47,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        35, 35,
-        37, 37,
-        61, 61,
-        59, 59,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        61, 61,
-        60, 60,
-        59, 59,
-        47, 47,
-        46, 46,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        35, 35,
-        37, 37,
-        124, 124,
-        91, 91,
-        61, 61,
-        59, 59,
-        47, 47,
-        46, 46,
-        41, 41,
-        40, 40,
-        39, 39,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        41, 41,
-        -1, -1,
-        -1, -1,
-        34, 34,
-        -1, -1,
-        -1, -1,
-        124, 124,
-        59, 59,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        35, 35,
-        37, 37,
-        124, 124,
-        65, 90,
-        95, 95,
-        97, 122,
-        91, 91,
-        64, 64,
-        61, 61,
-        60, 60,
-        59, 59,
-        47, 47,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        124, 124,
-        41, 41,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        59, 59,
-        35, 35,
-        37, 37,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        63, 63,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        47, 47,
-        46, 46,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        64, 64,
-        61, 61,
-        60, 60,
-        59, 59,
-        47, 47,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        65, 90,
-        95, 95,
-        97, 122,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        91, 91,
-        35, 35,
-        37, 37,
-        124, 124,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        63, 63,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        47, 47,
-        43, 43,
-        42, 42,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        124, 124,
-        65, 90,
-        95, 95,
-        97, 122,
-        91, 91,
-        64, 64,
-        61, 61,
-        60, 60,
-        59, 59,
-        58, 58,
-        47, 47,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        35, 35,
-        37, 37,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        91, 91,
-        61, 61,
-        35, 35,
-        37, 37,
-        59, 59,
-        124, 124,
-        64, 64,
-        65, 90,
-        95, 95,
-        97, 122,
-        60, 60,
-        58, 58,
-        47, 47,
-        41, 41,
-        40, 40,
-        39, 39,
-        38, 38,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        42, 42,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        102, 102,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        110, 110,
-        103, 103,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        111, 111,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        45, 45,
-        -1, -1,
-        103, 103,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        121, 121,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        35, 35,
-        37, 37,
-        124, 124,
-        61, 61,
-        59, 59,
-        41, 41,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        35, 35,
-        37, 37,
-        59, 59,
-        47, 47,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        35, 35,
-        37, 37,
-        124, 124,
-        59, 59,
-        41, 41,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        112, 112,
-        -1, -1,
-        -1, -1,
-        114, 114,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        100, 100,
-        -1, -1,
-        110, 110,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        101, 101,
-        -1, -1,
-        99, 99,
-        -1, -1,
-        64, 64,
-        47, 47,
-        39, 39,
-        34, 34,
-        33, 33,
-        32, 32,
-        13, 13,
-        10, 10,
-        9, 9,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        47, 47,
-        42, 42,
-        -1, -1,
-        64, 64,
-        39, 39,
-        34, 34,
-        33, 33,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1,
-        -1, -1
-};
-
-/* DFA transitions */
-UNICC_STATIC int _dfa_trans[ 4003 ] =
-{
-        15,
-         3,
-         3,
-         3,
-         2,
-         13,
-         14,
-         1,
-         4,
-         5,
-         6,
-         7,
-         -1,
-         10,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         8,
-         9,
-         -1,
-         11,
-         -1,
-         12,
-         -1,
-         62,
-         3,
-         61,
-         63,
-         65,
-         130,
-         67,
-         69,
-         71,
-         73,
-         75,
-         77,
-         17,
-         79,
-         81,
-         83,
-         83,
-         83,
-         83,
-         83,
-         83,
-         83,
-         2,
-         16,
-         7,
-         5,
-         13,
-         6,
-         59,
-         8,
-         64,
-         15,
-         14,
-         18,
-         9,
-         12,
-         66,
-         60,
-         4,
-         1,
-         11,
-         10,
-         19,
-         20,
-         21,
-         22,
-         -1,
-         25,
-         -1,
-         -1,
-         68,
-         -1,
-         -1,
-         -1,
-         29,
-         -1,
-         30,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         194,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         226,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         23,
-         24,
-         -1,
-         26,
-         -1,
-         70,
-         -1,
-         27,
-         -1,
-         72,
-         -1,
-         28,
-         -1,
-         74,
-         76,
-         -1,
-         88,
-         -1,
-         80,
-         -1,
-         146,
-         -1,
-         82,
-         84,
-         -1,
-         187,
-         -1,
-         186,
-         -1,
-         91,
-         -1,
-         85,
-         132,
-         -1,
-         92,
-         -1,
-         86,
-         -1,
-         157,
-         -1,
-         31,
-         87,
-         -1,
-         93,
-         -1,
-         131,
-         -1,
-         94,
-         -1,
-         89,
-         90,
-         -1,
-         166,
-         95,
-         -1,
-         -1,
-         134,
-         -1,
-         177,
-         -1,
-         135,
-         -1,
-         32,
-         -1,
-         97,
-         136,
-         -1,
-         243,
-         98,
-         -1,
-         33,
-         -1,
-         216,
-         -1,
-         99,
-         -1,
-         100,
-         148,
-         -1,
-         101,
-         -1,
-         35,
-         -1,
-         105,
-         -1,
-         106,
-         -1,
-         147,
-         196,
-         -1,
-         37,
-         -1,
-         153,
-         -1,
-         138,
-         -1,
-         200,
-         -1,
-         137,
-         -1,
-         158,
-         -1,
-         159,
-         -1,
-         163,
-         -1,
-         109,
-         -1,
-         204,
-         -1,
-         41,
-         -1,
-         150,
-         -1,
-         116,
-         -1,
-         117,
-         -1,
-         43,
-         -1,
-         221,
-         -1,
-         220,
-         -1,
-         45,
-         -1,
-         119,
-         -1,
-         227,
-         -1,
-         161,
-         121,
-         122,
-         -1,
-         49,
-         -1,
-         124,
-         -1,
-         143,
-         -1,
-         51,
-         -1,
-         167,
-         -1,
-         52,
-         -1,
-         214,
-         -1,
-         145,
-         -1,
-         54,
-         -1,
-         58,
-         -1,
-         78,
-         -1,
-         181,
-         -1,
-         96,
-         -1,
-         42,
-         -1,
-         103,
-         -1,
-         160,
-         -1,
-         36,
-         -1,
-         168,
-         -1,
-         112,
-         -1,
-         108,
-         -1,
-         110,
-         -1,
-         113,
-         -1,
-         203,
-         -1,
-         173,
-         -1,
-         155,
-         -1,
-         232,
-         -1,
-         34,
-         -1,
-         133,
-         -1,
-         152,
-         -1,
-         141,
-         -1,
-         118,
-         -1,
-         239,
-         -1,
-         206,
-         -1,
-         111,
-         -1,
-         120,
-         -1,
-         127,
-         -1,
-         183,
-         -1,
-         139,
-         -1,
-         192,
-         -1,
-         114,
-         -1,
-         202,
-         -1,
-         151,
-         -1,
-         213,
-         -1,
-         40,
-         -1,
-         184,
-         -1,
-         195,
-         -1,
-         102,
-         -1,
-         162,
-         -1,
-         217,
-         -1,
-         180,
-         -1,
-         128,
-         -1,
-         44,
-         -1,
-         104,
-         -1,
-         142,
-         -1,
-         129,
-         -1,
-         235,
-         -1,
-         126,
-         -1,
-         149,
-         -1,
-         193,
-         -1,
-         170,
-         -1,
-         175,
-         -1,
-         107,
-         -1,
-         212,
-         -1,
-         242,
-         -1,
-         219,
-         -1,
-         208,
-         -1,
-         172,
-         -1,
-         191,
-         -1,
-         125,
-         -1,
-         169,
-         -1,
-         178,
-         -1,
-         140,
-         -1,
-         237,
-         -1,
-         182,
-         -1,
-         224,
-         -1,
-         164,
-         -1,
-         185,
-         -1,
-         234,
-         -1,
-         38,
-         -1,
-         190,
-         -1,
-         39,
-         -1,
-         179,
-         -1,
-         171,
-         -1,
-         53,
-         -1,
-         115,
-         -1,
-         156,
-         -1,
-         210,
-         -1,
-         55,
-         -1,
-         197,
-         -1,
-         57,
-         -1,
-         154,
-         -1,
-         174,
-         -1,
-         231,
-         -1,
-         205,
-         -1,
-         201,
-         -1,
-         218,
-         -1,
-         198,
-         -1,
-         46,
-         -1,
-         207,
-         -1,
-         211,
-         -1,
-         228,
-         -1,
-         47,
-         -1,
-         209,
-         -1,
-         48,
-         -1,
-         189,
-         -1,
-         199,
-         -1,
-         188,
-         -1,
-         123,
-         -1,
-         176,
+        0,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        2,
+        3,
+        1,
+        1,
+        4,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        5,
+        6,
+        7,
+        8,
+        9,
+        10,
+        11,
+        12,
+        13,
+        14,
+        15,
+        16,
+        1,
+        17,
+        18,
+        19,
+        20,
+        20,
+        20,
+        20,
+        20,
+        20,
+        20,
+        20,
+        20,
+        20,
+        21,
+        22,
+        23,
+        24,
+        25,
+        26,
+        27,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        28,
+        29,
+        30,
+        31,
+        1,
+        28,
+        1,
+        32,
+        33,
+        34,
+        35,
+        36,
+        37,
+        38,
+        39,
+        40,
+        28,
+        28,
+        41,
+        42,
+        43,
+        44,
+        45,
+        28,
+        46,
+        47,
+        48,
+        49,
+        50,
+        51,
+        52,
+        53,
+        28,
+        1,
+        54,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1
+};
+
+/* DFA index table; Offset, number of ranges and dense row of every state */
+UNICC_STATIC short _dfa_idx[ 75 ][ 260 ][ 3 ] =
+{
+    {
+        { 0, 11, 0 },
+        { 12, 1, -1 },
+        { 14, 0, -1 },
+        { 15, 0, -1 },
+        { 16, 2, -1 },
+        { 19, 1, -1 },
+        { 21, 1, -1 },
+        { 23, 0, -1 },
+        { 24, 0, -1 },
+        { 25, 0, -1 },
+        { 26, 0, -1 },
+        { 27, 0, -1 },
+        { 28, 0, -1 },
+        { 29, 0, -1 },
+        { 30, 0, -1 },
+        { 31, 0, -1 }
+    },
+    {
+        { 32, 34, 55 },
+        { 67, 0, -1 },
+        { 68, 0, -1 },
+        { 69, 0, -1 },
+        { 70, 0, -1 },
+        { 71, 0, -1 },
+        { 72, 0, -1 },
+        { 73, 0, -1 },
+        { 74, 0, -1 },
+        { 75, 0, -1 },
+        { 76, 0, -1 },
+        { 77, 0, -1 },
+        { 78, 0, -1 },
+        { 79, 0, -1 },
+        { 80, 0, -1 },
+        { 81, 0, -1 },
+        { 82, 0, -1 },
+        { 83, 0, -1 },
+        { 84, 0, -1 },
+        { 85, 0, -1 },
+        { 86, 0, -1 },
+        { 87, 0, -1 },
+        { 88, 0, -1 },
+        { 89, 0, -1 },
+        { 90, 0, -1 },
+        { 91, 0, -1 },
+        { 92, 0, -1 },
+        { 93, 0, -1 }
+    },
+    {
+        { 94, 33, 110 },
+        { 128, 0, -1 },
+        { 129, 0, -1 },
+        { 130, 0, -1 },
+        { 131, 0, -1 },
+        { 132, 0, -1 },
+        { 133, 0, -1 },
+        { 134, 0, -1 },
+        { 135, 0, -1 },
+        { 136, 0, -1 },
+        { 137, 0, -1 },
+        { 138, 0, -1 },
+        { 139, 0, -1 },
+        { 140, 0, -1 },
+        { 141, 0, -1 },
+        { 142, 0, -1 },
+        { 143, 1, -1 },
+        { 145, 0, -1 },
+        { 146, 0, -1 },
+        { 147, 0, -1 },
+        { 148, 0, -1 },
+        { 149, 0, -1 },
+        { 150, 0, -1 },
+        { 151, 0, -1 },
+        { 152, 0, -1 },
+        { 153, 0, -1 },
+        { 154, 0, -1 },
+        { 155, 0, -1 }
+    },
+    {
+        { 156, 6, 165 },
+        { 163, 1, -1 },
+        { 165, 0, -1 },
+        { 166, 0, -1 },
+        { 167, 1, -1 },
+        { 169, 1, -1 },
+        { 171, 0, -1 },
+        { 172, 0, -1 },
+        { 173, 0, -1 }
+    },
+    {
+        { 174, 44, 220 },
+        { 219, 1, -1 },
+        { 221, 1, -1 },
+        { 223, 1, -1 },
+        { 225, 1, -1 },
+        { 227, 1, -1 },
+        { 229, 2, -1 },
+        { 232, 2, -1 },
+        { 235, 2, -1 },
+        { 238, 2, -1 },
+        { 241, 1, -1 },
+        { 243, 2, -1 },
+        { 246, 1, -1 },
+        { 248, 1, -1 },
+        { 250, 1, -1 },
+        { 252, 2, -1 },
+        { 255, 1, -1 },
+        { 257, 0, -1 },
+        { 258, 0, -1 },
+        { 259, 0, -1 },
+        { 260, 0, -1 },
+        { 261, 0, -1 },
+        { 262, 0, -1 },
+        { 263, 2, -1 },
+        { 266, 0, -1 },
+        { 267, 1, -1 },
+        { 269, 0, -1 },
+        { 270, 0, -1 },
+        { 271, 0, -1 },
+        { 272, 0, -1 },
+        { 273, 0, -1 },
+        { 274, 1, -1 },
+        { 276, 1, -1 },
+        { 278, 0, -1 },
+        { 279, 1, -1 },
+        { 281, 0, -1 },
+        { 282, 0, -1 },
+        { 283, 0, -1 },
+        { 284, 0, -1 },
+        { 285, 0, -1 },
+        { 286, 0, -1 },
+        { 287, 0, -1 },
+        { 288, 1, -1 },
+        { 290, 1, -1 },
+        { 292, 0, -1 },
+        { 293, 0, -1 },
+        { 294, 0, -1 },
+        { 295, 1, -1 },
+        { 297, 1, -1 },
+        { 299, 1, -1 },
+        { 301, 1, -1 },
+        { 303, 1, -1 },
+        { 305, 1, -1 },
+        { 307, 1, -1 },
+        { 309, 1, -1 },
+        { 311, 2, -1 },
+        { 314, 1, -1 },
+        { 316, 1, -1 },
+        { 318, 1, -1 },
+        { 320, 1, -1 },
+        { 322, 2, -1 },
+        { 325, 1, -1 },
+        { 327, 1, -1 },
+        { 329, 0, -1 },
+        { 330, 0, -1 },
+        { 331, 0, -1 },
+        { 332, 2, -1 },
+        { 335, 0, -1 },
+        { 336, 0, -1 },
+        { 337, 2, -1 },
+        { 340, 1, -1 },
+        { 342, 0, -1 },
+        { 343, 1, -1 },
+        { 345, 1, -1 },
+        { 347, 1, -1 },
+        { 349, 1, -1 },
+        { 351, 1, -1 },
+        { 353, 1, -1 },
+        { 355, 1, -1 },
+        { 357, 1, -1 },
+        { 359, 2, -1 },
+        { 362, 0, -1 },
+        { 363, 1, -1 },
+        { 365, 1, -1 },
+        { 367, 1, -1 },
+        { 369, 1, -1 },
+        { 371, 1, -1 },
+        { 373, 1, -1 },
+        { 375, 1, -1 },
+        { 377, 1, -1 },
+        { 379, 1, -1 },
+        { 381, 1, -1 },
+        { 383, 1, -1 },
+        { 385, 1, -1 },
+        { 387, 1, -1 },
+        { 389, 1, -1 },
+        { 391, 1, -1 },
+        { 393, 1, -1 },
+        { 395, 1, -1 },
+        { 397, 1, -1 },
+        { 399, 1, -1 },
+        { 401, 1, -1 },
+        { 403, 1, -1 },
+        { 405, 1, -1 },
+        { 407, 1, -1 },
+        { 409, 1, -1 },
+        { 411, 1, -1 },
+        { 413, 1, -1 },
+        { 415, 0, -1 },
+        { 416, 1, -1 },
+        { 418, 0, -1 },
+        { 419, 1, -1 },
+        { 421, 0, -1 },
+        { 422, 1, -1 },
+        { 424, 1, -1 },
+        { 426, 1, -1 },
+        { 428, 1, -1 },
+        { 430, 1, -1 },
+        { 432, 1, -1 },
+        { 434, 1, -1 },
+        { 436, 0, -1 },
+        { 437, 1, -1 },
+        { 439, 1, -1 },
+        { 441, 1, -1 },
+        { 443, 1, -1 },
+        { 445, 1, -1 },
+        { 447, 1, -1 },
+        { 449, 1, -1 },
+        { 451, 1, -1 },
+        { 453, 1, -1 },
+        { 455, 1, -1 },
+        { 457, 1, -1 },
+        { 459, 1, -1 },
+        { 461, 1, -1 },
+        { 463, 0, -1 },
+        { 464, 1, -1 },
+        { 466, 1, -1 },
+        { 468, 1, -1 },
+        { 470, 1, -1 },
+        { 472, 1, -1 },
+        { 474, 1, -1 },
+        { 476, 1, -1 },
+        { 478, 0, -1 },
+        { 479, 1, -1 },
+        { 481, 0, -1 },
+        { 482, 1, -1 },
+        { 484, 1, -1 },
+        { 486, 1, -1 },
+        { 488, 1, -1 },
+        { 490, 0, -1 },
+        { 491, 1, -1 },
+        { 493, 1, -1 },
+        { 495, 0, -1 },
+        { 496, 1, -1 },
+        { 498, 1, -1 },
+        { 500, 1, -1 },
+        { 502, 1, -1 },
+        { 504, 1, -1 },
+        { 506, 1, -1 },
+        { 508, 1, -1 },
+        { 510, 1, -1 },
+        { 512, 1, -1 },
+        { 514, 1, -1 },
+        { 516, 1, -1 },
+        { 518, 0, -1 },
+        { 519, 1, -1 },
+        { 521, 0, -1 },
+        { 522, 1, -1 },
+        { 524, 1, -1 },
+        { 526, 1, -1 },
+        { 528, 3, -1 },
+        { 532, 0, -1 },
+        { 533, 1, -1 },
+        { 535, 1, -1 },
+        { 537, 1, -1 },
+        { 539, 1, -1 },
+        { 541, 0, -1 },
+        { 542, 1, -1 },
+        { 544, 1, -1 },
+        { 546, 1, -1 },
+        { 548, 1, -1 },
+        { 550, 1, -1 },
+        { 552, 1, -1 },
+        { 554, 1, -1 },
+        { 556, 1, -1 },
+        { 558, 1, -1 },
+        { 560, 1, -1 },
+        { 562, 1, -1 },
+        { 564, 0, -1 },
+        { 565, 1, -1 },
+        { 567, 1, -1 },
+        { 569, 1, -1 },
+        { 571, 1, -1 },
+        { 573, 1, -1 },
+        { 575, 1, -1 },
+        { 577, 0, -1 },
+        { 578, 1, -1 },
+        { 580, 1, -1 },
+        { 582, 1, -1 },
+        { 584, 1, -1 },
+        { 586, 1, -1 },
+        { 588, 1, -1 },
+        { 590, 1, -1 },
+        { 592, 1, -1 },
+        { 594, 1, -1 },
+        { 596, 0, -1 },
+        { 597, 0, -1 },
+        { 598, 1, -1 },
+        { 600, 1, -1 },
+        { 602, 1, -1 },
+        { 604, 1, -1 },
+        { 606, 1, -1 },
+        { 608, 1, -1 },
+        { 610, 1, -1 },
+        { 612, 1, -1 },
+        { 614, 1, -1 },
+        { 616, 1, -1 },
+        { 618, 1, -1 },
+        { 620, 1, -1 },
+        { 622, 1, -1 },
+        { 624, 1, -1 },
+        { 626, 1, -1 },
+        { 628, 1, -1 },
+        { 630, 1, -1 },
+        { 632, 1, -1 },
+        { 634, 1, -1 },
+        { 636, 1, -1 },
+        { 638, 0, -1 },
+        { 639, 1, -1 },
+        { 641, 1, -1 },
+        { 643, 1, -1 },
+        { 645, 1, -1 },
+        { 647, 1, -1 },
+        { 649, 1, -1 },
+        { 651, 1, -1 },
+        { 653, 1, -1 },
+        { 655, 1, -1 },
+        { 657, 1, -1 },
+        { 659, 1, -1 },
+        { 661, 1, -1 },
+        { 663, 1, -1 },
+        { 665, 0, -1 },
+        { 666, 1, -1 },
+        { 668, 0, -1 },
+        { 669, 1, -1 },
+        { 671, 1, -1 },
+        { 673, 0, -1 },
+        { 674, 1, -1 },
+        { 676, 0, -1 },
+        { 677, 1, -1 },
+        { 679, 1, -1 },
+        { 681, 1, -1 },
+        { 683, 1, -1 },
+        { 685, 1, -1 },
+        { 687, 1, -1 },
+        { 689, 1, -1 },
+        { 691, 1, -1 },
+        { 693, 0, -1 },
+        { 694, 1, -1 },
+        { 696, 0, -1 }
+    },
+    {
+        { 697, 1, 275 },
+        { 699, 0, -1 }
+    },
+    {
+        { 700, 1, 330 },
+        { 702, 1, -1 },
+        { 704, 0, -1 }
+    },
+    {
+        { 705, 7, 385 },
+        { 713, 1, -1 },
+        { 715, 1, -1 },
+        { 717, 2, -1 },
+        { 720, 0, -1 },
+        { 721, 0, -1 },
+        { 722, 0, -1 },
+        { 723, 0, -1 },
+        { 724, 1, -1 },
+        { 726, 1, -1 },
+        { 728, 0, -1 },
+        { 729, 0, -1 },
+        { 730, 1, -1 },
+        { 732, 1, -1 },
+        { 734, 1, -1 },
+        { 736, 0, -1 },
+        { 737, 1, -1 },
+        { 739, 1, -1 },
+        { 741, 1, -1 },
+        { 743, 0, -1 }
+    },
+    {
+        { 744, 2, 440 },
+        { 747, 1, -1 },
+        { 749, 1, -1 },
+        { 751, 1, -1 },
+        { 753, 1, -1 },
+        { 755, 1, -1 },
+        { 757, 1, -1 },
+        { 759, 0, -1 },
+        { 760, 1, -1 },
+        { 762, 1, -1 },
+        { 764, 1, -1 },
+        { 766, 1, -1 },
+        { 768, 0, -1 }
+    },
+    {
+        { 769, 6, 495 },
+        { 776, 0, -1 },
+        { 777, 0, -1 },
+        { 778, 1, -1 },
+        { 780, 0, -1 },
+        { 781, 0, -1 }
+    },
+    {
+        { 782, 9, 550 },
+        { 792, 0, -1 },
+        { 793, 2, -1 },
+        { 796, 0, -1 },
+        { 797, 0, -1 },
+        { 798, 0, -1 },
+        { 799, 0, -1 },
+        { 800, 0, -1 },
+        { 801, 0, -1 },
+        { 802, 0, -1 },
+        { 803, 0, -1 }
+    },
+    {
+        { 804, 6, 605 },
+        { 811, 1, -1 },
+        { 813, 2, -1 },
+        { 816, 0, -1 },
+        { 817, 0, -1 },
+        { 818, 0, -1 },
+        { 819, 0, -1 },
+        { 820, 1, -1 },
+        { 822, 0, -1 },
+        { 823, 0, -1 },
+        { 824, 1, -1 },
+        { 826, 1, -1 },
+        { 828, 1, -1 },
+        { 830, 1, -1 },
+        { 832, 1, -1 },
+        { 834, 1, -1 },
+        { 836, 1, -1 },
+        { 838, 1, -1 },
+        { 840, 0, -1 }
+    },
+    {
+        { 841, 4, 660 },
+        { 846, 0, -1 },
+        { 847, 0, -1 },
+        { 848, 0, -1 }
+    },
+    {
+        { 849, 1, 715 },
+        { 851, 1, -1 },
+        { 853, 1, -1 },
+        { 855, 1, -1 },
+        { 857, 1, -1 },
+        { 859, 1, -1 },
+        { 861, 1, -1 },
+        { 863, 1, -1 },
+        { 865, 1, -1 },
+        { 867, 1, -1 },
+        { 869, 1, -1 },
+        { 871, 0, -1 }
+    },
+    {
+        { 872, 1, 770 },
+        { 874, 0, -1 }
+    },
+    {
+        { 875, 7, 825 },
+        { 883, 0, -1 },
+        { 884, 2, -1 },
+        { 887, 0, -1 },
+        { 888, 0, -1 },
+        { 889, 0, -1 },
+        { 890, 0, -1 },
+        { 891, 0, -1 },
+        { 892, 0, -1 }
+    },
+    {
+        { 893, 15, 880 },
+        { 909, 1, -1 },
+        { 911, 1, -1 },
+        { 913, 2, -1 },
+        { 916, 2, -1 },
+        { 919, 2, -1 },
+        { 922, 1, -1 },
+        { 924, 2, -1 },
+        { 927, 1, -1 },
+        { 929, 1, -1 },
+        { 931, 1, -1 },
+        { 933, 2, -1 },
+        { 936, 0, -1 },
+        { 937, 0, -1 },
+        { 938, 0, -1 },
+        { 939, 0, -1 },
+        { 940, 1, -1 },
+        { 942, 1, -1 },
+        { 944, 1, -1 },
+        { 946, 1, -1 },
+        { 948, 1, -1 },
+        { 950, 1, -1 },
+        { 952, 1, -1 },
+        { 954, 1, -1 },
+        { 956, 1, -1 },
+        { 958, 2, -1 },
+        { 961, 1, -1 },
+        { 963, 1, -1 },
+        { 965, 2, -1 },
+        { 968, 1, -1 },
+        { 970, 0, -1 },
+        { 971, 0, -1 },
+        { 972, 2, -1 },
+        { 975, 1, -1 },
+        { 977, 1, -1 },
+        { 979, 1, -1 },
+        { 981, 1, -1 },
+        { 983, 1, -1 },
+        { 985, 1, -1 },
+        { 987, 1, -1 },
+        { 989, 1, -1 },
+        { 991, 1, -1 },
+        { 993, 2, -1 },
+        { 996, 0, -1 },
+        { 997, 1, -1 },
+        { 999, 1, -1 },
+        { 1001, 1, -1 },
+        { 1003, 1, -1 },
+        { 1005, 1, -1 },
+        { 1007, 1, -1 },
+        { 1009, 1, -1 },
+        { 1011, 1, -1 },
+        { 1013, 1, -1 },
+        { 1015, 1, -1 },
+        { 1017, 1, -1 },
+        { 1019, 1, -1 },
+        { 1021, 1, -1 },
+        { 1023, 1, -1 },
+        { 1025, 1, -1 },
+        { 1027, 1, -1 },
+        { 1029, 1, -1 },
+        { 1031, 1, -1 },
+        { 1033, 1, -1 },
+        { 1035, 0, -1 },
+        { 1036, 1, -1 },
+        { 1038, 1, -1 },
+        { 1040, 1, -1 },
+        { 1042, 1, -1 },
+        { 1044, 1, -1 },
+        { 1046, 1, -1 },
+        { 1048, 1, -1 },
+        { 1050, 1, -1 },
+        { 1052, 0, -1 },
+        { 1053, 1, -1 },
+        { 1055, 1, -1 },
+        { 1057, 1, -1 },
+        { 1059, 1, -1 },
+        { 1061, 1, -1 },
+        { 1063, 1, -1 },
+        { 1065, 1, -1 },
+        { 1067, 1, -1 },
+        { 1069, 1, -1 },
+        { 1071, 1, -1 },
+        { 1073, 0, -1 },
+        { 1074, 1, -1 },
+        { 1076, 1, -1 },
+        { 1078, 1, -1 },
+        { 1080, 1, -1 },
+        { 1082, 1, -1 },
+        { 1084, 1, -1 },
+        { 1086, 1, -1 },
+        { 1088, 0, -1 },
+        { 1089, 1, -1 },
+        { 1091, 0, -1 },
+        { 1092, 1, -1 },
+        { 1094, 1, -1 },
+        { 1096, 1, -1 },
+        { 1098, 1, -1 },
+        { 1100, 0, -1 },
+        { 1101, 1, -1 },
+        { 1103, 1, -1 },
+        { 1105, 1, -1 },
+        { 1107, 1, -1 },
+        { 1109, 1, -1 },
+        { 1111, 1, -1 },
+        { 1113, 1, -1 },
+        { 1115, 1, -1 },
+        { 1117, 1, -1 },
+        { 1119, 0, -1 },
+        { 1120, 1, -1 },
+        { 1122, 0, -1 },
+        { 1123, 1, -1 },
+        { 1125, 1, -1 },
+        { 1127, 1, -1 },
+        { 1129, 3, -1 },
+        { 1133, 0, -1 },
+        { 1134, 1, -1 },
+        { 1136, 1, -1 },
+        { 1138, 1, -1 },
+        { 1140, 1, -1 },
+        { 1142, 1, -1 },
+        { 1144, 1, -1 },
+        { 1146, 1, -1 },
+        { 1148, 1, -1 },
+        { 1150, 1, -1 },
+        { 1152, 1, -1 },
+        { 1154, 1, -1 },
+        { 1156, 1, -1 },
+        { 1158, 1, -1 },
+        { 1160, 0, -1 },
+        { 1161, 1, -1 },
+        { 1163, 1, -1 },
+        { 1165, 1, -1 },
+        { 1167, 1, -1 },
+        { 1169, 1, -1 },
+        { 1171, 1, -1 },
+        { 1173, 0, -1 },
+        { 1174, 1, -1 },
+        { 1176, 1, -1 },
+        { 1178, 1, -1 },
+        { 1180, 1, -1 },
+        { 1182, 1, -1 },
+        { 1184, 1, -1 },
+        { 1186, 1, -1 },
+        { 1188, 1, -1 },
+        { 1190, 1, -1 },
+        { 1192, 0, -1 },
+        { 1193, 1, -1 },
+        { 1195, 1, -1 },
+        { 1197, 1, -1 },
+        { 1199, 1, -1 },
+        { 1201, 1, -1 },
+        { 1203, 1, -1 },
+        { 1205, 1, -1 },
+        { 1207, 1, -1 },
+        { 1209, 1, -1 },
+        { 1211, 1, -1 },
+        { 1213, 1, -1 },
+        { 1215, 1, -1 },
+        { 1217, 1, -1 },
+        { 1219, 1, -1 },
+        { 1221, 1, -1 },
+        { 1223, 1, -1 },
+        { 1225, 1, -1 },
+        { 1227, 1, -1 },
+        { 1229, 1, -1 },
+        { 1231, 0, -1 },
+        { 1232, 1, -1 },
+        { 1234, 1, -1 },
+        { 1236, 1, -1 },
+        { 1238, 1, -1 },
+        { 1240, 1, -1 },
+        { 1242, 1, -1 },
+        { 1244, 1, -1 },
+        { 1246, 1, -1 },
+        { 1248, 1, -1 },
+        { 1250, 1, -1 },
+        { 1252, 1, -1 },
+        { 1254, 1, -1 },
+        { 1256, 1, -1 },
+        { 1258, 0, -1 },
+        { 1259, 1, -1 },
+        { 1261, 0, -1 },
+        { 1262, 1, -1 },
+        { 1264, 1, -1 },
+        { 1266, 0, -1 },
+        { 1267, 1, -1 },
+        { 1269, 0, -1 },
+        { 1270, 1, -1 },
+        { 1272, 1, -1 },
+        { 1274, 1, -1 },
+        { 1276, 1, -1 },
+        { 1278, 1, -1 },
+        { 1280, 1, -1 },
+        { 1282, 1, -1 },
+        { 1284, 1, -1 },
+        { 1286, 0, -1 },
+        { 1287, 1, -1 },
+        { 1289, 0, -1 }
+    },
+    {
+        { 1290, 2, 935 },
+        { 1293, 0, -1 }
+    },
+    {
+        { 1294, 9, 990 },
+        { 1304, 2, -1 },
+        { 1307, 2, -1 },
+        { 1310, 1, -1 },
+        { 1312, 1, -1 },
+        { 1314, 1, -1 },
+        { 1316, 1, -1 },
+        { 1318, 2, -1 },
+        { 1321, 1, -1 },
+        { 1323, 2, -1 },
+        { 1326, 1, -1 },
+        { 1328, 1, -1 },
+        { 1330, 2, -1 },
+        { 1333, 1, -1 },
+        { 1335, 1, -1 },
+        { 1337, 1, -1 },
+        { 1339, 2, -1 },
+        { 1342, 1, -1 },
+        { 1344, 1, -1 },
+        { 1346, 1, -1 },
+        { 1348, 1, -1 },
+        { 1350, 1, -1 },
+        { 1352, 1, -1 },
+        { 1354, 1, -1 },
+        { 1356, 1, -1 },
+        { 1358, 1, -1 },
+        { 1360, 1, -1 },
+        { 1362, 0, -1 },
+        { 1363, 1, -1 },
+        { 1365, 1, -1 },
+        { 1367, 1, -1 },
+        { 1369, 1, -1 },
+        { 1371, 1, -1 },
+        { 1373, 1, -1 },
+        { 1375, 1, -1 },
+        { 1377, 1, -1 },
+        { 1379, 1, -1 },
+        { 1381, 1, -1 },
+        { 1383, 1, -1 },
+        { 1385, 1, -1 },
+        { 1387, 1, -1 },
+        { 1389, 1, -1 },
+        { 1391, 1, -1 },
+        { 1393, 1, -1 },
+        { 1395, 1, -1 },
+        { 1397, 0, -1 },
+        { 1398, 1, -1 },
+        { 1400, 1, -1 },
+        { 1402, 1, -1 },
+        { 1404, 1, -1 },
+        { 1406, 1, -1 },
+        { 1408, 1, -1 },
+        { 1410, 0, -1 },
+        { 1411, 1, -1 },
+        { 1413, 1, -1 },
+        { 1415, 1, -1 },
+        { 1417, 1, -1 },
+        { 1419, 1, -1 },
+        { 1421, 1, -1 },
+        { 1423, 1, -1 },
+        { 1425, 1, -1 },
+        { 1427, 1, -1 },
+        { 1429, 1, -1 },
+        { 1431, 1, -1 },
+        { 1433, 1, -1 },
+        { 1435, 1, -1 },
+        { 1437, 1, -1 },
+        { 1439, 0, -1 },
+        { 1440, 1, -1 },
+        { 1442, 0, -1 },
+        { 1443, 1, -1 },
+        { 1445, 1, -1 },
+        { 1447, 1, -1 },
+        { 1449, 1, -1 },
+        { 1451, 1, -1 },
+        { 1453, 1, -1 },
+        { 1455, 1, -1 },
+        { 1457, 1, -1 },
+        { 1459, 1, -1 },
+        { 1461, 1, -1 },
+        { 1463, 1, -1 },
+        { 1465, 1, -1 },
+        { 1467, 0, -1 },
+        { 1468, 1, -1 },
+        { 1470, 1, -1 },
+        { 1472, 1, -1 },
+        { 1474, 1, -1 },
+        { 1476, 1, -1 },
+        { 1478, 0, -1 },
+        { 1479, 0, -1 },
+        { 1480, 1, -1 },
+        { 1482, 1, -1 },
+        { 1484, 0, -1 },
+        { 1485, 3, -1 },
+        { 1489, 1, -1 },
+        { 1491, 1, -1 },
+        { 1493, 1, -1 },
+        { 1495, 1, -1 },
+        { 1497, 1, -1 },
+        { 1499, 1, -1 },
+        { 1501, 1, -1 },
+        { 1503, 1, -1 },
+        { 1505, 1, -1 },
+        { 1507, 1, -1 },
+        { 1509, 1, -1 },
+        { 1511, 1, -1 },
+        { 1513, 1, -1 },
+        { 1515, 1, -1 },
+        { 1517, 1, -1 },
+        { 1519, 1, -1 },
+        { 1521, 1, -1 },
+        { 1523, 1, -1 },
+        { 1525, 1, -1 },
+        { 1527, 1, -1 },
+        { 1529, 0, -1 },
+        { 1530, 1, -1 },
+        { 1532, 1, -1 },
+        { 1534, 1, -1 },
+        { 1536, 1, -1 },
+        { 1538, 1, -1 },
+        { 1540, 1, -1 },
+        { 1542, 1, -1 },
+        { 1544, 1, -1 },
+        { 1546, 1, -1 },
+        { 1548, 1, -1 },
+        { 1550, 1, -1 },
+        { 1552, 1, -1 },
+        { 1554, 1, -1 },
+        { 1556, 1, -1 },
+        { 1558, 1, -1 },
+        { 1560, 1, -1 },
+        { 1562, 1, -1 },
+        { 1564, 1, -1 },
+        { 1566, 1, -1 },
+        { 1568, 1, -1 },
+        { 1570, 1, -1 },
+        { 1572, 1, -1 },
+        { 1574, 1, -1 },
+        { 1576, 0, -1 },
+        { 1577, 1, -1 },
+        { 1579, 1, -1 },
+        { 1581, 1, -1 },
+        { 1583, 1, -1 },
+        { 1585, 1, -1 },
+        { 1587, 1, -1 },
+        { 1589, 1, -1 },
+        { 1591, 1, -1 },
+        { 1593, 1, -1 },
+        { 1595, 1, -1 },
+        { 1597, 1, -1 },
+        { 1599, 1, -1 },
+        { 1601, 1, -1 },
+        { 1603, 1, -1 },
+        { 1605, 0, -1 },
+        { 1606, 0, -1 },
+        { 1607, 1, -1 },
+        { 1609, 1, -1 },
+        { 1611, 0, -1 },
+        { 1612, 1, -1 },
+        { 1614, 0, -1 },
+        { 1615, 1, -1 },
+        { 1617, 1, -1 },
+        { 1619, 1, -1 },
+        { 1621, 1, -1 },
+        { 1623, 1, -1 },
+        { 1625, 1, -1 },
+        { 1627, 1, -1 },
+        { 1629, 1, -1 },
+        { 1631, 0, -1 },
+        { 1632, 1, -1 },
+        { 1634, 1, -1 },
+        { 1636, 0, -1 }
+    },
+    {
+        { 1637, 33, 110 },
+        { 1671, 0, -1 },
+        { 1672, 0, -1 },
+        { 1673, 0, -1 },
+        { 1674, 0, -1 },
+        { 1675, 0, -1 },
+        { 1676, 0, -1 },
+        { 1677, 0, -1 },
+        { 1678, 0, -1 },
+        { 1679, 0, -1 },
+        { 1680, 0, -1 },
+        { 1681, 0, -1 },
+        { 1682, 0, -1 },
+        { 1683, 0, -1 },
+        { 1684, 0, -1 },
+        { 1685, 0, -1 },
+        { 1686, 1, -1 },
+        { 1688, 0, -1 },
+        { 1689, 0, -1 },
+        { 1690, 0, -1 },
+        { 1691, 0, -1 },
+        { 1692, 0, -1 },
+        { 1693, 0, -1 },
+        { 1694, 0, -1 },
+        { 1695, 0, -1 },
+        { 1696, 0, -1 },
+        { 1697, 0, -1 },
+        { 1698, 0, -1 }
+    },
+    {
+        { 1699, 29, 1045 },
+        { 1729, 1, -1 },
+        { 1731, 1, -1 },
+        { 1733, 1, -1 },
+        { 1735, 0, -1 },
+        { 1736, 0, -1 },
+        { 1737, 0, -1 },
+        { 1738, 0, -1 },
+        { 1739, 0, -1 },
+        { 1740, 0, -1 },
+        { 1741, 0, -1 },
+        { 1742, 0, -1 },
+        { 1743, 2, -1 },
+        { 1746, 0, -1 },
+        { 1747, 1, -1 },
+        { 1749, 0, -1 },
+        { 1750, 0, -1 },
+        { 1751, 0, -1 },
+        { 1752, 0, -1 },
+        { 1753, 0, -1 },
+        { 1754, 1, -1 },
+        { 1756, 0, -1 },
+        { 1757, 0, -1 },
+        { 1758, 0, -1 },
+        { 1759, 0, -1 },
+        { 1760, 0, -1 },
+        { 1761, 0, -1 },
+        { 1762, 0, -1 },
+        { 1763, 0, -1 },
+        { 1764, 0, -1 },
+        { 1765, 0, -1 },
+        { 1766, 0, -1 },
+        { 1767, 0, -1 },
+        { 1768, 0, -1 },
+        { 1769, 2, -1 },
+        { 1772, 1, -1 },
+        { 1774, 1, -1 },
+        { 1776, 1, -1 },
+        { 1778, 0, -1 },
+        { 1779, 1, -1 },
+        { 1781, 0, -1 }
+    },
+    {
+        { 1782, 12, 1100 },
+        { 1795, 2, -1 },
+        { 1798, 1, -1 },
+        { 1800, 1, -1 },
+        { 1802, 1, -1 },
+        { 1804, 0, -1 },
+        { 1805, 0, -1 },
+        { 1806, 0, -1 },
+        { 1807, 0, -1 },
+        { 1808, 0, -1 },
+        { 1809, 0, -1 },
+        { 1810, 0, -1 },
+        { 1811, 0, -1 },
+        { 1812, 0, -1 },
+        { 1813, 0, -1 },
+        { 1814, 0, -1 },
+        { 1815, 0, -1 }
+    },
+    {
+        { 1816, 15, 1155 },
+        { 1832, 1, -1 },
+        { 1834, 0, -1 },
+        { 1835, 0, -1 },
+        { 1836, 0, -1 },
+        { 1837, 0, -1 },
+        { 1838, 0, -1 },
+        { 1839, 0, -1 },
+        { 1840, 2, -1 },
+        { 1843, 0, -1 },
+        { 1844, 0, -1 },
+        { 1845, 0, -1 },
+        { 1846, 0, -1 },
+        { 1847, 0, -1 },
+        { 1848, 0, -1 },
+        { 1849, 0, -1 },
+        { 1850, 0, -1 }
+    },
+    {
+        { 1851, 28, 1210 },
+        { 1880, 1, -1 },
+        { 1882, 1, -1 },
+        { 1884, 1, -1 },
+        { 1886, 0, -1 },
+        { 1887, 0, -1 },
+        { 1888, 0, -1 },
+        { 1889, 0, -1 },
+        { 1890, 0, -1 },
+        { 1891, 0, -1 },
+        { 1892, 0, -1 },
+        { 1893, 2, -1 },
+        { 1896, 0, -1 },
+        { 1897, 1, -1 },
+        { 1899, 0, -1 },
+        { 1900, 0, -1 },
+        { 1901, 0, -1 },
+        { 1902, 0, -1 },
+        { 1903, 0, -1 },
+        { 1904, 1, -1 },
+        { 1906, 0, -1 },
+        { 1907, 0, -1 },
+        { 1908, 0, -1 },
+        { 1909, 0, -1 },
+        { 1910, 0, -1 },
+        { 1911, 0, -1 },
+        { 1912, 0, -1 },
+        { 1913, 0, -1 },
+        { 1914, 0, -1 },
+        { 1915, 0, -1 },
+        { 1916, 0, -1 },
+        { 1917, 0, -1 },
+        { 1918, 0, -1 },
+        { 1919, 2, -1 },
+        { 1922, 1, -1 },
+        { 1924, 1, -1 },
+        { 1926, 1, -1 },
+        { 1928, 0, -1 },
+        { 1929, 1, -1 },
+        { 1931, 0, -1 }
+    },
+    {
+        { 1932, 7, 1265 },
+        { 1940, 0, -1 },
+        { 1941, 0, -1 },
+        { 1942, 0, -1 },
+        { 1943, 0, -1 },
+        { 1944, 0, -1 },
+        { 1945, 0, -1 }
+    },
+    {
+        { 1946, 25, 1320 },
+        { 1972, 1, -1 },
+        { 1974, 0, -1 },
+        { 1975, 0, -1 },
+        { 1976, 0, -1 },
+        { 1977, 0, -1 },
+        { 1978, 0, -1 },
+        { 1979, 0, -1 },
+        { 1980, 0, -1 },
+        { 1981, 0, -1 },
+        { 1982, 2, -1 },
+        { 1985, 0, -1 },
+        { 1986, 0, -1 },
+        { 1987, 0, -1 },
+        { 1988, 0, -1 },
+        { 1989, 0, -1 },
+        { 1990, 0, -1 },
+        { 1991, 1, -1 },
+        { 1993, 0, -1 },
+        { 1994, 0, -1 },
+        { 1995, 0, -1 },
+        { 1996, 0, -1 },
+        { 1997, 0, -1 },
+        { 1998, 0, -1 },
+        { 1999, 0, -1 },
+        { 2000, 0, -1 },
+        { 2001, 0, -1 },
+        { 2002, 2, -1 },
+        { 2005, 1, -1 },
+        { 2007, 1, -1 },
+        { 2009, 1, -1 },
+        { 2011, 0, -1 },
+        { 2012, 1, -1 },
+        { 2014, 0, -1 }
+    },
+    {
+        { 2015, 21, 1375 },
+        { 2037, 1, -1 },
+        { 2039, 0, -1 },
+        { 2040, 0, -1 },
+        { 2041, 0, -1 },
+        { 2042, 0, -1 },
+        { 2043, 0, -1 },
+        { 2044, 0, -1 },
+        { 2045, 0, -1 },
+        { 2046, 2, -1 },
+        { 2049, 0, -1 },
+        { 2050, 0, -1 },
+        { 2051, 0, -1 },
+        { 2052, 1, -1 },
+        { 2054, 0, -1 },
+        { 2055, 0, -1 },
+        { 2056, 0, -1 },
+        { 2057, 0, -1 },
+        { 2058, 0, -1 },
+        { 2059, 0, -1 },
+        { 2060, 0, -1 },
+        { 2061, 0, -1 },
+        { 2062, 0, -1 },
+        { 2063, 2, -1 },
+        { 2066, 1, -1 },
+        { 2068, 1, -1 },
+        { 2070, 1, -1 },
+        { 2072, 0, -1 },
+        { 2073, 1, -1 },
+        { 2075, 0, -1 }
+    },
+    {
+        { 2076, 6, 1430 },
+        { 2083, 0, -1 },
+        { 2084, 2, -1 },
+        { 2087, 0, -1 },
+        { 2088, 0, -1 },
+        { 2089, 0, -1 },
+        { 2090, 0, -1 },
+        { 2091, 0, -1 },
+        { 2092, 0, -1 }
+    },
+    {
+        { 2093, 13, 1485 },
+        { 2107, 0, -1 },
+        { 2108, 2, -1 },
+        { 2111, 0, -1 },
+        { 2112, 0, -1 },
+        { 2113, 0, -1 },
+        { 2114, 0, -1 },
+        { 2115, 0, -1 },
+        { 2116, 0, -1 },
+        { 2117, 0, -1 },
+        { 2118, 0, -1 },
+        { 2119, 0, -1 },
+        { 2120, 0, -1 },
+        { 2121, 0, -1 },
+        { 2122, 0, -1 }
+    },
+    {
+        { 2123, 7, 1540 },
+        { 2131, 2, -1 },
+        { 2134, 0, -1 },
+        { 2135, 0, -1 },
+        { 2136, 0, -1 },
+        { 2137, 0, -1 },
+        { 2138, 0, -1 },
+        { 2139, 0, -1 },
+        { 2140, 0, -1 },
+        { 2141, 0, -1 }
+    },
+    {
+        { 2142, 6, 1595 },
+        { 2149, 1, -1 },
+        { 2151, 2, -1 },
+        { 2154, 0, -1 },
+        { 2155, 0, -1 },
+        { 2156, 0, -1 },
+        { 2157, 0, -1 },
+        { 2158, 0, -1 },
+        { 2159, 0, -1 },
+        { 2160, 0, -1 }
+    },
+    {
+        { 2161, 7, 1650 },
+        { 2169, 2, -1 },
+        { 2172, 0, -1 },
+        { 2173, 2, -1 },
+        { 2176, 0, -1 },
+        { 2177, 0, -1 },
+        { 2178, 0, -1 },
+        { 2179, 0, -1 },
+        { 2180, 0, -1 },
+        { 2181, 1, -1 },
+        { 2183, 0, -1 },
+        { 2184, 0, -1 },
+        { 2185, 0, -1 }
+    },
+    {
+        { 2186, 7, 1705 },
+        { 2194, 0, -1 },
+        { 2195, 0, -1 },
+        { 2196, 2, -1 },
+        { 2199, 0, -1 },
+        { 2200, 0, -1 },
+        { 2201, 0, -1 },
+        { 2202, 0, -1 },
+        { 2203, 0, -1 },
+        { 2204, 0, -1 }
+    },
+    {
+        { 2205, 7, 1760 },
+        { 2213, 1, -1 },
+        { 2215, 0, -1 },
+        { 2216, 2, -1 },
+        { 2219, 0, -1 },
+        { 2220, 0, -1 },
+        { 2221, 0, -1 },
+        { 2222, 0, -1 },
+        { 2223, 0, -1 },
+        { 2224, 0, -1 },
+        { 2225, 0, -1 }
+    },
+    {
+        { 2226, 13, 1815 },
+        { 2240, 0, -1 },
+        { 2241, 0, -1 },
+        { 2242, 0, -1 },
+        { 2243, 2, -1 },
+        { 2246, 0, -1 },
+        { 2247, 0, -1 },
+        { 2248, 0, -1 },
+        { 2249, 0, -1 },
+        { 2250, 0, -1 },
+        { 2251, 0, -1 },
+        { 2252, 0, -1 },
+        { 2253, 0, -1 },
+        { 2254, 0, -1 },
+        { 2255, 0, -1 }
+    },
+    {
+        { 2256, 2, 1870 },
+        { 2259, 0, -1 },
+        { 2260, 0, -1 }
+    },
+    {
+        { 2261, 1, 1925 },
+        { 2263, 1, -1 },
+        { 2265, 0, -1 }
+    },
+    {
+        { 2266, 2, 1980 },
+        { 2269, 2, -1 },
+        { 2272, 0, -1 },
+        { 2273, 0, -1 },
+        { 2274, 1, -1 },
+        { 2276, 0, -1 }
+    },
+    {
+        { 2277, 2, 2035 },
+        { 2280, 1, -1 },
+        { 2282, 0, -1 },
+        { 2283, 0, -1 }
+    },
+    {
+        { 2284, 1, 330 },
+        { 2286, 1, -1 },
+        { 2288, 0, -1 }
+    },
+    {
+        { 2289, 11, 2090 },
+        { 2301, 1, -1 },
+        { 2303, 1, -1 },
+        { 2305, 0, -1 },
+        { 2306, 0, -1 },
+        { 2307, 2, -1 },
+        { 2310, 1, -1 },
+        { 2312, 0, -1 },
+        { 2313, 0, -1 },
+        { 2314, 0, -1 },
+        { 2315, 0, -1 },
+        { 2316, 0, -1 },
+        { 2317, 0, -1 },
+        { 2318, 0, -1 },
+        { 2319, 0, -1 },
+        { 2320, 0, -1 }
+    },
+    {
+        { 2321, 5, 2145 },
+        { 2327, 0, -1 },
+        { 2328, 0, -1 },
+        { 2329, 0, -1 },
+        { 2330, 0, -1 },
+        { 2331, 0, -1 }
+    },
+    {
+        { 2332, 14, 2200 },
+        { 2347, 1, -1 },
+        { 2349, 1, -1 },
+        { 2351, 0, -1 },
+        { 2352, 2, -1 },
+        { 2355, 0, -1 },
+        { 2356, 1, -1 },
+        { 2358, 0, -1 },
+        { 2359, 0, -1 },
+        { 2360, 0, -1 },
+        { 2361, 0, -1 },
+        { 2362, 0, -1 },
+        { 2363, 0, -1 },
+        { 2364, 0, -1 },
+        { 2365, 0, -1 },
+        { 2366, 0, -1 },
+        { 2367, 0, -1 },
+        { 2368, 0, -1 },
+        { 2369, 0, -1 },
+        { 2370, 0, -1 }
+    },
+    {
+        { 2371, 1, 2255 },
+        { 2373, 0, -1 }
+    },
+    {
+        { 2374, 1, 2310 },
+        { 2376, 0, -1 }
+    },
+    {
+        { 2377, 14, 2365 },
+        { 2392, 0, -1 },
+        { 2393, 0, -1 },
+        { 2394, 0, -1 },
+        { 2395, 0, -1 },
+        { 2396, 0, -1 },
+        { 2397, 0, -1 },
+        { 2398, 2, -1 },
+        { 2401, 0, -1 },
+        { 2402, 0, -1 },
+        { 2403, 0, -1 },
+        { 2404, 0, -1 },
+        { 2405, 0, -1 },
+        { 2406, 0, -1 },
+        { 2407, 0, -1 },
+        { 2408, 0, -1 }
+    },
+    {
+        { 2409, 25, 2420 },
+        { 2435, 1, -1 },
+        { 2437, 0, -1 },
+        { 2438, 0, -1 },
+        { 2439, 0, -1 },
+        { 2440, 0, -1 },
+        { 2441, 0, -1 },
+        { 2442, 0, -1 },
+        { 2443, 0, -1 },
+        { 2444, 0, -1 },
+        { 2445, 0, -1 },
+        { 2446, 2, -1 },
+        { 2449, 0, -1 },
+        { 2450, 0, -1 },
+        { 2451, 0, -1 },
+        { 2452, 0, -1 },
+        { 2453, 0, -1 },
+        { 2454, 1, -1 },
+        { 2456, 0, -1 },
+        { 2457, 0, -1 },
+        { 2458, 0, -1 },
+        { 2459, 0, -1 },
+        { 2460, 0, -1 },
+        { 2461, 0, -1 },
+        { 2462, 0, -1 },
+        { 2463, 0, -1 },
+        { 2464, 0, -1 },
+        { 2465, 2, -1 },
+        { 2468, 1, -1 },
+        { 2470, 1, -1 },
+        { 2472, 1, -1 },
+        { 2474, 0, -1 },
+        { 2475, 1, -1 },
+        { 2477, 0, -1 }
+    },
+    {
+        { 2478, 9, 2475 },
+        { 2488, 1, -1 },
+        { 2490, 0, -1 },
+        { 2491, 1, -1 },
+        { 2493, 2, -1 },
+        { 2496, 1, -1 },
+        { 2498, 0, -1 },
+        { 2499, 0, -1 },
+        { 2500, 0, -1 },
+        { 2501, 0, -1 },
+        { 2502, 0, -1 },
+        { 2503, 0, -1 },
+        { 2504, 0, -1 },
+        { 2505, 0, -1 },
+        { 2506, 0, -1 }
+    },
+    {
+        { 2507, 33, 110 },
+        { 2541, 0, -1 },
+        { 2542, 0, -1 },
+        { 2543, 0, -1 },
+        { 2544, 0, -1 },
+        { 2545, 0, -1 },
+        { 2546, 0, -1 },
+        { 2547, 0, -1 },
+        { 2548, 0, -1 },
+        { 2549, 0, -1 },
+        { 2550, 0, -1 },
+        { 2551, 0, -1 },
+        { 2552, 0, -1 },
+        { 2553, 0, -1 },
+        { 2554, 0, -1 },
+        { 2555, 0, -1 },
+        { 2556, 0, -1 },
+        { 2557, 0, -1 },
+        { 2558, 0, -1 },
+        { 2559, 0, -1 },
+        { 2560, 0, -1 },
+        { 2561, 0, -1 },
+        { 2562, 0, -1 },
+        { 2563, 0, -1 },
+        { 2564, 0, -1 },
+        { 2565, 0, -1 },
+        { 2566, 0, -1 }
+    },
+    {
+        { 2567, 20, 2530 },
+        { 2588, 1, -1 },
+        { 2590, 0, -1 },
+        { 2591, 0, -1 },
+        { 2592, 0, -1 },
+        { 2593, 0, -1 },
+        { 2594, 0, -1 },
+        { 2595, 2, -1 },
+        { 2598, 0, -1 },
+        { 2599, 0, -1 },
+        { 2600, 0, -1 },
+        { 2601, 0, -1 },
+        { 2602, 0, -1 },
+        { 2603, 0, -1 },
+        { 2604, 0, -1 },
+        { 2605, 0, -1 },
+        { 2606, 0, -1 },
+        { 2607, 0, -1 },
+        { 2608, 0, -1 },
+        { 2609, 0, -1 },
+        { 2610, 0, -1 },
+        { 2611, 0, -1 },
+        { 2612, 0, -1 }
+    },
+    {
+        { 2613, 21, 2585 },
+        { 2635, 1, -1 },
+        { 2637, 0, -1 },
+        { 2638, 0, -1 },
+        { 2639, 0, -1 },
+        { 2640, 0, -1 },
+        { 2641, 0, -1 },
+        { 2642, 0, -1 },
+        { 2643, 2, -1 },
+        { 2646, 0, -1 },
+        { 2647, 0, -1 },
+        { 2648, 0, -1 },
+        { 2649, 0, -1 },
+        { 2650, 1, -1 },
+        { 2652, 0, -1 },
+        { 2653, 0, -1 },
+        { 2654, 0, -1 },
+        { 2655, 0, -1 },
+        { 2656, 0, -1 },
+        { 2657, 0, -1 },
+        { 2658, 0, -1 },
+        { 2659, 0, -1 },
+        { 2660, 0, -1 },
+        { 2661, 2, -1 },
+        { 2664, 1, -1 },
+        { 2666, 1, -1 },
+        { 2668, 1, -1 },
+        { 2670, 0, -1 },
+        { 2671, 1, -1 },
+        { 2673, 0, -1 }
+    },
+    {
+        { 2674, 15, 2640 },
+        { 2690, 1, -1 },
+        { 2692, 0, -1 },
+        { 2693, 0, -1 },
+        { 2694, 0, -1 },
+        { 2695, 0, -1 },
+        { 2696, 0, -1 },
+        { 2697, 0, -1 },
+        { 2698, 0, -1 },
+        { 2699, 0, -1 },
+        { 2700, 0, -1 },
+        { 2701, 0, -1 },
+        { 2702, 0, -1 },
+        { 2703, 0, -1 },
+        { 2704, 0, -1 },
+        { 2705, 0, -1 }
+    },
+    {
+        { 2706, 12, 2695 },
+        { 2719, 0, -1 },
+        { 2720, 0, -1 },
+        { 2721, 0, -1 },
+        { 2722, 1, -1 },
+        { 2724, 0, -1 },
+        { 2725, 0, -1 },
+        { 2726, 0, -1 },
+        { 2727, 0, -1 },
+        { 2728, 0, -1 },
+        { 2729, 0, -1 },
+        { 2730, 0, -1 },
+        { 2731, 0, -1 }
+    },
+    {
+        { 2732, 7, 2750 },
+        { 2740, 0, -1 },
+        { 2741, 0, -1 },
+        { 2742, 1, -1 },
+        { 2744, 0, -1 },
+        { 2745, 0, -1 },
+        { 2746, 0, -1 },
+        { 2747, 0, -1 }
+    },
+    {
+        { 2748, 5, 2805 },
+        { 2754, 0, -1 },
+        { 2755, 1, -1 },
+        { 2757, 0, -1 },
+        { 2758, 0, -1 },
+        { 2759, 0, -1 }
+    },
+    {
+        { 2760, 20, 2860 },
+        { 2781, 1, -1 },
+        { 2783, 0, -1 },
+        { 2784, 0, -1 },
+        { 2785, 0, -1 },
+        { 2786, 0, -1 },
+        { 2787, 0, -1 },
+        { 2788, 0, -1 },
+        { 2789, 2, -1 },
+        { 2792, 0, -1 },
+        { 2793, 0, -1 },
+        { 2794, 0, -1 },
+        { 2795, 1, -1 },
+        { 2797, 0, -1 },
+        { 2798, 0, -1 },
+        { 2799, 0, -1 },
+        { 2800, 0, -1 },
+        { 2801, 0, -1 },
+        { 2802, 0, -1 },
+        { 2803, 0, -1 },
+        { 2804, 0, -1 },
+        { 2805, 0, -1 },
+        { 2806, 2, -1 },
+        { 2809, 1, -1 },
+        { 2811, 1, -1 },
+        { 2813, 1, -1 },
+        { 2815, 0, -1 },
+        { 2816, 1, -1 },
+        { 2818, 0, -1 }
+    },
+    {
+        { 2819, 3, 2915 },
+        { 2823, 1, -1 },
+        { 2825, 1, -1 },
+        { 2827, 1, -1 },
+        { 2829, 0, -1 },
+        { 2830, 0, -1 },
+        { 2831, 0, -1 }
+    },
+    {
+        { 2832, 1, 2970 },
+        { 2834, 0, -1 }
+    },
+    {
+        { 2835, 1, 3025 },
+        { 2837, 0, -1 }
+    },
+    {
+        { 2838, 17, 3080 },
+        { 2856, 1, -1 },
+        { 2858, 0, -1 },
+        { 2859, 0, -1 },
+        { 2860, 0, -1 },
+        { 2861, 0, -1 },
+        { 2862, 2, -1 },
+        { 2865, 0, -1 },
+        { 2866, 0, -1 },
+        { 2867, 0, -1 },
+        { 2868, 0, -1 },
+        { 2869, 0, -1 },
+        { 2870, 0, -1 },
+        { 2871, 0, -1 },
+        { 2872, 0, -1 },
+        { 2873, 0, -1 },
+        { 2874, 0, -1 },
+        { 2875, 0, -1 },
+        { 2876, 0, -1 },
+        { 2877, 0, -1 }
+    },
+    {
+        { 2878, 22, 3135 },
+        { 2901, 1, -1 },
+        { 2903, 0, -1 },
+        { 2904, 0, -1 },
+        { 2905, 0, -1 },
+        { 2906, 0, -1 },
+        { 2907, 0, -1 },
+        { 2908, 0, -1 },
+        { 2909, 0, -1 },
+        { 2910, 2, -1 },
+        { 2913, 0, -1 },
+        { 2914, 0, -1 },
+        { 2915, 0, -1 },
+        { 2916, 0, -1 },
+        { 2917, 1, -1 },
+        { 2919, 0, -1 },
+        { 2920, 0, -1 },
+        { 2921, 0, -1 },
+        { 2922, 0, -1 },
+        { 2923, 0, -1 },
+        { 2924, 0, -1 },
+        { 2925, 0, -1 },
+        { 2926, 0, -1 },
+        { 2927, 0, -1 },
+        { 2928, 2, -1 },
+        { 2931, 1, -1 },
+        { 2933, 1, -1 },
+        { 2935, 1, -1 },
+        { 2937, 0, -1 },
+        { 2938, 1, -1 },
+        { 2940, 0, -1 }
+    },
+    {
+        { 2941, 4, 3190 },
+        { 2946, 0, -1 },
+        { 2947, 0, -1 },
+        { 2948, 0, -1 }
+    },
+    {
+        { 2949, 20, 3245 },
+        { 2970, 1, -1 },
+        { 2972, 0, -1 },
+        { 2973, 0, -1 },
+        { 2974, 0, -1 },
+        { 2975, 0, -1 },
+        { 2976, 0, -1 },
+        { 2977, 0, -1 },
+        { 2978, 0, -1 },
+        { 2979, 2, -1 },
+        { 2982, 0, -1 },
+        { 2983, 0, -1 },
+        { 2984, 1, -1 },
+        { 2986, 0, -1 },
+        { 2987, 0, -1 },
+        { 2988, 0, -1 },
+        { 2989, 0, -1 },
+        { 2990, 0, -1 },
+        { 2991, 0, -1 },
+        { 2992, 0, -1 },
+        { 2993, 0, -1 },
+        { 2994, 0, -1 },
+        { 2995, 2, -1 },
+        { 2998, 1, -1 },
+        { 3000, 1, -1 },
+        { 3002, 1, -1 },
+        { 3004, 0, -1 },
+        { 3005, 1, -1 },
+        { 3007, 0, -1 }
+    },
+    {
+        { 3008, 26, 3300 },
+        { 3035, 1, -1 },
+        { 3037, 0, -1 },
+        { 3038, 0, -1 },
+        { 3039, 0, -1 },
+        { 3040, 0, -1 },
+        { 3041, 0, -1 },
+        { 3042, 0, -1 },
+        { 3043, 0, -1 },
+        { 3044, 0, -1 },
+        { 3045, 0, -1 },
+        { 3046, 2, -1 },
+        { 3049, 0, -1 },
+        { 3050, 0, -1 },
+        { 3051, 0, -1 },
+        { 3052, 0, -1 },
+        { 3053, 0, -1 },
+        { 3054, 0, -1 },
+        { 3055, 1, -1 },
+        { 3057, 0, -1 },
+        { 3058, 0, -1 },
+        { 3059, 0, -1 },
+        { 3060, 0, -1 },
+        { 3061, 0, -1 },
+        { 3062, 0, -1 },
+        { 3063, 0, -1 },
+        { 3064, 0, -1 },
+        { 3065, 0, -1 },
+        { 3066, 2, -1 },
+        { 3069, 1, -1 },
+        { 3071, 1, -1 },
+        { 3073, 1, -1 },
+        { 3075, 0, -1 },
+        { 3076, 1, -1 },
+        { 3078, 0, -1 }
+    },
+    {
+        { 3079, 3, 3355 },
+        { 3083, 0, -1 },
+        { 3084, 0, -1 }
+    },
+    {
+        { 3085, 2, 3410 },
+        { 3088, 0, -1 },
+        { 3089, 0, -1 }
+    },
+    {
+        { 3090, 2, 3465 },
+        { 3093, 0, -1 },
+        { 3094, 0, -1 }
+    },
+    {
+        { 3095, 2, 3520 },
+        { 3098, 1, -1 },
+        { 3100, 1, -1 },
+        { 3102, 1, -1 },
+        { 3104, 1, -1 },
+        { 3106, 1, -1 },
+        { 3108, 1, -1 },
+        { 3110, 1, -1 },
+        { 3112, 1, -1 },
+        { 3114, 1, -1 },
+        { 3116, 1, -1 },
+        { 3118, 1, -1 },
+        { 3120, 0, -1 },
+        { 3121, 1, -1 },
+        { 3123, 1, -1 },
+        { 3125, 1, -1 },
+        { 3127, 0, -1 }
+    },
+    {
+        { 3128, 22, 3575 },
+        { 3151, 1, -1 },
+        { 3153, 0, -1 },
+        { 3154, 0, -1 },
+        { 3155, 0, -1 },
+        { 3156, 0, -1 },
+        { 3157, 0, -1 },
+        { 3158, 0, -1 },
+        { 3159, 0, -1 },
+        { 3160, 0, -1 },
+        { 3161, 2, -1 },
+        { 3164, 0, -1 },
+        { 3165, 0, -1 },
+        { 3166, 0, -1 },
+        { 3167, 1, -1 },
+        { 3169, 0, -1 },
+        { 3170, 0, -1 },
+        { 3171, 0, -1 },
+        { 3172, 0, -1 },
+        { 3173, 0, -1 },
+        { 3174, 0, -1 },
+        { 3175, 0, -1 },
+        { 3176, 0, -1 },
+        { 3177, 0, -1 },
+        { 3178, 2, -1 },
+        { 3181, 1, -1 },
+        { 3183, 1, -1 },
+        { 3185, 1, -1 },
+        { 3187, 0, -1 },
+        { 3188, 1, -1 },
+        { 3190, 0, -1 }
+    },
+    {
+        { 3191, 8, 3630 },
+        { 3200, 0, -1 },
+        { 3201, 0, -1 },
+        { 3202, 2, -1 },
+        { 3205, 0, -1 },
+        { 3206, 0, -1 },
+        { 3207, 0, -1 },
+        { 3208, 0, -1 },
+        { 3209, 0, -1 },
+        { 3210, 0, -1 }
+    },
+    {
+        { 3211, 6, 3685 },
+        { 3218, 0, -1 },
+        { 3219, 0, -1 },
+        { 3220, 0, -1 },
+        { 3221, 0, -1 },
+        { 3222, 0, -1 }
+    },
+    {
+        { 3223, 5, 3740 },
+        { 3229, 0, -1 },
+        { 3230, 0, -1 },
+        { 3231, 0, -1 },
+        { 3232, 0, -1 }
+    },
+    {
+        { 3233, 1, 3795 },
+        { 3235, 1, -1 },
+        { 3237, 1, -1 },
+        { 3239, 1, -1 },
+        { 3241, 1, -1 },
+        { 3243, 1, -1 },
+        { 3245, 1, -1 },
+        { 3247, 1, -1 },
+        { 3249, 1, -1 },
+        { 3251, 1, -1 },
+        { 3253, 0, -1 }
+    },
+    {
+        { 3254, 9, 3850 },
+        { 3264, 0, -1 },
+        { 3265, 2, -1 },
+        { 3268, 0, -1 },
+        { 3269, 0, -1 },
+        { 3270, 0, -1 },
+        { 3271, 0, -1 },
+        { 3272, 0, -1 },
+        { 3273, 0, -1 },
+        { 3274, 0, -1 },
+        { 3275, 0, -1 },
+        { 3276, 0, -1 }
+    },
+    {
+        { 3277, 4, 3905 },
+        { 3282, 0, -1 },
+        { 3283, 0, -1 },
+        { 3284, 0, -1 },
+        { 3285, 0, -1 }
+    }
+};
+
+/* DFA transition character classes */
+UNICC_STATIC signed char _dfa_chars[ 3286 * 2 ] =
+{
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        8, 8,
+        10, 10,
+        19, 19,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        6, 6,
+        -1, -1,
+        6, 6,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        0, 0,
+        1, 1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        9, 9,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        17, 17,
+        18, 18,
+        19, 19,
+        20, 20,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        25, 25,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        30, 30,
+        31, 31,
+        32, 53,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        1, 1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        9, 9,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        17, 17,
+        18, 18,
+        19, 19,
+        20, 20,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        25, 25,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        30, 30,
+        31, 31,
+        32, 53,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        8, 8,
+        10, 10,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        6, 6,
+        -1, -1,
+        6, 6,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        9, 9,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        17, 17,
+        18, 18,
+        19, 19,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 33,
+        34, 34,
+        35, 35,
+        36, 36,
+        37, 37,
+        38, 38,
+        39, 40,
+        41, 41,
+        42, 42,
+        43, 43,
+        44, 44,
+        45, 45,
+        46, 46,
+        47, 47,
+        48, 50,
+        51, 51,
+        52, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        37, 37,
+        43, 43,
+        -1, -1,
+        45, 45,
+        52, 52,
+        -1, -1,
+        32, 32,
+        44, 44,
+        -1, -1,
+        36, 36,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        46, 46,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        39, 39,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        32, 32,
+        36, 36,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        6, 6,
+        -1, -1,
+        -1, -1,
+        6, 6,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        36, 36,
+        44, 44,
+        -1, -1,
+        33, 33,
+        -1, -1,
+        52, 52,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        37, 37,
+        52, 52,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        17, 17,
+        32, 32,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        39, 39,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        34, 34,
+        37, 37,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        -1, -1,
+        50, 50,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        52, 52,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        32, 32,
+        36, 36,
+        50, 50,
+        -1, -1,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        33, 33,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        50, 50,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        3, 3,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        41, 41,
+        42, 42,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        41, 41,
+        42, 42,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        8, 8,
+        10, 10,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        7, 7,
+        12, 12,
+        19, 19,
+        28, 28,
+        32, 53,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        47, 47,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        7, 7,
+        12, 12,
+        28, 28,
+        32, 53,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        22, 22,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        28, 28,
+        32, 53,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        34, 34,
+        35, 35,
+        36, 36,
+        37, 37,
+        38, 38,
+        41, 41,
+        43, 43,
+        45, 45,
+        46, 46,
+        51, 51,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        45, 45,
+        52, 52,
+        -1, -1,
+        32, 32,
+        44, 44,
+        -1, -1,
+        36, 36,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        46, 46,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        39, 39,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        36, 36,
+        44, 44,
+        -1, -1,
+        33, 33,
+        -1, -1,
+        52, 52,
+        -1, -1,
+        37, 37,
+        52, 52,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        17, 17,
+        32, 32,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        39, 39,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        34, 34,
+        37, 37,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        -1, -1,
+        50, 50,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        52, 52,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        32, 32,
+        36, 36,
+        50, 50,
+        -1, -1,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        33, 33,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        50, 50,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        28, 28,
+        32, 53,
+        -1, -1,
+        -1, -1,
+        34, 34,
+        35, 35,
+        36, 36,
+        37, 37,
+        41, 41,
+        43, 43,
+        45, 45,
+        46, 46,
+        51, 51,
+        -1, -1,
+        36, 36,
+        40, 40,
+        -1, -1,
+        34, 34,
+        46, 46,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        39, 39,
+        -1, -1,
+        45, 45,
+        52, 52,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        32, 32,
+        44, 44,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        36, 36,
+        44, 44,
+        -1, -1,
+        33, 33,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        52, 52,
+        -1, -1,
+        37, 37,
+        52, 52,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        39, 39,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        -1, -1,
+        50, 50,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        52, 52,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        -1, -1,
+        32, 32,
+        36, 36,
+        50, 50,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        42, 42,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        49, 49,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        33, 33,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        50, 50,
+        -1, -1,
+        41, 41,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        32, 32,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        5, 5,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        48, 48,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        40, 40,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        47, 47,
+        -1, -1,
+        -1, -1,
+        1, 1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        9, 9,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        17, 17,
+        18, 18,
+        19, 19,
+        20, 20,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        25, 25,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        30, 30,
+        31, 31,
+        32, 53,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        31, 31,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        9, 9,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        17, 17,
+        18, 18,
+        19, 19,
+        20, 20,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        9, 9,
+        17, 17,
+        19, 19,
+        21, 21,
+        23, 23,
+        24, 24,
+        28, 28,
+        32, 53,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        8, 8,
+        10, 10,
+        14, 14,
+        19, 19,
+        22, 22,
+        24, 24,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        9, 9,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        17, 17,
+        18, 18,
+        19, 19,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        7, 7,
+        8, 8,
+        10, 10,
+        12, 12,
+        14, 14,
+        22, 22,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        18, 18,
+        19, 19,
+        22, 22,
+        23, 23,
+        24, 24,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        19, 19,
+        22, 22,
+        23, 23,
+        24, 24,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        22, 22,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        12, 12,
+        13, 13,
+        18, 18,
+        19, 19,
+        23, 23,
+        28, 28,
+        32, 53,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        7, 7,
+        12, 12,
+        19, 19,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        29, 29,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        22, 22,
+        44, 44,
+        -1, -1,
+        37, 37,
+        43, 43,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        22, 22,
+        23, 23,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        19, 19,
+        22, 22,
+        29, 29,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        12, 12,
+        13, 13,
+        19, 19,
+        23, 23,
+        27, 27,
+        28, 28,
+        32, 53,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        7, 7,
+        12, 12,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        29, 29,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        22, 22,
+        44, 44,
+        -1, -1,
+        37, 37,
+        43, 43,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        -1, -1,
+        22, 22,
+        29, 29,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        31, 31,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        17, 17,
+        19, 19,
+        21, 21,
+        23, 23,
+        24, 24,
+        28, 28,
+        32, 53,
+        -1, -1,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        6, 6,
+        7, 7,
+        12, 12,
+        13, 13,
+        18, 18,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        12, 12,
+        13, 13,
+        17, 17,
+        18, 18,
+        19, 19,
+        21, 21,
+        22, 22,
+        24, 24,
+        -1, -1,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        12, 12,
+        -1, -1,
+        -1, -1,
+        13, 13,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        12, 12,
+        13, 13,
+        19, 19,
+        22, 22,
+        23, 23,
+        27, 27,
+        28, 28,
+        32, 53,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        19, 19,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        17, 17,
+        19, 19,
+        21, 21,
+        23, 23,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        24, 24,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        1, 1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        9, 9,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        17, 17,
+        18, 18,
+        19, 19,
+        20, 20,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        25, 25,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        30, 30,
+        31, 31,
+        32, 53,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        18, 18,
+        19, 19,
+        22, 22,
+        24, 24,
+        26, 26,
+        29, 29,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        18, 18,
+        19, 19,
+        23, 23,
+        24, 24,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        18, 18,
+        22, 22,
+        24, 24,
+        26, 26,
+        29, 29,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        12, 12,
+        13, 13,
+        14, 14,
+        18, 18,
+        22, 22,
+        24, 24,
+        29, 29,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        8, 8,
+        10, 10,
+        14, 14,
+        22, 22,
+        24, 24,
+        29, 29,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        8, 8,
+        10, 10,
+        22, 22,
+        24, 24,
+        29, 29,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        19, 19,
+        23, 23,
+        24, 24,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        17, 17,
+        21, 21,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        24, 24,
+        -1, -1,
+        25, 25,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        7, 7,
+        -1, -1,
+        -1, -1,
+        14, 14,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        12, 12,
+        13, 13,
+        14, 14,
+        18, 18,
+        19, 19,
+        22, 22,
+        24, 24,
+        29, 29,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        18, 18,
+        19, 19,
+        22, 22,
+        23, 23,
+        24, 24,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        8, 8,
+        10, 10,
+        22, 22,
+        24, 24,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        19, 19,
+        22, 22,
+        23, 23,
+        24, 24,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        15, 15,
+        16, 16,
+        18, 18,
+        19, 19,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        26, 26,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        8, 8,
+        10, 10,
+        22, 22,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        14, 14,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        22, 22,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        38, 38,
+        43, 43,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        17, 17,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        38, 38,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        53, 53,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        8, 8,
+        10, 10,
+        11, 11,
+        12, 12,
+        13, 13,
+        14, 14,
+        19, 19,
+        21, 21,
+        22, 22,
+        23, 23,
+        24, 24,
+        27, 27,
+        28, 28,
+        29, 29,
+        32, 53,
+        54, 54,
+        -1, -1,
+        15, 15,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        44, 44,
+        46, 46,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        37, 37,
+        -1, -1,
+        44, 44,
+        -1, -1,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        8, 8,
+        10, 10,
+        19, 19,
+        22, 22,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        8, 8,
+        10, 10,
+        14, 14,
+        22, 22,
+        24, 24,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        8, 8,
+        10, 10,
+        14, 14,
+        22, 22,
+        54, 54,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        45, 45,
+        -1, -1,
+        46, 46,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        35, 35,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        43, 43,
+        -1, -1,
+        34, 34,
+        -1, -1,
+        36, 36,
+        -1, -1,
+        -1, -1,
+        2, 2,
+        3, 3,
+        4, 4,
+        5, 5,
+        6, 6,
+        7, 7,
+        12, 12,
+        19, 19,
+        27, 27,
+        -1, -1,
+        -1, -1,
+        15, 15,
+        19, 19,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        6, 6,
+        7, 7,
+        12, 12,
+        27, 27,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1,
+        -1, -1
+};
+
+/* DFA transitions */
+UNICC_STATIC short _dfa_trans[ 3286 ] =
+{
+        10,
+         9,
+         8,
+         7,
+         6,
+         5,
+         4,
+         3,
+         2,
+         1,
+         2,
          -1,
-         50,
+         11,
          -1,
-         144,
          -1,
-         165,
          -1,
-         56,
+         13,
+         12,
          -1,
-         223,
+         14,
          -1,
-         229,
+         15,
          -1,
-         215,
          -1,
-         233,
          -1,
-         225,
          -1,
-         222,
          -1,
-         230,
          -1,
-         238,
          -1,
-         236,
          -1,
-         240,
          -1,
-         241,
          -1,
-         3,
-         6,
-         9,
-         9,
-         9,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         1,
          1,
+         27,
+         3,
+         26,
          2,
-         5,
-         8,
          4,
-         7,
-         11,
          12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
+         9,
+         24,
          21,
-         22,
-         23,
          24,
+         27,
+         11,
+         18,
+         17,
+         16,
+         15,
+         27,
+         13,
+         27,
+         5,
+         23,
          25,
-         26,
+         8,
+         19,
+         7,
+         14,
+         22,
+         6,
+         27,
+         10,
+         27,
+         6,
+         20,
          -1,
          -1,
          -1,
@@ -10005,7 +9017,6 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         27,
          -1,
          -1,
          -1,
@@ -10018,46 +9029,39 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         26,
          3,
-         6,
-         9,
-         9,
-         9,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         1,
-         1,
          2,
-         5,
-         8,
+         1,
          4,
-         7,
-         11,
          12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
+         9,
+         24,
          21,
-         22,
-         23,
          24,
+         26,
+         11,
+         18,
+         17,
+         16,
+         15,
+         26,
+         13,
+         26,
+         5,
+         23,
          25,
+         8,
+         19,
+         7,
+         14,
+         22,
+         6,
          26,
-         27,
+         10,
+         26,
+         6,
+         20,
          -1,
          -1,
          -1,
@@ -10074,6 +9078,7 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         27,
          -1,
          -1,
          -1,
@@ -10086,154 +9091,130 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         7,
-         3,
-         3,
+         5,
+         4,
          3,
          2,
          1,
-         8,
-         -1,
-         4,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         5,
-         -1,
-         6,
-         -1,
          2,
          -1,
+         6,
          -1,
-         1,
-         -1,
-         1,
          -1,
          -1,
-         5,
-         3,
-         3,
-         1,
-         2,
-         2,
-         2,
+         7,
          -1,
+         8,
          -1,
          -1,
          -1,
          -1,
+         40,
+         39,
+         38,
+         37,
+         36,
+         35,
+         34,
+         33,
+         32,
+         31,
+         30,
+         29,
+         28,
+         27,
+         26,
+         25,
+         24,
+         23,
          4,
-         -1,
-         10,
-         11,
-         9,
+         21,
+         17,
+         5,
+         18,
+         20,
+         22,
          1,
+         22,
+         8,
+         10,
+         7,
+         12,
+         3,
+         22,
+         15,
+         16,
          2,
-         3,
-         4,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         5,
          6,
-         -1,
-         12,
-         -1,
+         11,
+         9,
+         14,
+         22,
          13,
+         22,
+         19,
          -1,
-         14,
+         41,
          -1,
-         15,
+         42,
          -1,
-         7,
+         43,
          -1,
-         16,
+         44,
          -1,
-         18,
+         45,
          -1,
-         8,
+         47,
+         46,
          -1,
-         19,
+         49,
+         48,
          -1,
-         17,
+         51,
+         50,
          -1,
-         3,
-         4,
+         53,
+         52,
          -1,
+         54,
          -1,
+         56,
+         55,
          -1,
-         5,
+         57,
          -1,
-         6,
+         58,
          -1,
-         7,
+         59,
          -1,
-         8,
+         61,
+         60,
          -1,
-         1,
+         62,
          -1,
-         9,
          -1,
-         11,
          -1,
-         2,
          -1,
-         12,
          -1,
-         10,
          -1,
-         3,
-         4,
-         5,
-         11,
-         12,
-         15,
-         33,
-         16,
-         16,
-         17,
-         31,
-         6,
-         32,
-         14,
-         13,
-         18,
-         7,
-         10,
-         34,
-         1,
-         9,
-         8,
-         19,
-         20,
-         21,
-         22,
-         2,
-         2,
-         2,
          -1,
+         64,
+         63,
          -1,
          -1,
+         65,
          -1,
-         26,
          -1,
-         27,
          -1,
          -1,
          -1,
          -1,
+         66,
          -1,
+         67,
          -1,
          -1,
+         68,
          -1,
          -1,
          -1,
@@ -10242,627 +9223,604 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         69,
          -1,
+         70,
          -1,
          -1,
          -1,
          -1,
+         71,
          -1,
+         72,
          -1,
+         73,
          -1,
+         74,
          -1,
+         75,
          -1,
+         76,
          -1,
-         23,
-         24,
+         77,
          -1,
-         25,
+         78,
          -1,
-         28,
+         80,
+         79,
          -1,
-         35,
+         81,
          -1,
-         36,
-         37,
+         82,
          -1,
-         38,
+         83,
          -1,
-         29,
+         84,
          -1,
-         39,
+         86,
+         85,
          -1,
-         30,
+         87,
          -1,
-         2,
-         2,
-         16,
-         3,
-         3,
-         3,
-         6,
-         1,
-         5,
-         4,
-         15,
-         7,
-         8,
-         9,
-         10,
-         11,
+         88,
          -1,
          -1,
          -1,
          -1,
+         90,
+         89,
          -1,
          -1,
          -1,
+         92,
+         91,
          -1,
+         93,
          -1,
          -1,
+         94,
          -1,
+         95,
          -1,
+         96,
          -1,
+         97,
          -1,
+         98,
          -1,
-         12,
-         13,
+         99,
          -1,
-         14,
+         100,
          -1,
-         1,
+         101,
          -1,
+         103,
+         102,
          -1,
-         28,
-         30,
-         36,
-         31,
-         82,
-         35,
-         29,
-         34,
-         32,
-         33,
-         27,
-         1,
-         2,
-         3,
-         4,
          -1,
+         104,
          -1,
+         105,
          -1,
+         106,
          -1,
+         107,
          -1,
+         108,
          -1,
+         109,
          -1,
+         110,
          -1,
+         111,
          -1,
+         112,
          -1,
+         113,
          -1,
-         147,
+         114,
          -1,
+         115,
          -1,
+         116,
          -1,
+         117,
          -1,
+         118,
          -1,
+         119,
          -1,
+         120,
          -1,
+         121,
          -1,
+         122,
          -1,
+         123,
          -1,
+         124,
          -1,
+         125,
          -1,
+         126,
          -1,
+         127,
          -1,
+         128,
          -1,
+         129,
          -1,
-         5,
-         6,
          -1,
-         80,
+         130,
          -1,
-         37,
          -1,
-         38,
-         39,
+         131,
          -1,
-         40,
          -1,
-         41,
+         132,
          -1,
-         140,
+         133,
          -1,
-         43,
-         93,
+         134,
          -1,
-         95,
+         135,
          -1,
-         44,
-         45,
+         136,
          -1,
-         83,
+         137,
          -1,
-         79,
+         138,
          -1,
-         105,
          -1,
-         46,
+         139,
          -1,
-         96,
+         140,
          -1,
-         113,
-         47,
+         141,
          -1,
-         123,
+         142,
          -1,
-         182,
-         49,
+         143,
          -1,
-         7,
+         144,
          -1,
-         52,
-         53,
+         145,
          -1,
-         8,
+         146,
          -1,
-         81,
+         147,
          -1,
-         104,
          148,
          -1,
-         9,
-         -1,
-         58,
+         149,
          -1,
-         59,
+         150,
          -1,
-         157,
+         151,
          -1,
-         60,
          -1,
          152,
          -1,
-         112,
+         153,
          -1,
-         63,
+         154,
          -1,
-         153,
+         155,
          -1,
-         94,
+         156,
          -1,
-         66,
+         157,
          -1,
-         99,
+         158,
          -1,
-         88,
          -1,
-         12,
+         159,
          -1,
-         13,
          -1,
-         106,
+         160,
          -1,
-         69,
+         161,
+         -1,
+         162,
          -1,
          163,
          -1,
-         15,
          -1,
-         71,
+         164,
          -1,
-         167,
+         165,
          -1,
-         114,
-         73,
-         74,
          -1,
-         18,
+         166,
          -1,
-         116,
+         167,
          -1,
-         91,
+         168,
          -1,
-         132,
+         169,
          -1,
-         77,
+         170,
+         -1,
+         171,
          -1,
          172,
          -1,
-         131,
+         173,
          -1,
-         50,
+         174,
          -1,
-         141,
+         175,
          -1,
-         62,
+         176,
          -1,
-         42,
          -1,
-         160,
+         177,
          -1,
-         61,
          -1,
-         146,
+         178,
          -1,
-         75,
+         179,
          -1,
-         65,
+         180,
          -1,
-         161,
+         183,
+         182,
+         181,
          -1,
-         155,
          -1,
-         177,
+         184,
          -1,
-         122,
+         185,
          -1,
-         102,
+         186,
          -1,
-         48,
+         187,
          -1,
-         68,
          -1,
-         128,
+         188,
          -1,
-         54,
+         189,
          -1,
-         176,
+         190,
          -1,
-         124,
+         191,
          -1,
-         14,
+         192,
          -1,
-         72,
+         193,
          -1,
-         121,
+         194,
          -1,
-         76,
+         195,
          -1,
-         133,
+         196,
          -1,
-         64,
+         197,
          -1,
-         51,
+         198,
          -1,
-         70,
          -1,
-         173,
+         199,
          -1,
-         137,
+         200,
          -1,
-         20,
+         201,
          -1,
-         108,
+         202,
          -1,
-         126,
+         203,
          -1,
-         97,
+         204,
          -1,
-         55,
          -1,
-         90,
+         205,
          -1,
-         145,
+         206,
          -1,
-         117,
+         207,
          -1,
-         85,
+         208,
          -1,
-         56,
+         209,
          -1,
-         98,
+         210,
          -1,
-         129,
+         211,
          -1,
-         22,
+         212,
          -1,
-         139,
+         213,
          -1,
-         84,
          -1,
-         175,
          -1,
-         21,
+         214,
          -1,
-         110,
+         215,
          -1,
-         143,
+         216,
          -1,
-         57,
+         217,
          -1,
-         101,
+         218,
          -1,
-         103,
+         219,
          -1,
-         26,
+         220,
          -1,
-         120,
+         221,
          -1,
-         180,
+         222,
          -1,
-         23,
+         223,
          -1,
-         158,
+         224,
          -1,
-         25,
+         225,
          -1,
-         138,
+         226,
          -1,
-         78,
+         227,
          -1,
-         125,
+         228,
          -1,
-         118,
+         229,
          -1,
-         144,
+         230,
          -1,
-         119,
+         231,
          -1,
-         135,
+         232,
          -1,
-         87,
+         233,
          -1,
-         127,
          -1,
-         130,
+         234,
          -1,
-         165,
+         235,
          -1,
-         89,
+         236,
          -1,
-         134,
+         237,
          -1,
-         10,
+         238,
          -1,
-         136,
+         239,
          -1,
-         11,
+         240,
          -1,
-         67,
+         241,
          -1,
-         156,
+         242,
          -1,
-         107,
+         243,
          -1,
-         100,
+         244,
          -1,
-         154,
+         245,
          -1,
-         171,
+         246,
          -1,
-         149,
          -1,
-         150,
+         247,
          -1,
-         16,
          -1,
-         151,
+         248,
          -1,
-         168,
+         249,
          -1,
-         17,
          -1,
-         142,
+         250,
          -1,
-         115,
          -1,
-         109,
+         251,
          -1,
-         86,
+         252,
          -1,
-         19,
+         253,
          -1,
-         92,
+         254,
          -1,
-         111,
+         255,
          -1,
-         24,
+         256,
          -1,
-         169,
+         257,
          -1,
-         164,
+         258,
          -1,
-         159,
          -1,
-         166,
+         259,
          -1,
-         170,
          -1,
-         162,
+         1,
          -1,
-         174,
          -1,
-         178,
+         1,
          -1,
-         179,
+         2,
          -1,
-         181,
          -1,
-         16,
-         1,
-         1,
+         7,
+         6,
+         5,
+         4,
+         3,
          1,
          2,
-         3,
+         -1,
+         8,
+         -1,
+         9,
+         -1,
+         11,
+         10,
+         -1,
+         -1,
+         -1,
+         -1,
+         -1,
+         12,
+         -1,
+         13,
+         -1,
+         -1,
+         -1,
          14,
+         -1,
          15,
-         4,
-         5,
-         6,
-         7,
-         8,
          -1,
+         16,
          -1,
          -1,
-         12,
+         17,
+         -1,
+         18,
          -1,
+         19,
          -1,
          -1,
+         2,
+         1,
          -1,
+         3,
          -1,
+         4,
          -1,
+         5,
          -1,
+         6,
          -1,
+         7,
          -1,
+         8,
          -1,
          -1,
          9,
+         -1,
          10,
          -1,
          11,
          -1,
-         13,
+         12,
+         -1,
          -1,
-         8,
          2,
-         3,
+         2,
          4,
-         5,
-         1,
          1,
+         3,
          1,
          -1,
          -1,
          -1,
+         5,
          -1,
          -1,
          -1,
-         -1,
-         -1,
-         6,
+         8,
          7,
-         -1,
-         3,
-         4,
-         5,
          6,
-         12,
-         13,
-         16,
-         34,
-         17,
-         17,
-         18,
-         32,
-         7,
-         33,
-         15,
-         14,
-         19,
-         8,
-         11,
-         35,
-         1,
-         10,
-         9,
-         20,
-         21,
-         22,
-         23,
-         2,
-         2,
+         5,
+         4,
+         3,
          2,
+         1,
+         1,
          -1,
          -1,
+         10,
+         9,
          -1,
          -1,
-         27,
          -1,
-         28,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         6,
+         5,
+         4,
+         3,
+         2,
+         1,
          -1,
+         7,
          -1,
+         9,
+         8,
          -1,
          -1,
          -1,
          -1,
          -1,
+         10,
          -1,
          -1,
          -1,
+         11,
          -1,
+         12,
          -1,
+         13,
          -1,
+         14,
          -1,
+         15,
          -1,
+         16,
          -1,
+         17,
          -1,
+         18,
          -1,
          -1,
+         1,
+         2,
+         3,
+         3,
          -1,
          -1,
-         24,
-         25,
          -1,
-         26,
          -1,
-         29,
+         1,
          -1,
-         36,
+         2,
          -1,
-         37,
-         38,
+         3,
          -1,
-         39,
+         4,
          -1,
-         30,
+         5,
          -1,
-         40,
+         6,
          -1,
-         31,
+         7,
          -1,
-         3,
-         6,
-         9,
-         9,
-         9,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         1,
-         1,
-         2,
-         5,
          8,
-         4,
-         7,
-         11,
-         12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
-         21,
-         22,
-         23,
-         24,
-         25,
-         26,
          -1,
+         9,
          -1,
+         10,
          -1,
+         11,
          -1,
          -1,
+         1,
          -1,
          -1,
+         6,
+         5,
+         4,
+         3,
+         2,
+         1,
+         1,
          -1,
          -1,
+         8,
+         7,
          -1,
          -1,
          -1,
@@ -10870,736 +9828,783 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         27,
+         15,
+         14,
+         13,
+         12,
+         11,
+         4,
+         6,
+         3,
+         8,
+         2,
+         9,
+         1,
+         7,
+         5,
+         10,
          -1,
+         16,
          -1,
+         17,
          -1,
+         19,
+         18,
          -1,
+         21,
+         20,
          -1,
+         23,
+         22,
          -1,
+         24,
          -1,
+         26,
+         25,
          -1,
+         27,
          -1,
+         28,
          -1,
+         29,
          -1,
+         31,
+         30,
          -1,
-         18,
-         19,
-         20,
-         21,
-         22,
-         23,
-         24,
-         66,
-         25,
          -1,
          -1,
          -1,
          -1,
+         32,
          -1,
-         142,
+         33,
          -1,
+         34,
          -1,
+         35,
          -1,
+         36,
          -1,
+         37,
          -1,
+         38,
          -1,
+         39,
          -1,
+         40,
          -1,
+         42,
+         41,
          -1,
+         43,
          -1,
+         44,
          -1,
+         46,
+         45,
          -1,
+         47,
          -1,
-         67,
          -1,
-         26,
-         27,
          -1,
-         28,
-         29,
+         49,
+         48,
          -1,
-         30,
+         50,
          -1,
-         31,
+         51,
          -1,
-         32,
+         52,
          -1,
-         33,
-         78,
+         53,
          -1,
-         131,
+         54,
          -1,
-         64,
+         55,
          -1,
-         77,
+         56,
          -1,
-         35,
-         36,
+         57,
          -1,
-         1,
+         58,
          -1,
-         68,
+         60,
+         59,
          -1,
-         87,
-         37,
          -1,
-         79,
+         61,
          -1,
-         95,
+         62,
          -1,
-         89,
+         63,
+         -1,
+         64,
          -1,
          65,
          -1,
-         88,
+         66,
          -1,
-         2,
+         67,
          -1,
-         3,
+         68,
          -1,
-         45,
+         69,
          -1,
-         48,
+         70,
          -1,
-         110,
+         71,
          -1,
-         49,
+         72,
          -1,
-         50,
+         73,
          -1,
-         96,
+         74,
          -1,
-         119,
+         75,
          -1,
-         72,
+         76,
          -1,
-         4,
+         77,
          -1,
-         76,
+         78,
          -1,
-         81,
+         79,
          -1,
-         52,
          -1,
-         97,
+         80,
          -1,
-         55,
+         81,
          -1,
-         147,
+         82,
          -1,
-         9,
+         83,
          -1,
-         57,
+         84,
          -1,
-         126,
+         85,
          -1,
-         102,
-         58,
-         59,
+         86,
          -1,
-         98,
+         87,
          -1,
-         74,
          -1,
-         111,
+         88,
          -1,
-         62,
+         89,
          -1,
-         130,
+         90,
          -1,
-         118,
+         91,
          -1,
-         38,
+         92,
          -1,
-         46,
+         93,
          -1,
-         34,
+         94,
          -1,
-         133,
+         95,
          -1,
-         40,
+         96,
          -1,
-         60,
+         97,
          -1,
-         51,
          -1,
-         146,
+         98,
          -1,
-         122,
+         99,
          -1,
-         144,
+         100,
          -1,
          101,
          -1,
-         84,
+         102,
          -1,
-         54,
+         103,
          -1,
-         39,
+         104,
          -1,
-         154,
          -1,
-         143,
+         105,
          -1,
-         112,
          -1,
-         7,
+         106,
          -1,
-         103,
+         107,
          -1,
          108,
          -1,
-         61,
+         109,
          -1,
-         121,
          -1,
-         92,
+         110,
          -1,
-         41,
+         111,
          -1,
-         47,
+         112,
          -1,
-         43,
+         113,
          -1,
-         120,
+         114,
          -1,
-         11,
+         115,
          -1,
-         12,
+         116,
          -1,
-         90,
+         117,
          -1,
-         113,
+         118,
          -1,
-         42,
          -1,
-         71,
+         119,
          -1,
-         56,
          -1,
-         139,
+         120,
          -1,
-         85,
+         121,
          -1,
-         44,
+         122,
          -1,
-         86,
+         125,
+         124,
+         123,
          -1,
-         73,
          -1,
-         106,
+         126,
          -1,
-         14,
+         127,
          -1,
-         70,
+         128,
          -1,
-         138,
+         129,
          -1,
-         80,
+         130,
          -1,
-         13,
+         131,
          -1,
-         16,
+         132,
          -1,
-         5,
+         133,
          -1,
-         132,
+         134,
          -1,
-         151,
+         135,
          -1,
-         93,
+         136,
          -1,
-         63,
+         137,
          -1,
-         6,
+         138,
          -1,
-         135,
          -1,
-         83,
+         139,
          -1,
-         17,
+         140,
          -1,
-         53,
+         141,
          -1,
-         114,
+         142,
          -1,
-         155,
+         143,
          -1,
-         8,
+         144,
          -1,
-         10,
          -1,
-         136,
+         145,
          -1,
-         82,
+         146,
          -1,
-         91,
+         147,
          -1,
-         69,
+         148,
          -1,
-         75,
+         149,
          -1,
-         94,
+         150,
          -1,
-         15,
+         151,
          -1,
-         100,
+         152,
          -1,
-         117,
+         153,
          -1,
-         105,
          -1,
-         140,
+         154,
          -1,
-         129,
+         155,
          -1,
-         107,
+         156,
          -1,
-         123,
+         157,
          -1,
-         116,
+         158,
          -1,
-         134,
+         159,
          -1,
-         99,
+         160,
          -1,
-         145,
+         161,
          -1,
-         124,
+         162,
          -1,
-         115,
+         163,
          -1,
-         128,
+         164,
          -1,
-         104,
+         165,
          -1,
-         125,
+         166,
          -1,
-         127,
+         167,
          -1,
-         109,
+         168,
          -1,
-         137,
+         169,
          -1,
-         149,
+         170,
          -1,
-         141,
+         171,
          -1,
-         148,
+         172,
          -1,
-         152,
          -1,
-         150,
+         173,
          -1,
-         153,
+         174,
          -1,
-         1,
-         1,
-         1,
+         175,
+         -1,
+         176,
          -1,
+         177,
          -1,
-         10,
-         9,
-         1,
-         2,
-         3,
-         4,
+         178,
          -1,
+         179,
          -1,
+         180,
          -1,
+         181,
          -1,
+         182,
          -1,
+         183,
          -1,
+         184,
          -1,
-         18,
+         185,
          -1,
          -1,
-         5,
-         6,
+         186,
          -1,
-         11,
          -1,
-         12,
+         187,
          -1,
-         17,
+         188,
          -1,
-         14,
          -1,
-         7,
+         189,
          -1,
-         16,
          -1,
-         8,
+         190,
          -1,
-         13,
+         191,
          -1,
-         15,
+         192,
          -1,
-         10,
-         2,
-         3,
-         4,
-         5,
-         6,
-         7,
-         1,
-         1,
-         1,
+         193,
          -1,
+         194,
          -1,
+         195,
          -1,
+         196,
          -1,
+         197,
          -1,
          -1,
+         198,
          -1,
          -1,
+         1,
+         1,
          -1,
          -1,
-         8,
          9,
-         -1,
+         8,
+         7,
+         4,
+         5,
          3,
+         2,
+         1,
+         6,
          -1,
+         11,
          10,
          -1,
+         13,
+         12,
          -1,
-         4,
+         14,
          -1,
-         5,
+         15,
          -1,
-         9,
+         16,
          -1,
-         7,
+         17,
          -1,
-         1,
+         19,
+         18,
          -1,
-         11,
+         20,
          -1,
-         6,
+         22,
+         21,
          -1,
-         8,
+         23,
          -1,
-         2,
+         24,
          -1,
-         1,
-         1,
-         1,
-         2,
-         3,
+         26,
+         25,
          -1,
+         27,
          -1,
+         28,
          -1,
+         29,
          -1,
-         15,
-         2,
-         2,
-         2,
-         1,
-         13,
-         14,
-         3,
-         4,
-         5,
-         6,
-         7,
+         31,
+         30,
          -1,
+         32,
          -1,
+         33,
          -1,
-         11,
+         34,
          -1,
+         35,
          -1,
+         36,
          -1,
+         37,
          -1,
+         38,
          -1,
+         39,
          -1,
+         40,
          -1,
+         41,
          -1,
          -1,
+         42,
          -1,
-         8,
-         9,
+         43,
          -1,
-         12,
+         44,
          -1,
-         10,
+         45,
          -1,
-         7,
-         7,
-         7,
-         15,
-         1,
-         6,
-         13,
-         14,
-         2,
-         4,
-         5,
-         3,
+         46,
+         -1,
+         47,
+         -1,
+         48,
          -1,
+         49,
          -1,
+         50,
          -1,
+         51,
          -1,
+         52,
          -1,
+         53,
          -1,
-         11,
+         54,
          -1,
+         55,
          -1,
+         56,
          -1,
+         57,
          -1,
+         58,
          -1,
          -1,
+         59,
          -1,
-         8,
-         9,
+         60,
          -1,
-         10,
+         61,
          -1,
-         12,
+         62,
          -1,
-         2,
-         3,
-         15,
-         13,
-         14,
-         4,
-         5,
-         6,
-         7,
-         1,
-         1,
-         1,
+         63,
          -1,
+         64,
          -1,
          -1,
-         11,
+         65,
          -1,
+         66,
          -1,
+         67,
          -1,
+         68,
          -1,
+         69,
          -1,
+         70,
          -1,
+         71,
          -1,
+         72,
          -1,
+         73,
          -1,
+         74,
          -1,
-         8,
-         9,
+         75,
          -1,
-         10,
+         76,
          -1,
-         12,
+         77,
+         -1,
+         78,
          -1,
-         9,
-         16,
-         19,
-         34,
-         20,
-         20,
-         21,
-         23,
-         23,
-         23,
-         7,
-         15,
-         8,
-         1,
-         32,
-         10,
-         33,
-         18,
-         17,
-         22,
-         11,
-         14,
-         35,
-         6,
-         13,
-         12,
-         2,
-         4,
-         5,
-         3,
+         -1,
+         79,
          -1,
          -1,
+         80,
          -1,
+         81,
          -1,
+         82,
          -1,
+         83,
          -1,
+         84,
          -1,
+         85,
          -1,
-         27,
+         86,
          -1,
-         28,
+         87,
          -1,
+         88,
          -1,
+         89,
          -1,
+         90,
          -1,
+         91,
          -1,
          -1,
+         92,
          -1,
+         93,
          -1,
+         94,
          -1,
+         95,
          -1,
+         96,
          -1,
          -1,
          -1,
+         97,
          -1,
+         98,
          -1,
          -1,
+         101,
+         100,
+         99,
          -1,
+         102,
          -1,
+         103,
          -1,
+         104,
          -1,
+         105,
          -1,
+         106,
          -1,
+         107,
          -1,
-         24,
-         25,
+         108,
          -1,
-         26,
+         109,
          -1,
-         29,
+         110,
          -1,
-         36,
+         111,
          -1,
-         37,
-         38,
+         112,
          -1,
-         39,
+         113,
          -1,
-         30,
+         114,
          -1,
-         40,
+         115,
          -1,
-         31,
+         116,
          -1,
-         2,
+         117,
          -1,
+         118,
          -1,
-         1,
+         119,
          -1,
-         4,
-         4,
-         4,
-         3,
-         5,
-         14,
-         6,
-         7,
-         2,
-         1,
-         8,
-         9,
-         10,
-         11,
+         120,
          -1,
+         121,
          -1,
          -1,
+         122,
          -1,
+         123,
          -1,
+         124,
          -1,
+         125,
          -1,
+         126,
          -1,
+         127,
          -1,
+         128,
          -1,
+         129,
          -1,
+         130,
          -1,
+         131,
          -1,
+         132,
          -1,
-         12,
-         13,
+         133,
          -1,
-         9,
-         1,
-         2,
-         3,
-         4,
-         5,
-         6,
+         134,
          -1,
+         135,
          -1,
+         136,
          -1,
+         137,
          -1,
+         138,
          -1,
+         139,
          -1,
+         140,
          -1,
+         141,
          -1,
+         142,
          -1,
-         7,
-         8,
+         143,
          -1,
-         10,
-         1,
-         9,
-         2,
-         3,
-         4,
-         5,
+         144,
          -1,
          -1,
+         145,
          -1,
+         146,
          -1,
+         147,
          -1,
+         148,
          -1,
+         149,
          -1,
+         150,
          -1,
+         151,
          -1,
-         6,
-         7,
+         152,
          -1,
-         8,
+         153,
          -1,
-         11,
-         1,
-         10,
-         2,
-         3,
-         4,
-         5,
+         154,
+         -1,
+         155,
          -1,
+         156,
          -1,
+         157,
          -1,
+         158,
          -1,
          -1,
          -1,
+         159,
          -1,
+         160,
          -1,
          -1,
+         161,
          -1,
-         6,
-         7,
          -1,
-         8,
-         12,
+         162,
          -1,
-         9,
+         163,
          -1,
-         1,
-         2,
-         9,
-         3,
-         4,
-         5,
-         6,
+         164,
          -1,
+         165,
          -1,
+         166,
          -1,
+         167,
          -1,
+         168,
          -1,
+         169,
          -1,
          -1,
+         170,
          -1,
+         171,
          -1,
-         7,
-         8,
          -1,
-         9,
-         8,
-         1,
-         2,
+         26,
          3,
+         2,
+         1,
          4,
+         12,
+         9,
+         24,
+         21,
+         24,
+         26,
+         11,
+         18,
+         17,
+         16,
+         15,
+         26,
+         13,
+         26,
+         5,
+         23,
+         25,
+         8,
+         19,
+         7,
+         14,
+         22,
+         6,
+         26,
+         10,
+         26,
+         6,
+         20,
          -1,
          -1,
          -1,
@@ -11608,31 +10613,15 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         5,
-         6,
          -1,
-         7,
          -1,
-         1,
-         1,
-         1,
-         2,
-         3,
-         14,
-         4,
-         5,
-         6,
-         7,
-         8,
-         9,
-         10,
-         11,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         27,
          -1,
          -1,
          -1,
@@ -11641,58 +10630,66 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         12,
-         13,
          -1,
-         1,
-         2,
          -1,
          -1,
          -1,
+         27,
+         26,
+         25,
+         24,
+         23,
+         22,
+         10,
+         21,
+         10,
+         20,
+         19,
+         18,
+         17,
+         16,
+         15,
+         14,
+         13,
+         12,
+         4,
+         2,
+         11,
+         6,
          3,
+         7,
+         9,
+         5,
          1,
+         5,
+         8,
          -1,
+         28,
          -1,
+         29,
          -1,
-         2,
+         30,
          -1,
-         4,
-         1,
          -1,
          -1,
          -1,
          -1,
-         2,
-         5,
          -1,
-         3,
          -1,
-         2,
          -1,
          -1,
-         1,
+         32,
+         31,
          -1,
-         1,
-         1,
-         1,
-         2,
-         14,
-         3,
-         4,
-         5,
-         6,
-         7,
-         8,
-         9,
-         10,
-         11,
          -1,
+         33,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         34,
          -1,
          -1,
          -1,
@@ -11700,47 +10697,46 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         12,
-         13,
          -1,
-         1,
-         8,
-         2,
-         3,
-         4,
-         5,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         36,
+         35,
          -1,
+         37,
          -1,
-         6,
+         38,
+         -1,
+         39,
+         -1,
+         -1,
+         40,
+         -1,
+         -1,
+         11,
+         10,
+         9,
+         8,
          7,
-         -1,
          4,
-         4,
-         5,
-         23,
-         7,
-         9,
-         10,
-         10,
-         10,
-         11,
          1,
-         22,
-         6,
-         12,
          2,
-         24,
+         6,
          3,
-         8,
+         5,
+         5,
+         -1,
          13,
+         12,
+         -1,
          14,
+         -1,
          15,
+         -1,
          16,
          -1,
          -1,
@@ -11755,7 +10751,23 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         13,
+         12,
+         11,
+         10,
+         6,
+         6,
+         9,
+         8,
+         7,
+         3,
+         5,
+         2,
+         1,
+         2,
+         4,
          -1,
+         14,
          -1,
          -1,
          -1,
@@ -11763,54 +10775,51 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         16,
+         15,
          -1,
-         17,
-         18,
          -1,
-         19,
          -1,
-         25,
          -1,
-         26,
-         27,
          -1,
-         28,
          -1,
-         20,
          -1,
-         29,
          -1,
-         21,
          -1,
-         6,
-         27,
-         7,
-         8,
-         8,
+         26,
+         25,
+         24,
+         23,
+         22,
+         21,
          9,
-         14,
-         15,
-         15,
-         15,
+         20,
+         9,
+         19,
+         18,
+         17,
          16,
-         1,
-         26,
-         10,
-         5,
-         4,
+         15,
+         14,
          13,
+         12,
          11,
          2,
-         28,
+         10,
+         5,
          3,
-         12,
-         17,
-         18,
-         19,
-         20,
+         6,
+         8,
+         4,
+         1,
+         4,
+         7,
          -1,
+         27,
          -1,
+         28,
          -1,
+         29,
          -1,
          -1,
          -1,
@@ -11819,14 +10828,18 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         31,
+         30,
          -1,
          -1,
+         32,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         33,
          -1,
          -1,
          -1,
@@ -11834,31 +10847,33 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         21,
-         22,
          -1,
-         23,
          -1,
-         29,
          -1,
-         30,
-         31,
          -1,
-         32,
          -1,
-         24,
          -1,
-         33,
          -1,
-         25,
+         35,
+         34,
+         -1,
+         36,
+         -1,
+         37,
+         -1,
+         38,
+         -1,
+         -1,
+         39,
+         -1,
          -1,
-         3,
-         1,
-         4,
-         5,
          6,
+         4,
+         4,
+         1,
          2,
-         2,
+         5,
+         3,
          -1,
          -1,
          -1,
@@ -11866,46 +10881,33 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         3,
-         6,
-         7,
+         23,
+         22,
+         21,
+         20,
+         19,
+         18,
          8,
          8,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         9,
-         10,
-         10,
-         10,
-         18,
-         2,
-         15,
-         11,
          17,
          16,
-         1,
-         12,
-         13,
-         4,
+         15,
          14,
+         13,
+         12,
+         11,
+         10,
+         9,
+         3,
          5,
-         19,
-         20,
-         21,
-         22,
-         23,
+         4,
+         7,
+         2,
+         1,
+         2,
+         6,
+         -1,
          24,
-         25,
-         26,
-         27,
          -1,
          -1,
          -1,
@@ -11915,9 +10917,16 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         26,
+         25,
+         -1,
+         -1,
+         -1,
+         -1,
          -1,
          -1,
          -1,
+         27,
          -1,
          -1,
          -1,
@@ -11928,53 +10937,42 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         29,
+         28,
          -1,
+         30,
          -1,
+         31,
          -1,
+         32,
          -1,
          -1,
+         33,
+         -1,
          -1,
-         3,
-         4,
-         9,
-         11,
-         12,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         13,
-         14,
-         17,
-         18,
-         19,
          19,
-         20,
-         1,
-         6,
-         7,
-         15,
-         8,
+         18,
+         17,
          16,
-         5,
+         15,
+         14,
+         7,
+         7,
+         13,
+         12,
+         11,
          10,
-         21,
-         22,
-         23,
-         24,
-         25,
-         26,
-         27,
-         2,
+         9,
+         8,
+         3,
+         4,
+         6,
          2,
+         1,
          2,
+         5,
          -1,
+         20,
          -1,
          -1,
          -1,
@@ -11983,10 +10981,13 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         22,
+         21,
          -1,
          -1,
          -1,
          -1,
+         23,
          -1,
          -1,
          -1,
@@ -11997,68 +10998,53 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         25,
+         24,
          -1,
+         26,
          -1,
+         27,
          -1,
+         28,
          -1,
          -1,
-         12,
-         1,
-         2,
-         13,
-         14,
-         3,
-         4,
-         5,
-         6,
-         -1,
-         -1,
-         8,
-         -1,
-         -1,
+         29,
          -1,
          -1,
+         6,
+         5,
+         4,
+         3,
+         2,
+         1,
          -1,
          -1,
+         8,
+         7,
          -1,
          -1,
          -1,
          -1,
-         7,
          -1,
-         9,
-         10,
          -1,
-         11,
          -1,
-         4,
-         5,
-         5,
          5,
+         4,
+         3,
          6,
-         11,
-         27,
-         13,
-         14,
-         14,
-         15,
-         1,
-         12,
-         26,
-         10,
          9,
-         16,
          7,
          8,
-         28,
-         3,
+         11,
+         10,
          2,
-         17,
-         18,
-         19,
-         20,
+         1,
+         12,
+         12,
          -1,
          -1,
+         14,
+         13,
          -1,
          -1,
          -1,
@@ -12072,6 +11058,16 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         7,
+         6,
+         5,
+         4,
+         3,
+         2,
+         1,
+         -1,
+         9,
+         8,
          -1,
          -1,
          -1,
@@ -12081,80 +11077,62 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         6,
+         5,
+         4,
+         3,
+         2,
+         1,
          -1,
+         7,
          -1,
-         21,
-         22,
+         9,
+         8,
          -1,
-         23,
          -1,
-         29,
          -1,
-         30,
-         31,
          -1,
-         32,
          -1,
-         24,
          -1,
-         33,
          -1,
-         25,
          -1,
-         19,
-         2,
          7,
-         17,
-         3,
-         18,
-         1,
          6,
          5,
          4,
-         8,
-         9,
-         10,
-         11,
-         -1,
-         -1,
-         -1,
-         -1,
+         3,
+         2,
+         1,
          -1,
+         9,
+         8,
          -1,
          -1,
-         15,
+         11,
+         10,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         12,
          -1,
          -1,
          -1,
          -1,
-         12,
-         13,
+         7,
+         6,
+         5,
+         4,
+         3,
+         2,
+         1,
          -1,
-         14,
          -1,
-         16,
          -1,
-         1,
-         1,
-         1,
-         2,
-         3,
-         4,
-         15,
-         5,
-         6,
-         7,
-         8,
          9,
-         10,
-         11,
-         12,
+         8,
          -1,
          -1,
          -1,
@@ -12162,65 +11140,46 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         7,
+         6,
+         5,
+         4,
+         3,
+         2,
+         1,
          -1,
+         8,
          -1,
          -1,
+         10,
+         9,
          -1,
          -1,
          -1,
          -1,
          -1,
-         13,
-         14,
          -1,
-         1,
          -1,
          -1,
-         4,
-         6,
-         6,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
-         7,
+         12,
+         11,
+         10,
+         9,
+         8,
          7,
-         1,
-         1,
-         1,
-         2,
+         6,
          5,
+         4,
+         2,
          3,
-         8,
-         9,
-         10,
-         11,
-         12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
-         21,
-         22,
-         23,
-         24,
-         25,
-         26,
-         27,
-         -1,
+         1,
+         1,
          -1,
          -1,
          -1,
          -1,
+         14,
+         13,
          -1,
          -1,
          -1,
@@ -12232,76 +11191,61 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         2,
+         1,
          -1,
          -1,
          -1,
+         1,
          -1,
+         2,
          -1,
          -1,
+         2,
+         1,
          -1,
+         4,
+         3,
          -1,
          -1,
          -1,
+         5,
          -1,
          -1,
+         2,
          1,
          -1,
-         -1,
-         1,
-         2,
          3,
-         4,
-         5,
-         -1,
-         -1,
          -1,
          -1,
          -1,
-         -1,
-         5,
          1,
-         6,
          -1,
          2,
          -1,
          -1,
-         -1,
-         -1,
-         3,
-         -1,
-         4,
-         -1,
-         2,
-         5,
-         6,
-         6,
-         6,
-         24,
-         9,
+         10,
          9,
-         1,
-         7,
-         22,
-         12,
-         11,
          8,
-         10,
-         23,
-         4,
-         3,
-         13,
-         14,
-         15,
-         16,
-         -1,
-         -1,
-         -1,
+         7,
+         6,
+         5,
+         1,
+         4,
+         2,
+         3,
+         3,
          -1,
+         11,
          -1,
+         12,
          -1,
          -1,
          -1,
+         14,
+         13,
          -1,
+         15,
          -1,
          -1,
          -1,
@@ -12312,49 +11256,42 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         5,
+         4,
+         1,
+         3,
+         2,
          -1,
          -1,
          -1,
-         17,
-         18,
          -1,
-         25,
          -1,
-         19,
          -1,
-         26,
-         27,
+         14,
+         13,
+         12,
+         11,
+         10,
+         9,
+         8,
+         7,
+         6,
+         5,
+         4,
+         1,
+         3,
+         2,
          -1,
-         28,
+         15,
          -1,
-         20,
+         16,
          -1,
-         29,
          -1,
-         21,
+         18,
+         17,
          -1,
-         4,
-         4,
-         4,
-         7,
-         7,
-         2,
-         21,
-         3,
-         1,
-         5,
-         22,
-         9,
-         6,
-         8,
-         23,
-         10,
-         11,
-         12,
-         13,
-         14,
-         15,
          -1,
+         19,
          -1,
          -1,
          -1,
@@ -12369,73 +11306,71 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         1,
          -1,
          -1,
+         1,
          -1,
          -1,
+         10,
+         9,
+         8,
+         11,
+         4,
+         2,
+         3,
+         12,
+         7,
+         6,
+         1,
+         5,
+         13,
+         13,
          -1,
          -1,
-         16,
          -1,
-         17,
-         18,
          -1,
-         24,
          -1,
-         25,
-         26,
          -1,
-         27,
          -1,
-         19,
+         15,
+         14,
          -1,
-         28,
          -1,
-         20,
          -1,
-         1,
-         1,
-         5,
-         2,
-         3,
          -1,
          -1,
          -1,
          -1,
          -1,
-         4,
          -1,
+         23,
          22,
-         5,
-         5,
-         7,
-         3,
-         4,
-         6,
          21,
-         8,
-         2,
-         1,
-         13,
+         20,
+         19,
+         18,
+         9,
          9,
+         17,
+         16,
+         15,
+         14,
+         13,
          12,
          11,
+         8,
          10,
-         14,
-         15,
-         16,
-         17,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
+         3,
+         5,
+         4,
+         7,
+         2,
+         1,
+         2,
+         6,
          -1,
+         24,
          -1,
          -1,
          -1,
@@ -12446,74 +11381,57 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         18,
-         19,
+         26,
+         25,
          -1,
-         20,
          -1,
-         1,
-         1,
-         2,
-         7,
-         3,
-         4,
-         5,
          -1,
          -1,
          -1,
          -1,
+         27,
          -1,
          -1,
          -1,
-         6,
          -1,
-         3,
-         3,
-         5,
-         12,
-         2,
-         4,
-         1,
-         6,
-         7,
-         8,
-         9,
-         10,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         29,
+         28,
          -1,
+         30,
          -1,
+         31,
          -1,
+         32,
          -1,
          -1,
+         33,
          -1,
-         11,
          -1,
-         15,
-         4,
-         4,
+         9,
+         8,
+         7,
          6,
-         2,
-         3,
          5,
-         7,
+         4,
+         3,
+         2,
          1,
-         8,
-         9,
-         10,
-         11,
-         12,
-         13,
-         -1,
          -1,
+         10,
          -1,
          -1,
+         11,
          -1,
+         13,
+         12,
          -1,
+         14,
          -1,
          -1,
          -1,
@@ -12523,47 +11441,40 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         14,
          -1,
+         26,
          3,
-         6,
-         9,
-         9,
-         9,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         10,
-         1,
-         1,
          2,
-         5,
-         8,
+         1,
          4,
-         7,
-         11,
          12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
+         9,
+         24,
          21,
-         22,
-         23,
          24,
+         26,
+         11,
+         18,
+         17,
+         16,
+         15,
+         26,
+         13,
+         26,
+         5,
+         23,
          25,
+         8,
+         19,
+         7,
+         14,
+         22,
+         6,
+         26,
+         10,
          26,
+         6,
+         20,
          -1,
          -1,
          -1,
@@ -12591,34 +11502,36 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         22,
-         7,
-         7,
+         19,
+         18,
+         17,
+         16,
+         15,
+         14,
+         5,
+         5,
+         13,
+         12,
+         11,
+         10,
          9,
-         1,
+         8,
+         7,
          6,
          3,
-         8,
-         21,
-         4,
-         5,
-         23,
-         10,
-         11,
-         12,
-         13,
-         14,
-         15,
-         2,
-         2,
          2,
+         1,
+         4,
          -1,
+         20,
          -1,
          -1,
          -1,
          -1,
          -1,
          -1,
+         22,
+         21,
          -1,
          -1,
          -1,
@@ -12633,47 +11546,31 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         16,
-         17,
-         -1,
-         18,
-         -1,
-         24,
-         -1,
-         25,
-         26,
          -1,
-         27,
          -1,
          19,
-         -1,
-         28,
-         -1,
-         20,
-         -1,
-         2,
-         5,
-         6,
-         6,
-         6,
-         23,
-         9,
-         9,
-         1,
+         18,
+         17,
+         16,
+         15,
+         14,
          7,
+         7,
+         13,
+         12,
          11,
-         21,
-         8,
          10,
-         22,
-         4,
+         9,
+         8,
          3,
-         12,
-         13,
-         14,
-         15,
-         -1,
+         4,
+         6,
+         2,
+         1,
+         2,
+         5,
          -1,
+         20,
          -1,
          -1,
          -1,
@@ -12681,11 +11578,14 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         22,
+         21,
          -1,
          -1,
          -1,
          -1,
          -1,
+         23,
          -1,
          -1,
          -1,
@@ -12693,46 +11593,39 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         16,
-         17,
          -1,
-         24,
          -1,
-         18,
          -1,
          25,
+         24,
+         -1,
          26,
          -1,
          27,
          -1,
-         19,
-         -1,
          28,
          -1,
-         20,
          -1,
-         22,
-         7,
-         7,
-         9,
-         1,
-         6,
+         29,
+         -1,
+         -1,
+         14,
+         13,
          3,
-         21,
+         3,
+         12,
+         11,
+         10,
+         9,
          8,
-         4,
+         7,
+         6,
          5,
-         23,
-         10,
-         11,
-         12,
-         13,
-         14,
-         15,
-         2,
-         2,
+         4,
+         1,
          2,
          -1,
+         15,
          -1,
          -1,
          -1,
@@ -12748,124 +11641,82 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         11,
+         10,
+         8,
+         8,
+         1,
+         3,
+         5,
+         2,
+         9,
+         6,
+         4,
+         7,
          -1,
          -1,
          -1,
          -1,
+         12,
          -1,
-         16,
-         17,
          -1,
-         18,
          -1,
-         24,
          -1,
-         25,
-         26,
          -1,
-         27,
          -1,
-         19,
          -1,
-         28,
          -1,
-         20,
          -1,
          1,
          1,
-         2,
-         3,
-         -1,
-         -1,
-         -1,
-         -1,
-         7,
-         8,
-         8,
-         8,
-         25,
-         10,
-         10,
-         12,
          6,
-         9,
-         11,
-         23,
-         1,
-         13,
-         2,
          5,
-         24,
          4,
          3,
-         14,
-         15,
-         16,
-         17,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
+         2,
          -1,
          -1,
          -1,
+         7,
          -1,
          -1,
          -1,
-         18,
-         19,
          -1,
-         26,
          -1,
-         20,
+         1,
+         1,
+         4,
+         3,
+         2,
          -1,
-         27,
-         28,
          -1,
-         29,
+         5,
          -1,
-         21,
          -1,
-         30,
          -1,
-         22,
          -1,
-         2,
-         2,
-         4,
-         19,
-         1,
-         3,
          18,
-         5,
+         17,
+         16,
+         15,
+         14,
+         13,
+         7,
+         7,
+         12,
+         11,
          10,
-         6,
          9,
          8,
-         7,
-         11,
-         12,
-         13,
-         14,
-         -1,
-         -1,
-         -1,
-         -1,
-         -1,
+         3,
+         4,
+         6,
+         2,
+         1,
+         2,
+         5,
          -1,
+         19,
          -1,
          -1,
          -1,
@@ -12873,128 +11724,119 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         21,
+         20,
          -1,
          -1,
          -1,
          -1,
+         22,
          -1,
-         15,
-         16,
          -1,
-         17,
          -1,
-         1,
          -1,
          -1,
-         1,
          -1,
          -1,
-         1,
-         2,
          -1,
          -1,
          -1,
-         2,
-         2,
-         3,
-         1,
-         1,
-         1,
-         22,
-         4,
-         5,
-         6,
-         7,
-         23,
-         8,
-         9,
-         10,
          24,
-         11,
-         12,
-         13,
-         14,
-         15,
-         16,
+         23,
+         -1,
+         25,
          -1,
+         26,
          -1,
+         27,
          -1,
          -1,
+         28,
          -1,
          -1,
+         3,
+         2,
+         1,
          -1,
+         4,
          -1,
+         5,
          -1,
+         6,
          -1,
          -1,
          -1,
          -1,
+         1,
          -1,
          -1,
+         1,
          -1,
          -1,
+         16,
+         15,
+         14,
+         13,
+         12,
+         11,
+         4,
+         4,
+         10,
+         9,
+         8,
+         7,
+         6,
+         5,
+         2,
+         1,
+         3,
          -1,
+         17,
          -1,
          -1,
          -1,
          -1,
-         17,
          -1,
-         18,
          19,
+         18,
          -1,
-         25,
          -1,
-         26,
-         27,
          -1,
-         28,
          -1,
-         20,
          -1,
-         29,
          -1,
-         21,
          -1,
-         1,
-         2,
          -1,
          -1,
          -1,
-         1,
-         2,
-         2,
          -1,
          -1,
          -1,
-         28,
-         5,
-         5,
+         -1,
+         20,
+         19,
+         18,
+         17,
+         16,
+         15,
+         7,
          7,
          14,
-         15,
-         15,
-         15,
+         13,
+         12,
+         11,
+         10,
+         9,
+         8,
          3,
          4,
-         16,
          6,
-         17,
-         27,
-         8,
          2,
          1,
-         13,
-         9,
-         12,
-         29,
-         11,
-         10,
-         18,
-         19,
-         20,
-         21,
+         2,
+         5,
          -1,
+         21,
          -1,
          -1,
          -1,
@@ -13003,11 +11845,14 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         23,
+         22,
          -1,
          -1,
          -1,
          -1,
          -1,
+         24,
          -1,
          -1,
          -1,
@@ -13018,50 +11863,49 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         26,
+         25,
          -1,
+         27,
          -1,
+         28,
          -1,
-         22,
-         23,
+         29,
          -1,
-         24,
          -1,
          30,
          -1,
-         31,
-         32,
          -1,
-         33,
+         1,
+         1,
+         3,
+         2,
          -1,
-         25,
          -1,
-         34,
          -1,
-         26,
          -1,
-         23,
+         18,
+         17,
+         16,
+         15,
+         14,
+         13,
          7,
          7,
+         12,
+         11,
+         10,
          9,
-         1,
-         6,
-         3,
          8,
-         22,
-         10,
+         3,
          4,
-         5,
-         24,
-         11,
-         12,
-         13,
-         14,
-         15,
-         16,
-         2,
+         6,
          2,
+         1,
          2,
+         5,
          -1,
+         19,
          -1,
          -1,
          -1,
@@ -13070,9 +11914,12 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         21,
+         20,
          -1,
          -1,
          -1,
+         22,
          -1,
          -1,
          -1,
@@ -13083,51 +11930,47 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         17,
-         18,
-         -1,
-         19,
+         24,
+         23,
          -1,
          25,
          -1,
          26,
+         -1,
          27,
          -1,
-         28,
          -1,
-         20,
+         28,
          -1,
-         29,
          -1,
+         24,
+         23,
+         22,
          21,
-         -1,
-         27,
-         5,
-         5,
-         7,
-         8,
-         9,
+         20,
+         19,
          9,
          9,
-         2,
-         4,
+         18,
+         17,
+         16,
+         15,
+         14,
+         13,
+         12,
+         11,
+         8,
          10,
-         6,
          3,
-         26,
+         5,
+         4,
+         7,
+         2,
          1,
-         11,
-         12,
-         13,
-         14,
-         28,
-         15,
-         16,
-         17,
-         18,
-         19,
-         20,
+         2,
+         6,
          -1,
+         25,
          -1,
          -1,
          -1,
@@ -13138,6 +11981,8 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         27,
+         26,
          -1,
          -1,
          -1,
@@ -13145,6 +11990,7 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         28,
          -1,
          -1,
          -1,
@@ -13153,113 +11999,94 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         21,
-         22,
          -1,
-         23,
          -1,
+         30,
          29,
          -1,
-         30,
          31,
          -1,
          32,
          -1,
-         24,
-         -1,
          33,
          -1,
-         25,
-         -1,
-         4,
-         6,
-         6,
-         6,
-         23,
-         5,
-         1,
-         7,
-         3,
-         8,
-         24,
-         9,
-         10,
-         11,
-         25,
-         12,
-         13,
-         14,
-         15,
-         16,
-         17,
-         2,
-         2,
-         -1,
-         -1,
          -1,
+         34,
          -1,
          -1,
+         2,
+         2,
+         1,
          -1,
          -1,
          -1,
+         2,
+         1,
          -1,
          -1,
          -1,
+         2,
+         1,
          -1,
          -1,
          -1,
+         2,
+         1,
          -1,
+         3,
          -1,
+         4,
          -1,
+         5,
          -1,
+         6,
          -1,
+         7,
          -1,
+         8,
          -1,
+         9,
          -1,
+         10,
          -1,
-         18,
+         11,
          -1,
-         19,
-         20,
+         12,
          -1,
-         26,
+         13,
          -1,
-         27,
-         28,
          -1,
-         29,
+         14,
          -1,
-         21,
+         15,
          -1,
-         30,
+         16,
          -1,
-         22,
          -1,
-         24,
-         2,
-         3,
+         20,
+         19,
+         18,
+         17,
+         16,
+         15,
+         8,
+         8,
+         14,
+         13,
+         12,
+         11,
+         10,
+         7,
+         9,
          3,
          4,
-         5,
-         9,
-         10,
-         10,
-         10,
-         11,
-         1,
-         23,
          6,
-         12,
-         13,
-         25,
-         8,
-         7,
-         14,
-         15,
-         16,
-         17,
-         -1,
+         2,
+         1,
+         2,
+         5,
          -1,
+         21,
          -1,
          -1,
          -1,
@@ -13269,10 +12096,13 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
+         23,
+         22,
          -1,
          -1,
          -1,
          -1,
+         24,
          -1,
          -1,
          -1,
@@ -13281,63 +12111,35 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         18,
-         19,
          -1,
-         20,
          -1,
          26,
+         25,
          -1,
          27,
+         -1,
          28,
          -1,
          29,
          -1,
-         21,
          -1,
          30,
          -1,
-         22,
-         -1,
-         3,
-         4,
-         -1,
-         -1,
-         -1,
-         5,
-         -1,
-         6,
          -1,
          7,
-         -1,
-         12,
-         -1,
-         8,
-         -1,
-         16,
-         -1,
-         10,
-         -1,
+         6,
+         5,
+         4,
          1,
-         -1,
+         1,
+         3,
          2,
          -1,
-         9,
-         -1,
-         11,
-         -1,
-         15,
          -1,
-         13,
          -1,
-         14,
+         9,
+         8,
          -1,
-         1,
-         1,
-         2,
-         3,
-         4,
-         5,
          -1,
          -1,
          -1,
@@ -13346,66 +12148,60 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          2,
          2,
-         1,
-         9,
-         3,
-         4,
          5,
-         6,
-         -1,
-         -1,
-         -1,
-         -1,
+         4,
+         3,
+         1,
          -1,
          -1,
          -1,
          -1,
          -1,
-         7,
-         8,
          -1,
          4,
          4,
-         2,
          1,
          3,
+         2,
          -1,
          -1,
          -1,
          -1,
          -1,
-         2,
+         1,
          -1,
+         2,
          -1,
          3,
          -1,
          4,
          -1,
+         5,
+         -1,
+         6,
+         -1,
          7,
          -1,
          8,
          -1,
-         10,
-         -1,
-         5,
+         9,
          -1,
-         6,
+         10,
          -1,
-         1,
          -1,
          9,
-         -1,
-         3,
-         11,
+         8,
+         7,
+         6,
+         5,
          4,
+         3,
          2,
          1,
-         5,
-         6,
-         7,
-         8,
          -1,
          -1,
+         11,
+         10,
          -1,
          -1,
          -1,
@@ -13415,13 +12211,11 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1,
          -1,
          -1,
-         9,
-         10,
          -1,
+         4,
+         3,
          1,
          2,
-         3,
-         4,
          -1,
          -1,
          -1,
@@ -13429,387 +12223,4117 @@ UNICC_STATIC int _dfa_trans[ 4003 ] =
          -1
 };
 
-/* DFA acception states */
-UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
+/* DFA transitions on the character classes of the ASCII characters */
+UNICC_STATIC signed char _dfa_dense[ 3960 ] =
 {
-    {
-        0,
-        65,
-        63,
-        47,
-        45,
-        42,
-        43,
-        44,
+        -1,
+        -1,
+        10,
+        9,
+        8,
+        7,
+        -1,
+        -1,
+        6,
+        -1,
+        5,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        -1,
+        1,
+        27,
+        3,
+        26,
+        2,
+        4,
+        12,
+        9,
+        24,
+        21,
+        24,
+        27,
+        11,
+        18,
+        17,
+        16,
+        15,
+        27,
+        13,
+        27,
+        5,
+        23,
+        25,
+        8,
+        19,
+        7,
+        14,
+        22,
+        6,
+        27,
+        10,
+        27,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        20,
+        -1,
+        26,
+        3,
+        2,
+        1,
+        4,
+        12,
+        9,
+        24,
+        21,
+        24,
+        26,
+        11,
+        18,
+        17,
+        16,
+        15,
+        26,
+        13,
+        26,
+        5,
+        23,
+        25,
+        8,
+        19,
+        7,
+        14,
+        22,
+        6,
+        26,
+        10,
+        26,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        6,
+        20,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        5,
+        -1,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        -1,
+        -1,
+        -1,
+        40,
+        39,
+        38,
+        37,
+        36,
+        35,
+        34,
+        33,
+        32,
+        31,
+        30,
+        29,
+        28,
+        27,
+        26,
+        25,
+        24,
+        23,
+        -1,
+        4,
+        21,
+        17,
+        5,
+        -1,
+        18,
+        20,
+        22,
+        1,
+        -1,
+        -1,
+        22,
+        22,
+        8,
+        10,
+        7,
+        12,
+        3,
+        22,
+        22,
+        15,
+        16,
+        2,
+        6,
+        11,
+        9,
+        14,
+        22,
+        22,
+        22,
+        13,
+        22,
+        22,
+        19,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        7,
+        6,
+        5,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        1,
+        3,
+        -1,
+        -1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        -1,
+        -1,
+        -1,
+        8,
+        7,
+        6,
+        5,
+        -1,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        -1,
+        -1,
+        -1,
+        6,
+        5,
+        4,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        6,
+        5,
+        4,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        -1,
+        -1,
+        -1,
+        15,
+        14,
+        13,
+        12,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        11,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        6,
+        3,
+        8,
+        2,
+        -1,
+        -1,
+        9,
+        -1,
+        1,
+        -1,
+        7,
+        5,
+        -1,
+        -1,
+        -1,
+        -1,
+        10,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        9,
+        8,
+        7,
+        4,
+        -1,
+        -1,
+        -1,
+        5,
+        -1,
+        3,
+        -1,
+        2,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        6,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        27,
+        26,
+        25,
+        24,
+        23,
+        22,
+        10,
+        21,
+        10,
+        20,
+        19,
+        18,
+        17,
+        16,
+        15,
+        14,
+        13,
+        12,
+        4,
+        2,
+        11,
+        6,
+        3,
+        -1,
+        7,
+        9,
+        5,
+        1,
+        -1,
+        -1,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        8,
+        -1,
+        -1,
+        11,
+        10,
+        9,
+        8,
+        -1,
+        -1,
+        -1,
+        7,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        -1,
+        1,
+        -1,
+        2,
+        -1,
+        6,
+        3,
+        -1,
+        -1,
+        -1,
+        5,
+        -1,
+        -1,
+        -1,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        -1,
+        -1,
+        -1,
+        13,
+        12,
+        11,
+        10,
+        -1,
+        -1,
+        6,
+        -1,
+        6,
+        -1,
+        -1,
+        -1,
+        9,
+        -1,
+        -1,
+        -1,
+        -1,
+        8,
+        -1,
+        -1,
+        7,
+        -1,
+        3,
+        -1,
+        -1,
+        5,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        4,
+        -1,
+        -1,
+        26,
+        25,
+        24,
+        23,
+        22,
+        21,
+        9,
+        20,
+        9,
+        19,
+        18,
+        17,
+        16,
+        15,
+        14,
+        13,
+        12,
+        11,
+        -1,
+        2,
+        10,
+        5,
+        3,
+        -1,
+        6,
+        8,
+        4,
+        1,
+        -1,
+        -1,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        6,
+        4,
+        -1,
+        4,
+        -1,
+        1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        5,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        23,
+        22,
+        21,
+        20,
+        19,
+        18,
+        8,
+        -1,
+        8,
+        17,
+        16,
+        15,
+        14,
+        13,
+        12,
+        -1,
+        11,
+        10,
+        -1,
+        -1,
+        9,
+        3,
+        5,
+        -1,
+        4,
+        7,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        6,
+        -1,
+        -1,
+        19,
+        18,
+        17,
+        16,
+        15,
+        14,
+        7,
+        -1,
+        7,
+        13,
+        12,
+        11,
+        10,
+        -1,
+        -1,
+        -1,
+        -1,
+        9,
+        -1,
+        -1,
+        8,
+        3,
+        4,
+        -1,
+        -1,
+        6,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        5,
+        -1,
+        -1,
+        6,
+        5,
+        4,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        5,
+        4,
+        3,
+        6,
+        9,
+        7,
+        -1,
+        -1,
+        -1,
+        -1,
+        8,
+        11,
+        -1,
+        -1,
+        -1,
+        -1,
+        10,
+        2,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        12,
+        -1,
+        -1,
+        -1,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        12,
+        -1,
+        -1,
+        -1,
+        7,
+        6,
+        5,
+        4,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        6,
+        5,
+        4,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        7,
+        6,
+        5,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        7,
+        6,
+        5,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        2,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        7,
+        6,
+        5,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        12,
+        11,
+        10,
+        9,
+        8,
+        7,
+        -1,
+        -1,
+        -1,
+        -1,
+        6,
+        5,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        3,
+        1,
+        -1,
+        -1,
+        -1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        10,
+        9,
+        8,
+        7,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        6,
+        -1,
+        5,
+        -1,
+        1,
+        -1,
+        4,
+        2,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        5,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        14,
+        13,
+        12,
+        11,
+        10,
+        9,
+        -1,
+        -1,
+        -1,
+        -1,
+        8,
+        7,
+        -1,
+        -1,
+        -1,
+        6,
+        5,
+        4,
+        -1,
+        1,
+        3,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        10,
+        9,
+        8,
+        11,
+        4,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        12,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        7,
+        -1,
+        -1,
+        6,
+        1,
+        -1,
+        -1,
+        -1,
+        5,
+        13,
+        -1,
+        -1,
+        -1,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        13,
+        -1,
+        -1,
+        -1,
+        23,
+        22,
+        21,
+        20,
+        19,
+        18,
+        9,
+        -1,
+        9,
+        17,
+        16,
+        15,
+        14,
+        13,
+        12,
+        -1,
+        -1,
+        11,
+        -1,
+        8,
+        10,
+        3,
+        5,
+        -1,
+        4,
+        7,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        6,
+        -1,
+        -1,
+        9,
+        8,
+        7,
+        6,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        5,
+        -1,
+        4,
+        -1,
+        3,
+        -1,
+        2,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        19,
+        18,
+        17,
+        16,
+        15,
+        14,
+        5,
+        -1,
+        5,
+        -1,
+        13,
+        12,
+        11,
+        10,
+        9,
+        -1,
+        8,
+        7,
+        -1,
+        -1,
+        6,
+        -1,
+        3,
+        -1,
+        2,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        -1,
+        -1,
+        19,
+        18,
+        17,
+        16,
+        15,
+        14,
+        7,
+        -1,
+        7,
+        13,
+        12,
+        11,
+        10,
+        -1,
+        -1,
+        -1,
+        9,
+        8,
+        -1,
+        -1,
+        -1,
+        3,
+        4,
+        -1,
+        -1,
+        6,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        5,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        14,
+        13,
+        3,
+        -1,
+        3,
+        -1,
+        12,
+        11,
+        10,
+        9,
+        8,
+        -1,
+        7,
+        -1,
+        -1,
+        -1,
+        6,
+        -1,
+        5,
+        -1,
+        4,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        11,
+        10,
+        8,
+        -1,
+        8,
+        -1,
+        1,
+        3,
+        5,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        9,
+        -1,
+        6,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        7,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        6,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        5,
+        -1,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        18,
+        17,
+        16,
+        15,
+        14,
+        13,
+        7,
+        -1,
+        7,
+        12,
+        11,
+        10,
+        9,
+        -1,
+        -1,
+        -1,
+        -1,
+        8,
+        -1,
+        -1,
+        -1,
+        3,
+        4,
+        -1,
+        -1,
+        6,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        5,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        16,
+        15,
+        14,
+        13,
+        12,
+        11,
+        4,
+        -1,
+        4,
+        -1,
+        10,
+        9,
+        8,
+        -1,
+        -1,
+        -1,
+        7,
+        6,
+        -1,
+        -1,
+        5,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        20,
+        19,
+        18,
+        17,
+        16,
+        15,
+        7,
+        -1,
+        7,
+        14,
+        13,
+        12,
+        11,
+        -1,
+        -1,
+        -1,
+        10,
+        9,
+        -1,
+        -1,
+        8,
+        3,
+        4,
+        -1,
+        -1,
+        6,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        5,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        18,
+        17,
+        16,
+        15,
+        14,
+        13,
+        7,
+        -1,
+        7,
+        12,
+        11,
+        10,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        9,
+        -1,
+        -1,
+        8,
+        3,
+        4,
+        -1,
+        -1,
+        6,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        5,
+        -1,
+        -1,
+        24,
+        23,
+        22,
+        21,
+        20,
+        19,
+        9,
+        -1,
+        9,
+        18,
+        17,
+        16,
+        15,
+        14,
+        13,
+        -1,
+        12,
+        11,
+        -1,
+        8,
+        10,
+        3,
+        5,
+        -1,
+        4,
+        7,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        6,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        20,
+        19,
+        18,
+        17,
+        16,
+        15,
+        8,
+        -1,
+        8,
+        14,
+        13,
+        12,
+        11,
+        -1,
+        -1,
+        -1,
+        -1,
+        10,
+        -1,
+        7,
+        9,
+        3,
+        4,
+        -1,
+        -1,
+        6,
+        2,
+        1,
+        -1,
+        -1,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        2,
+        5,
+        -1,
+        -1,
+        7,
+        6,
+        5,
+        4,
+        -1,
+        -1,
+        1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
         2,
+        -1,
+        -1,
+        -1,
+        5,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
         4,
-        39,
-        38,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        4,
+        -1,
+        4,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        9,
+        8,
+        7,
+        6,
         5,
-        0,
-        65,
-        0
-    },
-    {
-        0,
-        65,
-        63,
-        47,
-        62,
-        49,
-        64,
-        60,
-        54,
-        59,
-        53,
-        50,
-        52,
-        66,
-        57,
-        56,
-        55,
-        61,
-        58,
-        45,
-        42,
-        43,
-        44,
+        4,
+        -1,
+        -1,
+        -1,
+        -1,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
         2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
         4,
-        39,
-        38,
-        5,
-        14,
-        12,
-        13,
-        16,
-        15,
-        18,
-        37,
-        30,
-        7,
-        29,
-        31,
-        32,
-        8,
-        11,
-        27,
-        17,
-        34,
-        28,
-        36,
-        19,
-        20,
-        10,
-        9,
-        33,
-        35,
-        26,
-        21,
-        23,
-        24,
-        25,
-        22,
-        0,
-        65,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        47,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        47,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
+        3,
+        -1,
+        -1,
+        -1,
+        -1,
+        1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        2,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1,
+        -1
+};
+
+/* DFA acception states */
+UNICC_STATIC unsigned char _dfa_accept[ 75 ][ 260 ] =
+{
+    {
         0,
         0,
+        48,
+        64,
         0,
-        0
+        66,
+        66,
+        46,
+        43,
+        44,
+        45,
+        5,
+        2,
+        4,
+        39,
+        40
     },
     {
         0,
-        65,
-        63,
-        61,
-        60,
-        55,
-        51,
-        49,
-        48,
-        47,
-        41,
-        66,
-        64,
+        42,
+        43,
+        45,
         46,
+        47,
+        48,
+        49,
+        50,
+        51,
+        52,
+        53,
         54,
+        55,
         56,
         57,
         58,
         59,
-        52,
+        60,
+        61,
         62,
-        50,
-        53,
-        45,
-        42,
-        43,
+        63,
+        64,
+        65,
+        66,
+        67,
         44,
-        3
+        41
     },
     {
         0,
-        65,
-        63,
-        61,
-        60,
-        55,
-        51,
-        49,
-        48,
-        47,
-        41,
-        66,
-        64,
+        43,
+        44,
+        45,
         46,
+        47,
+        48,
+        49,
+        50,
+        51,
+        52,
+        53,
         54,
+        55,
         56,
         57,
         58,
         59,
-        52,
+        60,
+        61,
         62,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        40
+        63,
+        64,
+        65,
+        66,
+        67,
+        41,
+        3
     },
     {
         0,
-        65,
-        63,
-        47,
-        38,
+        0,
+        48,
+        64,
+        66,
+        66,
         5,
         39,
-        0,
-        65
-    },
-    {
-        0,
-        3,
-        0
+        40
     },
     {
         0,
-        43
-    },
-    {
         0,
-        63,
-        47,
+        48,
+        48,
         65,
-        5,
-        0
-    },
-    {
-        0,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        37,
-        36,
+        61,
+        48,
+        48,
+        48,
+        48,
+        48,
+        48,
+        48,
+        48,
+        48,
+        48,
+        48,
+        50,
+        56,
+        62,
+        64,
+        67,
+        48,
         0,
+        55,
         0,
+        57,
+        58,
+        59,
+        60,
+        53,
         0,
+        66,
+        63,
+        66,
+        51,
+        54,
+        46,
+        43,
+        44,
+        45,
+        5,
         0,
         0,
+        12,
+        13,
+        16,
         0,
         0,
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        37,
-        36,
         0,
         0,
         0,
@@ -13819,101 +16343,26 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        62,
-        47,
-        49,
-        64,
-        60,
-        54,
-        59,
-        53,
-        50,
-        52,
-        66,
-        63,
-        57,
-        56,
-        55,
-        65,
-        61,
-        58,
-        45,
-        42,
-        43,
-        44,
         2,
         4,
         14,
-        12,
-        13,
-        5,
-        7,
-        8,
         0,
+        39,
+        40,
         0,
         0,
+        15,
         0,
         0,
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        63,
-        65,
-        47,
-        66,
-        60,
-        61,
-        58,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
         0,
-        0
-    },
-    {
         0,
-        66
-    },
-    {
         0,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
         18,
-        30,
-        29,
-        31,
-        32,
-        11,
-        27,
-        17,
-        28,
-        19,
-        20,
-        10,
-        9,
-        33,
-        26,
-        21,
-        23,
-        24,
-        25,
-        22,
         0,
         0,
         0,
@@ -13940,8 +16389,11 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        31,
         0,
+        38,
         0,
+        7,
         0,
         0,
         0,
@@ -13949,6 +16401,7 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        30,
         0,
         0,
         0,
@@ -13962,6 +16415,7 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        11,
         0,
         0,
         0,
@@ -13969,12 +16423,17 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        28,
         0,
+        32,
         0,
         0,
+        33,
         0,
+        8,
         0,
         0,
+        17,
         0,
         0,
         0,
@@ -13983,17 +16442,22 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        35,
         0,
         0,
+        29,
         0,
+        19,
         0,
         0,
         0,
         0,
+        20,
         0,
         0,
         0,
         0,
+        37,
         0,
         0,
         0,
@@ -14005,12 +16469,14 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        10,
         0,
         0,
         0,
         0,
         0,
         0,
+        9,
         0,
         0,
         0,
@@ -14020,6 +16486,8 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        34,
+        36,
         0,
         0,
         0,
@@ -14040,6 +16508,7 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        27,
         0,
         0,
         0,
@@ -14053,10 +16522,14 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        21,
         0,
+        22,
         0,
         0,
+        24,
         0,
+        25,
         0,
         0,
         0,
@@ -14065,137 +16538,233 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        26,
         0,
+        23
+    },
+    {
         0,
+        44
+    },
+    {
         0,
         0,
-        0
+        3
     },
     {
         0,
-        47,
-        49,
-        64,
-        62,
-        45,
-        42,
+        0,
+        0,
+        0,
+        46,
         43,
         44,
+        45,
+        0,
+        0,
         2,
         4,
-        14,
-        12,
-        13,
         0,
         0,
-        0
+        0,
+        38,
+        0,
+        0,
+        0,
+        37
     },
     {
         0,
-        47,
-        45,
-        42,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        38,
+        0,
+        0,
+        0,
+        0,
+        37
+    },
+    {
+        0,
+        48,
+        66,
+        0,
+        64,
+        5
+    },
+    {
+        0,
+        48,
+        0,
+        53,
+        51,
+        46,
         43,
         44,
+        45,
         2,
-        4,
-        0
+        4
     },
     {
         0,
-        62,
-        47,
-        49,
-        64,
-        60,
+        0,
+        0,
         46,
-        54,
-        59,
-        53,
-        50,
-        52,
-        66,
-        63,
-        57,
-        56,
-        55,
-        65,
-        61,
-        58,
-        45,
-        42,
         43,
         44,
+        45,
+        0,
         2,
         4,
-        14,
-        12,
-        13,
-        5,
-        7,
-        8,
-        0,
         0,
         0,
         0,
         0,
+        35,
         0,
         0,
         0,
-        0
+        36
     },
     {
         0,
-        65,
-        63,
-        61,
-        60,
-        55,
         51,
-        49,
+        53,
+        48
+    },
+    {
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        35,
+        0,
+        0,
+        0,
+        36
+    },
+    {
+        0,
+        67
+    },
+    {
+        0,
         48,
-        47,
-        41,
-        66,
-        64,
+        0,
         46,
-        54,
-        56,
-        57,
-        58,
-        59,
-        52,
-        62,
-        50,
-        53,
-        45,
-        42,
         43,
         44,
-        6
+        45,
+        2,
+        4
     },
     {
         0,
-        18,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        46,
+        43,
+        44,
+        45,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        2,
+        4,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        18,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        31,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
         30,
-        29,
-        27,
-        32,
-        31,
-        17,
-        20,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        11,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
         28,
-        19,
+        0,
+        32,
         33,
-        26,
-        21,
-        23,
-        24,
-        25,
-        22,
         0,
         0,
         0,
+        17,
         0,
         0,
         0,
@@ -14205,11 +16774,14 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        29,
         0,
+        19,
         0,
         0,
         0,
         0,
+        20,
         0,
         0,
         0,
@@ -14223,12 +16795,14 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        10,
         0,
         0,
         0,
         0,
         0,
         0,
+        9,
         0,
         0,
         0,
@@ -14238,6 +16812,7 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        34,
         0,
         0,
         0,
@@ -14257,6 +16832,7 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        27,
         0,
         0,
         0,
@@ -14270,10 +16846,14 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        21,
         0,
+        22,
         0,
         0,
+        24,
         0,
+        25,
         0,
         0,
         0,
@@ -14282,8 +16862,15 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        26,
         0,
+        23
+    },
+    {
         0,
+        48
+    },
+    {
         0,
         0,
         0,
@@ -14311,6 +16898,7 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        18,
         0,
         0,
         0,
@@ -14328,26 +16916,14 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
+        31,
         0,
         0,
-        0
-    },
-    {
         0,
-        47
-    },
-    {
         0,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        34,
-        35,
         0,
         0,
+        30,
         0,
         0,
         0,
@@ -14355,128 +16931,42 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        47,
-        52,
-        50,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
         0,
-        34,
-        35,
         0,
         0,
         0,
         0,
         0,
+        28,
         0,
+        32,
+        33,
         0,
         0,
-        0
-    },
-    {
         0,
-        47,
-        52,
-        50
-    },
-    {
         0,
-        63,
-        47,
-        65,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        39,
-        38,
         0,
-        65,
-        0
-    },
-    {
         0,
-        49,
-        45,
-        44,
-        42,
-        43,
-        64,
-        47,
-        2,
-        4,
-        14,
-        12,
-        13,
         0,
         0,
-        0
-    },
-    {
         0,
-        47,
-        49,
-        64,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        14,
-        12,
-        13,
         0,
         0,
-        0
-    },
-    {
+        17,
+        0,
+        0,
+        0,
+        0,
+        0,
+        20,
+        29,
+        0,
+        0,
+        19,
+        0,
+        0,
         0,
-        46,
-        45,
-        44,
-        42,
-        43,
-        62,
-        49,
-        64,
-        60,
-        54,
-        59,
-        53,
-        50,
-        52,
-        66,
-        63,
-        57,
-        56,
-        55,
-        65,
-        61,
-        58,
-        47,
-        2,
-        4,
-        14,
-        12,
-        13,
-        5,
-        7,
-        8,
         0,
         0,
         0,
@@ -14485,186 +16975,27 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        6,
-        0
-    },
-    {
         0,
-        53,
-        50,
-        63,
-        47,
-        49,
-        59,
-        52,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
         0,
-        52,
-        50,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
         0,
-        66,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
         0,
-        0
-    },
-    {
         0,
-        66,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        16,
-        15,
         0,
         0,
-        0
-    },
-    {
         0,
-        49,
-        66,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
         0,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
+        34,
         0,
-        0
-    },
-    {
         0,
-        47,
-        63,
-        49,
-        59,
-        52,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
         0,
-        52,
-        50
-    },
-    {
         0,
-        66,
-        5,
-        0
-    },
-    {
         0,
-        66,
-        16,
-        15,
         0,
-        0
-    },
-    {
         0,
-        5,
-        0
-    },
-    {
         0,
-        47,
-        49,
-        54,
-        59,
-        52,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
         0,
-        66,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
         0,
-        66,
-        52,
-        50,
-        65,
-        61,
-        58,
-        60,
-        53,
-        63,
-        47,
-        49,
-        59,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
         0,
         0,
         0,
@@ -14672,5384 +17003,4784 @@ UNICC_STATIC int _dfa_accept[ 88 ][ 244 ] =
         0,
         0,
         0,
-        0
-    },
-    {
         0,
-        66,
-        52,
-        50,
-        57,
-        56,
-        55,
-        60,
-        65,
-        61,
-        54,
-        59,
-        53,
-        58,
-        63,
-        47,
-        49,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
         0,
         0,
         0,
         0,
         0,
+        27,
         0,
         0,
-        0
-    },
-    {
         0,
-        66,
-        65,
-        61,
-        58,
-        52,
-        50
-    },
-    {
         0,
-        46,
-        48,
-        55,
-        57,
-        59,
-        61,
-        63,
-        65,
-        41,
-        47,
-        49,
-        54,
-        56,
-        58,
-        60,
-        64,
-        66,
-        51,
-        52,
-        62,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        40
-    },
-    {
         0,
-        46,
-        47,
-        48,
-        49,
-        52,
-        54,
-        56,
-        58,
-        60,
-        62,
-        64,
-        66,
-        41,
-        55,
-        57,
-        59,
-        61,
-        63,
-        65,
-        51,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        40
-    },
-    {
         0,
-        49,
-        64,
-        45,
-        42,
-        43,
-        44,
-        13,
-        12,
-        2,
-        4,
-        14,
         0,
         0,
-        0
-    },
-    {
         0,
-        66,
-        53,
-        50,
-        63,
-        47,
-        49,
-        59,
-        52,
-        57,
-        56,
-        55,
-        64,
-        60,
-        65,
-        61,
-        58,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
         0,
         0,
         0,
         0,
         0,
+        22,
+        24,
+        0,
+        0,
+        21,
+        0,
+        25,
+        0,
+        0,
         0,
         0,
-        0
-    },
-    {
         0,
-        59,
-        66,
-        54,
-        53,
-        50,
-        52,
-        64,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        14,
-        12,
-        13,
         0,
         0,
-        0
-    },
-    {
         0,
-        47,
-        63,
-        49,
-        66,
-        59,
-        52,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        0
-    },
-    {
+        26,
+        0,
         0,
-        52
+        23
     },
     {
         0,
+        43,
+        44,
+        45,
+        46,
         47,
-        51,
-        55,
-        61,
-        63,
-        65,
-        41,
         48,
-        60,
         49,
-        66,
-        64,
-        46,
+        50,
+        51,
+        52,
+        53,
         54,
+        55,
         56,
         57,
         58,
         59,
-        52,
+        60,
+        61,
         62,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        40
+        63,
+        64,
+        65,
+        66,
+        67,
+        41,
+        6
     },
     {
         0,
-        59
-    },
-    {
         0,
-        54,
-        59,
-        52,
+        65,
+        61,
+        47,
+        48,
         50,
-        53
-    },
-    {
-        0,
+        56,
+        62,
         64,
-        12,
-        13,
-        14,
+        66,
+        67,
         0,
-        0
-    },
-    {
+        55,
         0,
+        57,
+        58,
+        59,
         60,
-        61,
         53,
-        50,
+        0,
         63,
-        47,
-        49,
-        59,
-        65,
-        52,
-        58,
+        51,
         54,
-        45,
-        42,
+        46,
         43,
         44,
+        45,
+        5,
+        12,
+        13,
         2,
         4,
-        5,
-        7,
-        8,
-        0,
-        0,
+        14,
         0,
         0,
         0,
         0,
+        7,
         0,
-        0
+        8
     },
     {
         0,
-        60,
-        61,
-        63,
-        47,
-        49,
-        59,
+        0,
         65,
-        52,
-        58,
+        0,
+        0,
+        48,
         50,
-        53,
-        45,
-        42,
+        63,
+        46,
         43,
         44,
-        5,
+        45,
         2,
         4,
-        7,
-        8,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
+        12,
+        13,
+        14
     },
     {
         0,
-        65,
-        60,
-        66,
-        5,
-        0
-    },
-    {
         0,
-        57,
-        56,
-        55,
-        60,
-        65,
-        66,
+        48,
         61,
-        54,
+        62,
+        64,
+        66,
+        67,
+        0,
         59,
-        53,
-        50,
-        52,
-        58,
-        45,
-        42,
+        46,
         43,
         44,
-        2,
-        4,
+        45,
         5,
-        0,
-        0
+        2,
+        4
     },
     {
+        0,
         0,
         65,
         61,
-        60,
+        48,
+        50,
+        56,
+        62,
+        64,
         66,
-        58,
-        5,
-        0
-    },
-    {
+        67,
         0,
-        54,
-        60,
-        65,
-        66,
-        61,
+        55,
+        0,
+        57,
         58,
         59,
-        52,
-        50,
+        60,
         53,
+        0,
+        63,
+        51,
+        54,
+        46,
+        43,
+        44,
+        45,
         5,
-        0
+        12,
+        13,
+        2,
+        4,
+        14,
+        0,
+        0,
+        0,
+        0,
+        7,
+        0,
+        8
     },
     {
         0,
-        56,
-        55,
-        60,
-        65,
-        66,
-        61,
-        54,
-        57,
-        58,
-        59,
-        52,
-        50,
         53,
-        5,
-        0
+        59,
+        62,
+        66,
+        67,
+        51
     },
     {
         0,
-        65,
-        63,
-        61,
-        60,
-        55,
-        51,
-        49,
+        0,
         48,
-        47,
-        41,
-        66,
-        64,
-        46,
-        54,
+        50,
         56,
+        61,
+        62,
+        64,
+        66,
+        67,
+        0,
+        55,
         57,
         58,
         59,
-        52,
-        62,
-        50,
+        60,
         53,
-        45,
-        42,
+        0,
+        51,
+        54,
+        46,
         43,
-        44
+        44,
+        45,
+        5,
+        2,
+        4,
+        0,
+        0,
+        0,
+        0,
+        7,
+        0,
+        8
     },
     {
         0,
-        63,
-        47,
-        49,
+        0,
+        48,
+        50,
+        61,
+        62,
+        64,
+        66,
+        67,
+        0,
         59,
-        52,
         60,
-        65,
-        66,
-        61,
-        50,
         53,
-        45,
-        42,
+        0,
+        51,
+        54,
+        46,
         43,
         44,
+        45,
+        5,
         2,
         4,
-        5,
-        7,
-        8,
         0,
         0,
         0,
         0,
+        7,
         0,
+        8
+    },
+    {
         0,
+        67,
         0,
-        0
+        46,
+        43,
+        44,
+        45,
+        2,
+        4
     },
     {
         0,
-        60,
-        61,
-        53,
         50,
-        63,
-        47,
-        49,
-        59,
-        65,
-        52,
-        66,
+        0,
+        43,
+        44,
         45,
-        42,
+        46,
+        51,
+        53,
+        54,
+        55,
+        60,
+        48,
+        2,
+        4
+    },
+    {
+        0,
+        0,
+        53,
+        51,
+        46,
         43,
         44,
+        45,
         2,
-        4,
+        4
+    },
+    {
+        0,
+        0,
+        0,
+        46,
+        43,
+        44,
+        45,
         5,
-        7,
-        8,
+        2,
+        4
+    },
+    {
         0,
         0,
+        67,
         0,
+        46,
+        43,
+        44,
+        45,
+        16,
         0,
+        2,
+        4,
+        15
+    },
+    {
         0,
+        50,
+        67,
         0,
+        46,
+        43,
+        44,
+        45,
+        2,
+        4
+    },
+    {
         0,
-        0
+        0,
+        67,
+        0,
+        46,
+        43,
+        44,
+        45,
+        5,
+        2,
+        4
     },
     {
         0,
-        63,
-        47,
-        49,
-        59,
-        52,
-        60,
-        65,
-        58,
-        61,
+        48,
         50,
+        64,
+        0,
+        60,
         53,
-        45,
-        42,
+        51,
+        54,
+        46,
         43,
         44,
+        45,
         2,
-        4,
-        5,
-        7,
-        8,
+        4
+    },
+    {
+        0,
+        53,
+        51
+    },
+    {
         0,
         0,
+        5
+    },
+    {
         0,
         0,
+        67,
+        16,
         0,
+        15
+    },
+    {
         0,
         0,
-        0
+        67,
+        5
     },
     {
         0,
-        65,
-        60,
-        66
+        0,
+        6
     },
     {
         0,
-        54,
-        59,
-        53,
-        50,
-        52,
-        60,
-        63,
-        47,
-        49,
         65,
-        66,
-        61,
-        58,
-        45,
-        42,
+        0,
+        48,
+        50,
+        0,
+        0,
+        46,
         43,
         44,
+        45,
+        12,
+        13,
         2,
         4,
-        5,
-        7,
-        8,
-        0,
-        0,
-        0,
+        14
+    },
+    {
         0,
+        53,
+        55,
+        60,
+        51,
+        54
+    },
+    {
         0,
+        65,
         0,
+        67,
         0,
-        0
-    },
-    {
+        55,
         0,
         60,
-        65,
-        66,
-        61,
-        54,
-        59,
         53,
-        50,
-        52,
-        58,
-        45,
-        42,
+        51,
+        54,
+        46,
         43,
         44,
+        45,
+        12,
+        13,
         2,
         4,
-        5,
-        0,
-        0
+        14
     },
     {
         0,
-        58
+        53
     },
     {
         0,
-        50
+        60
     },
     {
         0,
-        61,
-        66
+        50,
+        51,
+        53,
+        54,
+        64,
+        67,
+        0,
+        43,
+        44,
+        45,
+        46,
+        60,
+        48,
+        2,
+        4
     },
     {
         0,
-        47,
-        65,
+        0,
+        48,
+        50,
+        56,
         61,
-        63,
-        60,
-        49,
+        62,
+        64,
+        65,
         66,
+        67,
+        0,
+        57,
         58,
         59,
-        52,
-        50,
+        60,
         53,
-        45,
-        42,
+        0,
+        51,
+        54,
+        46,
         43,
         44,
+        45,
         5,
         2,
         4,
-        7,
-        8,
-        0,
-        0,
-        0,
         0,
         0,
         0,
         0,
-        0
-    },
-    {
+        7,
         0,
-        61,
-        58
+        8
     },
     {
         0,
-        66,
-        65
-    },
-    {
         0,
-        57,
-        56,
-        55,
-        60,
-        65,
-        66,
-        61,
-        54,
-        59,
-        53,
         50,
-        52,
-        58,
-        63,
-        47,
-        49,
-        64,
-        45,
-        42,
+        65,
+        0,
+        0,
+        46,
         43,
         44,
+        45,
+        13,
+        12,
         2,
         4,
-        5,
-        7,
-        8,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
+        14
     },
     {
         0,
-        63,
+        43,
+        44,
+        45,
+        46,
         47,
+        48,
         49,
-        59,
+        50,
+        51,
         52,
+        53,
+        54,
+        55,
+        56,
+        57,
+        58,
+        59,
         60,
+        61,
+        62,
+        63,
+        64,
         65,
         66,
-        61,
-        58,
-        50,
-        53,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
+        67,
+        41
     },
     {
+        0,
         0,
         56,
-        55,
-        64,
-        60,
-        65,
-        66,
         61,
-        63,
-        47,
-        49,
+        62,
+        66,
+        67,
+        0,
+        55,
         57,
         58,
         59,
-        52,
-        50,
+        60,
         53,
-        45,
-        42,
+        51,
+        54,
+        46,
         43,
         44,
-        2,
-        4,
+        45,
         5,
-        7,
-        8,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0,
-        0
+        2,
+        4
     },
     {
         0,
-        60,
-        65,
-        66,
+        0,
+        48,
+        50,
         61,
-        63,
-        47,
-        49,
+        62,
         64,
-        58,
+        66,
+        0,
+        55,
         59,
-        52,
-        50,
+        60,
         53,
-        45,
-        42,
+        0,
+        51,
+        54,
+        46,
         43,
         44,
+        45,
         5,
         2,
         4,
-        7,
-        8,
-        0,
-        0,
         0,
         0,
         0,
         0,
+        7,
         0,
-        0
+        8
     },
     {
         0,
-        64,
-        60,
-        65,
+        0,
+        62,
         66,
+        56,
         61,
+        67,
+        55,
+        57,
         58,
-        53,
-        50,
-        63,
-        47,
-        49,
         59,
-        52,
-        45,
-        42,
-        43,
-        44,
-        2,
-        4,
-        5,
-        7,
-        8,
-        0,
+        60,
+        53,
+        51,
+        54,
+        5
+    },
+    {
         0,
+        53,
+        55,
+        60,
         0,
+        59,
+        61,
+        62,
+        66,
+        67,
+        51,
+        54,
+        5
+    },
+    {
         0,
+        66,
+        62,
         0,
+        61,
+        67,
+        59,
+        5
+    },
+    {
         0,
+        66,
         0,
-        0
+        61,
+        67,
+        5
     },
     {
         0,
-        11,
-        10,
         0,
+        48,
+        50,
+        61,
+        62,
+        64,
+        66,
         0,
+        59,
+        60,
+        53,
         0,
+        51,
+        54,
+        46,
+        43,
+        44,
+        45,
+        5,
+        2,
+        4,
         0,
         0,
         0,
         0,
+        7,
         0,
+        8
+    },
+    {
         0,
         0,
+        65,
         0,
+        13,
+        12,
+        14
+    },
+    {
         0,
+        51
+    },
+    {
         0,
-        0
+        59
     },
     {
         0,
-        65,
+        0,
         61,
-        60,
+        62,
         66,
-        58
+        67,
+        0,
+        55,
+        59,
+        60,
+        53,
+        51,
+        54,
+        46,
+        43,
+        44,
+        45,
+        5,
+        2,
+        4
     },
     {
         0,
+        0,
+        48,
+        50,
+        61,
+        62,
+        64,
         66,
-        65,
-        45,
-        42,
+        67,
+        0,
+        55,
+        59,
+        60,
+        53,
+        0,
+        51,
+        54,
+        46,
         43,
         44,
+        45,
+        5,
         2,
         4,
-        0
+        0,
+        0,
+        0,
+        0,
+        7,
+        0,
+        8
     },
     {
         0,
         66,
         61,
-        58,
-        65
+        67
     },
     {
         0,
-        9,
         0,
+        48,
+        50,
+        61,
+        62,
+        64,
+        66,
+        67,
         0,
+        60,
+        53,
         0,
+        51,
+        54,
+        46,
+        43,
+        44,
+        45,
+        5,
+        2,
+        4,
         0,
         0,
         0,
         0,
+        7,
         0,
-        0
+        8
     },
     {
         0,
-        53,
+        0,
+        48,
         50,
-        63,
-        52,
-        45,
-        42,
+        56,
+        61,
+        62,
+        64,
+        65,
+        66,
+        67,
+        0,
+        55,
+        57,
+        58,
+        59,
+        60,
+        53,
+        0,
+        51,
+        54,
+        46,
         43,
         44,
+        45,
+        5,
         2,
         4,
-        0
+        0,
+        0,
+        0,
+        0,
+        7,
+        0,
+        8
     },
     {
         0,
-        63,
-        52,
-        50,
-        53
-    }
-};
-
-#endif
-
-/* Symbol information table */
-UNICC_STATIC _syminfo _symbols[] =
-{
-	{ /* 0 */ "&eof", "", 3, 0, 0, 1 },
-	{ /* 1 */ "//", "", 2, 0, 0, 1 },
-	{ /* 2 */ "*/", "", 2, 0, 0, 1 },
-	{ /* 3 */ "/*", "", 2, 0, 0, 1 },
-	{ /* 4 */ "[*", "", 2, 0, 0, 1 },
-	{ /* 5 */ "*]", "", 2, 0, 0, 1 },
-	{ /* 6 */ "&eof", "", 2, 0, 0, 1 },
-	{ /* 7 */ "&error", "", 2, 0, 0, 1 },
-	{ /* 8 */ "precedence", "", 2, 0, 0, 1 },
-	{ /* 9 */ "non-greedy", "", 2, 0, 0, 1 },
-	{ /* 10 */ "greedy", "", 2, 0, 0, 1 },
-	{ /* 11 */ ":=", "", 2, 0, 0, 1 },
-	{ /* 12 */ "=>", "", 2, 0, 0, 1 },
-	{ /* 13 */ "->", "", 2, 0, 0, 1 },
-	{ /* 14 */ "off", "", 2, 0, 0, 1 },
-	{ /* 15 */ "on", "", 2, 0, 0, 1 },
-	{ /* 16 */ "extends", "", 2, 0, 0, 1 },
-	{ /* 17 */ "pcb", "", 2, 0, 0, 1 },
-	{ /* 18 */ "epilogue", "", 2, 0, 0, 1 },
-	{ /* 19 */ "prologue", "", 2, 0, 0, 1 },
-	{ /* 20 */ "reserve terminals", "", 2, 0, 0, 1 },
-	{ /* 21 */ "case insensitive strings", "", 2, 0, 0, 1 },
-	{ /* 22 */ "lexeme separation", "", 2, 0, 0, 1 },
-	{ /* 23 */ "default value type", "", 2, 0, 0, 1 },
-	{ /* 24 */ "default epsilon action", "", 2, 0, 0, 1 },
-	{ /* 25 */ "default action", "", 2, 0, 0, 1 },
-	{ /* 26 */ "prefix", "", 2, 0, 0, 1 },
-	{ /* 27 */ "nonassoc", "", 2, 0, 0, 1 },
-	{ /* 28 */ "right", "", 2, 0, 0, 1 },
-	{ /* 29 */ "left", "", 2, 0, 0, 1 },
-	{ /* 30 */ "fixate", "", 2, 0, 0, 1 },
-	{ /* 31 */ "lexeme", "", 2, 0, 0, 1 },
-	{ /* 32 */ "whitespaces", "", 2, 0, 0, 1 },
-	{ /* 33 */ "scanner", "", 2, 0, 0, 1 },
-	{ /* 34 */ "scannerless", "", 2, 0, 0, 1 },
-	{ /* 35 */ "language", "", 2, 0, 0, 1 },
-	{ /* 36 */ "mode", "", 2, 0, 0, 1 },
-	{ /* 37 */ "%!", "", 2, 0, 0, 1 },
-	{ /* 38 */ "#!", "", 2, 0, 0, 1 },
-	{ /* 39 */ "\\x0", "", 1, 0, 0, 1 },
-	{ /* 40 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF", "", 1, 0, 0, 1 },
-	{ /* 41 */ "\\r", "", 1, 0, 0, 1 },
-	{ /* 42 */ "\\n", "", 1, 0, 0, 1 },
-	{ /* 43 */ "\\t", "", 1, 0, 0, 1 },
-	{ /* 44 */ " ", "", 1, 0, 0, 1 },
-	{ /* 45 */ "0-9", "", 1, 0, 0, 1 },
-	{ /* 46 */ "A-Z_a-z", "", 1, 0, 0, 1 },
-	{ /* 47 */ ">", "", 1, 0, 0, 1 },
-	{ /* 48 */ "<", "", 1, 0, 0, 1 },
-	{ /* 49 */ "\"", "", 1, 0, 0, 1 },
-	{ /* 50 */ "\\\\", "", 1, 0, 0, 1 },
-	{ /* 51 */ "'", "", 1, 0, 0, 1 },
-	{ /* 52 */ "!", "", 1, 0, 0, 1 },
-	{ /* 53 */ ".", "", 1, 0, 0, 1 },
-	{ /* 54 */ "?", "", 1, 0, 0, 1 },
-	{ /* 55 */ "+", "", 1, 0, 0, 1 },
-	{ /* 56 */ "*", "", 1, 0, 0, 1 },
-	{ /* 57 */ ")", "", 1, 0, 0, 1 },
-	{ /* 58 */ "(", "", 1, 0, 0, 1 },
-	{ /* 59 */ "=", "", 1, 0, 0, 1 },
-	{ /* 60 */ "|", "", 1, 0, 0, 1 },
-	{ /* 61 */ "$", "", 1, 0, 0, 1 },
-	{ /* 62 */ "@", "", 1, 0, 0, 1 },
-	{ /* 63 */ ":", "", 1, 0, 0, 1 },
-	{ /* 64 */ "#%", "", 1, 0, 0, 1 },
-	{ /* 65 */ ";", "", 1, 0, 0, 1 },
-	{ /* 66 */ "\\x0#%#", "", 0, 0, 0, 1 },
-	{ /* 67 */ ":-;#", "", 0, 0, 0, 1 },
-	{ /* 68 */ "\\x0#%@#", "", 0, 0, 0, 1 },
-	{ /* 69 */ "$:-;#", "", 0, 0, 0, 1 },
-	{ /* 70 */ "\\x0#%@|#", "", 0, 0, 0, 1 },
-	{ /* 71 */ "$:-;=#", "", 0, 0, 0, 1 },
-	{ /* 72 */ "\\x0#%(@|#", "", 0, 0, 0, 1 },
-	{ /* 73 */ "$):-;=#", "", 0, 0, 0, 1 },
-	{ /* 74 */ "\\x0#%(*@|#", "", 0, 0, 0, 1 },
-	{ /* 75 */ "$)+:-;=#", "", 0, 0, 0, 1 },
-	{ /* 76 */ "\\x0#%(*?-@|#", "", 0, 0, 0, 1 },
-	{ /* 77 */ "$)+.:-;=#", "", 0, 0, 0, 1 },
-	{ /* 78 */ "$)+.:-=#", "", 0, 0, 0, 1 },
-	{ /* 79 */ "$)+.:-=A-Z_a-z#", "", 0, 0, 0, 1 },
-	{ /* 80 */ "0-9>#", "", 0, 0, 0, 1 },
-	{ /* 81 */ " $)+.:-=A-Z_a-z#", "", 0, 0, 0, 1 },
-	{ /* 82 */ "\\x0!#%(*?-@|#", "", 0, 0, 0, 1 },
-	{ /* 83 */ "\\r $)+.:-=A-Z_a-z#", "", 0, 0, 0, 1 },
-	{ /* 84 */ "\"'#", "", 0, 0, 0, 1 },
-	{ /* 85 */ "\\t0-9>#", "", 0, 0, 0, 1 },
-	{ /* 86 */ "\\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 87 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 88 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9>[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 89 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 90 */ "\\x0-\\b\\v- $&)+-/:-=A-[]-{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 91 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 92 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9;>[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 93 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 94 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/;?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 95 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 96 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-9;>[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 97 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 98 */ "\\x0-\\b\\v- #-&)+-/:-=A-[]-{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 99 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 100 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 101 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 102 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/:-;?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 103 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 104 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 105 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 106 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 107 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 108 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 109 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{}-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 110 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 111 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 112 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 113 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 114 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 115 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 116 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 117 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 118 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 119 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 120 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(,--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 121 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-(,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 122 */ "\\x0-\\b\\v- #-&(-)+-/:-=@-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 123 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-),--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 124 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-),--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 125 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-),--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 126 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-*,--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 127 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-*,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 128 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-*,--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 129 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-*,--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 130 */ "\\x0-\\b\\v- #-&(-/:-=@-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 131 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 132 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=->@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 133 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 134 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 135 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 136 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 137 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 138 */ "\\x0-\\b\\v- #-&(-/:-=?-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 139 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 140 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-;=-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 141 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 142 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 143 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 144 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-&(-;=-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 145 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 146 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 147 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 148 */ "\\x0-\\b\\v-!#-&(-/:-=?-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 149 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 150 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 151 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 152 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-;=-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 153 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 154 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 155 */ "\\x0-\\b\\v-&(-/:-=?-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 156 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 157 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-=?-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 158 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 159 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 160 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-@[]-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 161 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-@[-^`{-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 162 */ "\\x0-\\b\\v-&(-/:-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 163 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 164 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 165 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 166 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 167 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 168 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 169 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 170 */ "\\x0-\\b\\v-&(-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 171 */ "\\x1-\\b\\v-\\f\\xE-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 172 */ "\\x0-\\b\\v-\\f\\xE-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 173 */ "\\x0-\\b\\v-\\f\\xE-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 174 */ "\\x0-\\t\\v-\\f\\xE-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 175 */ "\\x0-\\t\\v-\\f\\xE-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 176 */ "\\x0-\\t\\v-\\f\\xE-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 177 */ "\\x1-\\t\\v-\\f\\xE-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 178 */ "\\x0-\\t\\v-&(-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 179 */ "\\x1-\\t\\v-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 180 */ "\\x0-\\t\\v-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 181 */ "\\x0-\\t\\v-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 182 */ "grammar_spec''", "", 0, 0, 0, 1 },
-	{ /* 183 */ "scanner'", "", 0, 0, 0, 1 },
-	{ /* 184 */ "scannerless'", "", 0, 0, 0, 1 },
-	{ /* 185 */ "language'", "", 0, 0, 0, 1 },
-	{ /* 186 */ "mode'", "", 0, 0, 0, 1 },
-	{ /* 187 */ "%!'", "", 0, 0, 0, 1 },
-	{ /* 188 */ "#!'", "", 0, 0, 0, 1 },
-	{ /* 189 */ "$'", "", 0, 0, 0, 1 },
-	{ /* 190 */ ":='", "", 0, 0, 0, 1 },
-	{ /* 191 */ "=>'", "", 0, 0, 0, 1 },
-	{ /* 192 */ "->'", "", 0, 0, 0, 1 },
-	{ /* 193 */ ".'", "", 0, 0, 0, 1 },
-	{ /* 194 */ "ccl'", "", 0, 0, 0, 1 },
-	{ /* 195 */ "?'", "", 0, 0, 0, 1 },
-	{ /* 196 */ "+'", "", 0, 0, 0, 1 },
-	{ /* 197 */ "*'", "", 0, 0, 0, 1 },
-	{ /* 198 */ "non-greedy'", "", 0, 0, 0, 1 },
-	{ /* 199 */ "greedy'", "", 0, 0, 0, 1 },
-	{ /* 200 */ "@'", "", 0, 0, 0, 1 },
-	{ /* 201 */ "&eof'", "", 0, 0, 0, 1 },
-	{ /* 202 */ "&error'", "", 0, 0, 0, 1 },
-	{ /* 203 */ "modifier'", "", 0, 0, 0, 1 },
-	{ /* 204 */ ":'", "", 0, 0, 0, 1 },
-	{ /* 205 */ "='", "", 0, 0, 0, 1 },
-	{ /* 206 */ "precedence'", "", 0, 0, 0, 1 },
-	{ /* 207 */ "|'", "", 0, 0, 0, 1 },
-	{ /* 208 */ ")'", "", 0, 0, 0, 1 },
-	{ /* 209 */ "('", "", 0, 0, 0, 1 },
-	{ /* 210 */ "identifier'", "", 0, 0, 0, 1 },
-	{ /* 211 */ "terminal'", "", 0, 0, 0, 1 },
-	{ /* 212 */ "kw'", "", 0, 0, 0, 1 },
-	{ /* 213 */ "ccl_string'", "", 0, 0, 0, 1 },
-	{ /* 214 */ "off'", "", 0, 0, 0, 1 },
-	{ /* 215 */ "on'", "", 0, 0, 0, 1 },
-	{ /* 216 */ "extends'", "", 0, 0, 0, 1 },
-	{ /* 217 */ "pcb'", "", 0, 0, 0, 1 },
-	{ /* 218 */ "epilogue'", "", 0, 0, 0, 1 },
-	{ /* 219 */ "prologue'", "", 0, 0, 0, 1 },
-	{ /* 220 */ "reserve terminals'", "", 0, 0, 0, 1 },
-	{ /* 221 */ "case insensitive strings'", "", 0, 0, 0, 1 },
-	{ /* 222 */ "lexeme separation'", "", 0, 0, 0, 1 },
-	{ /* 223 */ "type'", "", 0, 0, 0, 1 },
-	{ /* 224 */ "default value type'", "", 0, 0, 0, 1 },
-	{ /* 225 */ "default epsilon action'", "", 0, 0, 0, 1 },
-	{ /* 226 */ "default action'", "", 0, 0, 0, 1 },
-	{ /* 227 */ "prefix'", "", 0, 0, 0, 1 },
-	{ /* 228 */ "nonassoc'", "", 0, 0, 0, 1 },
-	{ /* 229 */ "right'", "", 0, 0, 0, 1 },
-	{ /* 230 */ "left'", "", 0, 0, 0, 1 },
-	{ /* 231 */ "fixate'", "", 0, 0, 0, 1 },
-	{ /* 232 */ "lexeme'", "", 0, 0, 0, 1 },
-	{ /* 233 */ "whitespaces'", "", 0, 0, 0, 1 },
-	{ /* 234 */ "#%'", "", 0, 0, 0, 1 },
-	{ /* 235 */ ";'", "", 0, 0, 0, 1 },
-	{ /* 236 */ "code'", "", 0, 0, 0, 1 },
-	{ /* 237 */ "&whitespace*", "", 0, 1, 1, 1 },
-	{ /* 238 */ "&whitespace+", "", 0, 1, 1, 1 },
-	{ /* 239 */ "&whitespace", "", 0, 1, 1, 1 },
-	{ /* 240 */ "grammar_spec'", "", 0, 0, 0, 1 },
-	{ /* 241 */ "\\x0-\\t\\v-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 242 */ "scomment?", "", 0, 1, 0, 1 },
-	{ /* 243 */ "scomment", "", 0, 1, 0, 1 },
-	{ /* 244 */ "comment?", "", 0, 1, 0, 1 },
-	{ /* 245 */ "comment", "", 0, 1, 0, 1 },
-	{ /* 246 */ "anychar", "", 0, 1, 0, 1 },
-	{ /* 247 */ "inner_code", "", 0, 1, 0, 1 },
-	{ /* 248 */ "inner_code_opt", "", 0, 1, 0, 1 },
-	{ /* 249 */ "code_begin", "", 0, 1, 0, 1 },
-	{ /* 250 */ "integer", "", 0, 0, 0, 1 },
-	{ /* 251 */ "0-9A-Z_a-z#", "", 0, 0, 0, 1 },
-	{ /* 252 */ "identifier_follow", "", 0, 1, 0, 1 },
-	{ /* 253 */ "identifier_start", "", 0, 1, 0, 1 },
-	{ /* 254 */ "\\x0-=?-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 255 */ "type_str", "", 0, 1, 0, 1 },
-	{ /* 256 */ "\\x0-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 257 */ "kw_char", "", 0, 1, 0, 1 },
-	{ /* 258 */ "kw_str", "", 0, 1, 0, 1 },
-	{ /* 259 */ "\\x1-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 260 */ "\\x0-&(-[]-\\uFFFF#", "", 0, 0, 0, 1 },
-	{ /* 261 */ "ccl_char", "", 0, 1, 0, 1 },
-	{ /* 262 */ "ccl_str", "", 0, 1, 0, 1 },
-	{ /* 263 */ "string_single+", "", 0, 0, 0, 1 },
-	{ /* 264 */ "re_factor", "", 0, 0, 0, 1 },
-	{ /* 265 */ "re_modifier", "", 0, 0, 0, 1 },
-	{ /* 266 */ "re_expr", "", 0, 0, 0, 1 },
-	{ /* 267 */ "re_alt", "", 0, 0, 0, 1 },
-	{ /* 268 */ "string_single", "", 0, 0, 0, 1 },
-	{ /* 269 */ "ccl", "", 0, 1, 0, 1 },
-	{ /* 270 */ "stack_cur_prod", "", 0, 0, 0, 1 },
-	{ /* 271 */ "access_name", "", 0, 0, 0, 1 },
-	{ /* 272 */ "symbol", "", 0, 0, 0, 1 },
-	{ /* 273 */ "rhs", "", 0, 0, 0, 1 },
-	{ /* 274 */ "prod_directives*", "", 0, 0, 0, 1 },
-	{ /* 275 */ "prod_directives+", "", 0, 0, 0, 1 },
-	{ /* 276 */ "prod_directives", "", 0, 0, 0, 1 },
-	{ /* 277 */ "code_opt_dup", "", 0, 0, 0, 1 },
-	{ /* 278 */ "rhs_opt", "", 0, 0, 0, 1 },
-	{ /* 279 */ "line_number", "", 0, 0, 0, 1 },
-	{ /* 280 */ "production", "", 0, 0, 0, 1 },
-	{ /* 281 */ "sym_option*", "", 0, 0, 0, 1 },
-	{ /* 282 */ "sym_option+", "", 0, 0, 0, 1 },
-	{ /* 283 */ "sym_option", "", 0, 0, 0, 1 },
-	{ /* 284 */ "ast_node", "", 0, 0, 0, 1 },
-	{ /* 285 */ "regex", "", 0, 0, 0, 1 },
-	{ /* 286 */ "productions", "", 0, 0, 0, 1 },
-	{ /* 287 */ "alt_lhs_list?", "", 0, 0, 0, 1 },
-	{ /* 288 */ "goal_mark", "", 0, 0, 0, 1 },
-	{ /* 289 */ "defines", "", 0, 0, 0, 1 },
-	{ /* 290 */ "regex_sym", "", 0, 0, 0, 1 },
-	{ /* 291 */ "alt_regex_sym", "", 0, 0, 0, 1 },
-	{ /* 292 */ "alt_lhs_list", "", 0, 0, 0, 1 },
-	{ /* 293 */ "lhs", "", 0, 0, 0, 1 },
-	{ /* 294 */ "sym", "", 0, 0, 0, 1 },
-	{ /* 295 */ "boolean", "", 0, 0, 0, 1 },
-	{ /* 296 */ "boolean_opt", "", 0, 0, 0, 1 },
-	{ /* 297 */ "code_opt", "", 0, 0, 0, 1 },
-	{ /* 298 */ "string", "", 0, 0, 0, 1 },
-	{ /* 299 */ "symbol_list", "", 0, 0, 0, 1 },
-	{ /* 300 */ "directive_parms", "", 0, 0, 0, 1 },
-	{ /* 301 */ "unfixed_directive", "", 0, 0, 0, 1 },
-	{ /* 302 */ "definition", "", 0, 0, 0, 1 },
-	{ /* 303 */ "string_or_ident", "", 0, 0, 0, 1 },
-	{ /* 304 */ "mode_type", "", 0, 0, 0, 1 },
-	{ /* 305 */ "fixed_directive", "", 0, 0, 0, 1 },
-	{ /* 306 */ "segment*", "", 0, 0, 0, 1 },
-	{ /* 307 */ "segment+", "", 0, 0, 0, 1 },
-	{ /* 308 */ "segment", "", 0, 0, 0, 1 },
-	{ /* 309 */ "fixed_directive_def*", "", 0, 0, 0, 1 },
-	{ /* 310 */ "fixed_directive_def+", "", 0, 0, 0, 1 },
-	{ /* 311 */ "fixed_directive_def", "", 0, 0, 0, 1 },
-	{ /* 312 */ "grammar_spec", "", 0, 0, 0, 1 },
-	{ /* 313 */ "type", "", 0, 1, 0, 1 },
-	{ /* 314 */ "kw", "", 0, 1, 0, 1 },
-	{ /* 315 */ "ccl_string", "", 0, 1, 0, 1 },
-	{ /* 316 */ "code", "", 0, 1, 0, 1 },
-	{ /* 317 */ "modifier", "", 0, 1, 0, 1 },
-	{ /* 318 */ "identifier", "", 0, 1, 0, 1 },
-	{ /* 319 */ "terminal", "", 0, 1, 0, 1 },
-	{ /* 320 */ "whitespace", "", 0, 1, 1, 1 }
-};
-
-/* Production information table */
-UNICC_STATIC _prodinfo _productions[] =
-{
-	{ /* 0 */ "fixed_directive_def+ : fixed_directive_def+ fixed_directive_def", "", 2, 310 },
-	{ /* 1 */ "fixed_directive_def+ : fixed_directive_def", "", 1, 310 },
-	{ /* 2 */ "fixed_directive_def* : fixed_directive_def+", "", 1, 309 },
-	{ /* 3 */ "fixed_directive_def* : ", "", 0, 309 },
-	{ /* 4 */ "grammar_spec : fixed_directive_def* segment*", "", 2, 312 },
-	{ /* 5 */ "segment+ : segment+ segment", "", 2, 307 },
-	{ /* 6 */ "segment+ : segment", "", 1, 307 },
-	{ /* 7 */ "segment* : segment+", "", 1, 306 },
-	{ /* 8 */ "segment* : ", "", 0, 306 },
-	{ /* 9 */ "fixed_directive_def : #!' fixed_directive ;'", "", 3, 311 },
-	{ /* 10 */ "fixed_directive_def : %!' fixed_directive ;'", "", 3, 311 },
-	{ /* 11 */ "fixed_directive : mode' mode_type", "", 2, 305 },
-	{ /* 12 */ "fixed_directive : language' string_or_ident", "", 2, 305 },
-	{ /* 13 */ "mode_type : scannerless'", "", 1, 304 },
-	{ /* 14 */ "mode_type : scanner'", "", 1, 304 },
-	{ /* 15 */ "segment : code'", "", 1, 308 },
-	{ /* 16 */ "segment : definition ;'", "", 2, 308 },
-	{ /* 17 */ "segment : unfixed_directive ;'", "", 2, 308 },
-	{ /* 18 */ "unfixed_directive : #%' directive_parms", "", 2, 301 },
-	{ /* 19 */ "directive_parms : whitespaces' symbol_list", "", 2, 300 },
-	{ /* 20 */ "directive_parms : lexeme' symbol_list", "", 2, 300 },
-	{ /* 21 */ "directive_parms : fixate' symbol_list", "", 2, 300 },
-	{ /* 22 */ "directive_parms : left' symbol_list", "", 2, 300 },
-	{ /* 23 */ "directive_parms : right' symbol_list", "", 2, 300 },
-	{ /* 24 */ "directive_parms : nonassoc' symbol_list", "", 2, 300 },
-	{ /* 25 */ "directive_parms : prefix' string", "", 2, 300 },
-	{ /* 26 */ "directive_parms : default action' code_opt", "", 2, 300 },
-	{ /* 27 */ "directive_parms : default epsilon action' code_opt", "", 2, 300 },
-	{ /* 28 */ "directive_parms : default value type' type'", "", 2, 300 },
-	{ /* 29 */ "directive_parms : lexeme separation' boolean_opt", "", 2, 300 },
-	{ /* 30 */ "directive_parms : case insensitive strings' boolean_opt", "", 2, 300 },
-	{ /* 31 */ "directive_parms : reserve terminals' boolean_opt", "", 2, 300 },
-	{ /* 32 */ "directive_parms : prologue' code'", "", 2, 300 },
-	{ /* 33 */ "directive_parms : epilogue' code'", "", 2, 300 },
-	{ /* 34 */ "directive_parms : pcb' code'", "", 2, 300 },
-	{ /* 35 */ "directive_parms : extends' string", "", 2, 300 },
-	{ /* 36 */ "boolean_opt : boolean", "", 1, 296 },
-	{ /* 37 */ "boolean_opt : ", "", 0, 296 },
-	{ /* 38 */ "boolean : on'", "", 1, 295 },
-	{ /* 39 */ "boolean : off'", "", 1, 295 },
-	{ /* 40 */ "symbol_list : symbol_list sym", "", 2, 299 },
-	{ /* 41 */ "symbol_list : sym", "", 1, 299 },
-	{ /* 42 */ "lhs : identifier'", "", 1, 293 },
-	{ /* 43 */ "alt_lhs_list : alt_lhs_list lhs", "", 2, 292 },
-	{ /* 44 */ "alt_lhs_list : lhs", "", 1, 292 },
-	{ /* 45 */ "alt_regex_sym : alt_regex_sym regex_sym", "", 2, 291 },
-	{ /* 46 */ "alt_regex_sym : regex_sym", "", 1, 291 },
-	{ /* 47 */ "regex_sym : identifier'", "", 1, 290 },
-	{ /* 48 */ "defines : ->'", "", 1, 289 },
-	{ /* 49 */ "defines : :'", "", 1, 289 },
-	{ /* 50 */ "defines : =>'", "", 1, 289 },
-	{ /* 51 */ "defines : :='", "", 1, 289 },
-	{ /* 52 */ "definition : lhs goal_mark alt_lhs_list? type' defines productions", "", 6, 302 },
-	{ /* 53 */ "alt_lhs_list? : alt_lhs_list", "", 1, 287 },
-	{ /* 54 */ "alt_lhs_list? : ", "", 0, 287 },
-	{ /* 55 */ "definition : @' alt_regex_sym type' regex code_opt ast_node sym_option*", "", 7, 302 },
-	{ /* 56 */ "sym_option+ : sym_option+ sym_option", "", 2, 282 },
-	{ /* 57 */ "sym_option+ : sym_option", "", 1, 282 },
-	{ /* 58 */ "sym_option* : sym_option+", "", 1, 281 },
-	{ /* 59 */ "sym_option* : ", "", 0, 281 },
-	{ /* 60 */ "sym_option : #%' greedy'", "", 2, 283 },
-	{ /* 61 */ "sym_option : #%' non-greedy'", "", 2, 283 },
-	{ /* 62 */ "goal_mark : $'", "", 1, 288 },
-	{ /* 63 */ "goal_mark : ", "", 0, 288 },
-	{ /* 64 */ "productions : productions |' production", "", 3, 286 },
-	{ /* 65 */ "productions : production", "", 1, 286 },
-	{ /* 66 */ "ast_node : =' identifier'", "", 2, 284 },
-	{ /* 67 */ "ast_node : =' string", "", 2, 284 },
-	{ /* 68 */ "ast_node : ", "", 0, 284 },
-	{ /* 69 */ "production : line_number rhs_opt code_opt_dup ast_node prod_directives*", "", 5, 280 },
-	{ /* 70 */ "prod_directives+ : prod_directives+ prod_directives", "", 2, 275 },
-	{ /* 71 */ "prod_directives+ : prod_directives", "", 1, 275 },
-	{ /* 72 */ "prod_directives* : prod_directives+", "", 1, 274 },
-	{ /* 73 */ "prod_directives* : ", "", 0, 274 },
-	{ /* 74 */ "rhs_opt : rhs", "", 1, 278 },
-	{ /* 75 */ "rhs_opt : ", "", 0, 278 },
-	{ /* 76 */ "prod_directives : #%' precedence' terminal'", "", 3, 276 },
-	{ /* 77 */ "rhs : rhs symbol access_name", "", 3, 273 },
-	{ /* 78 */ "rhs : symbol access_name", "", 2, 273 },
-	{ /* 79 */ "symbol : sym modifier'", "", 2, 272 },
-	{ /* 80 */ "symbol : &error'", "", 1, 272 },
-	{ /* 81 */ "symbol : &eof'", "", 1, 272 },
-	{ /* 82 */ "sym : terminal'", "", 1, 294 },
-	{ /* 83 */ "sym : identifier'", "", 1, 294 },
-	{ /* 84 */ "sym : type' (' stack_cur_prod productions )'", "", 5, 294 },
-	{ /* 85 */ "stack_cur_prod : ", "", 0, 270 },
-	{ /* 86 */ "terminal : ccl", "", 1, 319 },
-	{ /* 87 */ "terminal : kw", "", 1, 319 },
-	{ /* 88 */ "terminal : '@' identifier", "", 2, 319 },
-	{ /* 89 */ "modifier : '*'", "", 1, 317 },
-	{ /* 90 */ "modifier : '+'", "", 1, 317 },
-	{ /* 91 */ "modifier : '?'", "", 1, 317 },
-	{ /* 92 */ "modifier : ", "", 0, 317 },
-	{ /* 93 */ "access_name : :' identifier'", "", 2, 271 },
-	{ /* 94 */ "access_name : :' string_single", "", 2, 271 },
-	{ /* 95 */ "access_name : ", "", 0, 271 },
-	{ /* 96 */ "regex : re_alt", "", 1, 285 },
-	{ /* 97 */ "re_alt : re_alt |' re_expr", "", 3, 267 },
-	{ /* 98 */ "re_alt : re_expr", "", 1, 267 },
-	{ /* 99 */ "re_expr : re_expr re_modifier", "", 2, 266 },
-	{ /* 100 */ "re_expr : re_modifier", "", 1, 266 },
-	{ /* 101 */ "re_modifier : re_factor *'", "", 2, 265 },
-	{ /* 102 */ "re_modifier : re_factor +'", "", 2, 265 },
-	{ /* 103 */ "re_modifier : re_factor ?'", "", 2, 265 },
-	{ /* 104 */ "re_modifier : re_factor", "", 1, 265 },
-	{ /* 105 */ "re_factor : ccl'", "", 1, 264 },
-	{ /* 106 */ "re_factor : kw'", "", 1, 264 },
-	{ /* 107 */ "re_factor : .'", "", 1, 264 },
-	{ /* 108 */ "re_factor : (' regex )'", "", 3, 264 },
-	{ /* 109 */ "string_single+ : string_single+ string_single", "", 2, 263 },
-	{ /* 110 */ "string_single+ : string_single", "", 1, 263 },
-	{ /* 111 */ "string : string_single+", "", 1, 298 },
-	{ /* 112 */ "string_single : ccl_string'", "", 1, 268 },
-	{ /* 113 */ "string_single : kw'", "", 1, 268 },
-	{ /* 114 */ "ccl : ccl_string", "", 1, 269 },
-	{ /* 115 */ "ccl : '!' ccl_string", "", 2, 269 },
-	{ /* 116 */ "ccl_string : ''' ccl_str '''", "", 3, 315 },
-	{ /* 117 */ "ccl_str : ccl_str ccl_char", "", 2, 262 },
-	{ /* 118 */ "ccl_str : ", "", 0, 262 },
-	{ /* 119 */ "ccl_char : \\x0-&(-[]-\\uFFFF#", "", 1, 261 },
-	{ /* 120 */ "ccl_char : '\\\\' \\x1-\\uFFFF#", "", 2, 261 },
-	{ /* 121 */ "kw : '\"' '\"' kw_str '\"' '\"'", "", 5, 314 },
-	{ /* 122 */ "kw : '\"' kw_str '\"'", "", 3, 314 },
-	{ /* 123 */ "kw_str : kw_str kw_char", "", 2, 258 },
-	{ /* 124 */ "kw_str : ", "", 0, 258 },
-	{ /* 125 */ "kw_char : \\x0-!#-[]-\\uFFFF#", "", 1, 257 },
-	{ /* 126 */ "kw_char : '\\\\' \\x1-\\uFFFF#", "", 2, 257 },
-	{ /* 127 */ "type : '<' type_str '>'", "", 3, 313 },
-	{ /* 128 */ "type : ", "", 0, 313 },
-	{ /* 129 */ "type_str : type_str \\x0-=?-\\uFFFF#", "", 2, 255 },
-	{ /* 130 */ "type_str : ", "", 0, 255 },
-	{ /* 131 */ "identifier : identifier_start identifier_follow", "", 2, 318 },
-	{ /* 132 */ "identifier_start : 'A-Z_a-z'", "", 1, 253 },
-	{ /* 133 */ "identifier_follow : identifier_follow 0-9A-Z_a-z#", "", 2, 252 },
-	{ /* 134 */ "identifier_follow : ", "", 0, 252 },
-	{ /* 135 */ "string_or_ident : string", "", 1, 303 },
-	{ /* 136 */ "string_or_ident : identifier'", "", 1, 303 },
-	{ /* 137 */ "integer : integer '0-9'", "", 2, 250 },
-	{ /* 138 */ "integer : '0-9'", "", 1, 250 },
-	{ /* 139 */ "code_opt_dup : code_opt", "", 1, 277 },
-	{ /* 140 */ "code_opt : code'", "", 1, 297 },
-	{ /* 141 */ "code_opt : ", "", 0, 297 },
-	{ /* 142 */ "code : code_begin inner_code_opt \"*]\"", "", 3, 316 },
-	{ /* 143 */ "code_begin : \"[*\"", "", 1, 249 },
-	{ /* 144 */ "inner_code_opt : inner_code", "", 1, 248 },
-	{ /* 145 */ "inner_code_opt : ", "", 0, 248 },
-	{ /* 146 */ "inner_code : inner_code anychar", "", 2, 247 },
-	{ /* 147 */ "inner_code : anychar", "", 1, 247 },
-	{ /* 148 */ "whitespace : ' '", "", 1, 320 },
-	{ /* 149 */ "whitespace : '\\t'", "", 1, 320 },
-	{ /* 150 */ "whitespace : \"/*\" comment? \"*/\"", "", 3, 320 },
-	{ /* 151 */ "comment? : comment", "", 1, 244 },
-	{ /* 152 */ "comment? : ", "", 0, 244 },
-	{ /* 153 */ "whitespace : \"//\" scomment? '\\n'", "", 3, 320 },
-	{ /* 154 */ "scomment? : scomment", "", 1, 242 },
-	{ /* 155 */ "scomment? : ", "", 0, 242 },
-	{ /* 156 */ "whitespace : '\\r'", "", 1, 320 },
-	{ /* 157 */ "whitespace : '\\n'", "", 1, 320 },
-	{ /* 158 */ "comment : comment anychar", "", 2, 245 },
-	{ /* 159 */ "comment : anychar", "", 1, 245 },
-	{ /* 160 */ "anychar : \\x1-\\uFFFF#", "", 1, 246 },
-	{ /* 161 */ "scomment : scomment \\x0-\\t\\v-\\uFFFF#", "", 2, 243 },
-	{ /* 162 */ "scomment : \\x0-\\t\\v-\\uFFFF#", "", 1, 243 },
-	{ /* 163 */ "line_number : ", "", 0, 279 },
-	{ /* 164 */ "grammar_spec' : grammar_spec ~&eof", "", 2, 240 },
-	{ /* 165 */ "&whitespace : whitespace", "", 1, 239 },
-	{ /* 166 */ "&whitespace+ : &whitespace+ &whitespace", "", 2, 238 },
-	{ /* 167 */ "&whitespace+ : &whitespace", "", 1, 238 },
-	{ /* 168 */ "&whitespace* : &whitespace+", "", 1, 237 },
-	{ /* 169 */ "&whitespace* : ", "", 0, 237 },
-	{ /* 170 */ "code' : code &whitespace*", "", 2, 236 },
-	{ /* 171 */ ";' : ';' &whitespace*", "", 2, 235 },
-	{ /* 172 */ "#%' : '#%' &whitespace*", "", 2, 234 },
-	{ /* 173 */ "whitespaces' : \"whitespaces\" &whitespace*", "", 2, 233 },
-	{ /* 174 */ "lexeme' : \"lexeme\" &whitespace*", "", 2, 232 },
-	{ /* 175 */ "fixate' : \"fixate\" &whitespace*", "", 2, 231 },
-	{ /* 176 */ "left' : \"left\" &whitespace*", "", 2, 230 },
-	{ /* 177 */ "right' : \"right\" &whitespace*", "", 2, 229 },
-	{ /* 178 */ "nonassoc' : \"nonassoc\" &whitespace*", "", 2, 228 },
-	{ /* 179 */ "prefix' : \"prefix\" &whitespace*", "", 2, 227 },
-	{ /* 180 */ "default action' : \"default action\" &whitespace*", "", 2, 226 },
-	{ /* 181 */ "default epsilon action' : \"default epsilon action\" &whitespace*", "", 2, 225 },
-	{ /* 182 */ "default value type' : \"default value type\" &whitespace*", "", 2, 224 },
-	{ /* 183 */ "type' : type &whitespace*", "", 2, 223 },
-	{ /* 184 */ "lexeme separation' : \"lexeme separation\" &whitespace*", "", 2, 222 },
-	{ /* 185 */ "case insensitive strings' : \"case insensitive strings\" &whitespace*", "", 2, 221 },
-	{ /* 186 */ "reserve terminals' : \"reserve terminals\" &whitespace*", "", 2, 220 },
-	{ /* 187 */ "prologue' : \"prologue\" &whitespace*", "", 2, 219 },
-	{ /* 188 */ "epilogue' : \"epilogue\" &whitespace*", "", 2, 218 },
-	{ /* 189 */ "pcb' : \"pcb\" &whitespace*", "", 2, 217 },
-	{ /* 190 */ "extends' : \"extends\" &whitespace*", "", 2, 216 },
-	{ /* 191 */ "on' : \"on\" &whitespace*", "", 2, 215 },
-	{ /* 192 */ "off' : \"off\" &whitespace*", "", 2, 214 },
-	{ /* 193 */ "ccl_string' : ccl_string &whitespace*", "", 2, 213 },
-	{ /* 194 */ "kw' : kw &whitespace*", "", 2, 212 },
-	{ /* 195 */ "terminal' : terminal &whitespace*", "", 2, 211 },
-	{ /* 196 */ "identifier' : identifier &whitespace*", "", 2, 210 },
-	{ /* 197 */ "(' : '(' &whitespace*", "", 2, 209 },
-	{ /* 198 */ ")' : ')' &whitespace*", "", 2, 208 },
-	{ /* 199 */ "|' : '|' &whitespace*", "", 2, 207 },
-	{ /* 200 */ "precedence' : \"precedence\" &whitespace*", "", 2, 206 },
-	{ /* 201 */ "=' : '=' &whitespace*", "", 2, 205 },
-	{ /* 202 */ ":' : ':' &whitespace*", "", 2, 204 },
-	{ /* 203 */ "modifier' : modifier &whitespace*", "", 2, 203 },
-	{ /* 204 */ "&error' : \"&error\" &whitespace*", "", 2, 202 },
-	{ /* 205 */ "&eof' : \"&eof\" &whitespace*", "", 2, 201 },
-	{ /* 206 */ "@' : '@' &whitespace*", "", 2, 200 },
-	{ /* 207 */ "greedy' : \"greedy\" &whitespace*", "", 2, 199 },
-	{ /* 208 */ "non-greedy' : \"non-greedy\" &whitespace*", "", 2, 198 },
-	{ /* 209 */ "*' : '*' &whitespace*", "", 2, 197 },
-	{ /* 210 */ "+' : '+' &whitespace*", "", 2, 196 },
-	{ /* 211 */ "?' : '?' &whitespace*", "", 2, 195 },
-	{ /* 212 */ "ccl' : ccl &whitespace*", "", 2, 194 },
-	{ /* 213 */ ".' : '.' &whitespace*", "", 2, 193 },
-	{ /* 214 */ "->' : \"->\" &whitespace*", "", 2, 192 },
-	{ /* 215 */ "=>' : \"=>\" &whitespace*", "", 2, 191 },
-	{ /* 216 */ ":=' : \":=\" &whitespace*", "", 2, 190 },
-	{ /* 217 */ "$' : '$' &whitespace*", "", 2, 189 },
-	{ /* 218 */ "#!' : \"#!\" &whitespace*", "", 2, 188 },
-	{ /* 219 */ "%!' : \"%!\" &whitespace*", "", 2, 187 },
-	{ /* 220 */ "mode' : \"mode\" &whitespace*", "", 2, 186 },
-	{ /* 221 */ "language' : \"language\" &whitespace*", "", 2, 185 },
-	{ /* 222 */ "scannerless' : \"scannerless\" &whitespace*", "", 2, 184 },
-	{ /* 223 */ "scanner' : \"scanner\" &whitespace*", "", 2, 183 },
-	{ /* 224 */ "grammar_spec'' : &whitespace* grammar_spec'", "", 2, 182 },
-	{ /* 225 */ "\\x0-=?-\\uFFFF# : \\x0-\\t\\v-=?-\\uFFFF#", "", 1, 254 },
-	{ /* 226 */ "\\x0-=?-\\uFFFF# : '\\n'", "", 1, 254 },
-	{ /* 227 */ "\\x0-!#-[]-\\uFFFF# : \\x0-\\t\\v-!#-[]-\\uFFFF#", "", 1, 256 },
-	{ /* 228 */ "\\x0-!#-[]-\\uFFFF# : '\\n'", "", 1, 256 },
-	{ /* 229 */ "\\x1-\\uFFFF# : \\x1-\\t\\v-\\uFFFF#", "", 1, 259 },
-	{ /* 230 */ "\\x1-\\uFFFF# : '\\n'", "", 1, 259 },
-	{ /* 231 */ "\\x0-&(-[]-\\uFFFF# : \\x0-\\t\\v-&(-[]-\\uFFFF#", "", 1, 260 },
-	{ /* 232 */ "\\x0-&(-[]-\\uFFFF# : '\\n'", "", 1, 260 },
-	{ /* 233 */ "\\x1-\\t\\v-\\uFFFF# : '\\r'", "", 1, 179 },
-	{ /* 234 */ "\\x1-\\t\\v-\\uFFFF# : \\x1-\\t\\v-\\f\\xE-\\uFFFF#", "", 1, 179 },
-	{ /* 235 */ "\\x0-\\t\\v-!#-[]-\\uFFFF# : '\\r'", "", 1, 180 },
-	{ /* 236 */ "\\x0-\\t\\v-!#-[]-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-!#-[]-\\uFFFF#", "", 1, 180 },
-	{ /* 237 */ "\\x0-\\t\\v-=?-\\uFFFF# : '\\r'", "", 1, 181 },
-	{ /* 238 */ "\\x0-\\t\\v-=?-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-=?-\\uFFFF#", "", 1, 181 },
-	{ /* 239 */ "\\x0-\\t\\v-\\uFFFF# : '\\r'", "", 1, 241 },
-	{ /* 240 */ "\\x0-\\t\\v-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\uFFFF#", "", 1, 241 },
-	{ /* 241 */ "\\x0-\\t\\v-\\f\\xE-=?-\\uFFFF# : '\\t'", "", 1, 175 },
-	{ /* 242 */ "\\x0-\\t\\v-\\f\\xE-=?-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-=?-\\uFFFF#", "", 1, 175 },
-	{ /* 243 */ "\\x0-\\t\\v-\\f\\xE-!#-[]-\\uFFFF# : '\\t'", "", 1, 176 },
-	{ /* 244 */ "\\x0-\\t\\v-\\f\\xE-!#-[]-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-!#-[]-\\uFFFF#", "", 1, 176 },
-	{ /* 245 */ "\\x1-\\t\\v-\\f\\xE-\\uFFFF# : '\\t'", "", 1, 177 },
-	{ /* 246 */ "\\x1-\\t\\v-\\f\\xE-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\uFFFF#", "", 1, 177 },
-	{ /* 247 */ "\\x0-\\t\\v-&(-[]-\\uFFFF# : '\\t'", "", 1, 178 },
-	{ /* 248 */ "\\x0-\\t\\v-&(-[]-\\uFFFF# : \\x0-\\b\\v-&(-[]-\\uFFFF#", "", 1, 178 },
-	{ /* 249 */ "\\x1-\\b\\v-\\f\\xE-\\uFFFF# : ' '", "", 1, 171 },
-	{ /* 250 */ "\\x1-\\b\\v-\\f\\xE-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-\\uFFFF#", "", 1, 171 },
-	{ /* 251 */ "\\x0-\\b\\v-\\f\\xE-!#-[]-\\uFFFF# : ' '", "", 1, 172 },
-	{ /* 252 */ "\\x0-\\b\\v-\\f\\xE-!#-[]-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-[]-\\uFFFF#", "", 1, 172 },
-	{ /* 253 */ "\\x0-\\b\\v-\\f\\xE-=?-\\uFFFF# : ' '", "", 1, 173 },
-	{ /* 254 */ "\\x0-\\b\\v-\\f\\xE-=?-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-=?-\\uFFFF#", "", 1, 173 },
-	{ /* 255 */ "\\x0-\\t\\v-\\f\\xE-\\uFFFF# : ' '", "", 1, 174 },
-	{ /* 256 */ "\\x0-\\t\\v-\\f\\xE-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!-\\uFFFF#", "", 1, 174 },
-	{ /* 257 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-=?-\\uFFFF# : '0-9'", "", 1, 167 },
-	{ /* 258 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-=?-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-\\uFFFF#", "", 1, 167 },
-	{ /* 259 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-[]-\\uFFFF# : '0-9'", "", 1, 168 },
-	{ /* 260 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-[]-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-[]-\\uFFFF#", "", 1, 168 },
-	{ /* 261 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-\\uFFFF# : '0-9'", "", 1, 169 },
-	{ /* 262 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-/:-\\uFFFF#", "", 1, 169 },
-	{ /* 263 */ "\\x0-\\b\\v-&(-[]-\\uFFFF# : '0-9'", "", 1, 170 },
-	{ /* 264 */ "\\x0-\\b\\v-&(-[]-\\uFFFF# : \\x0-\\b\\v-&(-/:-[]-\\uFFFF#", "", 1, 170 },
-	{ /* 265 */ "0-9A-Z_a-z# : '0-9'", "", 1, 251 },
-	{ /* 266 */ "0-9A-Z_a-z# : 'A-Z_a-z'", "", 1, 251 },
-	{ /* 267 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-\\uFFFF# : 'A-Z_a-z'", "", 1, 163 },
-	{ /* 268 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-/:-@[-^`{-\\uFFFF#", "", 1, 163 },
-	{ /* 269 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-[]-\\uFFFF# : 'A-Z_a-z'", "", 1, 164 },
-	{ /* 270 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-[]-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-@[]-^`{-\\uFFFF#", "", 1, 164 },
-	{ /* 271 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-\\uFFFF# : 'A-Z_a-z'", "", 1, 165 },
-	{ /* 272 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF#", "", 1, 165 },
-	{ /* 273 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-\\uFFFF# : 'A-Z_a-z'", "", 1, 166 },
-	{ /* 274 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!-@[-^`{-\\uFFFF#", "", 1, 166 },
-	{ /* 275 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-@[]-^`{-\\uFFFF# : '>'", "", 1, 160 },
-	{ /* 276 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-=?-@[]-^`{-\\uFFFF#", "", 1, 160 },
-	{ /* 277 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-@[-^`{-\\uFFFF# : '>'", "", 1, 161 },
-	{ /* 278 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-@[-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF#", "", 1, 161 },
-	{ /* 279 */ "\\x0-\\b\\v-&(-/:-[]-\\uFFFF# : '>'", "", 1, 162 },
-	{ /* 280 */ "\\x0-\\b\\v-&(-/:-[]-\\uFFFF# : \\x0-\\b\\v-&(-/:-=?-[]-\\uFFFF#", "", 1, 162 },
-	{ /* 281 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF# : '<'", "", 1, 156 },
-	{ /* 282 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF#", "", 1, 156 },
-	{ /* 283 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-=?-@[]-^`{-\\uFFFF# : '<'", "", 1, 157 },
-	{ /* 284 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 157 },
-	{ /* 285 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-@[-^`{-\\uFFFF# : '<'", "", 1, 158 },
-	{ /* 286 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-@[-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!-;=-@[-^`{-\\uFFFF#", "", 1, 158 },
-	{ /* 287 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF# : '<'", "", 1, 159 },
-	{ /* 288 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-=?-@[-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF#", "", 1, 159 },
-	{ /* 289 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-;=-@[-^`{-\\uFFFF# : '\"'", "", 1, 152 },
-	{ /* 290 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!-;=-@[-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[-^`{-\\uFFFF#", "", 1, 152 },
-	{ /* 291 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF# : '\"'", "", 1, 154 },
-	{ /* 292 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[-^`{-\\uFFFF#", "", 1, 154 },
-	{ /* 293 */ "\\x0-\\b\\v-&(-/:-=?-[]-\\uFFFF# : '\"'", "", 1, 155 },
-	{ /* 294 */ "\\x0-\\b\\v-&(-/:-=?-[]-\\uFFFF# : \\x0-\\b\\v-!#-&(-/:-=?-[]-\\uFFFF#", "", 1, 155 },
-	{ /* 295 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[-^`{-\\uFFFF# : '\\\\'", "", 1, 149 },
-	{ /* 296 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 149 },
-	{ /* 297 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[-^`{-\\uFFFF# : '\\\\'", "", 1, 150 },
-	{ /* 298 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[]-^`{-\\uFFFF#", "", 1, 150 },
-	{ /* 299 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF# : '\\\\'", "", 1, 151 },
-	{ /* 300 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 151 },
-	{ /* 301 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[]-^`{-\\uFFFF# : '''", "", 1, 146 },
-	{ /* 302 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-;=-@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F!#-&(-;=-@[]-^`{-\\uFFFF#", "", 1, 146 },
-	{ /* 303 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF# : '''", "", 1, 147 },
-	{ /* 304 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 147 },
-	{ /* 305 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF# : '''", "", 1, 153 },
-	{ /* 306 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 153 },
-	{ /* 307 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF# : '!'", "", 1, 143 },
-	{ /* 308 */ "\\x1-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 143 },
-	{ /* 309 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-&(-;=-@[]-^`{-\\uFFFF# : '!'", "", 1, 144 },
-	{ /* 310 */ "\\x0-\\t\\v-\\f\\xE-\\x1F!#-&(-;=-@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(-;=-@[]-^`{-\\uFFFF#", "", 1, 144 },
-	{ /* 311 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[]-^`{-\\uFFFF# : '!'", "", 1, 145 },
-	{ /* 312 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!-/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 145 },
-	{ /* 313 */ "\\x0-\\b\\v-!#-&(-/:-=?-[]-\\uFFFF# : '!'", "", 1, 148 },
-	{ /* 314 */ "\\x0-\\b\\v-!#-&(-/:-=?-[]-\\uFFFF# : \\x0-\\b\\v- #-&(-/:-=?-[]-\\uFFFF#", "", 1, 148 },
-	{ /* 315 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-/:-;=?-@[]-^`{-\\uFFFF# : '.'", "", 1, 139 },
-	{ /* 316 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 139 },
-	{ /* 317 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-;=-@[]-^`{-\\uFFFF# : '.'", "", 1, 140 },
-	{ /* 318 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-;=-@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=-@[]-^`{-\\uFFFF#", "", 1, 140 },
-	{ /* 319 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-/:-;=?-@[]-^`{-\\uFFFF# : '.'", "", 1, 141 },
-	{ /* 320 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-/:-;=?-@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 141 },
-	{ /* 321 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF# : '.'", "", 1, 142 },
-	{ /* 322 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 142 },
-	{ /* 323 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=?-@[]-^`{-\\uFFFF# : '?'", "", 1, 135 },
-	{ /* 324 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=?-@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=@[]-^`{-\\uFFFF#", "", 1, 135 },
-	{ /* 325 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=-@[]-^`{-\\uFFFF# : '?'", "", 1, 136 },
-	{ /* 326 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=-@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=->@[]-^`{-\\uFFFF#", "", 1, 136 },
-	{ /* 327 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=?-@[]-^`{-\\uFFFF# : '?'", "", 1, 137 },
-	{ /* 328 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=@[]-^`{-\\uFFFF#", "", 1, 137 },
-	{ /* 329 */ "\\x0-\\b\\v- #-&(-/:-=?-[]-\\uFFFF# : '?'", "", 1, 138 },
-	{ /* 330 */ "\\x0-\\b\\v- #-&(-/:-=?-[]-\\uFFFF# : \\x0-\\b\\v- #-&(-/:-=@-[]-\\uFFFF#", "", 1, 138 },
-	{ /* 331 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=@[]-^`{-\\uFFFF# : '+'", "", 1, 131 },
-	{ /* 332 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-*,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 131 },
-	{ /* 333 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=->@[]-^`{-\\uFFFF# : '+'", "", 1, 132 },
-	{ /* 334 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(-*,--/-;=->@[]-^`{-\\uFFFF#", "", 1, 132 },
-	{ /* 335 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=@[]-^`{-\\uFFFF# : '+'", "", 1, 133 },
-	{ /* 336 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(-*,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 133 },
-	{ /* 337 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(--/:-;=?-@[]-^`{-\\uFFFF# : '+'", "", 1, 134 },
-	{ /* 338 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(--/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-*,--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 134 },
-	{ /* 339 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-*,--/:-;=@[]-^`{-\\uFFFF# : '*'", "", 1, 127 },
-	{ /* 340 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-*,--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(-),--/:-;=@[]-^`{-\\uFFFF#", "", 1, 127 },
-	{ /* 341 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-*,--/-;=->@[]-^`{-\\uFFFF# : '*'", "", 1, 128 },
-	{ /* 342 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-*,--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(-),--/-;=->@[]-^`{-\\uFFFF#", "", 1, 128 },
-	{ /* 343 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-*,--/:-;=@[]-^`{-\\uFFFF# : '*'", "", 1, 129 },
-	{ /* 344 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-*,--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-),--/:-;=@[]-^`{-\\uFFFF#", "", 1, 129 },
-	{ /* 345 */ "\\x0-\\b\\v- #-&(-/:-=@-[]-\\uFFFF# : '*'", "", 1, 130 },
-	{ /* 346 */ "\\x0-\\b\\v- #-&(-/:-=@-[]-\\uFFFF# : \\x0-\\b\\v- #-&(-)+-/:-=@-[]-\\uFFFF#", "", 1, 130 },
-	{ /* 347 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-),--/:-;=@[]-^`{-\\uFFFF# : ')'", "", 1, 123 },
-	{ /* 348 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-),--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-(,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 123 },
-	{ /* 349 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-),--/-;=->@[]-^`{-\\uFFFF# : ')'", "", 1, 124 },
-	{ /* 350 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(-),--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&(,--/-;=->@[]-^`{-\\uFFFF#", "", 1, 124 },
-	{ /* 351 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-),--/:-;=@[]-^`{-\\uFFFF# : ')'", "", 1, 125 },
-	{ /* 352 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(-),--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&(,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 125 },
-	{ /* 353 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-*,--/:-;=?-@[]-^`{-\\uFFFF# : ')'", "", 1, 126 },
-	{ /* 354 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(-*,--/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;=?-@[]-^`{-\\uFFFF#", "", 1, 126 },
-	{ /* 355 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(,--/:-;=@[]-^`{-\\uFFFF# : '('", "", 1, 119 },
-	{ /* 356 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&(,--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;=@[]-^`{-\\uFFFF#", "", 1, 119 },
-	{ /* 357 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(,--/-;=->@[]-^`{-\\uFFFF# : '('", "", 1, 120 },
-	{ /* 358 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&(,--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;=->@[]-^`{-\\uFFFF#", "", 1, 120 },
-	{ /* 359 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-(,--/:-;=@[]-^`{-\\uFFFF# : '('", "", 1, 121 },
-	{ /* 360 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-(,--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;=@[]-^`{-\\uFFFF#", "", 1, 121 },
-	{ /* 361 */ "\\x0-\\b\\v- #-&(-)+-/:-=@-[]-\\uFFFF# : '('", "", 1, 122 },
-	{ /* 362 */ "\\x0-\\b\\v- #-&(-)+-/:-=@-[]-\\uFFFF# : \\x0-\\b\\v- #-&)+-/:-=@-[]-\\uFFFF#", "", 1, 122 },
-	{ /* 363 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;=@[]-^`{-\\uFFFF# : '='", "", 1, 115 },
-	{ /* 364 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;=@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{-\\uFFFF#", "", 1, 115 },
-	{ /* 365 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;=->@[]-^`{-\\uFFFF# : '='", "", 1, 116 },
-	{ /* 366 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;=->@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{-\\uFFFF#", "", 1, 116 },
-	{ /* 367 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;=@[]-^`{-\\uFFFF# : '='", "", 1, 117 },
-	{ /* 368 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;=@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{-\\uFFFF#", "", 1, 117 },
-	{ /* 369 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;=?-@[]-^`{-\\uFFFF# : '='", "", 1, 118 },
-	{ /* 370 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;=?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;?-@[]-^`{-\\uFFFF#", "", 1, 118 },
-	{ /* 371 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{-\\uFFFF# : '|'", "", 1, 111 },
-	{ /* 372 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{}-\\uFFFF#", "", 1, 111 },
-	{ /* 373 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{-\\uFFFF# : '|'", "", 1, 112 },
-	{ /* 374 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{}-\\uFFFF#", "", 1, 112 },
-	{ /* 375 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{-\\uFFFF# : '|'", "", 1, 113 },
-	{ /* 376 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{}-\\uFFFF#", "", 1, 113 },
-	{ /* 377 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-\\uFFFF# : '|'", "", 1, 114 },
-	{ /* 378 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-\\uFFFF# : \\x0-\\b\\v- #-&)+-/:-=@-[]-{}-\\uFFFF#", "", 1, 114 },
-	{ /* 379 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{}-\\uFFFF# : '$'", "", 1, 107 },
-	{ /* 380 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-',--/:-;@[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;@[]-^`{}-\\uFFFF#", "", 1, 107 },
-	{ /* 381 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{}-\\uFFFF# : '$'", "", 1, 108 },
-	{ /* 382 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#-&,--/-;>@[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>@[]-^`{}-\\uFFFF#", "", 1, 108 },
-	{ /* 383 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{}-\\uFFFF# : '$'", "", 1, 109 },
-	{ /* 384 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#-&,--/:-;@[]-^`{}-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;@[]-^`{}-\\uFFFF#", "", 1, 109 },
-	{ /* 385 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;?-@[]-^`{-\\uFFFF# : '$'", "", 1, 110 },
-	{ /* 386 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#-&(*,--/:-;?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/:-;?-@[]-^`{-\\uFFFF#", "", 1, 110 },
-	{ /* 387 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;@[]-^`{}-\\uFFFF# : '@'", "", 1, 103 },
-	{ /* 388 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;@[]-^`{}-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;[]-^`{}-\\uFFFF#", "", 1, 103 },
-	{ /* 389 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>@[]-^`{}-\\uFFFF# : '@'", "", 1, 104 },
-	{ /* 390 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>@[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>[]-^`{}-\\uFFFF#", "", 1, 104 },
-	{ /* 391 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;@[]-^`{}-\\uFFFF# : '@'", "", 1, 105 },
-	{ /* 392 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;@[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;[]-^`{}-\\uFFFF#", "", 1, 105 },
-	{ /* 393 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-{}-\\uFFFF# : '@'", "", 1, 106 },
-	{ /* 394 */ "\\x0-\\b\\v- #-&)+-/:-=@-[]-{}-\\uFFFF# : \\x0-\\b\\v- #-&)+-/:-=A-[]-{}-\\uFFFF#", "", 1, 106 },
-	{ /* 395 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;[]-^`{}-\\uFFFF# : ':'", "", 1, 99 },
-	{ /* 396 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/:-;[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/;[]-^`{}-\\uFFFF#", "", 1, 99 },
-	{ /* 397 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>[]-^`{}-\\uFFFF# : ':'", "", 1, 100 },
-	{ /* 398 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-;>[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-9;>[]-^`{}-\\uFFFF#", "", 1, 100 },
-	{ /* 399 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;[]-^`{}-\\uFFFF# : ':'", "", 1, 101 },
-	{ /* 400 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/:-;[]-^`{}-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/;[]-^`{}-\\uFFFF#", "", 1, 101 },
-	{ /* 401 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/:-;?-@[]-^`{-\\uFFFF# : ':'", "", 1, 102 },
-	{ /* 402 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/:-;?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/;?-@[]-^`{-\\uFFFF#", "", 1, 102 },
-	{ /* 403 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/;[]-^`{}-\\uFFFF# : '#%'", "", 1, 95 },
-	{ /* 404 */ "\\x1-\\b\\v-\\f\\xE-\\x1F#%-&,--/;[]-^`{}-\\uFFFF# : \\x1-\\b\\v-\\f\\xE-\\x1F&,--/;[]-^`{}-\\uFFFF#", "", 1, 95 },
-	{ /* 405 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-9;>[]-^`{}-\\uFFFF# : '#%'", "", 1, 96 },
-	{ /* 406 */ "\\x0-\\t\\v-\\f\\xE-\\x1F#%-&,--/-9;>[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9;>[]-^`{}-\\uFFFF#", "", 1, 96 },
-	{ /* 407 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/;[]-^`{}-\\uFFFF# : '#%'", "", 1, 97 },
-	{ /* 408 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"-#%-',--/;[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/;[]-^`{}-\\uFFFF#", "", 1, 97 },
-	{ /* 409 */ "\\x0-\\b\\v- #-&)+-/:-=A-[]-{}-\\uFFFF# : '#%'", "", 1, 98 },
-	{ /* 410 */ "\\x0-\\b\\v- #-&)+-/:-=A-[]-{}-\\uFFFF# : \\x0-\\b\\v- $&)+-/:-=A-[]-{}-\\uFFFF#", "", 1, 98 },
-	{ /* 411 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/;[]-^`{}-\\uFFFF# : ';'", "", 1, 91 },
-	{ /* 412 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/;[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/[]-^`{}-\\uFFFF#", "", 1, 91 },
-	{ /* 413 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9;>[]-^`{}-\\uFFFF# : ';'", "", 1, 92 },
-	{ /* 414 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9;>[]-^`{}-\\uFFFF# : \\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9>[]-^`{}-\\uFFFF#", "", 1, 92 },
-	{ /* 415 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/;[]-^`{}-\\uFFFF# : ';'", "", 1, 93 },
-	{ /* 416 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/;[]-^`{}-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 93 },
-	{ /* 417 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/;?-@[]-^`{-\\uFFFF# : ';'", "", 1, 94 },
-	{ /* 418 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/;?-@[]-^`{-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/?-@[]-^`{-\\uFFFF#", "", 1, 94 },
-	{ /* 419 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9>[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF#", "", 1, 88 },
-	{ /* 420 */ "\\x0-\\t\\v-\\f\\xE-\\x1F&,--/-9>[]-^`{}-\\uFFFF# : \\t0-9>#", "", 1, 88 },
-	{ /* 421 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/[]-^`{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF#", "", 1, 89 },
-	{ /* 422 */ "\\x0-\\b\\v-\\f\\xE-\\x1F\"&-',--/[]-^`{}-\\uFFFF# : \"'#", "", 1, 89 },
-	{ /* 423 */ "\\x0-\\b\\v- $&)+-/:-=A-[]-{}-\\uFFFF# : \\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF#", "", 1, 90 },
-	{ /* 424 */ "\\x0-\\b\\v- $&)+-/:-=A-[]-{}-\\uFFFF# : \\r $)+.:-=A-Z_a-z#", "", 1, 90 },
-	{ /* 425 */ "\\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 86 },
-	{ /* 426 */ "\\x0-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF# : '\\x0'", "", 1, 86 },
-	{ /* 427 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/?-@[]-^`{-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 87 },
-	{ /* 428 */ "\\x0-\\b\\v-\\f\\xE-\\x1F!#%-&(*,--/?-@[]-^`{-\\uFFFF# : \\x0!#%(*?-@|#", "", 1, 87 },
-	{ /* 429 */ "\\r $)+.:-=A-Z_a-z# : '\\r'", "", 1, 83 },
-	{ /* 430 */ "\\r $)+.:-=A-Z_a-z# :  $)+.:-=A-Z_a-z#", "", 1, 83 },
-	{ /* 431 */ "\\t0-9># : '\\t'", "", 1, 85 },
-	{ /* 432 */ "\\t0-9># : 0-9>#", "", 1, 85 },
-	{ /* 433 */ " $)+.:-=A-Z_a-z# : ' '", "", 1, 81 },
-	{ /* 434 */ " $)+.:-=A-Z_a-z# : $)+.:-=A-Z_a-z#", "", 1, 81 },
-	{ /* 435 */ "0-9># : '0-9'", "", 1, 80 },
-	{ /* 436 */ "0-9># : '>'", "", 1, 80 },
-	{ /* 437 */ "$)+.:-=A-Z_a-z# : 'A-Z_a-z'", "", 1, 79 },
-	{ /* 438 */ "$)+.:-=A-Z_a-z# : $)+.:-=#", "", 1, 79 },
-	{ /* 439 */ "$)+.:-=# : '<'", "", 1, 78 },
-	{ /* 440 */ "$)+.:-=# : $)+.:-;=#", "", 1, 78 },
-	{ /* 441 */ "\"'# : '\"'", "", 1, 84 },
-	{ /* 442 */ "\"'# : '''", "", 1, 84 },
-	{ /* 443 */ "\\x0!#%(*?-@|# : '!'", "", 1, 82 },
-	{ /* 444 */ "\\x0!#%(*?-@|# : \\x0#%(*?-@|#", "", 1, 82 },
-	{ /* 445 */ "$)+.:-;=# : '.'", "", 1, 77 },
-	{ /* 446 */ "$)+.:-;=# : $)+:-;=#", "", 1, 77 },
-	{ /* 447 */ "\\x0#%(*?-@|# : '?'", "", 1, 76 },
-	{ /* 448 */ "\\x0#%(*?-@|# : \\x0#%(*@|#", "", 1, 76 },
-	{ /* 449 */ "$)+:-;=# : '+'", "", 1, 75 },
-	{ /* 450 */ "$)+:-;=# : $):-;=#", "", 1, 75 },
-	{ /* 451 */ "\\x0#%(*@|# : '*'", "", 1, 74 },
-	{ /* 452 */ "\\x0#%(*@|# : \\x0#%(@|#", "", 1, 74 },
-	{ /* 453 */ "$):-;=# : ')'", "", 1, 73 },
-	{ /* 454 */ "$):-;=# : $:-;=#", "", 1, 73 },
-	{ /* 455 */ "\\x0#%(@|# : '('", "", 1, 72 },
-	{ /* 456 */ "\\x0#%(@|# : \\x0#%@|#", "", 1, 72 },
-	{ /* 457 */ "$:-;=# : '='", "", 1, 71 },
-	{ /* 458 */ "$:-;=# : $:-;#", "", 1, 71 },
-	{ /* 459 */ "\\x0#%@|# : '|'", "", 1, 70 },
-	{ /* 460 */ "\\x0#%@|# : \\x0#%@#", "", 1, 70 },
-	{ /* 461 */ "$:-;# : '$'", "", 1, 69 },
-	{ /* 462 */ "$:-;# : :-;#", "", 1, 69 },
-	{ /* 463 */ "\\x0#%@# : '@'", "", 1, 68 },
-	{ /* 464 */ "\\x0#%@# : \\x0#%#", "", 1, 68 },
-	{ /* 465 */ ":-;# : ':'", "", 1, 67 },
-	{ /* 466 */ ":-;# : ';'", "", 1, 67 },
-	{ /* 467 */ "\\x0#%# : '#%'", "", 1, 66 },
-	{ /* 468 */ "\\x0#%# : '\\x0'", "", 1, 66 }
-};
-
-UNICC_STATIC UNICC_SCHAR* _lexem( _pcb* pcb )
-{
-#if UNICC_WCHAR || !UNICC_UTF8
-    pcb->lexem = pcb->buf;
-#else
-    size_t		size;
-
-    size = wcstombs( (char*)NULL, pcb->buf, 0 );
-
-    free( pcb->lexem );
-
-    if( !( pcb->lexem = (UNICC_SCHAR*)malloc(
-            ( size + 1 ) * sizeof( UNICC_SCHAR ) ) ) )
-    {
-        UNICC_OUTOFMEM( pcb );
-        return (UNICC_SCHAR*)NULL;
-    }
-
-    wcstombs( pcb->lexem, pcb->buf, size + 1 );
-#endif
-
-#if UNICC_DEBUG	> 2
-    fprintf( stderr, "%s: lexem: pcb->lexem = >" UNICC_SCHAR_FORMAT "<\n",
-                        UNICC_PARSER, pcb->lexem );
-#endif
-    return pcb->lexem;
-}
-
-
-UNICC_STATIC _ast* _ast_create( _pcb* pcb, char* emit,
-                                                    UNICC_SCHAR* token )
-{
-    _ast*	node;
-
-    if( !( node = (_ast*)malloc( sizeof( _ast ) ) ) )
-    {
-        UNICC_OUTOFMEM( pcb );
-        return node;
-    }
-
-    memset( node, 0, sizeof( _ast ) );
-
-    node->emit = emit;
-
-    if( token )
-    {
-        #if !UNICC_WCHAR
-        if( !( node->token = strdup( token ) ) )
-        {
-            UNICC_OUTOFMEM( pcb );
-            free( node );
-            return (_ast*)NULL;
-        }
-        #else
-        if( !( node->token = wcsdup( token ) ) )
-        {
-            UNICC_OUTOFMEM( pcb );
-            free( node );
-            return (_ast*)NULL;
-        }
-        #endif
-    }
-
-    return node;
-}
-
-/* Don't report on unused _ast_free or _ast_print */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-function"
-
-UNICC_STATIC _ast* _ast_free( _ast* node )
-{
-    if( !node )
-        return (_ast*)NULL;
-
-    _ast_free( node->child );
-    _ast_free( node->next );
-
-    if( node->token )
-        free( node->token );
-
-    free( node );
-    return (_ast*)NULL;
-}
-
-UNICC_STATIC void _ast_print( FILE* stream, _ast* node )
-{
-    int 		i;
-    static int 	rec;
-
-    if( !node )
-        return;
-
-    if( !stream )
-        stream = stderr;
-
-    while( node )
+        67,
+        66
+    },
     {
-        for( i = 0; i < rec; i++ )
-            fprintf( stream,  " " );
-
-        fprintf( stream, "%s", node->emit );
-
-        if( node->token && strcmp( node->emit, node->token ) != 0 )
-            fprintf( stream, " (%s)", node->token );
-
-        fprintf( stream, "\n" );
-
-        rec++;
-        _ast_print( stream, node->child );
-        rec--;
-
-        node = node->next;
-    }
-}
-
-#pragma GCC diagnostic pop
-
-UNICC_STATIC int _get_act( _pcb* pcb )
-{
-    int i;
-
-    for( i = 1; i < _act[ pcb->tos->state ][0] * 3; i += 3 )
+        0,
+        62,
+        59
+    },
     {
-        if( _act[ pcb->tos->state ][i] == pcb->sym )
-        {
-            if( ( pcb->act = _act[ pcb->tos->state ][i+1] )
-                    == UNICC_ERROR )
-                return 0; /* Force parse error! */
-
-            pcb->idx = _act[ pcb->tos->state ][i+2];
-            return 1;
-        }
-    }
-
-    /* Default production */
-    if( ( pcb->idx = _def_prod[ pcb->tos->state ] ) > -1 )
+        0,
+        62,
+        67
+    },
     {
-        pcb->act = 1; /* Reduce */
-        return 1;
-    }
-
-    return 0;
-}
-
-UNICC_STATIC int _get_go( _pcb* pcb )
-{
-    int i;
-
-    for( i = 1; i < _go[ pcb->tos->state ][0] * 3; i += 3 )
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        11,
+        0,
+        0,
+        0,
+        10
+    },
     {
-        if( _go[ pcb->tos->state ][i] == pcb->lhs )
-        {
-            pcb->act = _go[ pcb->tos->state ][ i + 1 ];
-            pcb->idx = _go[ pcb->tos->state ][ i + 2 ];
-            return 1;
-        }
-    }
-
-    return 0;
-}
-
-UNICC_STATIC int _alloc_stack( _pcb* pcb )
-{
-    unsigned int	size;
-
-    if( !pcb->stacksize )
+        0,
+        0,
+        48,
+        50,
+        61,
+        62,
+        64,
+        65,
+        66,
+        67,
+        0,
+        59,
+        60,
+        53,
+        0,
+        51,
+        54,
+        46,
+        43,
+        44,
+        45,
+        5,
+        2,
+        4,
+        0,
+        0,
+        0,
+        0,
+        7,
+        0,
+        8
+    },
     {
-        if( !( pcb->tos = pcb->stack = (_tok*)malloc(
-                UNICC_MALLOCSTEP * sizeof( _tok ) ) ) )
-        {
-            UNICC_OUTOFMEM( pcb );
-            return -1;
-        }
-
-        pcb->stacksize = UNICC_MALLOCSTEP;
-    }
-    else if( ( size = (unsigned int)( pcb->tos - pcb->stack ) )
-                == pcb->stacksize )
+        0,
+        66,
+        67,
+        0,
+        46,
+        43,
+        44,
+        45,
+        2,
+        4
+    },
     {
-        _tok*	ptr;
-
-        if( !( ptr = (_tok*)realloc( pcb->stack,
-                ( pcb->stacksize + UNICC_MALLOCSTEP )
-                    * sizeof( _tok ) ) ) )
-        {
-            UNICC_OUTOFMEM( pcb );
-            free( pcb->stack );
-
-            return -1;
-        }
-
-        pcb->tos = pcb->stack = ptr;
-
-        pcb->stacksize += UNICC_MALLOCSTEP;
-        pcb->tos += size;
-    }
-
-    return 0;
-}
-
-#ifndef UNICC_GETINPUT
-
-#if UNICC_UTF8
-static int offsets_utf8[ 6 ] =
-{
-    0x00000000UL, 0x00003080UL, 0x000E2080UL,
-    0x03C82080UL, 0xFA082080UL, 0x82082080UL
-};
-
-static int trailbyte_utf8[ 256 ] =
-{
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
-    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,4,4,4,4,5,5,5,5
-};
-
-UNICC_STATIC UNICC_CHAR _utf8_getchar( int (*getfn)() )
-{
-    UNICC_CHAR	ch	= 0;
-    int 		nb;
-    int			c;
-
-    if( !getfn )
-        getfn = getchar;
-
-    switch( ( nb = trailbyte_utf8[ ( c = (*getfn)() ) ] ) )
+        0,
+        62,
+        66,
+        61,
+        67,
+        59
+    },
     {
-        case 3:
-            ch += c;
-            ch <<= 6;
-            c = (*getfn)();
-        case 2:
-            ch += c;
-            ch <<= 6;
-            c = (*getfn)();
-        case 1:
-            ch += c;
-            ch <<= 6;
-            c = (*getfn)();
-        case 0:
-            ch += c;
-            break;
-    }
-
-    ch -= offsets_utf8[ nb ];
-#if UNICC_DEBUG	> 3
-    fprintf( stderr, "%s: getchar: %d\n", UNICC_PARSER, ch );
-#endif
-    return ch;
-}
-#define UNICC_GETINPUT		_utf8_getchar( getchar )
-
-#else
-#define UNICC_GETINPUT		getchar()
-#endif
-
-#endif
-
-UNICC_STATIC UNICC_CHAR _get_input( _pcb* pcb, unsigned int offset )
-{
-#if UNICC_DEBUG	> 2
-    fprintf( stderr, "%s: get input: pcb->buf + offset = %p pcb->bufend = %p\n",
-                UNICC_PARSER, pcb->buf + offset, pcb->bufend );
-#endif
-
-    while( pcb->buf + offset >= pcb->bufend )
+        0,
+        59,
+        62,
+        67,
+        66
+    },
+    {
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        0,
+        9
+    },
     {
-#if UNICC_DEBUG	> 2
-            fprintf( stderr, "%s: get input: requiring more input\n",
-                    UNICC_PARSER );
-#endif
-        if( !pcb->buf )
-        {
-            pcb->bufend = pcb->buf = (UNICC_CHAR*)malloc(
-                ( UNICC_MALLOCSTEP + 1 ) * sizeof( UNICC_CHAR ) );
-
-            if( !pcb->buf )
-            {
-                UNICC_OUTOFMEM( pcb );
-                return 0;
-            }
-
-            *pcb->buf = 0;
-        }
-        else if( *pcb->buf && !( ( pcb->bufend - pcb->buf ) %
-                    UNICC_MALLOCSTEP ) )
-        {
-            unsigned int 	size	= (unsigned int)( pcb->bufend - pcb->buf );
-            UNICC_CHAR*		buf;
-
-            if( !( buf = (UNICC_CHAR*)realloc( pcb->buf,
-                        ( size + UNICC_MALLOCSTEP + 1 )
-                            * sizeof( UNICC_CHAR ) ) ) )
-            {
-                UNICC_OUTOFMEM( pcb );
-                free( pcb->buf );
-
-                return 0;
-            }
-
-            pcb->buf = buf;
-            pcb->bufend = pcb->buf + size;
-        }
-
-        if( pcb->is_eof || ( *( pcb->bufend ) = (UNICC_CHAR)UNICC_GETINPUT )
-                                    == pcb->eof )
-        {
-#if UNICC_DEBUG	> 2
-            fprintf( stderr, "%s: get input: can't get more input, "
-                        "end-of-file reached\n", UNICC_PARSER );
-#endif
-            pcb->is_eof = 1;
-            return pcb->eof;
-        }
-#if UNICC_DEBUG	> 2
-        fprintf( stderr, "%s: get input: read char >%c< %d\n",
-                    UNICC_PARSER, (char)*( pcb->bufend ), *( pcb->bufend ) );
-#endif
-
-#if UNICC_DEBUG	> 2
-        fprintf( stderr, "%s: get input: reading character >%c< %d\n",
-                    UNICC_PARSER, (char)*( pcb->bufend ), *( pcb->bufend ) );
-#endif
-
-        *( ++pcb->bufend ) = 0;
-    }
-
-#if UNICC_DEBUG	> 2
+        0,
+        64,
+        0,
+        53,
+        51,
+        54,
+        46,
+        43,
+        44,
+        45,
+        2,
+        4
+    },
     {
-        UNICC_CHAR*		chptr;
-
-        fprintf( stderr, "%s: get input: offset = %d\n",
-                    UNICC_PARSER, offset );
-        fprintf( stderr, "%s: get input: buf = >" UNICC_CHAR_FORMAT "<\n",
-                    UNICC_PARSER, pcb->buf );
-        fprintf( stderr, "%s: get input: returning %d\n",
-                    UNICC_PARSER, *( pcb->buf + offset ) );
+        0,
+        53,
+        64,
+        51,
+        54
     }
-#endif
-
-    return pcb->buf[ offset ];
-}
-
-UNICC_STATIC void _clear_input( _pcb* pcb )
-{
-    int		i;
-
-    if( pcb->buf )
-    {
-        if( pcb->len )
-        {
-            /* Update counters for line and column */
-            for( i = 0; i < pcb->len; i++ )
-            {
-                if( (char)pcb->buf[i] == '\n' )
-                {
-                    pcb->line++;
-                    pcb->column = 1;
-                }
-                else
-                    pcb->column++;
-            }
+};
 
-#if UNICC_DEBUG > 2
-    fprintf( stderr, "%s: clear input: "
-        "Clearing %d characters (%d bytes)\n",
-            UNICC_PARSER, pcb->len, pcb->len * sizeof( UNICC_CHAR ) );
-    fprintf( stderr, "%s: clear input: buf = >" UNICC_CHAR_FORMAT "<\n",
-            UNICC_PARSER, pcb->buf, sizeof( UNICC_CHAR ) );
-    fprintf( stderr, "%s: clear input: pcb->bufend >" UNICC_CHAR_FORMAT "<\n",
-            UNICC_PARSER, pcb->bufend );
 #endif
 
-            memmove( pcb->buf, pcb->buf + pcb->len,
-                        ( ( pcb->bufend - ( pcb->buf + pcb->len ) ) + 1 + 1 )
-                            * sizeof( UNICC_CHAR ) );
-            pcb->bufend = pcb->buf + ( pcb->bufend - ( pcb->buf + pcb->len ) );
-
-#if UNICC_DEBUG	> 2
-    fprintf( stderr, "%s: clear input: now buf = >" UNICC_CHAR_FORMAT "<\n",
-                UNICC_PARSER, pcb->buf, sizeof( UNICC_CHAR ) );
-    fprintf( stderr, "%s: clear input: now bufend = >" UNICC_CHAR_FORMAT "<\n",
-                UNICC_PARSER, pcb->bufend, sizeof( UNICC_CHAR ) );
-#endif
-        }
-        else
-        {
-            pcb->bufend = pcb->buf;
-            *( pcb->buf ) = 0;
-        }
-    }
+/* Symbol information table */
+UNICC_STATIC _syminfo _symbols[] =
+{
+	{ /* 0 */ "&eof", "", 3, 0, 0, 1 },
+	{ /* 1 */ "//", "", 2, 0, 0, 1 },
+	{ /* 2 */ "*/", "", 2, 0, 0, 1 },
+	{ /* 3 */ "/*", "", 2, 0, 0, 1 },
+	{ /* 4 */ "[*", "", 2, 0, 0, 1 },
+	{ /* 5 */ "*]", "", 2, 0, 0, 1 },
+	{ /* 6 */ "&eof", "", 2, 0, 0, 1 },
+	{ /* 7 */ "&error", "", 2, 0, 0, 1 },
+	{ /* 8 */ "precedence", "", 2, 0, 0, 1 },
+	{ /* 9 */ "non-greedy", "", 2, 0, 0, 1 },
+	{ /* 10 */ "greedy", "", 2, 0, 0, 1 },
+	{ /* 11 */ ":=", "", 2, 0, 0, 1 },
+	{ /* 12 */ "=>", "", 2, 0, 0, 1 },
+	{ /* 13 */ "->", "", 2, 0, 0, 1 },
+	{ /* 14 */ "off", "", 2, 0, 0, 1 },
+	{ /* 15 */ "on", "", 2, 0, 0, 1 },
+	{ /* 16 */ "extends", "", 2, 0, 0, 1 },
+	{ /* 17 */ "pcb", "", 2, 0, 0, 1 },
+	{ /* 18 */ "epilogue", "", 2, 0, 0, 1 },
+	{ /* 19 */ "prologue", "", 2, 0, 0, 1 },
+	{ /* 20 */ "compressed tables", "", 2, 0, 0, 1 },
+	{ /* 21 */ "reserve terminals", "", 2, 0, 0, 1 },
+	{ /* 22 */ "case insensitive strings", "", 2, 0, 0, 1 },
+	{ /* 23 */ "lexeme separation", "", 2, 0, 0, 1 },
+	{ /* 24 */ "default value type", "", 2, 0, 0, 1 },
+	{ /* 25 */ "default epsilon action", "", 2, 0, 0, 1 },
+	{ /* 26 */ "default action", "", 2, 0, 0, 1 },
+	{ /* 27 */ "prefix", "", 2, 0, 0, 1 },
+	{ /* 28 */ "nonassoc", "", 2, 0, 0, 1 },
+	{ /* 29 */ "right", "", 2, 0, 0, 1 },
+	{ /* 30 */ "left", "", 2, 0, 0, 1 },
+	{ /* 31 */ "fixate", "", 2, 0, 0, 1 },
+	{ /* 32 */ "lexeme", "", 2, 0, 0, 1 },
+	{ /* 33 */ "whitespaces", "", 2, 0, 0, 1 },
+	{ /* 34 */ "scanner", "", 2, 0, 0, 1 },
+	{ /* 35 */ "scannerless", "", 2, 0, 0, 1 },
+	{ /* 36 */ "language", "", 2, 0, 0, 1 },
+	{ /* 37 */ "mode", "", 2, 0, 0, 1 },
+	{ /* 38 */ "%!", "", 2, 0, 0, 1 },
+	{ /* 39 */ "#!", "", 2, 0, 0, 1 },
+	{ /* 40 */ "\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF", "", 1, 0, 0, 1 },
+	{ /* 41 */ "\\x0", "", 1, 0, 0, 1 },
+	{ /* 42 */ "\\r", "", 1, 0, 0, 1 },
+	{ /* 43 */ "\\n", "", 1, 0, 0, 1 },
+	{ /* 44 */ "\\t", "", 1, 0, 0, 1 },
+	{ /* 45 */ " ", "", 1, 0, 0, 1 },
+	{ /* 46 */ "0-9", "", 1, 0, 0, 1 },
+	{ /* 47 */ "A-Z_a-z", "", 1, 0, 0, 1 },
+	{ /* 48 */ ">", "", 1, 0, 0, 1 },
+	{ /* 49 */ "<", "", 1, 0, 0, 1 },
+	{ /* 50 */ "\"", "", 1, 0, 0, 1 },
+	{ /* 51 */ "\\\\", "", 1, 0, 0, 1 },
+	{ /* 52 */ "'", "", 1, 0, 0, 1 },
+	{ /* 53 */ "!", "", 1, 0, 0, 1 },
+	{ /* 54 */ ".", "", 1, 0, 0, 1 },
+	{ /* 55 */ "?", "", 1, 0, 0, 1 },
+	{ /* 56 */ "+", "", 1, 0, 0, 1 },
+	{ /* 57 */ "*", "", 1, 0, 0, 1 },
+	{ /* 58 */ ")", "", 1, 0, 0, 1 },
+	{ /* 59 */ "(", "", 1, 0, 0, 1 },
+	{ /* 60 */ "=", "", 1, 0, 0, 1 },
+	{ /* 61 */ "|", "", 1, 0, 0, 1 },
+	{ /* 62 */ "$", "", 1, 0, 0, 1 },
+	{ /* 63 */ "@", "", 1, 0, 0, 1 },
+	{ /* 64 */ ":", "", 1, 0, 0, 1 },
+	{ /* 65 */ "#%", "", 1, 0, 0, 1 },
+	{ /* 66 */ ";", "", 1, 0, 0, 1 },
+	{ /* 67 */ "grammar_spec''", "", 0, 0, 0, 1 },
+	{ /* 68 */ "scanner'", "", 0, 0, 0, 1 },
+	{ /* 69 */ "scannerless'", "", 0, 0, 0, 1 },
+	{ /* 70 */ "language'", "", 0, 0, 0, 1 },
+	{ /* 71 */ "mode'", "", 0, 0, 0, 1 },
+	{ /* 72 */ "%!'", "", 0, 0, 0, 1 },
+	{ /* 73 */ "#!'", "", 0, 0, 0, 1 },
+	{ /* 74 */ "$'", "", 0, 0, 0, 1 },
+	{ /* 75 */ ":='", "", 0, 0, 0, 1 },
+	{ /* 76 */ "=>'", "", 0, 0, 0, 1 },
+	{ /* 77 */ "->'", "", 0, 0, 0, 1 },
+	{ /* 78 */ ".'", "", 0, 0, 0, 1 },
+	{ /* 79 */ "ccl'", "", 0, 0, 0, 1 },
+	{ /* 80 */ "?'", "", 0, 0, 0, 1 },
+	{ /* 81 */ "+'", "", 0, 0, 0, 1 },
+	{ /* 82 */ "*'", "", 0, 0, 0, 1 },
+	{ /* 83 */ "non-greedy'", "", 0, 0, 0, 1 },
+	{ /* 84 */ "greedy'", "", 0, 0, 0, 1 },
+	{ /* 85 */ "@'", "", 0, 0, 0, 1 },
+	{ /* 86 */ "&eof'", "", 0, 0, 0, 1 },
+	{ /* 87 */ "&error'", "", 0, 0, 0, 1 },
+	{ /* 88 */ "modifier'", "", 0, 0, 0, 1 },
+	{ /* 89 */ ":'", "", 0, 0, 0, 1 },
+	{ /* 90 */ "='", "", 0, 0, 0, 1 },
+	{ /* 91 */ "precedence'", "", 0, 0, 0, 1 },
+	{ /* 92 */ "|'", "", 0, 0, 0, 1 },
+	{ /* 93 */ ")'", "", 0, 0, 0, 1 },
+	{ /* 94 */ "('", "", 0, 0, 0, 1 },
+	{ /* 95 */ "identifier'", "", 0, 0, 0, 1 },
+	{ /* 96 */ "terminal'", "", 0, 0, 0, 1 },
+	{ /* 97 */ "kw'", "", 0, 0, 0, 1 },
+	{ /* 98 */ "ccl_string'", "", 0, 0, 0, 1 },
+	{ /* 99 */ "off'", "", 0, 0, 0, 1 },
+	{ /* 100 */ "on'", "", 0, 0, 0, 1 },
+	{ /* 101 */ "extends'", "", 0, 0, 0, 1 },
+	{ /* 102 */ "pcb'", "", 0, 0, 0, 1 },
+	{ /* 103 */ "epilogue'", "", 0, 0, 0, 1 },
+	{ /* 104 */ "prologue'", "", 0, 0, 0, 1 },
+	{ /* 105 */ "compressed tables'", "", 0, 0, 0, 1 },
+	{ /* 106 */ "reserve terminals'", "", 0, 0, 0, 1 },
+	{ /* 107 */ "case insensitive strings'", "", 0, 0, 0, 1 },
+	{ /* 108 */ "lexeme separation'", "", 0, 0, 0, 1 },
+	{ /* 109 */ "type'", "", 0, 0, 0, 1 },
+	{ /* 110 */ "default value type'", "", 0, 0, 0, 1 },
+	{ /* 111 */ "default epsilon action'", "", 0, 0, 0, 1 },
+	{ /* 112 */ "default action'", "", 0, 0, 0, 1 },
+	{ /* 113 */ "prefix'", "", 0, 0, 0, 1 },
+	{ /* 114 */ "nonassoc'", "", 0, 0, 0, 1 },
+	{ /* 115 */ "right'", "", 0, 0, 0, 1 },
+	{ /* 116 */ "left'", "", 0, 0, 0, 1 },
+	{ /* 117 */ "fixate'", "", 0, 0, 0, 1 },
+	{ /* 118 */ "lexeme'", "", 0, 0, 0, 1 },
+	{ /* 119 */ "whitespaces'", "", 0, 0, 0, 1 },
+	{ /* 120 */ "#%'", "", 0, 0, 0, 1 },
+	{ /* 121 */ ";'", "", 0, 0, 0, 1 },
+	{ /* 122 */ "code'", "", 0, 0, 0, 1 },
+	{ /* 123 */ "&whitespace*", "", 0, 1, 1, 1 },
+	{ /* 124 */ "&whitespace+", "", 0, 1, 1, 1 },
+	{ /* 125 */ "&whitespace", "", 0, 1, 1, 1 },
+	{ /* 126 */ "grammar_spec'", "", 0, 0, 0, 1 },
+	{ /* 127 */ "\\x0-\\t\\v-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 128 */ "scomment?", "", 0, 1, 0, 1 },
+	{ /* 129 */ "scomment", "", 0, 1, 0, 1 },
+	{ /* 130 */ "comment?", "", 0, 1, 0, 1 },
+	{ /* 131 */ "comment", "", 0, 1, 0, 1 },
+	{ /* 132 */ "anychar", "", 0, 1, 0, 1 },
+	{ /* 133 */ "inner_code", "", 0, 1, 0, 1 },
+	{ /* 134 */ "inner_code_opt", "", 0, 1, 0, 1 },
+	{ /* 135 */ "code_begin", "", 0, 1, 0, 1 },
+	{ /* 136 */ "integer", "", 0, 0, 0, 1 },
+	{ /* 137 */ "0-9A-Z_a-z#", "", 0, 0, 0, 1 },
+	{ /* 138 */ "identifier_follow", "", 0, 1, 0, 1 },
+	{ /* 139 */ "identifier_start", "", 0, 1, 0, 1 },
+	{ /* 140 */ "\\x0-=?-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 141 */ "type_str", "", 0, 1, 0, 1 },
+	{ /* 142 */ "\\x0-!#-[]-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 143 */ "kw_char", "", 0, 1, 0, 1 },
+	{ /* 144 */ "kw_str", "", 0, 1, 0, 1 },
+	{ /* 145 */ "\\x1-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 146 */ "\\x0-&(-[]-\\uFFFF#", "", 0, 0, 0, 1 },
+	{ /* 147 */ "ccl_char", "", 0, 1, 0, 1 },
+	{ /* 148 */ "ccl_str", "", 0, 1, 0, 1 },
+	{ /* 149 */ "string_single+", "", 0, 0, 0, 1 },
+	{ /* 150 */ "re_factor", "", 0, 0, 0, 1 },
+	{ /* 151 */ "re_modifier", "", 0, 0, 0, 1 },
+	{ /* 152 */ "re_expr", "", 0, 0, 0, 1 },
+	{ /* 153 */ "re_alt", "", 0, 0, 0, 1 },
+	{ /* 154 */ "string_single", "", 0, 0, 0, 1 },
+	{ /* 155 */ "ccl", "", 0, 1, 0, 1 },
+	{ /* 156 */ "stack_cur_prod", "", 0, 0, 0, 1 },
+	{ /* 157 */ "access_name", "", 0, 0, 0, 1 },
+	{ /* 158 */ "symbol", "", 0, 0, 0, 1 },
+	{ /* 159 */ "rhs", "", 0, 0, 0, 1 },
+	{ /* 160 */ "prod_directives*", "", 0, 0, 0, 1 },
+	{ /* 161 */ "prod_directives+", "", 0, 0, 0, 1 },
+	{ /* 162 */ "prod_directives", "", 0, 0, 0, 1 },
+	{ /* 163 */ "code_opt_dup", "", 0, 0, 0, 1 },
+	{ /* 164 */ "rhs_opt", "", 0, 0, 0, 1 },
+	{ /* 165 */ "line_number", "", 0, 0, 0, 1 },
+	{ /* 166 */ "production", "", 0, 0, 0, 1 },
+	{ /* 167 */ "sym_option*", "", 0, 0, 0, 1 },
+	{ /* 168 */ "sym_option+", "", 0, 0, 0, 1 },
+	{ /* 169 */ "sym_option", "", 0, 0, 0, 1 },
+	{ /* 170 */ "ast_node", "", 0, 0, 0, 1 },
+	{ /* 171 */ "regex", "", 0, 0, 0, 1 },
+	{ /* 172 */ "productions", "", 0, 0, 0, 1 },
+	{ /* 173 */ "alt_lhs_list?", "", 0, 0, 0, 1 },
+	{ /* 174 */ "goal_mark", "", 0, 0, 0, 1 },
+	{ /* 175 */ "defines", "", 0, 0, 0, 1 },
+	{ /* 176 */ "regex_sym", "", 0, 0, 0, 1 },
+	{ /* 177 */ "alt_regex_sym", "", 0, 0, 0, 1 },
+	{ /* 178 */ "alt_lhs_list", "", 0, 0, 0, 1 },
+	{ /* 179 */ "lhs", "", 0, 0, 0, 1 },
+	{ /* 180 */ "sym", "", 0, 0, 0, 1 },
+	{ /* 181 */ "boolean", "", 0, 0, 0, 1 },
+	{ /* 182 */ "boolean_opt", "", 0, 0, 0, 1 },
+	{ /* 183 */ "code_opt", "", 0, 0, 0, 1 },
+	{ /* 184 */ "string", "", 0, 0, 0, 1 },
+	{ /* 185 */ "symbol_list", "", 0, 0, 0, 1 },
+	{ /* 186 */ "directive_parms", "", 0, 0, 0, 1 },
+	{ /* 187 */ "unfixed_directive", "", 0, 0, 0, 1 },
+	{ /* 188 */ "definition", "", 0, 0, 0, 1 },
+	{ /* 189 */ "string_or_ident", "", 0, 0, 0, 1 },
+	{ /* 190 */ "mode_type", "", 0, 0, 0, 1 },
+	{ /* 191 */ "fixed_directive", "", 0, 0, 0, 1 },
+	{ /* 192 */ "segment*", "", 0, 0, 0, 1 },
+	{ /* 193 */ "segment+", "", 0, 0, 0, 1 },
+	{ /* 194 */ "segment", "", 0, 0, 0, 1 },
+	{ /* 195 */ "fixed_directive_def*", "", 0, 0, 0, 1 },
+	{ /* 196 */ "fixed_directive_def+", "", 0, 0, 0, 1 },
+	{ /* 197 */ "fixed_directive_def", "", 0, 0, 0, 1 },
+	{ /* 198 */ "grammar_spec", "", 0, 0, 0, 1 },
+	{ /* 199 */ "type", "", 0, 1, 0, 1 },
+	{ /* 200 */ "kw", "", 0, 1, 0, 1 },
+	{ /* 201 */ "ccl_string", "", 0, 1, 0, 1 },
+	{ /* 202 */ "code", "", 0, 1, 0, 1 },
+	{ /* 203 */ "modifier", "", 0, 1, 0, 1 },
+	{ /* 204 */ "identifier", "", 0, 1, 0, 1 },
+	{ /* 205 */ "terminal", "", 0, 1, 0, 1 },
+	{ /* 206 */ "whitespace", "", 0, 1, 1, 1 }
+};
 
-    pcb->len = 0;
-    pcb->sym = -1;
-#if UNICC_DEBUG	> 2
-    fprintf( stderr, "%s: clear input: symbol cleared\n", UNICC_PARSER );
-#endif
-}
+/* Production information table */
+UNICC_STATIC _prodinfo _productions[] =
+{
+	{ /* 0 */ "fixed_directive_def+ : fixed_directive_def+ fixed_directive_def", "", 2, 196 },
+	{ /* 1 */ "fixed_directive_def+ : fixed_directive_def", "", 1, 196 },
+	{ /* 2 */ "fixed_directive_def* : fixed_directive_def+", "", 1, 195 },
+	{ /* 3 */ "fixed_directive_def* : ", "", 0, 195 },
+	{ /* 4 */ "grammar_spec : fixed_directive_def* segment*", "", 2, 198 },
+	{ /* 5 */ "segment+ : segment+ segment", "", 2, 193 },
+	{ /* 6 */ "segment+ : segment", "", 1, 193 },
+	{ /* 7 */ "segment* : segment+", "", 1, 192 },
+	{ /* 8 */ "segment* : ", "", 0, 192 },
+	{ /* 9 */ "fixed_directive_def : #!' fixed_directive ;'", "", 3, 197 },
+	{ /* 10 */ "fixed_directive_def : %!' fixed_directive ;'", "", 3, 197 },
+	{ /* 11 */ "fixed_directive : mode' mode_type", "", 2, 191 },
+	{ /* 12 */ "fixed_directive : language' string_or_ident", "", 2, 191 },
+	{ /* 13 */ "mode_type : scannerless'", "", 1, 190 },
+	{ /* 14 */ "mode_type : scanner'", "", 1, 190 },
+	{ /* 15 */ "segment : code'", "", 1, 194 },
+	{ /* 16 */ "segment : definition ;'", "", 2, 194 },
+	{ /* 17 */ "segment : unfixed_directive ;'", "", 2, 194 },
+	{ /* 18 */ "unfixed_directive : #%' directive_parms", "", 2, 187 },
+	{ /* 19 */ "directive_parms : whitespaces' symbol_list", "", 2, 186 },
+	{ /* 20 */ "directive_parms : lexeme' symbol_list", "", 2, 186 },
+	{ /* 21 */ "directive_parms : fixate' symbol_list", "", 2, 186 },
+	{ /* 22 */ "directive_parms : left' symbol_list", "", 2, 186 },
+	{ /* 23 */ "directive_parms : right' symbol_list", "", 2, 186 },
+	{ /* 24 */ "directive_parms : nonassoc' symbol_list", "", 2, 186 },
+	{ /* 25 */ "directive_parms : prefix' string", "", 2, 186 },
+	{ /* 26 */ "directive_parms : default action' code_opt", "", 2, 186 },
+	{ /* 27 */ "directive_parms : default epsilon action' code_opt", "", 2, 186 },
+	{ /* 28 */ "directive_parms : default value type' type'", "", 2, 186 },
+	{ /* 29 */ "directive_parms : lexeme separation' boolean_opt", "", 2, 186 },
+	{ /* 30 */ "directive_parms : case insensitive strings' boolean_opt", "", 2, 186 },
+	{ /* 31 */ "directive_parms : reserve terminals' boolean_opt", "", 2, 186 },
+	{ /* 32 */ "directive_parms : compressed tables' boolean_opt", "", 2, 186 },
+	{ /* 33 */ "directive_parms : prologue' code'", "", 2, 186 },
+	{ /* 34 */ "directive_parms : epilogue' code'", "", 2, 186 },
+	{ /* 35 */ "directive_parms : pcb' code'", "", 2, 186 },
+	{ /* 36 */ "directive_parms : extends' string", "", 2, 186 },
+	{ /* 37 */ "boolean_opt : boolean", "", 1, 182 },
+	{ /* 38 */ "boolean_opt : ", "", 0, 182 },
+	{ /* 39 */ "boolean : on'", "", 1, 181 },
+	{ /* 40 */ "boolean : off'", "", 1, 181 },
+	{ /* 41 */ "symbol_list : symbol_list sym", "", 2, 185 },
+	{ /* 42 */ "symbol_list : sym", "", 1, 185 },
+	{ /* 43 */ "lhs : identifier'", "", 1, 179 },
+	{ /* 44 */ "alt_lhs_list : alt_lhs_list lhs", "", 2, 178 },
+	{ /* 45 */ "alt_lhs_list : lhs", "", 1, 178 },
+	{ /* 46 */ "alt_regex_sym : alt_regex_sym regex_sym", "", 2, 177 },
+	{ /* 47 */ "alt_regex_sym : regex_sym", "", 1, 177 },
+	{ /* 48 */ "regex_sym : identifier'", "", 1, 176 },
+	{ /* 49 */ "defines : ->'", "", 1, 175 },
+	{ /* 50 */ "defines : :'", "", 1, 175 },
+	{ /* 51 */ "defines : =>'", "", 1, 175 },
+	{ /* 52 */ "defines : :='", "", 1, 175 },
+	{ /* 53 */ "definition : lhs goal_mark alt_lhs_list? type' defines productions", "", 6, 188 },
+	{ /* 54 */ "alt_lhs_list? : alt_lhs_list", "", 1, 173 },
+	{ /* 55 */ "alt_lhs_list? : ", "", 0, 173 },
+	{ /* 56 */ "definition : @' alt_regex_sym type' regex code_opt ast_node sym_option*", "", 7, 188 },
+	{ /* 57 */ "sym_option+ : sym_option+ sym_option", "", 2, 168 },
+	{ /* 58 */ "sym_option+ : sym_option", "", 1, 168 },
+	{ /* 59 */ "sym_option* : sym_option+", "", 1, 167 },
+	{ /* 60 */ "sym_option* : ", "", 0, 167 },
+	{ /* 61 */ "sym_option : #%' greedy'", "", 2, 169 },
+	{ /* 62 */ "sym_option : #%' non-greedy'", "", 2, 169 },
+	{ /* 63 */ "goal_mark : $'", "", 1, 174 },
+	{ /* 64 */ "goal_mark : ", "", 0, 174 },
+	{ /* 65 */ "productions : productions |' production", "", 3, 172 },
+	{ /* 66 */ "productions : production", "", 1, 172 },
+	{ /* 67 */ "ast_node : =' identifier'", "", 2, 170 },
+	{ /* 68 */ "ast_node : =' string", "", 2, 170 },
+	{ /* 69 */ "ast_node : ", "", 0, 170 },
+	{ /* 70 */ "production : line_number rhs_opt code_opt_dup ast_node prod_directives*", "", 5, 166 },
+	{ /* 71 */ "prod_directives+ : prod_directives+ prod_directives", "", 2, 161 },
+	{ /* 72 */ "prod_directives+ : prod_directives", "", 1, 161 },
+	{ /* 73 */ "prod_directives* : prod_directives+", "", 1, 160 },
+	{ /* 74 */ "prod_directives* : ", "", 0, 160 },
+	{ /* 75 */ "rhs_opt : rhs", "", 1, 164 },
+	{ /* 76 */ "rhs_opt : ", "", 0, 164 },
+	{ /* 77 */ "prod_directives : #%' precedence' terminal'", "", 3, 162 },
+	{ /* 78 */ "rhs : rhs symbol access_name", "", 3, 159 },
+	{ /* 79 */ "rhs : symbol access_name", "", 2, 159 },
+	{ /* 80 */ "symbol : sym modifier'", "", 2, 158 },
+	{ /* 81 */ "symbol : &error'", "", 1, 158 },
+	{ /* 82 */ "symbol : &eof'", "", 1, 158 },
+	{ /* 83 */ "sym : terminal'", "", 1, 180 },
+	{ /* 84 */ "sym : identifier'", "", 1, 180 },
+	{ /* 85 */ "sym : type' (' stack_cur_prod productions )'", "", 5, 180 },
+	{ /* 86 */ "stack_cur_prod : ", "", 0, 156 },
+	{ /* 87 */ "terminal : ccl", "", 1, 205 },
+	{ /* 88 */ "terminal : kw", "", 1, 205 },
+	{ /* 89 */ "terminal : '@' identifier", "", 2, 205 },
+	{ /* 90 */ "modifier : '*'", "", 1, 203 },
+	{ /* 91 */ "modifier : '+'", "", 1, 203 },
+	{ /* 92 */ "modifier : '?'", "", 1, 203 },
+	{ /* 93 */ "modifier : ", "", 0, 203 },
+	{ /* 94 */ "access_name : :' identifier'", "", 2, 157 },
+	{ /* 95 */ "access_name : :' string_single", "", 2, 157 },
+	{ /* 96 */ "access_name : ", "", 0, 157 },
+	{ /* 97 */ "regex : re_alt", "", 1, 171 },
+	{ /* 98 */ "re_alt : re_alt |' re_expr", "", 3, 153 },
+	{ /* 99 */ "re_alt : re_expr", "", 1, 153 },
+	{ /* 100 */ "re_expr : re_expr re_modifier", "", 2, 152 },
+	{ /* 101 */ "re_expr : re_modifier", "", 1, 152 },
+	{ /* 102 */ "re_modifier : re_factor *'", "", 2, 151 },
+	{ /* 103 */ "re_modifier : re_factor +'", "", 2, 151 },
+	{ /* 104 */ "re_modifier : re_factor ?'", "", 2, 151 },
+	{ /* 105 */ "re_modifier : re_factor", "", 1, 151 },
+	{ /* 106 */ "re_factor : ccl'", "", 1, 150 },
+	{ /* 107 */ "re_factor : kw'", "", 1, 150 },
+	{ /* 108 */ "re_factor : .'", "", 1, 150 },
+	{ /* 109 */ "re_factor : (' regex )'", "", 3, 150 },
+	{ /* 110 */ "string_single+ : string_single+ string_single", "", 2, 149 },
+	{ /* 111 */ "string_single+ : string_single", "", 1, 149 },
+	{ /* 112 */ "string : string_single+", "", 1, 184 },
+	{ /* 113 */ "string_single : ccl_string'", "", 1, 154 },
+	{ /* 114 */ "string_single : kw'", "", 1, 154 },
+	{ /* 115 */ "ccl : ccl_string", "", 1, 155 },
+	{ /* 116 */ "ccl : '!' ccl_string", "", 2, 155 },
+	{ /* 117 */ "ccl_string : ''' ccl_str '''", "", 3, 201 },
+	{ /* 118 */ "ccl_str : ccl_str ccl_char", "", 2, 148 },
+	{ /* 119 */ "ccl_str : ", "", 0, 148 },
+	{ /* 120 */ "ccl_char : \\x0-&(-[]-\\uFFFF#", "", 1, 147 },
+	{ /* 121 */ "ccl_char : '\\\\' \\x1-\\uFFFF#", "", 2, 147 },
+	{ /* 122 */ "kw : '\"' '\"' kw_str '\"' '\"'", "", 5, 200 },
+	{ /* 123 */ "kw : '\"' kw_str '\"'", "", 3, 200 },
+	{ /* 124 */ "kw_str : kw_str kw_char", "", 2, 144 },
+	{ /* 125 */ "kw_str : ", "", 0, 144 },
+	{ /* 126 */ "kw_char : \\x0-!#-[]-\\uFFFF#", "", 1, 143 },
+	{ /* 127 */ "kw_char : '\\\\' \\x1-\\uFFFF#", "", 2, 143 },
+	{ /* 128 */ "type : '<' type_str '>'", "", 3, 199 },
+	{ /* 129 */ "type : ", "", 0, 199 },
+	{ /* 130 */ "type_str : type_str \\x0-=?-\\uFFFF#", "", 2, 141 },
+	{ /* 131 */ "type_str : ", "", 0, 141 },
+	{ /* 132 */ "identifier : identifier_start identifier_follow", "", 2, 204 },
+	{ /* 133 */ "identifier_start : 'A-Z_a-z'", "", 1, 139 },
+	{ /* 134 */ "identifier_follow : identifier_follow 0-9A-Z_a-z#", "", 2, 138 },
+	{ /* 135 */ "identifier_follow : ", "", 0, 138 },
+	{ /* 136 */ "string_or_ident : string", "", 1, 189 },
+	{ /* 137 */ "string_or_ident : identifier'", "", 1, 189 },
+	{ /* 138 */ "integer : integer '0-9'", "", 2, 136 },
+	{ /* 139 */ "integer : '0-9'", "", 1, 136 },
+	{ /* 140 */ "code_opt_dup : code_opt", "", 1, 163 },
+	{ /* 141 */ "code_opt : code'", "", 1, 183 },
+	{ /* 142 */ "code_opt : ", "", 0, 183 },
+	{ /* 143 */ "code : code_begin inner_code_opt \"*]\"", "", 3, 202 },
+	{ /* 144 */ "code_begin : \"[*\"", "", 1, 135 },
+	{ /* 145 */ "inner_code_opt : inner_code", "", 1, 134 },
+	{ /* 146 */ "inner_code_opt : ", "", 0, 134 },
+	{ /* 147 */ "inner_code : inner_code anychar", "", 2, 133 },
+	{ /* 148 */ "inner_code : anychar", "", 1, 133 },
+	{ /* 149 */ "whitespace : ' '", "", 1, 206 },
+	{ /* 150 */ "whitespace : '\\t'", "", 1, 206 },
+	{ /* 151 */ "whitespace : \"/*\" comment? \"*/\"", "", 3, 206 },
+	{ /* 152 */ "comment? : comment", "", 1, 130 },
+	{ /* 153 */ "comment? : ", "", 0, 130 },
+	{ /* 154 */ "whitespace : \"//\" scomment? '\\n'", "", 3, 206 },
+	{ /* 155 */ "scomment? : scomment", "", 1, 128 },
+	{ /* 156 */ "scomment? : ", "", 0, 128 },
+	{ /* 157 */ "whitespace : '\\r'", "", 1, 206 },
+	{ /* 158 */ "whitespace : '\\n'", "", 1, 206 },
+	{ /* 159 */ "comment : comment anychar", "", 2, 131 },
+	{ /* 160 */ "comment : anychar", "", 1, 131 },
+	{ /* 161 */ "anychar : \\x1-\\uFFFF#", "", 1, 132 },
+	{ /* 162 */ "scomment : scomment \\x0-\\t\\v-\\uFFFF#", "", 2, 129 },
+	{ /* 163 */ "scomment : \\x0-\\t\\v-\\uFFFF#", "", 1, 129 },
+	{ /* 164 */ "line_number : ", "", 0, 165 },
+	{ /* 165 */ "grammar_spec' : grammar_spec ~&eof", "", 2, 126 },
+	{ /* 166 */ "&whitespace : whitespace", "", 1, 125 },
+	{ /* 167 */ "&whitespace+ : &whitespace+ &whitespace", "", 2, 124 },
+	{ /* 168 */ "&whitespace+ : &whitespace", "", 1, 124 },
+	{ /* 169 */ "&whitespace* : &whitespace+", "", 1, 123 },
+	{ /* 170 */ "&whitespace* : ", "", 0, 123 },
+	{ /* 171 */ "code' : code &whitespace*", "", 2, 122 },
+	{ /* 172 */ ";' : ';' &whitespace*", "", 2, 121 },
+	{ /* 173 */ "#%' : '#%' &whitespace*", "", 2, 120 },
+	{ /* 174 */ "whitespaces' : \"whitespaces\" &whitespace*", "", 2, 119 },
+	{ /* 175 */ "lexeme' : \"lexeme\" &whitespace*", "", 2, 118 },
+	{ /* 176 */ "fixate' : \"fixate\" &whitespace*", "", 2, 117 },
+	{ /* 177 */ "left' : \"left\" &whitespace*", "", 2, 116 },
+	{ /* 178 */ "right' : \"right\" &whitespace*", "", 2, 115 },
+	{ /* 179 */ "nonassoc' : \"nonassoc\" &whitespace*", "", 2, 114 },
+	{ /* 180 */ "prefix' : \"prefix\" &whitespace*", "", 2, 113 },
+	{ /* 181 */ "default action' : \"default action\" &whitespace*", "", 2, 112 },
+	{ /* 182 */ "default epsilon action' : \"default epsilon action\" &whitespace*", "", 2, 111 },
+	{ /* 183 */ "default value type' : \"default value type\" &whitespace*", "", 2, 110 },
+	{ /* 184 */ "type' : type &whitespace*", "", 2, 109 },
+	{ /* 185 */ "lexeme separation' : \"lexeme separation\" &whitespace*", "", 2, 108 },
+	{ /* 186 */ "case insensitive strings' : \"case insensitive strings\" &whitespace*", "", 2, 107 },
+	{ /* 187 */ "reserve terminals' : \"reserve terminals\" &whitespace*", "", 2, 106 },
+	{ /* 188 */ "compressed tables' : \"compressed tables\" &whitespace*", "", 2, 105 },
+	{ /* 189 */ "prologue' : \"prologue\" &whitespace*", "", 2, 104 },
+	{ /* 190 */ "epilogue' : \"epilogue\" &whitespace*", "", 2, 103 },
+	{ /* 191 */ "pcb' : \"pcb\" &whitespace*", "", 2, 102 },
+	{ /* 192 */ "extends' : \"extends\" &whitespace*", "", 2, 101 },
+	{ /* 193 */ "on' : \"on\" &whitespace*", "", 2, 100 },
+	{ /* 194 */ "off' : \"off\" &whitespace*", "", 2, 99 },
+	{ /* 195 */ "ccl_string' : ccl_string &whitespace*", "", 2, 98 },
+	{ /* 196 */ "kw' : kw &whitespace*", "", 2, 97 },
+	{ /* 197 */ "terminal' : terminal &whitespace*", "", 2, 96 },
+	{ /* 198 */ "identifier' : identifier &whitespace*", "", 2, 95 },
+	{ /* 199 */ "(' : '(' &whitespace*", "", 2, 94 },
+	{ /* 200 */ ")' : ')' &whitespace*", "", 2, 93 },
+	{ /* 201 */ "|' : '|' &whitespace*", "", 2, 92 },
+	{ /* 202 */ "precedence' : \"precedence\" &whitespace*", "", 2, 91 },
+	{ /* 203 */ "=' : '=' &whitespace*", "", 2, 90 },
+	{ /* 204 */ ":' : ':' &whitespace*", "", 2, 89 },
+	{ /* 205 */ "modifier' : modifier &whitespace*", "", 2, 88 },
+	{ /* 206 */ "&error' : \"&error\" &whitespace*", "", 2, 87 },
+	{ /* 207 */ "&eof' : \"&eof\" &whitespace*", "", 2, 86 },
+	{ /* 208 */ "@' : '@' &whitespace*", "", 2, 85 },
+	{ /* 209 */ "greedy' : \"greedy\" &whitespace*", "", 2, 84 },
+	{ /* 210 */ "non-greedy' : \"non-greedy\" &whitespace*", "", 2, 83 },
+	{ /* 211 */ "*' : '*' &whitespace*", "", 2, 82 },
+	{ /* 212 */ "+' : '+' &whitespace*", "", 2, 81 },
+	{ /* 213 */ "?' : '?' &whitespace*", "", 2, 80 },
+	{ /* 214 */ "ccl' : ccl &whitespace*", "", 2, 79 },
+	{ /* 215 */ ".' : '.' &whitespace*", "", 2, 78 },
+	{ /* 216 */ "->' : \"->\" &whitespace*", "", 2, 77 },
+	{ /* 217 */ "=>' : \"=>\" &whitespace*", "", 2, 76 },
+	{ /* 218 */ ":=' : \":=\" &whitespace*", "", 2, 75 },
+	{ /* 219 */ "$' : '$' &whitespace*", "", 2, 74 },
+	{ /* 220 */ "#!' : \"#!\" &whitespace*", "", 2, 73 },
+	{ /* 221 */ "%!' : \"%!\" &whitespace*", "", 2, 72 },
+	{ /* 222 */ "mode' : \"mode\" &whitespace*", "", 2, 71 },
+	{ /* 223 */ "language' : \"language\" &whitespace*", "", 2, 70 },
+	{ /* 224 */ "scannerless' : \"scannerless\" &whitespace*", "", 2, 69 },
+	{ /* 225 */ "scanner' : \"scanner\" &whitespace*", "", 2, 68 },
+	{ /* 226 */ "grammar_spec'' : &whitespace* grammar_spec'", "", 2, 67 },
+	{ /* 227 */ "\\x0-\\t\\v-\\uFFFF# : '\\x0'", "", 1, 127 },
+	{ /* 228 */ "\\x0-\\t\\v-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 127 },
+	{ /* 229 */ "\\x0-\\t\\v-\\uFFFF# : '\\t'", "", 1, 127 },
+	{ /* 230 */ "\\x0-\\t\\v-\\uFFFF# : '\\r'", "", 1, 127 },
+	{ /* 231 */ "\\x0-\\t\\v-\\uFFFF# : ' '", "", 1, 127 },
+	{ /* 232 */ "\\x0-\\t\\v-\\uFFFF# : '!'", "", 1, 127 },
+	{ /* 233 */ "\\x0-\\t\\v-\\uFFFF# : '\"'", "", 1, 127 },
+	{ /* 234 */ "\\x0-\\t\\v-\\uFFFF# : '#%'", "", 1, 127 },
+	{ /* 235 */ "\\x0-\\t\\v-\\uFFFF# : '$'", "", 1, 127 },
+	{ /* 236 */ "\\x0-\\t\\v-\\uFFFF# : '''", "", 1, 127 },
+	{ /* 237 */ "\\x0-\\t\\v-\\uFFFF# : '('", "", 1, 127 },
+	{ /* 238 */ "\\x0-\\t\\v-\\uFFFF# : ')'", "", 1, 127 },
+	{ /* 239 */ "\\x0-\\t\\v-\\uFFFF# : '*'", "", 1, 127 },
+	{ /* 240 */ "\\x0-\\t\\v-\\uFFFF# : '+'", "", 1, 127 },
+	{ /* 241 */ "\\x0-\\t\\v-\\uFFFF# : '.'", "", 1, 127 },
+	{ /* 242 */ "\\x0-\\t\\v-\\uFFFF# : '0-9'", "", 1, 127 },
+	{ /* 243 */ "\\x0-\\t\\v-\\uFFFF# : ':'", "", 1, 127 },
+	{ /* 244 */ "\\x0-\\t\\v-\\uFFFF# : ';'", "", 1, 127 },
+	{ /* 245 */ "\\x0-\\t\\v-\\uFFFF# : '<'", "", 1, 127 },
+	{ /* 246 */ "\\x0-\\t\\v-\\uFFFF# : '='", "", 1, 127 },
+	{ /* 247 */ "\\x0-\\t\\v-\\uFFFF# : '>'", "", 1, 127 },
+	{ /* 248 */ "\\x0-\\t\\v-\\uFFFF# : '?'", "", 1, 127 },
+	{ /* 249 */ "\\x0-\\t\\v-\\uFFFF# : '@'", "", 1, 127 },
+	{ /* 250 */ "\\x0-\\t\\v-\\uFFFF# : 'A-Z_a-z'", "", 1, 127 },
+	{ /* 251 */ "\\x0-\\t\\v-\\uFFFF# : '\\\\'", "", 1, 127 },
+	{ /* 252 */ "\\x0-\\t\\v-\\uFFFF# : '|'", "", 1, 127 },
+	{ /* 253 */ "0-9A-Z_a-z# : '0-9'", "", 1, 137 },
+	{ /* 254 */ "0-9A-Z_a-z# : 'A-Z_a-z'", "", 1, 137 },
+	{ /* 255 */ "\\x0-=?-\\uFFFF# : '\\x0'", "", 1, 140 },
+	{ /* 256 */ "\\x0-=?-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 140 },
+	{ /* 257 */ "\\x0-=?-\\uFFFF# : '\\t'", "", 1, 140 },
+	{ /* 258 */ "\\x0-=?-\\uFFFF# : '\\n'", "", 1, 140 },
+	{ /* 259 */ "\\x0-=?-\\uFFFF# : '\\r'", "", 1, 140 },
+	{ /* 260 */ "\\x0-=?-\\uFFFF# : ' '", "", 1, 140 },
+	{ /* 261 */ "\\x0-=?-\\uFFFF# : '!'", "", 1, 140 },
+	{ /* 262 */ "\\x0-=?-\\uFFFF# : '\"'", "", 1, 140 },
+	{ /* 263 */ "\\x0-=?-\\uFFFF# : '#%'", "", 1, 140 },
+	{ /* 264 */ "\\x0-=?-\\uFFFF# : '$'", "", 1, 140 },
+	{ /* 265 */ "\\x0-=?-\\uFFFF# : '''", "", 1, 140 },
+	{ /* 266 */ "\\x0-=?-\\uFFFF# : '('", "", 1, 140 },
+	{ /* 267 */ "\\x0-=?-\\uFFFF# : ')'", "", 1, 140 },
+	{ /* 268 */ "\\x0-=?-\\uFFFF# : '*'", "", 1, 140 },
+	{ /* 269 */ "\\x0-=?-\\uFFFF# : '+'", "", 1, 140 },
+	{ /* 270 */ "\\x0-=?-\\uFFFF# : '.'", "", 1, 140 },
+	{ /* 271 */ "\\x0-=?-\\uFFFF# : '0-9'", "", 1, 140 },
+	{ /* 272 */ "\\x0-=?-\\uFFFF# : ':'", "", 1, 140 },
+	{ /* 273 */ "\\x0-=?-\\uFFFF# : ';'", "", 1, 140 },
+	{ /* 274 */ "\\x0-=?-\\uFFFF# : '<'", "", 1, 140 },
+	{ /* 275 */ "\\x0-=?-\\uFFFF# : '='", "", 1, 140 },
+	{ /* 276 */ "\\x0-=?-\\uFFFF# : '?'", "", 1, 140 },
+	{ /* 277 */ "\\x0-=?-\\uFFFF# : '@'", "", 1, 140 },
+	{ /* 278 */ "\\x0-=?-\\uFFFF# : 'A-Z_a-z'", "", 1, 140 },
+	{ /* 279 */ "\\x0-=?-\\uFFFF# : '\\\\'", "", 1, 140 },
+	{ /* 280 */ "\\x0-=?-\\uFFFF# : '|'", "", 1, 140 },
+	{ /* 281 */ "\\x0-!#-[]-\\uFFFF# : '\\x0'", "", 1, 142 },
+	{ /* 282 */ "\\x0-!#-[]-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 142 },
+	{ /* 283 */ "\\x0-!#-[]-\\uFFFF# : '\\t'", "", 1, 142 },
+	{ /* 284 */ "\\x0-!#-[]-\\uFFFF# : '\\n'", "", 1, 142 },
+	{ /* 285 */ "\\x0-!#-[]-\\uFFFF# : '\\r'", "", 1, 142 },
+	{ /* 286 */ "\\x0-!#-[]-\\uFFFF# : ' '", "", 1, 142 },
+	{ /* 287 */ "\\x0-!#-[]-\\uFFFF# : '!'", "", 1, 142 },
+	{ /* 288 */ "\\x0-!#-[]-\\uFFFF# : '#%'", "", 1, 142 },
+	{ /* 289 */ "\\x0-!#-[]-\\uFFFF# : '$'", "", 1, 142 },
+	{ /* 290 */ "\\x0-!#-[]-\\uFFFF# : '''", "", 1, 142 },
+	{ /* 291 */ "\\x0-!#-[]-\\uFFFF# : '('", "", 1, 142 },
+	{ /* 292 */ "\\x0-!#-[]-\\uFFFF# : ')'", "", 1, 142 },
+	{ /* 293 */ "\\x0-!#-[]-\\uFFFF# : '*'", "", 1, 142 },
+	{ /* 294 */ "\\x0-!#-[]-\\uFFFF# : '+'", "", 1, 142 },
+	{ /* 295 */ "\\x0-!#-[]-\\uFFFF# : '.'", "", 1, 142 },
+	{ /* 296 */ "\\x0-!#-[]-\\uFFFF# : '0-9'", "", 1, 142 },
+	{ /* 297 */ "\\x0-!#-[]-\\uFFFF# : ':'", "", 1, 142 },
+	{ /* 298 */ "\\x0-!#-[]-\\uFFFF# : ';'", "", 1, 142 },
+	{ /* 299 */ "\\x0-!#-[]-\\uFFFF# : '<'", "", 1, 142 },
+	{ /* 300 */ "\\x0-!#-[]-\\uFFFF# : '='", "", 1, 142 },
+	{ /* 301 */ "\\x0-!#-[]-\\uFFFF# : '>'", "", 1, 142 },
+	{ /* 302 */ "\\x0-!#-[]-\\uFFFF# : '?'", "", 1, 142 },
+	{ /* 303 */ "\\x0-!#-[]-\\uFFFF# : '@'", "", 1, 142 },
+	{ /* 304 */ "\\x0-!#-[]-\\uFFFF# : 'A-Z_a-z'", "", 1, 142 },
+	{ /* 305 */ "\\x0-!#-[]-\\uFFFF# : '|'", "", 1, 142 },
+	{ /* 306 */ "\\x1-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 145 },
+	{ /* 307 */ "\\x1-\\uFFFF# : '\\t'", "", 1, 145 },
+	{ /* 308 */ "\\x1-\\uFFFF# : '\\n'", "", 1, 145 },
+	{ /* 309 */ "\\x1-\\uFFFF# : '\\r'", "", 1, 145 },
+	{ /* 310 */ "\\x1-\\uFFFF# : ' '", "", 1, 145 },
+	{ /* 311 */ "\\x1-\\uFFFF# : '!'", "", 1, 145 },
+	{ /* 312 */ "\\x1-\\uFFFF# : '\"'", "", 1, 145 },
+	{ /* 313 */ "\\x1-\\uFFFF# : '#%'", "", 1, 145 },
+	{ /* 314 */ "\\x1-\\uFFFF# : '$'", "", 1, 145 },
+	{ /* 315 */ "\\x1-\\uFFFF# : '''", "", 1, 145 },
+	{ /* 316 */ "\\x1-\\uFFFF# : '('", "", 1, 145 },
+	{ /* 317 */ "\\x1-\\uFFFF# : ')'", "", 1, 145 },
+	{ /* 318 */ "\\x1-\\uFFFF# : '*'", "", 1, 145 },
+	{ /* 319 */ "\\x1-\\uFFFF# : '+'", "", 1, 145 },
+	{ /* 320 */ "\\x1-\\uFFFF# : '.'", "", 1, 145 },
+	{ /* 321 */ "\\x1-\\uFFFF# : '0-9'", "", 1, 145 },
+	{ /* 322 */ "\\x1-\\uFFFF# : ':'", "", 1, 145 },
+	{ /* 323 */ "\\x1-\\uFFFF# : ';'", "", 1, 145 },
+	{ /* 324 */ "\\x1-\\uFFFF# : '<'", "", 1, 145 },
+	{ /* 325 */ "\\x1-\\uFFFF# : '='", "", 1, 145 },
+	{ /* 326 */ "\\x1-\\uFFFF# : '>'", "", 1, 145 },
+	{ /* 327 */ "\\x1-\\uFFFF# : '?'", "", 1, 145 },
+	{ /* 328 */ "\\x1-\\uFFFF# : '@'", "", 1, 145 },
+	{ /* 329 */ "\\x1-\\uFFFF# : 'A-Z_a-z'", "", 1, 145 },
+	{ /* 330 */ "\\x1-\\uFFFF# : '\\\\'", "", 1, 145 },
+	{ /* 331 */ "\\x1-\\uFFFF# : '|'", "", 1, 145 },
+	{ /* 332 */ "\\x0-&(-[]-\\uFFFF# : '\\x0'", "", 1, 146 },
+	{ /* 333 */ "\\x0-&(-[]-\\uFFFF# : '\\x1-\\b\\v-\\f\\xE-\\x1F&,--/[]-^`{}-\\uFFFF'", "", 1, 146 },
+	{ /* 334 */ "\\x0-&(-[]-\\uFFFF# : '\\t'", "", 1, 146 },
+	{ /* 335 */ "\\x0-&(-[]-\\uFFFF# : '\\n'", "", 1, 146 },
+	{ /* 336 */ "\\x0-&(-[]-\\uFFFF# : '\\r'", "", 1, 146 },
+	{ /* 337 */ "\\x0-&(-[]-\\uFFFF# : ' '", "", 1, 146 },
+	{ /* 338 */ "\\x0-&(-[]-\\uFFFF# : '!'", "", 1, 146 },
+	{ /* 339 */ "\\x0-&(-[]-\\uFFFF# : '\"'", "", 1, 146 },
+	{ /* 340 */ "\\x0-&(-[]-\\uFFFF# : '#%'", "", 1, 146 },
+	{ /* 341 */ "\\x0-&(-[]-\\uFFFF# : '$'", "", 1, 146 },
+	{ /* 342 */ "\\x0-&(-[]-\\uFFFF# : '('", "", 1, 146 },
+	{ /* 343 */ "\\x0-&(-[]-\\uFFFF# : ')'", "", 1, 146 },
+	{ /* 344 */ "\\x0-&(-[]-\\uFFFF# : '*'", "", 1, 146 },
+	{ /* 345 */ "\\x0-&(-[]-\\uFFFF# : '+'", "", 1, 146 },
+	{ /* 346 */ "\\x0-&(-[]-\\uFFFF# : '.'", "", 1, 146 },
+	{ /* 347 */ "\\x0-&(-[]-\\uFFFF# : '0-9'", "", 1, 146 },
+	{ /* 348 */ "\\x0-&(-[]-\\uFFFF# : ':'", "", 1, 146 },
+	{ /* 349 */ "\\x0-&(-[]-\\uFFFF# : ';'", "", 1, 146 },
+	{ /* 350 */ "\\x0-&(-[]-\\uFFFF# : '<'", "", 1, 146 },
+	{ /* 351 */ "\\x0-&(-[]-\\uFFFF# : '='", "", 1, 146 },
+	{ /* 352 */ "\\x0-&(-[]-\\uFFFF# : '>'", "", 1, 146 },
+	{ /* 353 */ "\\x0-&(-[]-\\uFFFF# : '?'", "", 1, 146 },
+	{ /* 354 */ "\\x0-&(-[]-\\uFFFF# : '@'", "", 1, 146 },
+	{ /* 355 */ "\\x0-&(-[]-\\uFFFF# : 'A-Z_a-z'", "", 1, 146 },
+	{ /* 356 */ "\\x0-&(-[]-\\uFFFF# : '|'", "", 1, 146 }
+};
 
-#if 88
-UNICC_STATIC void _lex( _pcb* pcb )
+UNICC_STATIC UNICC_SCHAR* _lexem( _pcb* pcb )
 {
-    int 			dfa_st	= 0;
-    unsigned int	len		= 0;
-    int				chr;
-    UNICC_CHAR		next;
-#if !0
-    int				mach	= _dfa_select[ pcb->tos->state ];
+#if UNICC_WCHAR || !UNICC_UTF8
+    pcb->lexem = pcb->buf;
 #else
-    int				mach	= 0;
-#endif
-
-    next = _get_input( pcb, len );
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
-#endif
-
-    if( next == pcb->eof )
-    {
-        pcb->sym = 0;
-        return;
-    }
-
-    do
-    {
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
-#endif
-
-        chr = _dfa_idx[ mach ][ dfa_st ];
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: chr = %d\n", UNICC_PARSER, chr );
-#endif
-
-        dfa_st = -1;
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: FIRST next = %d _dfa_chars[ chr ] = %d, "
-            "_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-                _dfa_chars[ chr ], _dfa_chars[ chr + 1 ] );
-#endif
-        while( _dfa_chars[ chr ] > -1 )
-        {
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: next = %d _dfa_chars[ chr ] = %d, "
-        "_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-            _dfa_chars[ chr ], _dfa_chars[ chr + 1 ] );
-#endif
-            if( next >= _dfa_chars[ chr ] &&
-                next <= _dfa_chars[ chr+1 ] )
-            {
-                dfa_st = *( _dfa_trans + ( chr / 2 ) );
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: dfa_st = %d\n", UNICC_PARSER, dfa_st );
-#endif
-                if( _dfa_accept[ mach ][ dfa_st ] > 0 )
-                {
-                    pcb->len = len + 1;
-                    pcb->sym = _dfa_accept[ mach ][ dfa_st ] - 1;
-
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
-            UNICC_PARSER, pcb->sym, _symbols[ pcb->sym ].greedy );
-#endif
-                    if( pcb->sym == 0 )
-                    {
-                        dfa_st = -1; /* test! */
-                        break;
-                    }
-
-                    /* Stop if matched symbol should be parsed nongreedy */
-                    if( !_symbols[ pcb->sym ].greedy )
-                    {
-                        dfa_st = -1;
-                        break;
-                    }
-                }
+    size_t		size;
 
-                next = _get_input( pcb, ++len );
-                break;
-            }
+    size = wcstombs( (char*)NULL, pcb->buf, 0 );
 
-            chr += 2;
-        }
-    }
-    while( dfa_st > -1 && next != pcb->eof );
+    free( pcb->lexem );
 
-    if( pcb->sym > -1 )
+    if( !( pcb->lexem = (UNICC_SCHAR*)malloc(
+            ( size + 1 ) * sizeof( UNICC_SCHAR ) ) ) )
     {
-#if UNICC_SEMANTIC_TERM_SEL
-        /*
-            Execute scanner actions, if existing, but with
-            UNICC_ON_SHIFT = 0, so that no memory allocation
-            should be performed. This actions should only be
-            handled if there are semantic-code dependent
-            terminal symbol selections.
-
-            tos is incremented here, if the semantic code
-            stores data for the symbol. It won't get lost
-            in case of a shift.
-        */
-        _alloc_stack( pcb );
-        pcb->tos++;
-
-        next = pcb->buf[ pcb->len ];
-        pcb->buf[ pcb->len ] = '\0';
-
-#define UNICC_ON_SHIFT 	0
-        switch( pcb->sym )
-        {
-
-
-            default:
-                break;
-        }
-#undef UNICC_ON_SHIFT
-
-        pcb->buf[ pcb->len ] = next;
-
-        pcb->tos--;
-#endif /* UNICC_SEMANTIC_TERM_SEL */
+        UNICC_OUTOFMEM( pcb );
+        return (UNICC_SCHAR*)NULL;
     }
 
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: function exits, pcb->sym = %d, pcb->len = %d\n",
-            UNICC_PARSER, pcb->sym, pcb->len );
+    wcstombs( pcb->lexem, pcb->buf, size + 1 );
+#endif
+
+#if UNICC_DEBUG	> 2
+    fprintf( stderr, "%s: lexem: pcb->lexem = >" UNICC_SCHAR_FORMAT "<\n",
+                        UNICC_PARSER, pcb->lexem );
 #endif
+    return pcb->lexem;
 }
-#endif
 
-UNICC_STATIC int _get_sym( _pcb* pcb )
+
+UNICC_STATIC _ast* _ast_create( _pcb* pcb, char* emit,
+                                                    UNICC_SCHAR* token )
 {
-    pcb->sym = -1;
-    pcb->len = 0;
+    _ast*	node;
 
-#if 0
-    do
+    if( !( node = (_ast*)malloc( sizeof( _ast ) ) ) )
     {
-#endif
-#if !0
-
-#if UNICC_DEBUG > 2
-        fprintf( stderr, "%s: get sym: state = %d dfa_select = %d\n",
-                    UNICC_PARSER, pcb->tos->state,
-                        _dfa_select[ pcb->tos->state ] );
-#endif
+        UNICC_OUTOFMEM( pcb );
+        return node;
+    }
 
-        if( _dfa_select[ pcb->tos->state ] > -1 )
-            _lex( pcb );
-        /*
-         * If there is no DFA state machine,
-         * try to identify the end-of-file symbol.
-         * If this also fails, a parse error will
-         * raise.
-         */
-        else if( _get_input( pcb, 0 ) == pcb->eof )
-            pcb->sym = 0;
-#else
-        _lex( pcb );
-#endif /* !0 */
+    memset( node, 0, sizeof( _ast ) );
 
-#if 0
+    node->emit = emit;
 
-        if( pcb->sym > -1 && _symbols[ pcb->sym ].whitespace )
+    if( token )
+    {
+        #if !UNICC_WCHAR
+        if( !( node->token = strdup( token ) ) )
         {
-            UNICC_CLEARIN( pcb );
-            continue;
+            UNICC_OUTOFMEM( pcb );
+            free( node );
+            return (_ast*)NULL;
         }
-
-        break;
+        #else
+        if( !( node->token = wcsdup( token ) ) )
+        {
+            UNICC_OUTOFMEM( pcb );
+            free( node );
+            return (_ast*)NULL;
+        }
+        #endif
     }
-    while( 1 );
-#endif /* 0 */
 
-    return ( pcb->sym > -1 ) ? 1 : 0;
+    return node;
 }
 
-#if UNICC_STACKDEBUG
-UNICC_STATIC void _dbg_stack( FILE* out,
-    _tok* stack, _tok* tos )
+/* Don't report on unused _ast_free or _ast_print */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+
+UNICC_STATIC _ast* _ast_free( _ast* node )
 {
-    fprintf( out, "%s: Stack Dump: ", UNICC_PARSER );
+    if( !node )
+        return (_ast*)NULL;
 
-    for( ; stack <= tos; stack++ )
-    {
-        fprintf( out, "%d%s%s%s ", stack->state,
-            stack->symbol ? " (" : "",
-            stack->symbol ? stack->symbol->name : "",
-            stack->symbol ? ")" : "" );
-    }
+    _ast_free( node->child );
+    _ast_free( node->next );
 
-    fprintf( out, "\n" );
+    if( node->token )
+        free( node->token );
+
+    free( node );
+    return (_ast*)NULL;
 }
-#endif /* UNICC_STACKDEBUG */
 
-UNICC_STATIC int _handle_error( _pcb* pcb, FILE* _dbg )
+UNICC_STATIC void _ast_print( FILE* stream, _ast* node )
 {
-#if UNICC_DEBUG
-    int					i;
-#endif
+    int 		i;
+    static int 	rec;
 
-    if( !pcb->error_delay )
-    {
-#if UNICC_DEBUG
-        fprintf( _dbg, "%s: !!!PARSE ERROR!!!\n"
-                "%s: error recovery: current token %d (%s)\n",
-                    UNICC_PARSER, UNICC_PARSER, pcb->sym,
-                        ( ( pcb->sym >= 0 ) ?
-                            _symbols[ pcb->sym ].name :
-                                "(null)" ) );
+    if( !node )
+        return;
 
-        fprintf( _dbg,
-                "%s: error recovery: expecting ", UNICC_PARSER );
+    if( !stream )
+        stream = stderr;
 
-        for( i = 1; i < _act[ pcb->tos->state ][0] * 3; i += 3 )
-        {
-            fprintf( _dbg, "%d (%s)%s",
-                _act[ pcb->tos->state ][i],
-                _symbols[ _act[ pcb->tos->state ][i] ].name,
-                ( i == _act[ pcb->tos->state ][0] * 3 - 3 ) ?
-                        "\n" : ", " );
-        }
+    while( node )
+    {
+        for( i = 0; i < rec; i++ )
+            fprintf( stream,  " " );
 
-        fprintf( _dbg, "\n%s: error recovery: error_delay is %d, %s\n",
-                    UNICC_PARSER, pcb->error_delay,
-                    ( pcb->error_delay ? "error recovery runs silently" :
-                        "error is reported before its recover!" ) );
-#endif
-    }
+        fprintf( stream, "%s", node->emit );
 
-#if -1 < 0
-    /* No error token defined? Then exit here... */
+        if( node->token && strcmp( node->emit, node->token ) != 0 )
+            fprintf( stream, " (%s)", node->token );
 
-#if UNICC_DEBUG
-    fprintf( _dbg,
-        "%s: error recovery: No error resync token used by grammar, "
-            "exiting parser.\n", UNICC_PARSER );
-#endif
+        fprintf( stream, "\n" );
 
-    UNICC_PARSE_ERROR( pcb );
-    pcb->error_count++;
+        rec++;
+        _ast_print( stream, node->child );
+        rec--;
 
-    return 1;
-#else
-    /*
-    _pcb 		org_pcb;
-    */
+        node = node->next;
+    }
+}
 
-#if UNICC_DEBUG
-    fprintf( _dbg, "%s: error recovery: "
-        "trying to recover...\n", UNICC_PARSER );
-#if UNICC_STACKDEBUG
-    _dbg_stack( _dbg, pcb->stack, pcb->tos );
-#endif
-#endif
+#pragma GCC diagnostic pop
 
-    #if 0
-    /* Create a copy of original parser control block (maybe later...) */
-    memcpy( &org_pcb, pcb, sizeof( _pcb ) );
-    org_pcb.buf = (char*)malloc( ( strlen( pcb->buf ) / UNICC_MALLOCSTEP +
-                    ( !( strlen( pcb->buf ) % UNICC_MALLOCSTEP ) ? 1 : 0 ) )
-                            * UNICC_MALLOCSTEP );
-    strcpy( org_pcb.buf, pcb->buf );
-    #endif
+UNICC_STATIC int _get_act( _pcb* pcb )
+{
+    int i;
 
-    /* Remember previous symbol, or discard it */
-    if( pcb->error_delay != UNICC_ERROR_DELAY )
-        pcb->old_sym = pcb->sym;
-    else
-    {
-        pcb->old_sym = -1;
-        pcb->len = 1;
-        UNICC_CLEARIN( pcb );
-    }
+#if 0
+    i = _act_base[ pcb->tos->state ] + pcb->sym;
 
-    /* Try to shift on error resync */
-    pcb->sym = -1;
+    if( i >= 0 && i < 0
+            && _act_check[ i ] == pcb->tos->state )
+    {
+        if( ( pcb->act = _act_next[ i ][0] ) == UNICC_ERROR )
+            return 0; /* Force parse error! */
 
-    while( pcb->tos >= pcb->stack )
+        pcb->idx = _act_next[ i ][1];
+        return 1;
+    }
+#else
+    for( i = 1; i < _act[ pcb->tos->state ][0] * 3; i += 3 )
     {
-#if UNICC_DEBUG
-        fprintf( _dbg, "%s: error recovery: in state %d, trying "
-                "to shift error resync token...\n",
-                    UNICC_PARSER, pcb->tos->state );
-#if UNICC_STACKDEBUG
-        _dbg_stack( _dbg, pcb->stack, pcb->tos );
-#endif
-#endif
-        if( _get_act( pcb ) )
+        if( _act[ pcb->tos->state ][i] == pcb->sym )
         {
-            /* Shift */
-            if( pcb->act & UNICC_SHIFT )
-            {
-#if UNICC_DEBUG
-                fprintf( _dbg, "%s: error recovery: "
-                            "error resync shifted\n", UNICC_PARSER );
-#endif
-                break;
-            }
-        }
+            if( ( pcb->act = _act[ pcb->tos->state ][i+1] )
+                    == UNICC_ERROR )
+                return 0; /* Force parse error! */
 
-#if UNICC_DEBUG
-        fprintf( _dbg, "%s: error recovery: failed, "
-                    "discarding token '%s'\n", UNICC_PARSER,
-                        pcb->tos->symbol ?
-                            pcb->tos->symbol->name : "NULL" );
+            pcb->idx = _act[ pcb->tos->state ][i+2];
+            return 1;
+        }
+    }
 #endif
 
-        /* Discard one token from stack */
-        /* TODO: Discarded token memory (semantic action) */
-        pcb->tos--;
+    /* Default production */
+    if( ( pcb->idx = _def_prod[ pcb->tos->state ] ) > -1 )
+    {
+        pcb->act = 1; /* Reduce */
+        return 1;
     }
 
-    if( pcb->tos <= pcb->stack )
-    {
-#if UNICC_DEBUG
-    fprintf( _dbg, "%s: error recovery: "
-                "Can't recover this issue, stack is empty.\n",
-                    UNICC_PARSER );
-#endif
-        UNICC_PARSE_ERROR( pcb );
-        pcb->error_count++;
+    return 0;
+}
+
+UNICC_STATIC int _get_go( _pcb* pcb )
+{
+    int i;
+
+#if 0
+    i = _go_base[ pcb->tos->state ] + pcb->lhs;
 
+    if( i >= 0 && i < 0
+            && _go_check[ i ] == pcb->tos->state )
+    {
+        pcb->act = _go_next[ i ][0];
+        pcb->idx = _go_next[ i ][1];
         return 1;
     }
-
-#if UNICC_DEBUG
-    fprintf( _dbg, "%s: error recovery: "
-                "trying to continue with modified parser state\n",
-                    UNICC_PARSER );
+#else
+    for( i = 1; i < _go[ pcb->tos->state ][0] * 3; i += 3 )
+    {
+        if( _go[ pcb->tos->state ][i] == pcb->lhs )
+        {
+            pcb->act = _go[ pcb->tos->state ][ i + 1 ];
+            pcb->idx = _go[ pcb->tos->state ][ i + 2 ];
+            return 1;
+        }
+    }
 #endif
 
-    pcb->error_delay = UNICC_ERROR_DELAY + 1;
-
     return 0;
-
-#endif /* -1 >= 0 */
 }
 
-int _parse( _pcb* pcb )
+UNICC_STATIC int _alloc_stack( _pcb* pcb )
 {
-    int			ret;
-    int					i;
-
-    _ast*		node;
-    _ast*		lnode;
-
-#if UNICC_DEBUG
-    _vtype*		vptr;
-    FILE* 				_dbg;
+    unsigned int	size;
 
-    _dbg = stderr;
-#endif
+    if( !pcb->stacksize )
+    {
+        if( !( pcb->tos = pcb->stack = (_tok*)malloc(
+                UNICC_MALLOCSTEP * sizeof( _tok ) ) ) )
+        {
+            UNICC_OUTOFMEM( pcb );
+            return -1;
+        }
 
-    /* If there is no Parser Control Block given, allocate your own one! */
-    if( !pcb )
+        pcb->stacksize = UNICC_MALLOCSTEP;
+    }
+    else if( ( size = (unsigned int)( pcb->tos - pcb->stack ) )
+                == pcb->stacksize )
     {
-        if( !( pcb = (_pcb*)malloc( sizeof( _pcb ) ) ) )
+        _tok*	ptr;
+
+        if( !( ptr = (_tok*)realloc( pcb->stack,
+                ( pcb->stacksize + UNICC_MALLOCSTEP )
+                    * sizeof( _tok ) ) ) )
         {
-            /* Can't allocate memory */
             UNICC_OUTOFMEM( pcb );
-            return (int)0;
+            free( pcb->stack );
+
+            return -1;
         }
 
-        memset( pcb, 0, sizeof( _pcb ) );
-        pcb->is_internal = 1;
+        pcb->tos = pcb->stack = ptr;
+
+        pcb->stacksize += UNICC_MALLOCSTEP;
+        pcb->tos += size;
     }
-    else
-        pcb->is_internal = 0;
 
-    /* Initialize Parser Control Block */
-    pcb->stacksize = 0;
-    if( _alloc_stack( pcb ) < 0 )
-        return (int)0;
+    return 0;
+}
 
-    memset( pcb->tos, 0, sizeof( _tok ) );
+#ifndef UNICC_GETINPUT
 
-    pcb->act = UNICC_SHIFT;
-    pcb->sym = -1;
-    pcb->old_sym = -1;
-    pcb->line = 1;
-    pcb->column = 1;
+#if UNICC_UTF8
+static int offsets_utf8[ 6 ] =
+{
+    0x00000000UL, 0x00003080UL, 0x000E2080UL,
+    0x03C82080UL, 0xFA082080UL, 0x82082080UL
+};
 
-    memset( &pcb->test, 0, sizeof( _vtype ) );
+static int trailbyte_utf8[ 256 ] =
+{
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, 3,3,3,3,3,3,3,3,4,4,4,4,5,5,5,5
+};
 
-    /* Begin of main parser loop */
-    while( 1 )
+UNICC_STATIC UNICC_CHAR _utf8_getchar( int (*getfn)() )
+{
+    UNICC_CHAR	ch	= 0;
+    int 		nb;
+    int			c;
+
+    if( !getfn )
+        getfn = getchar;
+
+    switch( ( nb = trailbyte_utf8[ ( c = (*getfn)() ) ] ) )
     {
-        /* Reduce */
-        while( pcb->act & UNICC_REDUCE )
-        {
-#if UNICC_DEBUG
-            fprintf( _dbg, "%s: << "
-                    "reducing by production %d (%s)\n",
-                        UNICC_PARSER, pcb->idx,
-                            _productions[ pcb->idx ].definition );
-#endif
-            /* Set default left-hand side */
-            pcb->lhs = _productions[ pcb->idx ].lhs;
+        case 3:
+            ch += c;
+            ch <<= 6;
+            c = (*getfn)();
+        case 2:
+            ch += c;
+            ch <<= 6;
+            c = (*getfn)();
+        case 1:
+            ch += c;
+            ch <<= 6;
+            c = (*getfn)();
+        case 0:
+            ch += c;
+            break;
+    }
 
-            /* Run reduction code */
-            memset( &( pcb->ret ), 0, sizeof( _vtype ) );
+    ch -= offsets_utf8[ nb ];
+#if UNICC_DEBUG	> 3
+    fprintf( stderr, "%s: getchar: %d\n", UNICC_PARSER, ch );
+#endif
+    return ch;
+}
+#define UNICC_GETINPUT		_utf8_getchar( getchar )
 
-            switch( pcb->idx )
-            {
-            case 0:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 1:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 2:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 3:
-                    {
-                     pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 4:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 5:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 6:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 7:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 8:
-                    {
-                     pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 9:
-                    {
-                        ;
-                    }
-                    break;
-                case 10:
-                    {
-                        ;
-                    }
-                    break;
-                case 11:
-                    {
-                        ;
-                    }
-                    break;
-                case 12:
-                    {
-                    #line 132 "src/parse.par"
+#else
+#define UNICC_GETINPUT		getchar()
+#endif
 
-                            if( !( parser->p_template ) )
-                                parser->p_template = pstrdup( strbuf );
-                            else if( !pcb->main )
-                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "!language" );
-                            ;
-                    }
-                    break;
-                case 13:
-                    {
-                    #line 160 "src/parse.par"
- parser->p_mode = MODE_SCANNERLESS;     ;
-                    }
-                    break;
-                case 14:
-                    {
-                    #line 162 "src/parse.par"
- parser->p_mode = MODE_SCANNER;     ;
-                    }
-                    break;
-                case 15:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 16:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 17:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 18:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 19:
-                    {
-                    #line 174 "src/parse.par"
+#endif
 
-                            LIST* l;
-                            SYMBOL* s;
+/* Reads up to n characters into buf, and returns the number of characters
+    read, or 0 at the end of input; Without a block-wise input function, a
+    single character is read from UNICC_GETINPUT. buf holds UNICC_CHAR, so a
+    byte-wise block read like fread() only fits with UNICC_UTF8 set to 0;
+    UTF-8 input is decoded per character by UNICC_GETINPUT anyway. */
+#ifndef UNICC_READ
+#define UNICC_READ( pcb, buf, n ) \
+    ( ( *( buf ) = (UNICC_CHAR)UNICC_GETINPUT ) == ( pcb )->eof ? 0 : 1 )
+#endif
 
-                            for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
-                            {
-                                s = l->pptr;
+UNICC_STATIC UNICC_CHAR _get_input( _pcb* pcb, unsigned int offset )
+{
+    int		n;
+    int		i;
 
-                                /* Do not allow nonterminal definitions here
-                                    in conext-free model */
-                                if( s->type == SYM_NON_TERMINAL &&
-                                    parser->p_mode !=
-                                        MODE_SCANNERLESS )
-                                {
-                                    print_error( parser, ERR_NONTERM_WS_NOT_ALLOWED,
-                                        ERRSTYLE_FATAL | ERRSTYLE_FILEINFO,
-                                                pcb->filename, pcb->line,
-                                                    s->name );
-                                }
-                                else
-                                    s->whitespace = TRUE;
-                            }
+#if UNICC_DEBUG	> 2
+    fprintf( stderr, "%s: get input: pcb->buf + offset = %p pcb->bufend = %p\n",
+                UNICC_PARSER, pcb->buf + offset, pcb->bufend );
+#endif
 
-                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
-                            ;
-                    }
-                    break;
-                case 20:
-                    {
-                    #line 201 "src/parse.par"
+    while( pcb->buf + offset >= pcb->bufend )
+    {
+#if UNICC_DEBUG	> 2
+            fprintf( stderr, "%s: get input: requiring more input\n",
+                    UNICC_PARSER );
+#endif
+        if( pcb->is_eof )
+        {
+#if UNICC_DEBUG	> 2
+            fprintf( stderr, "%s: get input: can't get more input, "
+                        "end-of-file reached\n", UNICC_PARSER );
+#endif
+            return pcb->eof;
+        }
 
-                            LIST* l;
-                            SYMBOL* s;
+        if( !pcb->bufstart )
+        {
+            pcb->bufend = pcb->buf = pcb->bufstart = (UNICC_CHAR*)malloc(
+                ( UNICC_MALLOCSTEP + 1 ) * sizeof( UNICC_CHAR ) );
 
+            if( !pcb->buf )
+            {
+                UNICC_OUTOFMEM( pcb );
+                return 0;
+            }
 
-                            /* Ouput a warning, if this definition
-                                is effectless */
-                            if( parser->p_mode != MODE_SCANNERLESS )
-                            {
-                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line, "lexeme" );
-                            }
-                            else
-                            {
-                                for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
-                                {
-                                    s = l->pptr;
-                                    s->lexem = TRUE;
-                                }
-                            }
+            pcb->bufsize = UNICC_MALLOCSTEP;
+            *pcb->buf = 0;
+        }
+        else if( pcb->bufend == pcb->bufstart + pcb->bufsize )
+        {
+            unsigned int 	size	= (unsigned int)( pcb->bufend - pcb->buf );
+            unsigned int	start	= (unsigned int)( pcb->buf - pcb->bufstart );
+            UNICC_CHAR*		buf;
 
-                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
-                            ;
-                    }
-                    break;
-                case 21:
-                    {
-                    #line 227 "src/parse.par"
+            /* Move the window to the front if the consumed characters
+                exceed half of the buffer, or double the buffer */
+            if( start > pcb->bufsize / 2 )
+            {
+                memmove( pcb->bufstart, pcb->buf,
+                            ( size + 1 ) * sizeof( UNICC_CHAR ) );
+                start = 0;
+            }
+            else
+            {
+                if( !( buf = (UNICC_CHAR*)realloc( pcb->bufstart,
+                            ( pcb->bufsize * 2 + 1 )
+                                * sizeof( UNICC_CHAR ) ) ) )
+                {
+                    UNICC_OUTOFMEM( pcb );
+                    free( pcb->bufstart );
 
-                            LIST* l;
-                            SYMBOL* s;
+                    pcb->buf = pcb->bufend = pcb->bufstart = (UNICC_CHAR*)NULL;
+                    return 0;
+                }
 
-                            /* Ouput a warning, if this definition
-                                is effectless */
-                            if( parser->p_mode != MODE_SCANNERLESS )
-                            {
-                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line, "fixate" );
-                            }
-                            else
-                            {
-                                for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
-                                {
-                                    s = l->pptr;
-                                    s->fixated = TRUE;
-                                }
-                            }
+                pcb->bufstart = buf;
+                pcb->bufsize *= 2;
+            }
 
-                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
-                            ;
-                    }
-                    break;
-                case 22:
-                    {
-                    #line 252 "src/parse.par"
- set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_LEFT );     ;
-                    }
-                    break;
-                case 23:
-                    {
-                    #line 256 "src/parse.par"
- set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_RIGHT );     ;
-                    }
-                    break;
-                case 24:
-                    {
-                    #line 260 "src/parse.par"
- set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_NOASSOC );     ;
-                    }
-                    break;
-                case 25:
-                    {
-                    #line 263 "src/parse.par"
- parser->p_prefix = pstrcatstr(
-                            parser->p_prefix, strbuf, FALSE );     ;
-                    }
-                    break;
-                case 26:
-                    {
-                    #line 267 "src/parse.par"
-  if( !( parser->p_def_action ) )
-                                parser->p_def_action = pstrdup( strbuf );
-                            else
-                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "default epsilon action" );
-                            ;
-                    }
-                    break;
-                case 27:
-                    {
-                    #line 277 "src/parse.par"
-    if( !( parser->p_def_action_e ) )
-                                parser->p_def_action_e = pstrdup( strbuf );
-                            else
-                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "default epsilon action" );
-                            ;
-                    }
-                    break;
-                case 28:
-                    {
-                    #line 287 "src/parse.par"
-    if( !( parser->p_def_type ) )
-                                parser->p_def_type = create_vtype(
-                                    parser, (char*)( ( pcb->tos - 0 )->value.value_3 ) );
-                            else
-                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "default value type" );
+            pcb->buf = pcb->bufstart + start;
+            pcb->bufend = pcb->buf + size;
+        }
 
-                            pfree( ( ( pcb->tos - 0 )->value.value_3 ) );
-                            ;
-                    }
-                    break;
-                case 29:
-                    {
-                    #line 300 "src/parse.par"
-    /* Ouput a warning, if this definition
-                                is effectless */
-                            if( parser->p_mode != MODE_SCANNERLESS )
-                            {
-                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
-                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            "lexem separation" );
-                            }
-                            else
-                                parser->p_lexem_sep = !( ( pcb->tos - 0 )->value.value_0 );
-                            ;
-                    }
-                    break;
-                case 30:
-                    {
-                    #line 314 "src/parse.par"
-    parser->p_cis_strings = !( ( pcb->tos - 0 )->value.value_0 );        ;
-                    }
-                    break;
-                case 31:
-                    {
-                    #line 317 "src/parse.par"
-    parser->p_reserve_regex = !( ( pcb->tos - 0 )->value.value_0 );            ;
-                    }
-                    break;
-                case 32:
-                    {
-                    #line 320 "src/parse.par"
-    parser->p_header = pstrcatstr(
-                                parser->p_header, strbuf, FALSE );        ;
-                    }
-                    break;
-                case 33:
-                    {
-                    #line 324 "src/parse.par"
-    parser->p_footer = pstrcatstr(
-                                parser->p_footer, strbuf, FALSE );        ;
-                    }
-                    break;
-                case 34:
-                    {
-                    #line 327 "src/parse.par"
-    parser->p_pcb = pstrcatstr(
-                                parser->p_pcb, strbuf, FALSE );        ;
-                    }
-                    break;
-                case 35:
-                    {
-                    #line 332 "src/parse.par"
+        /* Fill the free space of the buffer; Input ends on the
+            end-of-file character, characters read behind it are dropped */
+        n = UNICC_READ( pcb, pcb->bufend,
+                (unsigned int)( pcb->bufstart + pcb->bufsize - pcb->bufend ) );
+
+        for( i = 0; i < n && pcb->bufend[ i ] != pcb->eof; i++ )
+            ;
+
+        if( i < n || n <= 0 )
+            pcb->is_eof = 1;
+
+#if UNICC_DEBUG	> 2
+        fprintf( stderr, "%s: get input: read %d characters\n",
+                    UNICC_PARSER, i );
+#endif
+
+        pcb->bufend += i;
+        *( pcb->bufend ) = 0;
+    }
+
+#if UNICC_DEBUG	> 2
+    {
+        UNICC_CHAR*		chptr;
+
+        fprintf( stderr, "%s: get input: offset = %d\n",
+                    UNICC_PARSER, offset );
+        fprintf( stderr, "%s: get input: buf = >" UNICC_CHAR_FORMAT "<\n",
+                    UNICC_PARSER, pcb->buf );
+        fprintf( stderr, "%s: get input: returning %d\n",
+                    UNICC_PARSER, *( pcb->buf + offset ) );
+    }
+#endif
+
+    return pcb->buf[ offset ];
+}
 
-                            char*    src;
-                            char*    filename = strbuf;
+UNICC_STATIC void _clear_input( _pcb* pcb )
+{
+    int		i;
 
-                            strbuf = NULL;
+    if( pcb->buf )
+    {
+        if( pcb->len )
+        {
+            /* Update counters for line and column */
+            for( i = 0; i < pcb->len; i++ )
+            {
+                if( (char)pcb->buf[i] == '\n' )
+                {
+                    pcb->line++;
+                    pcb->column = 1;
+                }
+                else
+                    pcb->column++;
+            }
 
-                            if( !pfiletostr( &src, filename ) )
-                            {
-                                print_error( parser, ERR_OPEN_INPUT_FILE,
-                                                ERRSTYLE_FATAL, filename );
-                            }
-                            else
-                            {
-                                parse_grammar( parser, filename, src );
-                                strbuf = NULL;
-                                pfree( src );
-                            }
+#if UNICC_DEBUG > 2
+    fprintf( stderr, "%s: clear input: "
+        "Clearing %d characters (%d bytes)\n",
+            UNICC_PARSER, pcb->len, pcb->len * sizeof( UNICC_CHAR ) );
+    fprintf( stderr, "%s: clear input: buf = >" UNICC_CHAR_FORMAT "<\n",
+            UNICC_PARSER, pcb->buf, sizeof( UNICC_CHAR ) );
+    fprintf( stderr, "%s: clear input: pcb->bufend >" UNICC_CHAR_FORMAT "<\n",
+            UNICC_PARSER, pcb->bufend );
+#endif
 
-                            pfree( filename );
-                            ;
-                    }
-                    break;
-                case 36:
-                    {
-                     pcb->ret.value_0 = ( ( pcb->tos - 0 )->value.value_0 );     ;
-                    }
-                    break;
-                case 37:
-                    {
-                    #line 356 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 38:
-                    {
-                    #line 359 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 39:
-                    {
-                    #line 360 "src/parse.par"
- pcb->ret.value_0 = TRUE;     ;
-                    }
-                    break;
-                case 40:
-                    {
-                    #line 364 "src/parse.par"
- pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ), (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
-                    }
-                    break;
-                case 41:
-                    {
-                    #line 366 "src/parse.par"
- pcb->ret.value_1 = list_push( (LIST*)NULL, (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
-                    }
-                    break;
-                case 42:
-                    {
-                    #line 370 "src/parse.par"
-  pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_NON_TERMINAL, TRUE );
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 43:
-                    {
-                    #line 378 "src/parse.par"
- pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ), (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
-                    }
-                    break;
-                case 44:
-                    {
-                    #line 380 "src/parse.par"
- pcb->ret.value_1 = list_push( (LIST*)NULL, (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
-                    }
-                    break;
-                case 45:
-                    {
-                    #line 384 "src/parse.par"
-  pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ),
-                                    (void*)( ( pcb->tos - 0 )->value.value_2 ) );
-                            ( ( pcb->tos - 0 )->value.value_2 )->derived_from =
-                                (SYMBOL*)list_access( ( ( pcb->tos - 1 )->value.value_1 ) );
-                            ;
-                    }
-                    break;
-                case 46:
-                    {
-                    #line 390 "src/parse.par"
-  pcb->ret.value_1 = list_push( (LIST*)NULL,
-                                    (void*)( ( pcb->tos - 0 )->value.value_2 ) );
+            /* Slide the window behind the consumed characters; The buffer
+                is compacted by _get_input() when it runs full. */
+            pcb->buf += pcb->len;
 
-                            current_sym = ( ( pcb->tos - 0 )->value.value_2 );
-                            ;
-                    }
-                    break;
-                case 47:
-                    {
-                    #line 398 "src/parse.par"
-  pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
+            if( pcb->buf >= pcb->bufend )
+            {
+                pcb->buf = pcb->bufend = pcb->bufstart;
+                *( pcb->buf ) = 0;
+            }
 
-                            if( pcb->ret.value_2->defined )
-                            {
-                                print_error( parser, ERR_DOUBLE_TERMINAL_DEF,
-                                    ERRSTYLE_FATAL | ERRSTYLE_FILEINFO,
-                                        pcb->filename, pcb->line,
-                                            pcb->ret.value_2->name );
-                            }
+#if UNICC_DEBUG	> 2
+    fprintf( stderr, "%s: clear input: now buf = >" UNICC_CHAR_FORMAT "<\n",
+                UNICC_PARSER, pcb->buf, sizeof( UNICC_CHAR ) );
+    fprintf( stderr, "%s: clear input: now bufend = >" UNICC_CHAR_FORMAT "<\n",
+                UNICC_PARSER, pcb->bufend, sizeof( UNICC_CHAR ) );
+#endif
+        }
+        else
+        {
+            pcb->buf = pcb->bufend = pcb->bufstart;
+            *( pcb->buf ) = 0;
+        }
+    }
 
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 48:
-                    {
-                    #line 414 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 49:
-                    {
-                    #line 415 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 50:
-                    {
-                    #line 416 "src/parse.par"
- pcb->ret.value_0 = TRUE;     ;
-                    }
-                    break;
-                case 51:
-                    {
-                    #line 417 "src/parse.par"
- pcb->ret.value_0 = TRUE;     ;
-                    }
-                    break;
-                case 52:
-                    {
-                    #line 425 "src/parse.par"
+    pcb->len = 0;
+    pcb->sym = -1;
+#if UNICC_DEBUG	> 2
+    fprintf( stderr, "%s: clear input: symbol cleared\n", UNICC_PARSER );
+#endif
+}
 
-                            LIST*     l;
-                            LIST*    m;
-                            PROD*     p;
-                            SYMBOL*    lhs;
-                            VTYPE*    vt        = (VTYPE*)NULL;
+#if 75
+UNICC_STATIC void _lex( _pcb* pcb )
+{
+    int 			dfa_st	= 0;
+    unsigned int	len		= 0;
+    int				chr;
+    int				cls;
+    int				lo;
+    int				hi;
+    UNICC_CHAR		next;
+#if !0
+    int				mach	= _dfa_select[ pcb->tos->state ];
+#else
+    int				mach	= 0;
+#endif
 
-                            ( ( pcb->tos - 3 )->value.value_1 ) = list_push( ( ( pcb->tos - 3 )->value.value_1 ), (void*)( ( pcb->tos - 5 )->value.value_2 ) );
+    next = _get_input( pcb, len );
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
+#endif
 
-                            /* Value type */
-                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
-                            {
-                                vt = create_vtype( parser,
-                                        (char*)( ( pcb->tos - 2 )->value.value_3 ) );
+    if( next == pcb->eof )
+    {
+        pcb->sym = 0;
+        return;
+    }
 
-                                pfree( ( ( pcb->tos - 2 )->value.value_3 ) );
-                            }
+    do
+    {
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
+#endif
 
-                            /* Connect left-hand sides */
-                            for( l = ( ( pcb->tos - 3 )->value.value_1 ); l; l = list_next( l ) )
-                            {
-                                lhs = (SYMBOL*)list_access( l );
+        /* The lexer runs on the character class of next */
+        if( (unsigned int)next <= 65535 )
+            cls = _char_map[ _char_map_idx[ next >> 8 ]
+                                        + ( next & 0xFF ) ];
+        else
+            cls = 55;
+
+        /* The next state is looked up in the dense row of hot states for
+            the classes of ASCII characters, and by binary search on the
+            sorted ranges of the state otherwise */
+        if( cls < 55
+                && _dfa_idx[ mach ][ dfa_st ][ 2 ] > -1 )
+            dfa_st = _dfa_dense[ _dfa_idx[ mach ][ dfa_st ][ 2 ]
+                                            + cls ];
+        else
+        {
+            lo = _dfa_idx[ mach ][ dfa_st ][ 0 ];
+            hi = lo + _dfa_idx[ mach ][ dfa_st ][ 1 ];
+            dfa_st = -1;
 
-                                LISTFOR( ( ( pcb->tos - 0 )->value.value_1 ), m )
-                                    plist_push( lhs->productions,
-                                        list_access( m ) );
+            while( lo < hi )
+            {
+                chr = ( lo + hi ) / 2;
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: cls = %d _dfa_chars[ chr * 2 ] = %d, "
+        "_dfa_chars[ chr * 2 + 1 ] = %d\n", UNICC_PARSER, cls,
+            _dfa_chars[ chr * 2 ], _dfa_chars[ chr * 2 + 1 ] );
+#endif
+                if( cls < _dfa_chars[ chr * 2 ] )
+                    hi = chr;
+                else if( cls > _dfa_chars[ chr * 2 + 1 ] )
+                    lo = chr + 1;
+                else
+                {
+                    dfa_st = _dfa_trans[ chr ];
+                    break;
+                }
+            }
+        }
 
-                                lhs->vtype = vt;
-                            }
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: dfa_st = %d\n", UNICC_PARSER, dfa_st );
+#endif
+        if( dfa_st > -1 && _dfa_accept[ mach ][ dfa_st ] > 0 )
+        {
+            pcb->len = len + 1;
+            pcb->sym = _dfa_accept[ mach ][ dfa_st ] - 1;
 
-                            /* Link productions with this left-hand sides */
-                            for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
-                            {
-                                LIST* m;
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
+            UNICC_PARSER, pcb->sym, _symbols[ pcb->sym ].greedy );
+#endif
+            /* Stop on end of input, or if matched symbol should be parsed
+                nongreedy */
+            if( pcb->sym == 0 || !_symbols[ pcb->sym ].greedy )
+                dfa_st = -1;
+        }
 
-                                p = (PROD*)list_access( l );
+        if( dfa_st > -1 )
+            next = _get_input( pcb, ++len );
+    }
+    while( dfa_st > -1 && next != pcb->eof );
 
-                                p->lhs = ( ( pcb->tos - 5 )->value.value_2 );
+    if( pcb->sym > -1 )
+    {
+#if UNICC_SEMANTIC_TERM_SEL
+        /*
+            Execute scanner actions, if existing, but with
+            UNICC_ON_SHIFT = 0, so that no memory allocation
+            should be performed. This actions should only be
+            handled if there are semantic-code dependent
+            terminal symbol selections.
 
-                                LISTFOR( ( ( pcb->tos - 3 )->value.value_1 ), m )
-                                    plist_push( p->all_lhs, list_access( m ) );
+            tos is incremented here, if the semantic code
+            stores data for the symbol. It won't get lost
+            in case of a shift.
+        */
+        _alloc_stack( pcb );
+        pcb->tos++;
 
-                                /* AST */
-                                if( ( ( pcb->tos - 1 )->value.value_0 ) && !p->emit )
-                                    p->emit = pstrdup( ( ( pcb->tos - 5 )->value.value_2 )->name );
-                            }
+        next = pcb->buf[ pcb->len ];
+        pcb->buf[ pcb->len ] = '\0';
 
-                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
-                            list_free( ( ( pcb->tos - 3 )->value.value_1 ) );
+#define UNICC_ON_SHIFT 	0
+        switch( pcb->sym )
+        {
 
-                            /* Goal primary defined? */
-                            if( ( ( pcb->tos - 4 )->value.value_0 ) && pcb->main )
-                            {
-                                if( parser->goal )
-                                {
-                                    print_error( parser, ERR_MULTIPLE_GOAL_DEF,
-                                        ERRSTYLE_FATAL,
-                                            parser->goal->name );
-                                }
-                                else
-                                {
-                                    parser->goal = ( ( pcb->tos - 5 )->value.value_2 );
-                                    parser->goal->used = TRUE;
-                                }
-                            }
-                            ;
-                    }
-                    break;
-                case 53:
-                    {
-                     pcb->ret.value_1 = ( ( pcb->tos - 0 )->value.value_1 );     ;
-                    }
-                    break;
-                case 54:
-                    {
-                     pcb->ret.value_1 = 0;     ;
-                    }
-                    break;
-                case 55:
-                    {
-                    #line 495 "src/parse.par"
 
-                            SYMBOL* primary;
-                            SYMBOL* s;
-                            LIST* l;
-                            VTYPE* vt;
+            default:
+                break;
+        }
+#undef UNICC_ON_SHIFT
 
-                            primary = (SYMBOL*)list_access( ( ( pcb->tos - 5 )->value.value_1 ) );
+        pcb->buf[ pcb->len ] = next;
 
-                            primary->ptn = ( ( pcb->tos - 3 )->value.value_6 );
-                            primary->greedy = greedy;
-                            primary->emit = ( ( pcb->tos - 1 )->value.value_3 );
+        pcb->tos--;
+#endif /* UNICC_SEMANTIC_TERM_SEL */
+    }
 
-                            greedy = TRUE;
+#if UNICC_DEBUG	> 1
+fprintf( stderr, "%s: lex: function exits, pcb->sym = %d, pcb->len = %d\n",
+            UNICC_PARSER, pcb->sym, pcb->len );
+#endif
+}
+#endif
 
-                            /* Attach code */
-                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
-                            {
-                                /* Copy code for every symbol  */
-                                for( l = ( ( pcb->tos - 5 )->value.value_1 ); l;
-                                    l = list_next( l ) )
-                                {
-                                    s = (SYMBOL*)list_access( l );
+UNICC_STATIC int _get_sym( _pcb* pcb )
+{
+    pcb->sym = -1;
+    pcb->len = 0;
 
-                                    /*
-                                        Last symbol gets strbuf-pointer,
-                                        all other assignments need to be
-                                        duplicated.
-                                    */
-                                    if( list_next( l ) )
-                                        s->code = pstrdup( strbuf );
-                                    else
-                                        s->code = strbuf;
+#if 0
+    do
+    {
+#endif
+#if !0
 
-                                    primary->code_at = last_code_begin;
-                                }
+#if UNICC_DEBUG > 2
+        fprintf( stderr, "%s: get sym: state = %d dfa_select = %d\n",
+                    UNICC_PARSER, pcb->tos->state,
+                        _dfa_select[ pcb->tos->state ] );
+#endif
 
-                                strbuf = (char*)NULL;
-                            }
+        if( _dfa_select[ pcb->tos->state ] > -1 )
+            _lex( pcb );
+        /*
+         * If there is no DFA state machine,
+         * try to identify the end-of-file symbol.
+         * If this also fails, a parse error will
+         * raise.
+         */
+        else if( _get_input( pcb, 0 ) == pcb->eof )
+            pcb->sym = 0;
+#else
+        _lex( pcb );
+#endif /* !0 */
 
-                            /* Value type */
-                            if( ( ( pcb->tos - 4 )->value.value_3 ) )
-                            {
-                                vt = create_vtype( parser, ( ( pcb->tos - 4 )->value.value_3 ) );
+#if 0
 
-                                for( l = ( ( pcb->tos - 5 )->value.value_1 ); l;
-                                    l = list_next( l ) )
-                                {
-                                    s = (SYMBOL*)list_access( l );
-                                    s->vtype = vt;
-                                }
+        if( pcb->sym > -1 && _symbols[ pcb->sym ].whitespace )
+        {
+            UNICC_CLEARIN( pcb );
+            continue;
+        }
 
-                                pfree( ( ( pcb->tos - 4 )->value.value_3 ) );
-                            }
+        break;
+    }
+    while( 1 );
+#endif /* 0 */
 
-                            /* re_dbg_print_nfa( s->nfa_def,
-                                parser->p_universe ); */
+    return ( pcb->sym > -1 ) ? 1 : 0;
+}
 
-                            /* Assign the list of all possible symbols to
-                                the primary symbol */
-                            LISTFOR( ( ( pcb->tos - 5 )->value.value_1 ), l )
-                                plist_push( primary->all_sym,
-                                    list_access( l ) );
+#if UNICC_STACKDEBUG
+UNICC_STATIC void _dbg_stack( FILE* out,
+    _tok* stack, _tok* tos )
+{
+    fprintf( out, "%s: Stack Dump: ", UNICC_PARSER );
 
-                            current_sym = (SYMBOL*)NULL;
-                            ;
-                    }
-                    break;
-                case 56:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 57:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 58:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 59:
-                    {
-                     pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 60:
-                    {
-                    #line 563 "src/parse.par"
- greedy = TRUE;     ;
-                    }
-                    break;
-                case 61:
-                    {
-                    #line 565 "src/parse.par"
- greedy = FALSE;     ;
-                    }
-                    break;
-                case 62:
-                    {
-                    #line 569 "src/parse.par"
- pcb->ret.value_0 = TRUE;     ;
-                    }
-                    break;
-                case 63:
-                    {
-                    #line 571 "src/parse.par"
- pcb->ret.value_0 = FALSE;     ;
-                    }
-                    break;
-                case 64:
-                    {
-                    #line 575 "src/parse.par"
- pcb->ret.value_1 = list_push( ( ( pcb->tos - 2 )->value.value_1 ), ( ( pcb->tos - 0 )->value.value_4 ) );     ;
-                    }
-                    break;
-                case 65:
-                    {
-                    #line 578 "src/parse.par"
- pcb->ret.value_1 = list_push( (LIST*)NULL, ( ( pcb->tos - 0 )->value.value_4 ) );     ;
-                    }
-                    break;
-                case 66:
-                    {
-                    #line 582 "src/parse.par"
- pcb->ret.value_3 = pstrdup( strbuf );     ;
-                    }
-                    break;
-                case 67:
-                    {
-                    #line 584 "src/parse.par"
- pcb->ret.value_3 = pstrdup( strbuf );     ;
-                    }
-                    break;
-                case 68:
-                    {
-                    #line 586 "src/parse.par"
- pcb->ret.value_3 = (char*)NULL;     ;
-                    }
-                    break;
-                case 69:
-                    {
-                    #line 592 "src/parse.par"
+    for( ; stack <= tos; stack++ )
+    {
+        fprintf( out, "%d%s%s%s ", stack->state,
+            stack->symbol ? " (" : "",
+            stack->symbol ? stack->symbol->name : "",
+            stack->symbol ? ")" : "" );
+    }
 
-                            ( ( pcb->tos - 3 )->value.value_4 )->line = ( ( pcb->tos - 4 )->value.value_5 );
+    fprintf( out, "\n" );
+}
+#endif /* UNICC_STACKDEBUG */
 
-                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
-                            {
-                                ( ( pcb->tos - 3 )->value.value_4 )->code = ( ( pcb->tos - 2 )->value.value_3 );
-                                ( ( pcb->tos - 3 )->value.value_4 )->code_at = last_code_begin;
-                            }
+UNICC_STATIC int _handle_error( _pcb* pcb, FILE* _dbg )
+{
+#if UNICC_DEBUG
+    int					i;
+#if 0
+    int					j;
+#endif
+#endif
 
-                            ( ( pcb->tos - 3 )->value.value_4 )->emit = ( ( pcb->tos - 1 )->value.value_3 );
+    if( !pcb->error_delay )
+    {
+#if UNICC_DEBUG
+        fprintf( _dbg, "%s: !!!PARSE ERROR!!!\n"
+                "%s: error recovery: current token %d (%s)\n",
+                    UNICC_PARSER, UNICC_PARSER, pcb->sym,
+                        ( ( pcb->sym >= 0 ) ?
+                            _symbols[ pcb->sym ].name :
+                                "(null)" ) );
 
-                            pcb->ret.value_4 = ( ( pcb->tos - 3 )->value.value_4 );
+        fprintf( _dbg,
+                "%s: error recovery: expecting ", UNICC_PARSER );
 
-                            current_prod = (PROD*)NULL;
-                            ;
-                    }
-                    break;
-                case 70:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 71:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 72:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
-                    }
-                    break;
-                case 73:
-                    {
-                     pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 74:
-                    {
-                     pcb->ret.value_4 = ( ( pcb->tos - 0 )->value.value_4 );     ;
-                    }
-                    break;
-                case 75:
-                    {
-                    #line 610 "src/parse.par"
+#if 0
+        for( i = 0; i < 207; i++ )
+        {
+            j = _act_base[ pcb->tos->state ] + i;
 
-                            pcb->ret.value_4 = current_prod = create_production( parser,
-                                    (SYMBOL*)NULL );
-                            ;
-                    }
-                    break;
-                case 76:
-                    {
-                    #line 618 "src/parse.par"
-    current_prod->prec = ( ( pcb->tos - 0 )->value.value_2 )->prec;     ;
-                    }
-                    break;
-                case 77:
-                    {
-                    #line 624 "src/parse.par"
-    append_to_production( ( ( pcb->tos - 2 )->value.value_4 ), ( ( pcb->tos - 1 )->value.value_2 ),
-                                ( *strbuf == '\0' ? (char*)NULL :
-                                            pstrdup( strbuf ) ) );
-                                    pcb->ret.value_4 = ( ( pcb->tos - 2 )->value.value_4 );
-                            ;
-                    }
-                    break;
-                case 78:
-                    {
-                    #line 632 "src/parse.par"
-    pcb->ret.value_4 = current_prod =
-                                create_production( parser,
-                                    (SYMBOL*)NULL );
+            if( j >= 0 && j < 0
+                    && _act_check[ j ] == pcb->tos->state )
+                fprintf( _dbg, "%d (%s), ",
+                    i, _symbols[ i ].name );
+        }
+#else
+        for( i = 1; i < _act[ pcb->tos->state ][0] * 3; i += 3 )
+        {
+            fprintf( _dbg, "%d (%s)%s",
+                _act[ pcb->tos->state ][i],
+                _symbols[ _act[ pcb->tos->state ][i] ].name,
+                ( i == _act[ pcb->tos->state ][0] * 3 - 3 ) ?
+                        "\n" : ", " );
+        }
+#endif
 
-                            append_to_production( pcb->ret.value_4, ( ( pcb->tos - 1 )->value.value_2 ),
-                                ( *strbuf == '\0' ? (char*)NULL :
-                                    pstrdup( strbuf ) ) );
-                            ;
-                    }
-                    break;
-                case 79:
-                    {
-                    #line 644 "src/parse.par"
+        fprintf( _dbg, "\n%s: error recovery: error_delay is %d, %s\n",
+                    UNICC_PARSER, pcb->error_delay,
+                    ( pcb->error_delay ? "error recovery runs silently" :
+                        "error is reported before its recover!" ) );
+#endif
+    }
 
-                            switch( ( ( pcb->tos - 0 )->value.value_5 ) )
-                            {
-                                case '*':
-                                    pcb->ret.value_2 = kleene_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
-                                    break;
-                                case '+':
-                                    pcb->ret.value_2 = positive_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
-                                    break;
-                                case '?':
-                                    pcb->ret.value_2 = optional_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
-                                    break;
-                                default:
-                                    pcb->ret.value_2 = ( ( pcb->tos - 1 )->value.value_2 );
-                                    break;
-                            }
-                            ;
-                    }
-                    break;
-                case 80:
-                    {
-                    #line 664 "src/parse.par"
-    pcb->ret.value_2 = get_symbol( parser,
-                                    P_ERROR_RESYNC, SYM_SYSTEM_TERMINAL,
-                                        TRUE );
-                            ;
-                    }
-                    break;
-                case 81:
-                    {
-                    #line 671 "src/parse.par"
-    pcb->ret.value_2 = get_symbol( parser,
-                                    P_END_OF_FILE, SYM_SYSTEM_TERMINAL,
-                                        TRUE );
-                            ;
-                    }
-                    break;
-                case 82:
-                    {
-                     pcb->ret.value_2 = ( ( pcb->tos - 0 )->value.value_2 );     ;
-                    }
-                    break;
-                case 83:
-                    {
-                    #line 681 "src/parse.par"
-    pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_NON_TERMINAL, TRUE );
-                            pcb->ret.value_2->used = TRUE;
+#if -1 < 0
+    /* No error token defined? Then exit here... */
 
-                            if( pcb->ret.value_2->line < 0 )
-                                pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 84:
-                    {
-                    #line 692 "src/parse.par"
+#if UNICC_DEBUG
+    fprintf( _dbg,
+        "%s: error recovery: No error resync token used by grammar, "
+            "exiting parser.\n", UNICC_PARSER );
+#endif
 
-                            char    temp_nonterm[ ONE_LINE + 1 ];
-                            PROD*    prod;
-                            LIST*    l;
+    UNICC_PARSE_ERROR( pcb );
+    pcb->error_count++;
 
-                            sprintf( temp_nonterm, P_EMBEDDED,
-                                    embedded_count++ );
+    return 1;
+#else
+    /*
+    _pcb 		org_pcb;
+    */
 
-                            pcb->ret.value_2 = get_symbol( parser,
-                                    temp_nonterm, SYM_NON_TERMINAL,
-                                        TRUE );
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->used = TRUE;
-                            pcb->ret.value_2->generated = TRUE;
+#if UNICC_DEBUG
+    fprintf( _dbg, "%s: error recovery: "
+        "trying to recover...\n", UNICC_PARSER );
+#if UNICC_STACKDEBUG
+    _dbg_stack( _dbg, pcb->stack, pcb->tos );
+#endif
+#endif
 
-                            /* Value type */
-                            if( ( ( pcb->tos - 4 )->value.value_3 ) )
-                            {
-                                VTYPE*    vt;
+    #if 0
+    /* Create a copy of original parser control block (maybe later...) */
+    memcpy( &org_pcb, pcb, sizeof( _pcb ) );
+    org_pcb.buf = (char*)malloc( ( strlen( pcb->buf ) / UNICC_MALLOCSTEP +
+                    ( !( strlen( pcb->buf ) % UNICC_MALLOCSTEP ) ? 1 : 0 ) )
+                            * UNICC_MALLOCSTEP );
+    strcpy( org_pcb.buf, pcb->buf );
+    #endif
 
-                                vt = create_vtype( parser,
-                                        (char*)( ( pcb->tos - 4 )->value.value_3 ) );
-                                pcb->ret.value_2->vtype = vt;
+    /* Remember previous symbol, or discard it */
+    if( pcb->error_delay != UNICC_ERROR_DELAY )
+        pcb->old_sym = pcb->sym;
+    else
+    {
+        pcb->old_sym = -1;
+        pcb->len = 1;
+        UNICC_CLEARIN( pcb );
+    }
 
-                                pfree( ( ( pcb->tos - 4 )->value.value_3 ) );
-                            }
+    /* Try to shift on error resync */
+    pcb->sym = -1;
 
-                            /* Associate the productions */
-                            current_prod = ( ( pcb->tos - 2 )->value.value_4 );
+    while( pcb->tos >= pcb->stack )
+    {
+#if UNICC_DEBUG
+        fprintf( _dbg, "%s: error recovery: in state %d, trying "
+                "to shift error resync token...\n",
+                    UNICC_PARSER, pcb->tos->state );
+#if UNICC_STACKDEBUG
+        _dbg_stack( _dbg, pcb->stack, pcb->tos );
+#endif
+#endif
+        if( _get_act( pcb ) )
+        {
+            /* Shift */
+            if( pcb->act & UNICC_SHIFT )
+            {
+#if UNICC_DEBUG
+                fprintf( _dbg, "%s: error recovery: "
+                            "error resync shifted\n", UNICC_PARSER );
+#endif
+                break;
+            }
+        }
 
-                            /* Link productions with this left-hand side */
-                            for( l = ( ( pcb->tos - 1 )->value.value_1 ); l; l = list_next( l ) )
-                            {
-                                prod = (PROD*)list_access( l );
+#if UNICC_DEBUG
+        fprintf( _dbg, "%s: error recovery: failed, "
+                    "discarding token '%s'\n", UNICC_PARSER,
+                        pcb->tos->symbol ?
+                            pcb->tos->symbol->name : "NULL" );
+#endif
 
-                                prod->lhs = pcb->ret.value_2;
-                                plist_push( pcb->ret.value_2->productions, prod );
-                                plist_push( prod->all_lhs, pcb->ret.value_2 );
-                                make_semantic_rhs( prod );
-                            }
-                            ;
-                    }
-                    break;
-                case 85:
-                    {
-                    #line 736 "src/parse.par"
-     pcb->ret.value_4 = current_prod;
-                            current_prod = (PROD*)NULL;
-                            ;
-                    }
-                    break;
-                case 86:
-                    {
-                    #line 743 "src/parse.par"
+        /* Discard one token from stack */
+        /* TODO: Discarded token memory (semantic action) */
+        pcb->tos--;
+    }
 
-                            pccl*        ccl;
+    if( pcb->tos <= pcb->stack )
+    {
+#if UNICC_DEBUG
+    fprintf( _dbg, "%s: error recovery: "
+                "Can't recover this issue, stack is empty.\n",
+                    UNICC_PARSER );
+#endif
+        UNICC_PARSE_ERROR( pcb );
+        pcb->error_count++;
 
-                            ccl = pccl_create( -1, -1, strbuf );
-                            if( ( ( pcb->tos - 0 )->value.value_0 ) )
-                                pccl_negate( ccl );
+        return 1;
+    }
 
-                            pcb->ret.value_2 = get_symbol( parser, (void*)ccl,
-                                    SYM_CCL_TERMINAL, TRUE );
+#if UNICC_DEBUG
+    fprintf( _dbg, "%s: error recovery: "
+                "trying to continue with modified parser state\n",
+                    UNICC_PARSER );
+#endif
 
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->used = TRUE;
+    pcb->error_delay = UNICC_ERROR_DELAY + 1;
 
-                            if( pcb->ret.value_2->line < 0 )
-                                pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 87:
-                    {
-                    #line 762 "src/parse.par"
+    return 0;
 
-                            pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
+#endif /* -1 >= 0 */
+}
 
-                            pcb->ret.value_2->used = TRUE;
-                            pcb->ret.value_2->defined = TRUE;
-                            pcb->ret.value_2->keyword = TRUE;
-                            pcb->ret.value_2->emit = ( ( pcb->tos - 0 )->value.value_0 ) ? pstrdup( strbuf ) : NULL;
+int _parse( _pcb* pcb )
+{
+    int			ret;
+    int					i;
 
-                            pcb->ret.value_2->ptn = pregex_ptn_create_string( strbuf,
-                                        parser->p_cis_strings ?
-                                            PREGEX_COMP_INSENSITIVE : 0 );
+    _ast*		node;
+    _ast*		lnode;
 
-                            if( pcb->ret.value_2->line < 0 )
-                                pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 88:
-                    {
-                    #line 781 "src/parse.par"
-    pcb->ret.value_2 = get_symbol( parser,
-                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
+#if UNICC_DEBUG
+    _vtype*		vptr;
+    FILE* 				_dbg;
 
-                            /* pcb->ret.value_2->defined = TRUE;
-                            DO NOT SET DEFINED! */
-                            pcb->ret.value_2->used = TRUE;
+    _dbg = stderr;
+#endif
 
-                            if( pcb->ret.value_2->line < 0 )
-                                pcb->ret.value_2->line = pcb->line;
-                            ;
-                    }
-                    break;
-                case 89:
-                    {
-                    #line 794 "src/parse.par"
-  pcb->ret.value_5 = (int)'*';     ;
-                    }
-                    break;
-                case 90:
-                    {
-                    #line 797 "src/parse.par"
- pcb->ret.value_5 = (int)'+';     ;
-                    }
-                    break;
-                case 91:
-                    {
-                    #line 800 "src/parse.par"
- pcb->ret.value_5 = (int)'?';     ;
-                    }
-                    break;
-                case 92:
-                    {
-                    #line 803 "src/parse.par"
- pcb->ret.value_5 = 0;     ;
-                    }
-                    break;
-                case 93:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 94:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
-                    }
-                    break;
-                case 95:
-                    {
-                    #line 809 "src/parse.par"
- reset_strbuf();     ;
-                    }
-                    break;
-                case 96:
-                    {
-                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
-                    }
-                    break;
-                case 97:
-                    {
-                    #line 818 "src/parse.par"
+    /* If there is no Parser Control Block given, allocate your own one! */
+    if( !pcb )
+    {
+        if( !( pcb = (_pcb*)malloc( sizeof( _pcb ) ) ) )
+        {
+            /* Can't allocate memory */
+            UNICC_OUTOFMEM( pcb );
+            return (int)0;
+        }
 
-                            pcb->ret.value_6 = pregex_ptn_create_alt(
-                                    ( ( pcb->tos - 2 )->value.value_6 ), ( ( pcb->tos - 0 )->value.value_6 ), (pregex_ptn*)NULL );
-                            ;
-                    }
-                    break;
-                case 98:
-                    {
-                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
-                    }
-                    break;
-                case 99:
-                    {
-                    #line 829 "src/parse.par"
+        memset( pcb, 0, sizeof( _pcb ) );
+        pcb->is_internal = 1;
+    }
+    else
+        pcb->is_internal = 0;
 
-                            pcb->ret.value_6 = pregex_ptn_create_seq(
-                                    ( ( pcb->tos - 1 )->value.value_6 ), ( ( pcb->tos - 0 )->value.value_6 ), (pregex_ptn*)NULL );
-                            ;
-                    }
-                    break;
-                case 100:
-                    {
-                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
-                    }
-                    break;
-                case 101:
-                    {
-                    #line 841 "src/parse.par"
+    /* Initialize Parser Control Block */
+    pcb->stacksize = 0;
+    if( _alloc_stack( pcb ) < 0 )
+        return (int)0;
 
-                            pcb->ret.value_6 = pregex_ptn_create_kle( ( ( pcb->tos - 1 )->value.value_6 ) );
-                            ;
-                    }
-                    break;
-                case 102:
-                    {
-                    #line 847 "src/parse.par"
+    memset( pcb->tos, 0, sizeof( _tok ) );
 
-                            pcb->ret.value_6 = pregex_ptn_create_pos( ( ( pcb->tos - 1 )->value.value_6 ) );
-                            ;
-                    }
-                    break;
-                case 103:
-                    {
-                    #line 853 "src/parse.par"
+    pcb->act = UNICC_SHIFT;
+    pcb->sym = -1;
+    pcb->old_sym = -1;
+    pcb->line = 1;
+    pcb->column = 1;
 
-                            pcb->ret.value_6 = pregex_ptn_create_opt( ( ( pcb->tos - 1 )->value.value_6 ) );
-                            ;
-                    }
-                    break;
-                case 104:
-                    {
-                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
-                    }
-                    break;
-                case 105:
-                    {
-                    #line 863 "src/parse.par"
+    memset( &pcb->test, 0, sizeof( _vtype ) );
 
-                        pccl*        ccl;
+    /* Begin of main parser loop */
+    while( 1 )
+    {
+        /* Reduce */
+        while( pcb->act & UNICC_REDUCE )
+        {
+#if UNICC_DEBUG
+            fprintf( _dbg, "%s: << "
+                    "reducing by production %d (%s)\n",
+                        UNICC_PARSER, pcb->idx,
+                            _productions[ pcb->idx ].definition );
+#endif
+            /* Set default left-hand side */
+            pcb->lhs = _productions[ pcb->idx ].lhs;
 
-                        ccl = pccl_create( -1, -1, strbuf );
-                        if( ( ( pcb->tos - 0 )->value.value_0 ) )
-                            pccl_negate( ccl );
+            /* Run reduction code */
+            memset( &( pcb->ret ), 0, sizeof( _vtype ) );
 
-                        pcb->ret.value_6 = pregex_ptn_create_char( ccl );
-                        ;
+            switch( pcb->idx )
+            {
+            case 0:
+                    {
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 106:
+                case 1:
                     {
-                    #line 875 "src/parse.par"
-
-                        pcb->ret.value_6 = pregex_ptn_create_string( strbuf, 0 );
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 107:
+                case 2:
                     {
-                    #line 881 "src/parse.par"
-
-                        pccl*    ccl;
-                        greedy = FALSE;
-
-                        ccl = pccl_create( -1, -1, (char*)NULL );
-
-                        pccl_addrange( ccl, PCCL_MIN, PCCL_MAX );
-
-                        pcb->ret.value_6 = pregex_ptn_create_char( ccl );
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 108:
+                case 3:
                     {
-                    #line 894 "src/parse.par"
-
-                        pcb->ret.value_6 = pregex_ptn_create_sub( ( ( pcb->tos - 1 )->value.value_6 ) );
-                        ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 109:
+                case 4:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 110:
+                case 5:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 111:
+                case 6:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 112:
+                case 7:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 113:
-                    {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_0 );     ;
-                    }
-                    break;
-                case 114:
+                case 8:
                     {
-                    #line 908 "src/parse.par"
-    pcb->ret.value_0 = FALSE;     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 115:
+                case 9:
                     {
-                    #line 912 "src/parse.par"
-    pcb->ret.value_0 = TRUE;     ;
+                        ;
                     }
                     break;
-                case 116:
+                case 10:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 2 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 117:
+                case 11:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 118:
+                case 12:
                     {
-                    #line 921 "src/parse.par"
-  reset_strbuf();     ;
+                    #line 132 "src/parse.par"
+
+                            if( !( parser->p_template ) )
+                                parser->p_template = pstrdup( strbuf );
+                            else if( !pcb->main )
+                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "!language" );
+                            ;
                     }
                     break;
-                case 119:
+                case 13:
                     {
-                    #line 925 "src/parse.par"
-  strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 160 "src/parse.par"
+ parser->p_mode = MODE_SCANNERLESS;     ;
                     }
                     break;
-                case 120:
+                case 14:
                     {
-                    #line 928 "src/parse.par"
-
-                        strbuf_append( (char)'\\' );
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                    #line 162 "src/parse.par"
+ parser->p_mode = MODE_SCANNER;     ;
                     }
                     break;
-                case 121:
+                case 15:
                     {
-                    #line 934 "src/parse.par"
- pcb->ret.value_0 = TRUE     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 122:
+                case 16:
                     {
-                    #line 935 "src/parse.par"
- pcb->ret.value_0 = FALSE     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 123:
+                case 17:
                     {
-                    #line 939 "src/parse.par"
- strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 124:
+                case 18:
                     {
-                    #line 940 "src/parse.par"
-    reset_strbuf();     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 125:
+                case 19:
                     {
-                    #line 944 "src/parse.par"
-     strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 174 "src/parse.par"
+
+                            LIST* l;
+                            SYMBOL* s;
+
+                            for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
+                            {
+                                s = l->pptr;
+
+                                /* Do not allow nonterminal definitions here
+                                    in conext-free model */
+                                if( s->type == SYM_NON_TERMINAL &&
+                                    parser->p_mode !=
+                                        MODE_SCANNERLESS )
+                                {
+                                    print_error( parser, ERR_NONTERM_WS_NOT_ALLOWED,
+                                        ERRSTYLE_FATAL | ERRSTYLE_FILEINFO,
+                                                pcb->filename, pcb->line,
+                                                    s->name );
+                                }
+                                else
+                                    s->whitespace = TRUE;
+                            }
+
+                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
+                            ;
                     }
                     break;
-                case 126:
+                case 20:
                     {
-                    #line 947 "src/parse.par"
-     strbuf_append( (char)'\\' );
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                    #line 201 "src/parse.par"
+
+                            LIST* l;
+                            SYMBOL* s;
+
+
+                            /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line, "lexeme" );
+                            }
+                            else
+                            {
+                                for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
+                                {
+                                    s = l->pptr;
+                                    s->lexem = TRUE;
+                                }
+                            }
+
+                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
+                            ;
                     }
                     break;
-                case 127:
+                case 21:
                     {
-                    #line 953 "src/parse.par"
- pcb->ret.value_3 = pstrdup( strbuf );     ;
+                    #line 227 "src/parse.par"
+
+                            LIST* l;
+                            SYMBOL* s;
+
+                            /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line, "fixate" );
+                            }
+                            else
+                            {
+                                for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
+                                {
+                                    s = l->pptr;
+                                    s->fixated = TRUE;
+                                }
+                            }
+
+                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
+                            ;
                     }
                     break;
-                case 128:
+                case 22:
                     {
-                    #line 954 "src/parse.par"
- pcb->ret.value_3 = (char*)NULL;     ;
+                    #line 252 "src/parse.par"
+ set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_LEFT );     ;
                     }
                     break;
-                case 129:
+                case 23:
                     {
-                    #line 958 "src/parse.par"
- strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 256 "src/parse.par"
+ set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_RIGHT );     ;
                     }
                     break;
-                case 130:
+                case 24:
                     {
-                    #line 959 "src/parse.par"
- reset_strbuf();     ;
+                    #line 260 "src/parse.par"
+ set_assoc_and_prec( ( ( pcb->tos - 0 )->value.value_1 ), ASSOC_NOASSOC );     ;
                     }
                     break;
-                case 131:
+                case 25:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 263 "src/parse.par"
+ parser->p_prefix = pstrcatstr(
+                            parser->p_prefix, strbuf, FALSE );     ;
                     }
                     break;
-                case 132:
+                case 26:
                     {
-                    #line 966 "src/parse.par"
-
-                        reset_strbuf();
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                    #line 267 "src/parse.par"
+  if( !( parser->p_def_action ) )
+                                parser->p_def_action = pstrdup( strbuf );
+                            else
+                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "default epsilon action" );
+                            ;
                     }
                     break;
-                case 133:
+                case 27:
                     {
-                    #line 974 "src/parse.par"
- strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 277 "src/parse.par"
+    if( !( parser->p_def_action_e ) )
+                                parser->p_def_action_e = pstrdup( strbuf );
+                            else
+                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "default epsilon action" );
+                            ;
                     }
                     break;
-                case 134:
+                case 28:
                     {
-                     pcb->ret.value_5 = 0;     ;
+                    #line 287 "src/parse.par"
+    if( !( parser->p_def_type ) )
+                                parser->p_def_type = create_vtype(
+                                    parser, (char*)( ( pcb->tos - 0 )->value.value_3 ) );
+                            else
+                                print_error( parser, ERR_DIRECTIVE_ALREADY_USED,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "default value type" );
+
+                            pfree( ( ( pcb->tos - 0 )->value.value_3 ) );
+                            ;
                     }
                     break;
-                case 135:
+                case 29:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 300 "src/parse.par"
+    /* Ouput a warning, if this definition
+                                is effectless */
+                            if( parser->p_mode != MODE_SCANNERLESS )
+                            {
+                                print_error( parser, ERR_NO_EFFECT_IN_MODE,
+                                    ERRSTYLE_WARNING | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            "lexem separation" );
+                            }
+                            else
+                                parser->p_lexem_sep = !( ( pcb->tos - 0 )->value.value_0 );
+                            ;
                     }
                     break;
-                case 136:
+                case 30:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 314 "src/parse.par"
+    parser->p_cis_strings = !( ( pcb->tos - 0 )->value.value_0 );        ;
                     }
                     break;
-                case 137:
+                case 31:
                     {
-                    #line 986 "src/parse.par"
- strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
+                    #line 317 "src/parse.par"
+    parser->p_reserve_regex = !( ( pcb->tos - 0 )->value.value_0 );            ;
                     }
                     break;
-                case 138:
+                case 32:
                     {
-                    #line 988 "src/parse.par"
-
-                        reset_strbuf();
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                    #line 320 "src/parse.par"
+    parser->p_compressed = !( ( pcb->tos - 0 )->value.value_0 );        ;
                     }
                     break;
-                case 139:
+                case 33:
                     {
-                    #line 996 "src/parse.par"
-
-                        pcb->ret.value_3 = pstrdup( ( ( pcb->tos - 0 )->value.value_3 ) );
-                        reset_strbuf();
-                        ;
+                    #line 323 "src/parse.par"
+    parser->p_header = pstrcatstr(
+                                parser->p_header, strbuf, FALSE );        ;
                     }
                     break;
-                case 140:
+                case 34:
                     {
-                    #line 1003 "src/parse.par"
-    pcb->ret.value_3 = strbuf;     ;
+                    #line 327 "src/parse.par"
+    parser->p_footer = pstrcatstr(
+                                parser->p_footer, strbuf, FALSE );        ;
                     }
                     break;
-                case 141:
+                case 35:
                     {
-                    #line 1005 "src/parse.par"
-
-                        reset_strbuf();
-                        pcb->ret.value_3 = (char*)NULL;
-                        ;
+                    #line 330 "src/parse.par"
+    parser->p_pcb = pstrcatstr(
+                                parser->p_pcb, strbuf, FALSE );        ;
                     }
                     break;
-                case 142:
+                case 36:
                     {
-                    #line 1012 "src/parse.par"
+                    #line 335 "src/parse.par"
 
-                        if( !parser->p_template )
-                        {
-                            print_error( parser,
-                                ERR_NO_TARGET_TPL_SUPPLY,
-                                    ERRSTYLE_WARNING | ERRSTYLE_IMPORTANT
-                                            | ERRSTYLE_FILEINFO,
-                                        pcb->filename, last_code_begin );
+                            char*    src;
+                            char*    filename = strbuf;
 
-                            reset_strbuf();
-                        }
-                        ;
+                            strbuf = NULL;
+
+                            if( !pfiletostr( &src, filename ) )
+                            {
+                                print_error( parser, ERR_OPEN_INPUT_FILE,
+                                                ERRSTYLE_FATAL, filename );
+                            }
+                            else
+                            {
+                                parse_grammar( parser, filename, src );
+                                strbuf = NULL;
+                                pfree( src );
+                            }
+
+                            pfree( filename );
+                            ;
                     }
                     break;
-                case 143:
+                case 37:
                     {
-                    #line 1027 "src/parse.par"
- last_code_begin = pcb->line;     ;
+                     pcb->ret.value_0 = ( ( pcb->tos - 0 )->value.value_0 );     ;
                     }
                     break;
-                case 144:
+                case 38:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 359 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 145:
+                case 39:
                     {
-                    #line 1031 "src/parse.par"
-    reset_strbuf();     ;
+                    #line 362 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 146:
+                case 40:
                     {
-                    #line 1035 "src/parse.par"
-    strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );            ;
+                    #line 363 "src/parse.par"
+ pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 147:
+                case 41:
                     {
-                    #line 1038 "src/parse.par"
-
-                        reset_strbuf();
-                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
-                        ;
+                    #line 367 "src/parse.par"
+ pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ), (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
                     }
                     break;
-                case 151:
+                case 42:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 369 "src/parse.par"
+ pcb->ret.value_1 = list_push( (LIST*)NULL, (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
                     }
                     break;
-                case 152:
+                case 43:
                     {
-                     pcb->ret.value_5 = 0;     ;
+                    #line 373 "src/parse.par"
+  pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_NON_TERMINAL, TRUE );
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 154:
+                case 44:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 381 "src/parse.par"
+ pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ), (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
                     }
                     break;
-                case 155:
+                case 45:
                     {
-                     pcb->ret.value_5 = 0;     ;
+                    #line 383 "src/parse.par"
+ pcb->ret.value_1 = list_push( (LIST*)NULL, (void*)( ( pcb->tos - 0 )->value.value_2 ) );     ;
                     }
                     break;
-                case 158:
+                case 46:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 387 "src/parse.par"
+  pcb->ret.value_1 = list_push( ( ( pcb->tos - 1 )->value.value_1 ),
+                                    (void*)( ( pcb->tos - 0 )->value.value_2 ) );
+                            ( ( pcb->tos - 0 )->value.value_2 )->derived_from =
+                                (SYMBOL*)list_access( ( ( pcb->tos - 1 )->value.value_1 ) );
+                            ;
                     }
                     break;
-                case 159:
+                case 47:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 393 "src/parse.par"
+  pcb->ret.value_1 = list_push( (LIST*)NULL,
+                                    (void*)( ( pcb->tos - 0 )->value.value_2 ) );
+
+                            current_sym = ( ( pcb->tos - 0 )->value.value_2 );
+                            ;
                     }
                     break;
-                case 160:
+                case 48:
                     {
-                    #line 1057 "src/parse.par"
+                    #line 401 "src/parse.par"
+  pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
 
-                        pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );
-                        ;
+                            if( pcb->ret.value_2->defined )
+                            {
+                                print_error( parser, ERR_DOUBLE_TERMINAL_DEF,
+                                    ERRSTYLE_FATAL | ERRSTYLE_FILEINFO,
+                                        pcb->filename, pcb->line,
+                                            pcb->ret.value_2->name );
+                            }
+
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 161:
+                case 49:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 417 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 162:
+                case 50:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 418 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 163:
+                case 51:
                     {
-                    #line 1066 "src/parse.par"
- pcb->ret.value_5 = pcb->line;     ;
+                    #line 419 "src/parse.par"
+ pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 164:
+                case 52:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 420 "src/parse.par"
+ pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 170:
+                case 53:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 428 "src/parse.par"
+
+                            LIST*     l;
+                            LIST*    m;
+                            PROD*     p;
+                            SYMBOL*    lhs;
+                            VTYPE*    vt        = (VTYPE*)NULL;
+
+                            ( ( pcb->tos - 3 )->value.value_1 ) = list_push( ( ( pcb->tos - 3 )->value.value_1 ), (void*)( ( pcb->tos - 5 )->value.value_2 ) );
+
+                            /* Value type */
+                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
+                            {
+                                vt = create_vtype( parser,
+                                        (char*)( ( pcb->tos - 2 )->value.value_3 ) );
+
+                                pfree( ( ( pcb->tos - 2 )->value.value_3 ) );
+                            }
+
+                            /* Connect left-hand sides */
+                            for( l = ( ( pcb->tos - 3 )->value.value_1 ); l; l = list_next( l ) )
+                            {
+                                lhs = (SYMBOL*)list_access( l );
+
+                                LISTFOR( ( ( pcb->tos - 0 )->value.value_1 ), m )
+                                    plist_push( lhs->productions,
+                                        list_access( m ) );
+
+                                lhs->vtype = vt;
+                            }
+
+                            /* Link productions with this left-hand sides */
+                            for( l = ( ( pcb->tos - 0 )->value.value_1 ); l; l = l->next )
+                            {
+                                LIST* m;
+
+                                p = (PROD*)list_access( l );
+
+                                p->lhs = ( ( pcb->tos - 5 )->value.value_2 );
+
+                                LISTFOR( ( ( pcb->tos - 3 )->value.value_1 ), m )
+                                    plist_push( p->all_lhs, list_access( m ) );
+
+                                /* AST */
+                                if( ( ( pcb->tos - 1 )->value.value_0 ) && !p->emit )
+                                    p->emit = pstrdup( ( ( pcb->tos - 5 )->value.value_2 )->name );
+                            }
+
+                            list_free( ( ( pcb->tos - 0 )->value.value_1 ) );
+                            list_free( ( ( pcb->tos - 3 )->value.value_1 ) );
+
+                            /* Goal primary defined? */
+                            if( ( ( pcb->tos - 4 )->value.value_0 ) && pcb->main )
+                            {
+                                if( parser->goal )
+                                {
+                                    print_error( parser, ERR_MULTIPLE_GOAL_DEF,
+                                        ERRSTYLE_FATAL,
+                                            parser->goal->name );
+                                }
+                                else
+                                {
+                                    parser->goal = ( ( pcb->tos - 5 )->value.value_2 );
+                                    parser->goal->used = TRUE;
+                                }
+                            }
+                            ;
                     }
                     break;
-                case 171:
+                case 54:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_1 = ( ( pcb->tos - 0 )->value.value_1 );     ;
+                    }
+                    break;
+                case 55:
+                    {
+                     pcb->ret.value_1 = 0;     ;
+                    }
+                    break;
+                case 56:
+                    {
+                    #line 498 "src/parse.par"
+
+                            SYMBOL* primary;
+                            SYMBOL* s;
+                            LIST* l;
+                            VTYPE* vt;
+
+                            primary = (SYMBOL*)list_access( ( ( pcb->tos - 5 )->value.value_1 ) );
+
+                            primary->ptn = ( ( pcb->tos - 3 )->value.value_6 );
+                            primary->greedy = greedy;
+                            primary->emit = ( ( pcb->tos - 1 )->value.value_3 );
+
+                            greedy = TRUE;
+
+                            /* Attach code */
+                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
+                            {
+                                /* Copy code for every symbol  */
+                                for( l = ( ( pcb->tos - 5 )->value.value_1 ); l;
+                                    l = list_next( l ) )
+                                {
+                                    s = (SYMBOL*)list_access( l );
+
+                                    /*
+                                        Last symbol gets strbuf-pointer,
+                                        all other assignments need to be
+                                        duplicated.
+                                    */
+                                    if( list_next( l ) )
+                                        s->code = pstrdup( strbuf );
+                                    else
+                                        s->code = strbuf;
+
+                                    primary->code_at = last_code_begin;
+                                }
+
+                                strbuf = (char*)NULL;
+                            }
+
+                            /* Value type */
+                            if( ( ( pcb->tos - 4 )->value.value_3 ) )
+                            {
+                                vt = create_vtype( parser, ( ( pcb->tos - 4 )->value.value_3 ) );
+
+                                for( l = ( ( pcb->tos - 5 )->value.value_1 ); l;
+                                    l = list_next( l ) )
+                                {
+                                    s = (SYMBOL*)list_access( l );
+                                    s->vtype = vt;
+                                }
+
+                                pfree( ( ( pcb->tos - 4 )->value.value_3 ) );
+                            }
+
+                            /* re_dbg_print_nfa( s->nfa_def,
+                                parser->p_universe ); */
+
+                            /* Assign the list of all possible symbols to
+                                the primary symbol */
+                            LISTFOR( ( ( pcb->tos - 5 )->value.value_1 ), l )
+                                plist_push( primary->all_sym,
+                                    list_access( l ) );
+
+                            current_sym = (SYMBOL*)NULL;
+                            ;
                     }
                     break;
-                case 172:
+                case 57:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 173:
-                    {
-                        ;
-                    }
-                    break;
-                case 174:
-                    {
-                        ;
-                    }
-                    break;
-                case 175:
-                    {
-                        ;
-                    }
-                    break;
-                case 176:
-                    {
-                        ;
-                    }
-                    break;
-                case 177:
-                    {
-                        ;
-                    }
-                    break;
-                case 178:
-                    {
-                        ;
-                    }
-                    break;
-                case 179:
-                    {
-                        ;
-                    }
-                    break;
-                case 180:
+                case 58:
                     {
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 181:
+                case 59:
                     {
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 182:
+                case 60:
                     {
-                        ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 183:
+                case 61:
                     {
-                     pcb->ret.value_3 = ( ( pcb->tos - 1 )->value.value_3 );     ;
+                    #line 566 "src/parse.par"
+ greedy = TRUE;     ;
                     }
                     break;
-                case 184:
+                case 62:
                     {
-                        ;
+                    #line 568 "src/parse.par"
+ greedy = FALSE;     ;
                     }
                     break;
-                case 185:
+                case 63:
                     {
-                        ;
+                    #line 572 "src/parse.par"
+ pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 186:
+                case 64:
                     {
-                        ;
+                    #line 574 "src/parse.par"
+ pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 187:
+                case 65:
                     {
-                        ;
+                    #line 578 "src/parse.par"
+ pcb->ret.value_1 = list_push( ( ( pcb->tos - 2 )->value.value_1 ), ( ( pcb->tos - 0 )->value.value_4 ) );     ;
                     }
                     break;
-                case 188:
+                case 66:
                     {
-                        ;
+                    #line 581 "src/parse.par"
+ pcb->ret.value_1 = list_push( (LIST*)NULL, ( ( pcb->tos - 0 )->value.value_4 ) );     ;
                     }
                     break;
-                case 189:
+                case 67:
                     {
-                        ;
+                    #line 585 "src/parse.par"
+ pcb->ret.value_3 = pstrdup( strbuf );     ;
                     }
                     break;
-                case 190:
+                case 68:
                     {
-                        ;
+                    #line 587 "src/parse.par"
+ pcb->ret.value_3 = pstrdup( strbuf );     ;
                     }
                     break;
-                case 191:
+                case 69:
                     {
-                        ;
+                    #line 589 "src/parse.par"
+ pcb->ret.value_3 = (char*)NULL;     ;
                     }
                     break;
-                case 192:
+                case 70:
                     {
-                        ;
+                    #line 595 "src/parse.par"
+
+                            ( ( pcb->tos - 3 )->value.value_4 )->line = ( ( pcb->tos - 4 )->value.value_5 );
+
+                            if( ( ( pcb->tos - 2 )->value.value_3 ) )
+                            {
+                                ( ( pcb->tos - 3 )->value.value_4 )->code = ( ( pcb->tos - 2 )->value.value_3 );
+                                ( ( pcb->tos - 3 )->value.value_4 )->code_at = last_code_begin;
+                            }
+
+                            ( ( pcb->tos - 3 )->value.value_4 )->emit = ( ( pcb->tos - 1 )->value.value_3 );
+
+                            pcb->ret.value_4 = ( ( pcb->tos - 3 )->value.value_4 );
+
+                            current_prod = (PROD*)NULL;
+                            ;
                     }
                     break;
-                case 193:
+                case 71:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 194:
-                    {
-                     pcb->ret.value_0 = ( ( pcb->tos - 1 )->value.value_0 );     ;
-                    }
-                    break;
-                case 195:
+                case 72:
                     {
-                     pcb->ret.value_2 = ( ( pcb->tos - 1 )->value.value_2 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 196:
+                case 73:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 197:
+                case 74:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 198:
+                case 75:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_4 = ( ( pcb->tos - 0 )->value.value_4 );     ;
                     }
                     break;
-                case 199:
+                case 76:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 613 "src/parse.par"
+
+                            pcb->ret.value_4 = current_prod = create_production( parser,
+                                    (SYMBOL*)NULL );
+                            ;
                     }
                     break;
-                case 200:
+                case 77:
                     {
-                        ;
+                    #line 621 "src/parse.par"
+    current_prod->prec = ( ( pcb->tos - 0 )->value.value_2 )->prec;     ;
                     }
                     break;
-                case 201:
+                case 78:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 627 "src/parse.par"
+    append_to_production( ( ( pcb->tos - 2 )->value.value_4 ), ( ( pcb->tos - 1 )->value.value_2 ),
+                                ( *strbuf == '\0' ? (char*)NULL :
+                                            pstrdup( strbuf ) ) );
+                                    pcb->ret.value_4 = ( ( pcb->tos - 2 )->value.value_4 );
+                            ;
                     }
                     break;
-                case 202:
+                case 79:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 635 "src/parse.par"
+    pcb->ret.value_4 = current_prod =
+                                create_production( parser,
+                                    (SYMBOL*)NULL );
+
+                            append_to_production( pcb->ret.value_4, ( ( pcb->tos - 1 )->value.value_2 ),
+                                ( *strbuf == '\0' ? (char*)NULL :
+                                    pstrdup( strbuf ) ) );
+                            ;
                     }
                     break;
-                case 203:
+                case 80:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 647 "src/parse.par"
+
+                            switch( ( ( pcb->tos - 0 )->value.value_5 ) )
+                            {
+                                case '*':
+                                    pcb->ret.value_2 = kleene_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
+                                    break;
+                                case '+':
+                                    pcb->ret.value_2 = positive_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
+                                    break;
+                                case '?':
+                                    pcb->ret.value_2 = optional_closure( parser, ( ( pcb->tos - 1 )->value.value_2 ) );
+                                    break;
+                                default:
+                                    pcb->ret.value_2 = ( ( pcb->tos - 1 )->value.value_2 );
+                                    break;
+                            }
+                            ;
                     }
                     break;
-                case 204:
+                case 81:
                     {
-                        ;
+                    #line 667 "src/parse.par"
+    pcb->ret.value_2 = get_symbol( parser,
+                                    P_ERROR_RESYNC, SYM_SYSTEM_TERMINAL,
+                                        TRUE );
+                            ;
                     }
                     break;
-                case 205:
+                case 82:
                     {
-                        ;
+                    #line 674 "src/parse.par"
+    pcb->ret.value_2 = get_symbol( parser,
+                                    P_END_OF_FILE, SYM_SYSTEM_TERMINAL,
+                                        TRUE );
+                            ;
                     }
                     break;
-                case 206:
+                case 83:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_2 = ( ( pcb->tos - 0 )->value.value_2 );     ;
                     }
                     break;
-                case 207:
+                case 84:
                     {
-                        ;
+                    #line 684 "src/parse.par"
+    pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_NON_TERMINAL, TRUE );
+                            pcb->ret.value_2->used = TRUE;
+
+                            if( pcb->ret.value_2->line < 0 )
+                                pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 208:
+                case 85:
                     {
-                        ;
+                    #line 695 "src/parse.par"
+
+                            char    temp_nonterm[ ONE_LINE + 1 ];
+                            PROD*    prod;
+                            LIST*    l;
+
+                            sprintf( temp_nonterm, P_EMBEDDED,
+                                    embedded_count++ );
+
+                            pcb->ret.value_2 = get_symbol( parser,
+                                    temp_nonterm, SYM_NON_TERMINAL,
+                                        TRUE );
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->used = TRUE;
+                            pcb->ret.value_2->generated = TRUE;
+
+                            /* Value type */
+                            if( ( ( pcb->tos - 4 )->value.value_3 ) )
+                            {
+                                VTYPE*    vt;
+
+                                vt = create_vtype( parser,
+                                        (char*)( ( pcb->tos - 4 )->value.value_3 ) );
+                                pcb->ret.value_2->vtype = vt;
+
+                                pfree( ( ( pcb->tos - 4 )->value.value_3 ) );
+                            }
+
+                            /* Associate the productions */
+                            current_prod = ( ( pcb->tos - 2 )->value.value_4 );
+
+                            /* Link productions with this left-hand side */
+                            for( l = ( ( pcb->tos - 1 )->value.value_1 ); l; l = list_next( l ) )
+                            {
+                                prod = (PROD*)list_access( l );
+
+                                prod->lhs = pcb->ret.value_2;
+                                plist_push( pcb->ret.value_2->productions, prod );
+                                plist_push( prod->all_lhs, pcb->ret.value_2 );
+                                make_semantic_rhs( prod );
+                            }
+                            ;
                     }
                     break;
-                case 209:
+                case 86:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 739 "src/parse.par"
+     pcb->ret.value_4 = current_prod;
+                            current_prod = (PROD*)NULL;
+                            ;
                     }
                     break;
-                case 210:
+                case 87:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 746 "src/parse.par"
+
+                            pccl*        ccl;
+
+                            ccl = pccl_create( -1, -1, strbuf );
+                            if( ( ( pcb->tos - 0 )->value.value_0 ) )
+                                pccl_negate( ccl );
+
+                            pcb->ret.value_2 = get_symbol( parser, (void*)ccl,
+                                    SYM_CCL_TERMINAL, TRUE );
+
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->used = TRUE;
+
+                            if( pcb->ret.value_2->line < 0 )
+                                pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 211:
+                case 88:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 765 "src/parse.par"
+
+                            pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
+
+                            pcb->ret.value_2->used = TRUE;
+                            pcb->ret.value_2->defined = TRUE;
+                            pcb->ret.value_2->keyword = TRUE;
+                            pcb->ret.value_2->emit = ( ( pcb->tos - 0 )->value.value_0 ) ? pstrdup( strbuf ) : NULL;
+
+                            pcb->ret.value_2->ptn = pregex_ptn_create_string( strbuf,
+                                        parser->p_cis_strings ?
+                                            PREGEX_COMP_INSENSITIVE : 0 );
+
+                            if( pcb->ret.value_2->line < 0 )
+                                pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 212:
+                case 89:
                     {
-                     pcb->ret.value_0 = ( ( pcb->tos - 1 )->value.value_0 );     ;
+                    #line 784 "src/parse.par"
+    pcb->ret.value_2 = get_symbol( parser,
+                                    strbuf, SYM_REGEX_TERMINAL, TRUE );
+
+                            /* pcb->ret.value_2->defined = TRUE;
+                            DO NOT SET DEFINED! */
+                            pcb->ret.value_2->used = TRUE;
+
+                            if( pcb->ret.value_2->line < 0 )
+                                pcb->ret.value_2->line = pcb->line;
+                            ;
                     }
                     break;
-                case 213:
+                case 90:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                    #line 797 "src/parse.par"
+  pcb->ret.value_5 = (int)'*';     ;
                     }
                     break;
-                case 214:
+                case 91:
                     {
-                        ;
+                    #line 800 "src/parse.par"
+ pcb->ret.value_5 = (int)'+';     ;
                     }
                     break;
-                case 215:
+                case 92:
                     {
-                        ;
+                    #line 803 "src/parse.par"
+ pcb->ret.value_5 = (int)'?';     ;
                     }
                     break;
-                case 216:
+                case 93:
                     {
-                        ;
+                    #line 806 "src/parse.par"
+ pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 217:
+                case 94:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 218:
+                case 95:
                     {
-                        ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 219:
+                case 96:
                     {
-                        ;
+                    #line 812 "src/parse.par"
+ reset_strbuf();     ;
                     }
                     break;
-                case 220:
+                case 97:
                     {
-                        ;
+                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
                     }
                     break;
-                case 221:
+                case 98:
                     {
-                        ;
+                    #line 821 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_alt(
+                                    ( ( pcb->tos - 2 )->value.value_6 ), ( ( pcb->tos - 0 )->value.value_6 ), (pregex_ptn*)NULL );
+                            ;
                     }
                     break;
-                case 222:
+                case 99:
                     {
-                        ;
+                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
                     }
                     break;
-                case 223:
+                case 100:
                     {
-                        ;
+                    #line 832 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_seq(
+                                    ( ( pcb->tos - 1 )->value.value_6 ), ( ( pcb->tos - 0 )->value.value_6 ), (pregex_ptn*)NULL );
+                            ;
                     }
                     break;
-                case 224:
+                case 101:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
+                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
                     }
                     break;
-                case 225:
+                case 102:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 844 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_kle( ( ( pcb->tos - 1 )->value.value_6 ) );
+                            ;
                     }
                     break;
-                case 226:
+                case 103:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 850 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_pos( ( ( pcb->tos - 1 )->value.value_6 ) );
+                            ;
                     }
                     break;
-                case 227:
+                case 104:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 856 "src/parse.par"
+
+                            pcb->ret.value_6 = pregex_ptn_create_opt( ( ( pcb->tos - 1 )->value.value_6 ) );
+                            ;
                     }
                     break;
-                case 228:
+                case 105:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_6 = ( ( pcb->tos - 0 )->value.value_6 );     ;
                     }
                     break;
-                case 229:
+                case 106:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 866 "src/parse.par"
+
+                        pccl*        ccl;
+
+                        ccl = pccl_create( -1, -1, strbuf );
+                        if( ( ( pcb->tos - 0 )->value.value_0 ) )
+                            pccl_negate( ccl );
+
+                        pcb->ret.value_6 = pregex_ptn_create_char( ccl );
+                        ;
                     }
                     break;
-                case 230:
+                case 107:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 878 "src/parse.par"
+
+                        pcb->ret.value_6 = pregex_ptn_create_string( strbuf, 0 );
+                        ;
                     }
                     break;
-                case 231:
+                case 108:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 884 "src/parse.par"
+
+                        pccl*    ccl;
+                        greedy = FALSE;
+
+                        ccl = pccl_create( -1, -1, (char*)NULL );
+
+                        pccl_addrange( ccl, PCCL_MIN, PCCL_MAX );
+
+                        pcb->ret.value_6 = pregex_ptn_create_char( ccl );
+                        ;
                     }
                     break;
-                case 232:
+                case 109:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 897 "src/parse.par"
+
+                        pcb->ret.value_6 = pregex_ptn_create_sub( ( ( pcb->tos - 1 )->value.value_6 ) );
+                        ;
                     }
                     break;
-                case 233:
+                case 110:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 234:
+                case 111:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 235:
+                case 112:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 236:
+                case 113:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 237:
+                case 114:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_0 );     ;
                     }
                     break;
-                case 238:
+                case 115:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 911 "src/parse.par"
+    pcb->ret.value_0 = FALSE;     ;
                     }
                     break;
-                case 239:
+                case 116:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 915 "src/parse.par"
+    pcb->ret.value_0 = TRUE;     ;
                     }
                     break;
-                case 240:
+                case 117:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 2 )->value.value_5 );     ;
                     }
                     break;
-                case 241:
+                case 118:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 242:
+                case 119:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 924 "src/parse.par"
+  reset_strbuf();     ;
                     }
                     break;
-                case 243:
+                case 120:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 928 "src/parse.par"
+  strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 244:
+                case 121:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 931 "src/parse.par"
+
+                        strbuf_append( (char)'\\' );
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 245:
+                case 122:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 937 "src/parse.par"
+ pcb->ret.value_0 = TRUE     ;
                     }
                     break;
-                case 246:
+                case 123:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 938 "src/parse.par"
+ pcb->ret.value_0 = FALSE     ;
                     }
                     break;
-                case 247:
+                case 124:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 942 "src/parse.par"
+ strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 248:
+                case 125:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 943 "src/parse.par"
+    reset_strbuf();     ;
                     }
                     break;
-                case 249:
+                case 126:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 947 "src/parse.par"
+     strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 250:
+                case 127:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 950 "src/parse.par"
+     strbuf_append( (char)'\\' );
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 251:
+                case 128:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 956 "src/parse.par"
+ pcb->ret.value_3 = pstrdup( strbuf );     ;
                     }
                     break;
-                case 252:
+                case 129:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 957 "src/parse.par"
+ pcb->ret.value_3 = (char*)NULL;     ;
                     }
                     break;
-                case 253:
+                case 130:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 961 "src/parse.par"
+ strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 254:
+                case 131:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 962 "src/parse.par"
+ reset_strbuf();     ;
                     }
                     break;
-                case 255:
+                case 132:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 256:
+                case 133:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 969 "src/parse.par"
+
+                        reset_strbuf();
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 257:
+                case 134:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 977 "src/parse.par"
+ strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 258:
+                case 135:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 259:
+                case 136:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 260:
+                case 137:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 261:
+                case 138:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 989 "src/parse.par"
+ strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );     ;
                     }
                     break;
-                case 262:
+                case 139:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 991 "src/parse.par"
+
+                        reset_strbuf();
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 263:
+                case 140:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 999 "src/parse.par"
+
+                        pcb->ret.value_3 = pstrdup( ( ( pcb->tos - 0 )->value.value_3 ) );
+                        reset_strbuf();
+                        ;
                     }
                     break;
-                case 264:
+                case 141:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1006 "src/parse.par"
+    pcb->ret.value_3 = strbuf;     ;
                     }
                     break;
-                case 265:
+                case 142:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1008 "src/parse.par"
+
+                        reset_strbuf();
+                        pcb->ret.value_3 = (char*)NULL;
+                        ;
                     }
                     break;
-                case 266:
+                case 143:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1015 "src/parse.par"
+
+                        if( !parser->p_template )
+                        {
+                            print_error( parser,
+                                ERR_NO_TARGET_TPL_SUPPLY,
+                                    ERRSTYLE_WARNING | ERRSTYLE_IMPORTANT
+                                            | ERRSTYLE_FILEINFO,
+                                        pcb->filename, last_code_begin );
+
+                            reset_strbuf();
+                        }
+                        ;
                     }
                     break;
-                case 267:
+                case 144:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1030 "src/parse.par"
+ last_code_begin = pcb->line;     ;
                     }
                     break;
-                case 268:
+                case 145:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 269:
+                case 146:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1034 "src/parse.par"
+    reset_strbuf();     ;
                     }
                     break;
-                case 270:
+                case 147:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1038 "src/parse.par"
+    strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );            ;
                     }
                     break;
-                case 271:
+                case 148:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1041 "src/parse.par"
+
+                        reset_strbuf();
+                        strbuf_append( ( ( pcb->tos - 0 )->value.value_5 ) );
+                        ;
                     }
                     break;
-                case 272:
+                case 152:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 273:
+                case 153:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 274:
+                case 155:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 275:
+                case 156:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = 0;     ;
                     }
                     break;
-                case 276:
+                case 159:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 277:
+                case 160:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 278:
+                case 161:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1060 "src/parse.par"
+
+                        pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );
+                        ;
                     }
                     break;
-                case 279:
+                case 162:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 280:
+                case 163:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 281:
+                case 164:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                    #line 1069 "src/parse.par"
+ pcb->ret.value_5 = pcb->line;     ;
                     }
                     break;
-                case 282:
+                case 165:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 283:
+                case 171:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 284:
+                case 172:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 285:
+                case 173:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 286:
+                case 174:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 287:
+                case 175:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 288:
+                case 176:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 289:
+                case 177:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 290:
+                case 178:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 291:
+                case 179:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 292:
+                case 180:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 293:
+                case 181:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 294:
+                case 182:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 295:
+                case 183:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 296:
+                case 184:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_3 = ( ( pcb->tos - 1 )->value.value_3 );     ;
                     }
                     break;
-                case 297:
+                case 185:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 298:
+                case 186:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 299:
+                case 187:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 300:
+                case 188:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 301:
+                case 189:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 302:
+                case 190:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 303:
+                case 191:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 304:
+                case 192:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 305:
+                case 193:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 306:
+                case 194:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 307:
+                case 195:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 308:
+                case 196:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_0 = ( ( pcb->tos - 1 )->value.value_0 );     ;
                     }
                     break;
-                case 309:
+                case 197:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_2 = ( ( pcb->tos - 1 )->value.value_2 );     ;
                     }
                     break;
-                case 310:
+                case 198:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 311:
+                case 199:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 312:
+                case 200:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 313:
+                case 201:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 314:
+                case 202:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 315:
+                case 203:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 316:
+                case 204:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 317:
+                case 205:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 318:
+                case 206:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 319:
+                case 207:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 320:
+                case 208:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 321:
+                case 209:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 322:
+                case 210:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 323:
+                case 211:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 324:
+                case 212:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 325:
+                case 213:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 326:
+                case 214:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_0 = ( ( pcb->tos - 1 )->value.value_0 );     ;
                     }
                     break;
-                case 327:
+                case 215:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 328:
+                case 216:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 329:
+                case 217:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 330:
+                case 218:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 331:
+                case 219:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 332:
+                case 220:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 333:
+                case 221:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 334:
+                case 222:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 335:
+                case 223:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 336:
+                case 224:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 337:
+                case 225:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                        ;
                     }
                     break;
-                case 338:
+                case 226:
                     {
-                     pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
+                     pcb->ret.value_5 = ( ( pcb->tos - 1 )->value.value_5 );     ;
                     }
                     break;
-                case 339:
+                case 227:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 340:
+                case 228:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 341:
+                case 229:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 342:
+                case 230:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 343:
+                case 231:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 344:
+                case 232:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 345:
+                case 233:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 346:
+                case 234:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 347:
+                case 235:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 348:
+                case 236:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 349:
+                case 237:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 350:
+                case 238:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 351:
+                case 239:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 352:
+                case 240:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 353:
+                case 241:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 354:
+                case 242:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 355:
+                case 243:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 356:
+                case 244:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 357:
+                case 245:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 358:
+                case 246:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 359:
+                case 247:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 360:
+                case 248:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 361:
+                case 249:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 362:
+                case 250:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 363:
+                case 251:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 364:
+                case 252:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 365:
+                case 253:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 366:
+                case 254:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 367:
+                case 255:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 368:
+                case 256:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 369:
+                case 257:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 370:
+                case 258:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 371:
+                case 259:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 372:
+                case 260:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 373:
+                case 261:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 374:
+                case 262:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 375:
+                case 263:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 376:
+                case 264:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 377:
+                case 265:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 378:
+                case 266:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 379:
+                case 267:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 380:
+                case 268:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 381:
+                case 269:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 382:
+                case 270:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 383:
+                case 271:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 384:
+                case 272:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 385:
+                case 273:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 386:
+                case 274:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 387:
+                case 275:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 388:
+                case 276:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 389:
+                case 277:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 390:
+                case 278:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 391:
+                case 279:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 392:
+                case 280:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 393:
+                case 281:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 394:
+                case 282:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 395:
+                case 283:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 396:
+                case 284:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 397:
+                case 285:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 398:
+                case 286:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 399:
+                case 287:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 400:
+                case 288:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 401:
+                case 289:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 402:
+                case 290:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 403:
+                case 291:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 404:
+                case 292:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 405:
+                case 293:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 406:
+                case 294:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 407:
+                case 295:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 408:
+                case 296:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 409:
+                case 297:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 410:
+                case 298:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 411:
+                case 299:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 412:
+                case 300:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 413:
+                case 301:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 414:
+                case 302:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 415:
+                case 303:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 416:
+                case 304:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 417:
+                case 305:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 418:
+                case 306:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 419:
+                case 307:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 420:
+                case 308:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 421:
+                case 309:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 422:
+                case 310:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 423:
+                case 311:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 424:
+                case 312:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 425:
+                case 313:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 426:
+                case 314:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 427:
+                case 315:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 428:
+                case 316:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 429:
+                case 317:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 430:
+                case 318:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 431:
+                case 319:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 432:
+                case 320:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 433:
+                case 321:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 434:
+                case 322:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 435:
+                case 323:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 436:
+                case 324:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 437:
+                case 325:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 438:
+                case 326:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 439:
+                case 327:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 440:
+                case 328:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 441:
+                case 329:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 442:
+                case 330:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 443:
+                case 331:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 444:
+                case 332:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 445:
+                case 333:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 446:
+                case 334:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 447:
+                case 335:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 448:
+                case 336:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 449:
+                case 337:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 450:
+                case 338:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 451:
+                case 339:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 452:
+                case 340:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 453:
+                case 341:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 454:
+                case 342:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 455:
+                case 343:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 456:
+                case 344:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 457:
+                case 345:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 458:
+                case 346:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 459:
+                case 347:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 460:
+                case 348:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 461:
+                case 349:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 462:
+                case 350:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 463:
+                case 351:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 464:
+                case 352:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 465:
+                case 353:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 466:
+                case 354:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 467:
+                case 355:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
                     break;
-                case 468:
+                case 356:
                     {
                      pcb->ret.value_5 = ( ( pcb->tos - 0 )->value.value_5 );     ;
                     }
@@ -20114,7 +21845,7 @@ int _parse( _pcb* pcb )
                 break;
 
             /* Goal symbol reduced, and stack is empty? */
-            if( pcb->lhs == 182 && pcb->tos == pcb->stack )
+            if( pcb->lhs == 67 && pcb->tos == pcb->stack )
             {
                 memcpy( &( pcb->tos->value ), &( pcb->ret ),
                             sizeof( _vtype ) );
@@ -20290,7 +22021,7 @@ int _parse( _pcb* pcb )
     ret = ( ( pcb->tos - 0 )->value.value_5 );
 
     /* Clean up parser control block */
-    free( pcb->buf );
+    free( pcb->bufstart );
     free( pcb->stack );
 #if UNICC_UTF8
     free( pcb->lexem );
@@ -20369,7 +22100,7 @@ int parse_grammar( PARSER* p, char* filename, char* src )
 
         _parse( &pcb );
 
-        pfree( strbuf );
+        strbuf = pfree( strbuf );
     }
 
     return pcb.error_count + error_count;
@@ -20378,7 +22109,7 @@ int parse_grammar( PARSER* p, char* filename, char* src )
 
 
 /* Create Main? */
-#if 1854 == 0
+#if 1863 == 0
     #ifndef UNICC_MAIN
     #define UNICC_MAIN 	1
     #endif
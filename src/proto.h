@@ -1,3 +1,23 @@
+/* src/arena.c */
+void arena_init( ARENA* a, char* name, size_t chunk, size_t objsize );
+void* arena_malloc( ARENA* a, size_t size );
+void arena_recycle( ARENA* a, void* ptr );
+char* arena_strdup( ARENA* a, char* str );
+char* arena_strcat( ARENA* a, char* str, char* append );
+void arena_merge( ARENA* a, ARENA* from );
+void arena_free( ARENA* a );
+void arena_stats( FILE* stream, ARENA* a );
+
+/* src/bitset.c */
+void bitset_init( BITSET* set );
+void bitset_reset( BITSET* set );
+void bitset_erase( BITSET* set );
+BOOLEAN bitset_set( BITSET* set, int bit );
+BOOLEAN bitset_get( BITSET* set, int bit );
+int bitset_count( BITSET* set );
+int bitset_union( BITSET* set, BITSET* from );
+int bitset_next( BITSET* set, int bit );
+
 /* src/build.c */
 char* escape_for_target( GENERATOR* g, char* str, BOOLEAN clear );
 char* build_action( PARSER* parser, GENERATOR* g, PROD* p, char* base, BOOLEAN def_code );
@@ -6,21 +26,30 @@ char* mkproduction_str( PROD* p );
 BOOLEAN load_generator( PARSER* parser, GENERATOR* g, char* genfile );
 void build_code( PARSER* parser );
 
+/* src/charmap.c */
+void build_charmap( PARSER* parser );
+void free_charmap( CHARMAP* map );
+int charmap_class( CHARMAP* map, wchar_t ch );
+pccl* charmap_to_classes( CHARMAP* map, pccl* ccl );
+pccl* charmap_to_chars( CHARMAP* map, pccl* cls );
+
 /* src/debug.c */
 void print_symbol( FILE* stream, SYMBOL* sym );
 void dump_grammar( FILE* stream, PARSER* parser );
 void dump_symbols( FILE* stream, PARSER* parser );
-void dump_item_set( FILE* stream, char* title, LIST* list );
+void dump_item_set( FILE* stream, PARSER* parser, char* title, parray* items );
 void dump_lalr_states( FILE* stream, PARSER* parser );
 void dump_productions( FILE* stream, PARSER* parser );
 void dump_production( FILE* stream, PROD* p, BOOLEAN with_lhs, BOOLEAN semantics );
 
+/* src/digraph.c */
+void compute_lookaheads( PARSER* parser );
+
 /* src/error.c */
 void print_error( PARSER* parser, ERRORCODE err_id, int err_style, ... );
 
 /* src/first.c */
 void compute_first( PARSER* parser );
-int seek_rhs_first( plist* first, plistel* rhs );
 
 /* src/integrity.c */
 BOOLEAN find_undef_or_unused( PARSER* parser );
@@ -35,6 +64,7 @@ void detect_default_productions( PARSER* parser );
 void merge_symbols_to_dfa( PARSER* parser );
 void construct_single_lexer( PARSER* parser );
 pregex_dfa* find_equal_dfa( PARSER* parser, pregex_dfa* ndfa );
+int find_dfa( PARSER* parser, pregex_dfa* dfa );
 void nfa_from_symbol( PARSER* parser, pregex_nfa* nfa, SYMBOL* sym );
 
 /* src/list.c */
@@ -60,13 +90,13 @@ void free_symbol( SYMBOL* sym );
 PROD* create_production( PARSER* p, SYMBOL* lhs );
 void append_to_production( PROD* p, SYMBOL* sym, char* name );
 void free_production( PROD* prod );
-ITEM* create_item( PROD* p );
-void free_item( ITEM* it );
+ITEM* create_item( ARENA* arena, PROD* p );
+void free_item( ARENA* arena, ITEM* it );
 STATE* create_state( PARSER* p );
 void free_state( STATE* st );
-TABCOL* create_tabcol( SYMBOL* sym, short action, int idx, ITEM* item );
-void free_tabcol( TABCOL* act );
-TABCOL* find_tabcol( LIST* row, SYMBOL* sym );
+TABCOL* create_tabcol( parray* row, SYMBOL* sym, short action, int idx, ITEM* item );
+TABCOL* find_tabcol( parray* row, SYMBOL* sym );
+void remove_tabcol( parray* row, TABCOL* act );
 OPT* create_opt( plist* options, char* opt, char* def );
 plist* free_opts( plist* options );
 PARSER* create_parser( void );
@@ -69,9 +69,11 @@ void rewrite_grammar( PARSER* parser )
         Find out all lexeme non-terminals and those
         which belong to them.
     */
-    done = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
+    done = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE
+                                | PLIST_MOD_PTRHASH );
     stack = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
-    rewritten = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE );
+    rewritten = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_RECYCLE
+                                | PLIST_MOD_PTRHASH );
 
     plist_for( parser->symbols, e )
     {
@@ -229,142 +231,258 @@ void rewrite_grammar( PARSER* parser )
     parser->goal = sym;
 }
 
+/* Bound of a range of a character-class terminal */
+typedef struct
+{
+    wchar_t		ch;				/* Character at the bound */
+    int			term;			/* Index of the terminal */
+    BOOLEAN		begin;			/* TRUE if the range begins at ch,
+                                    FALSE if it ends before ch */
+} CCLBOUND;
+
+/* Disjoint character set of the partition of the character-class terminals */
+typedef struct
+{
+    pccl*		ccl;			/* Characters of the set */
+    int*		terms;			/* Indexes of the terminals containing it */
+    int			count;			/* Number of terminals containing it */
+    SYMBOL*		sym;			/* Terminal symbol of the set */
+} CCLSET;
+
+/* Orders range bounds by their character; Ends come first */
+static int sort_bounds( const void* l, const void* r )
+{
+    const CCLBOUND*	lb	= (const CCLBOUND*)l;
+    const CCLBOUND*	rb	= (const CCLBOUND*)r;
+
+    if( lb->ch != rb->ch )
+        return lb->ch < rb->ch ? -1 : 1;
+
+    return (int)lb->begin - (int)rb->begin;
+}
+
 /** Rewrites the grammar to work with uniquely identifyable character sets
-instead of overlapping ones. This function was completely rewritten in Nov 2009.
+instead of overlapping ones.
+
+The character-class terminals are partitioned into disjoint sets of characters
+by one sweep over the bounds of all their ranges. Between two bounds, the
+characters are contained by the same terminals, and characters contained by
+the same terminals form one set. Every terminal consisting of more than one
+set is rewritten into a nonterminal, deriving the terminals of its sets.
 
 //parser// is the pointer to parser to be rewritten.
 */
 void unique_charsets( PARSER* parser )
 {
     plistel*	e;
-    plistel*	f;
     SYMBOL*		sym;
-    SYMBOL*		tsym;
-    SYMBOL*		nsym;
-    SYMBOL*		rsym;
+    SYMBOL**	terms;
     PROD*		p;
-    pccl*		inter;
-    pccl*		diff;
-    int			old_prod_cnt;
-
-    /*
-    11.11.2009	Jan Max Meyer
-    Entire redesign of function, to work with full
-    Unicode-range character classes.
-    */
+    parray*		bounds;
+    parray*		sets;
+    plist*		keys;
+    CCLBOUND*	b;
+    CCLBOUND*	end;
+    CCLBOUND	bound;
+    CCLSET*		set;
+    int*		active;
+    int*		sets_of;
+    char*		key;
+    char*		pos;
+    int			cnt		= 0;
+    int			act		= 0;
+    int			i;
+    int			j;
+    wchar_t		from;
+    wchar_t		to;
 
     PROC( "unique_charsets" );
 
-    do
+    plist_for( parser->symbols, e )
+        if( ( (SYMBOL*)plist_access( e ) )->type == SYM_CCL_TERMINAL )
+            cnt++;
+
+    VARS( "cnt", "%d", cnt );
+    if( cnt < 2 )
+        VOIDRET;
+
+    if( !( terms = (SYMBOL**)pmalloc( cnt * sizeof( SYMBOL* ) ) )
+        || !( active = (int*)pmalloc( cnt * sizeof( int ) ) )
+        || !( sets_of = (int*)pmalloc( cnt * sizeof( int ) ) )
+        || !( key = (char*)pmalloc( ( cnt * 12 + 1 ) * sizeof( char ) ) ) )
     {
-        old_prod_cnt = plist_count( parser->productions );
+        OUTOFMEM;
+        VOIDRET;
+    }
 
-        plist_for( parser->symbols, e )
+    bounds = parray_create( sizeof( CCLBOUND ), 0 );
+    sets = parray_create( sizeof( CCLSET ), 0 );
+    keys = plist_create( sizeof( int ), PLIST_MOD_NONE );
+
+    /* Collect the bounds of all ranges */
+    cnt = 0;
+    plist_for( parser->symbols, e )
+    {
+        sym = (SYMBOL*)plist_access( e );
+        if( sym->type != SYM_CCL_TERMINAL )
+            continue;
+
+        VARS( "sym->name", "%s", sym->name );
+        bound.term = cnt;
+
+        for( i = 0; pccl_get( &from, &to, sym->ccl, i ); i++ )
         {
-            /* Get symbol pointer */
-            sym = (SYMBOL*)plist_access( e );
-            if( sym->type != SYM_CCL_TERMINAL )
-                continue;
+            bound.ch = from;
+            bound.begin = TRUE;
+            parray_push( bounds, &bound );
 
-            MSG( "NEXT SYMBOL FOR REVISION" );
-            VARS( "sym->name", "%s", sym->name );
+            bound.ch = to + 1;
+            bound.begin = FALSE;
+            parray_push( bounds, &bound );
+        }
+
+        sets_of[ cnt ] = 0;
+        terms[ cnt++ ] = sym;
+    }
+
+    qsort( parray_first( bounds ), parray_count( bounds ), sizeof( CCLBOUND ),
+            sort_bounds );
+
+    /* Sweep over the bounds; The terminals containing the characters up to
+        the next bound are kept in active, ordered by their index. */
+    MSG( "Sweeping over the range bounds" );
+    end = (CCLBOUND*)parray_last( bounds );
+
+    for( b = (CCLBOUND*)parray_first( bounds ); b && b <= end; )
+    {
+        from = b->ch;
 
-            /*
-            fprintf( stderr, "sym->ccl: %d\n", pccl_size( sym->ccl ) );
-            pccl_print( stderr, sym->ccl, 1 );
-            */
+        for( ; b <= end && b->ch == from; b++ )
+        {
+            for( i = 0; i < act && active[ i ] < b->term; i++ )
+                ;
 
-            /* Find overlapping character classes */
-            MSG( "Searching for overlapping character classes" );
-            plist_for( parser->symbols, f )
+            if( b->begin )
+            {
+                memmove( active + i + 1, active + i,
+                            ( act - i ) * sizeof( int ) );
+                active[ i ] = b->term;
+                act++;
+            }
+            else
             {
-                tsym = (SYMBOL*)plist_access( f );
+                memmove( active + i, active + i + 1,
+                            ( act - i - 1 ) * sizeof( int ) );
+                act--;
+            }
+        }
 
-                if( tsym->type != SYM_CCL_TERMINAL )
-                    continue;
+        if( !act )
+            continue;
 
-                VARS( "tsym->name", "%s", tsym->name );
+        to = b->ch - 1;
 
-                inter = pccl_intersect( sym->ccl, tsym->ccl );
+        for( pos = key, i = 0; i < act; i++ )
+            pos += sprintf( pos, "%d ", active[ i ] );
 
-                /*
-                fprintf( stdout, "inter = >%s< sym = >%s< tsym = >%s<\n",
-                    pccl_to_str( inter, TRUE ),
-                    pccl_to_str( sym->ccl, TRUE ),
-                    pccl_to_str( tsym->ccl, TRUE ) );
-                */
+        if( ( e = plist_get_by_key( keys, key ) ) )
+            set = (CCLSET*)parray_get( sets, *( (int*)plist_access( e ) ) );
+        else
+        {
+            i = parray_count( sets );
+            plist_insert( keys, (plistel*)NULL, key, (void*)&i );
 
-                VARS( "inter", "%p", inter );
-                if( inter )
-                {
-                    MSG( "Intersections found with tsym" );
+            set = (CCLSET*)parray_malloc( sets );
+            set->ccl = pccl_create( -1, -1, (char*)NULL );
+            set->terms = (int*)pmemdup( active, act * sizeof( int ) );
+            set->count = act;
 
-                    /* Create charclass-symbol for remaining symbols */
-                    diff = pccl_diff( tsym->ccl, inter );
-                    if( !pccl_size( diff ) )
-                    {
-                        diff = pccl_free( diff );
-                        inter = pccl_free( inter );
-                        continue;
-                    }
+            for( i = 0; i < act; i++ )
+                sets_of[ active[ i ] ]++;
+        }
 
-                    /* Disallow intersections in scanner-mode */
-                    if( parser->p_mode == MODE_SCANNER )
-                    {
-                        print_error( parser, ERR_CHARCLASS_OVERLAP,
-                                    ERRSTYLE_FATAL,
-                                        pccl_to_str( inter, TRUE ));
+        if( !pccl_addrange( set->ccl, from, to ) )
+            OUTOFMEM;
+    }
 
-                        inter = pccl_free( inter );
-                        continue;
-                    }
+    VARS( "parray_count( sets )", "%d", parray_count( sets ) );
 
-                    /* Create charclass-symbol for intersecting symbols */
-                    if( !( nsym = get_symbol( parser, (void*)inter,
-                                    SYM_CCL_TERMINAL, FALSE ) ) )
-                    {
-                        nsym = get_symbol( parser, (void*)inter,
-                                        SYM_CCL_TERMINAL, TRUE );
-                        nsym->used = TRUE;
-                        nsym->defined = TRUE;
-                    }
-                    else
-                        inter = pccl_free( inter );
+    /* Terminals made of one set are the set's terminal */
+    parray_for( sets, set )
+        if( sets_of[ set->terms[ 0 ] ] == 1 )
+            set->sym = terms[ set->terms[ 0 ] ];
+
+    /* Disallow intersections in scanner-mode */
+    if( parser->p_mode == MODE_SCANNER )
+    {
+        parray_for( sets, set )
+            if( set->count > 1 )
+                print_error( parser, ERR_CHARCLASS_OVERLAP, ERRSTYLE_FATAL,
+                                pccl_to_str( set->ccl, TRUE ) );
+    }
+    else
+    {
+        /* Create charclass-symbols for the remaining sets */
+        parray_for( sets, set )
+        {
+            if( set->sym )
+                continue;
 
-                    rsym = get_symbol( parser, (void*)diff,
+            if( !( set->sym = get_symbol( parser, (void*)set->ccl,
+                                    SYM_CCL_TERMINAL, FALSE ) ) )
+            {
+                set->sym = get_symbol( parser, (void*)set->ccl,
                                     SYM_CCL_TERMINAL, TRUE );
-                    rsym->used = TRUE;
-                    rsym->defined = TRUE;
-
-                    /* Re-configure symbol */
-                    tsym->ccl = pccl_free( tsym->ccl );
-                    tsym->name = pstrcatstr( tsym->name,
-                                    P_REWRITTEN_CCL, FALSE );
-                    tsym->type = SYM_NON_TERMINAL;
-                    plist_erase( tsym->first );
-                    tsym->productions = plist_create( 0, PLIST_MOD_PTR );
-
-                    /* Create & append productions */
-                    p = create_production( parser, tsym );
-                    append_to_production( p, nsym, (char*)NULL );
-
-                    p = create_production( parser, tsym );
-                    append_to_production( p, rsym, (char*)NULL );
-                }
-                else
-                {
-                    MSG( "Has no intersections, next" );
-                }
+                set->sym->used = TRUE;
+                set->sym->defined = TRUE;
+
+                set->ccl = (pccl*)NULL;
             }
         }
 
-        /*
-        fprintf( stderr, "-----\nCURRENT GRAMMAR:\n" );
-        dump_grammar( stderr, parser );
-        getchar();
-        */
+        /* Re-configure the terminals made of several sets */
+        for( i = 0; i < cnt; i++ )
+        {
+            if( sets_of[ i ] < 2 )
+                continue;
+
+            sym = terms[ i ];
+            MSG( "Rewriting symbol" );
+            VARS( "sym->name", "%s", sym->name );
+
+            sym->ccl = pccl_free( sym->ccl );
+            sym->name = arena_strcat( &parser->strings, sym->name,
+                            P_REWRITTEN_CCL );
+            sym->type = SYM_NON_TERMINAL;
+            bitset_erase( &sym->first );
+            sym->productions = plist_create( 0, PLIST_MOD_PTR );
+
+            /* Create & append productions, in the order of the sets */
+            parray_for( sets, set )
+                for( j = 0; j < set->count; j++ )
+                    if( set->terms[ j ] == i )
+                    {
+                        p = create_production( parser, sym );
+                        append_to_production( p, set->sym, (char*)NULL );
+                        break;
+                    }
+        }
     }
-    while( old_prod_cnt != plist_count( parser->productions ) );
+
+    parray_for( sets, set )
+    {
+        pccl_free( set->ccl );
+        pfree( set->terms );
+    }
+
+    parray_free( bounds );
+    parray_free( sets );
+    plist_free( keys );
+
+    pfree( terms );
+    pfree( active );
+    pfree( sets_of );
+    pfree( key );
 
     VOIDRET;
 }
@@ -459,7 +577,7 @@ void inherit_fixiations( PARSER* parser )
     plist*		done;
     plist*		stack;
 
-    done = plist_create( 0, PLIST_MOD_PTR );
+    done = plist_create( 0, PLIST_MOD_PTR | PLIST_MOD_PTRHASH );
     stack = plist_create( 0, PLIST_MOD_PTR );
 
     plist_for( parser->symbols, e )
@@ -41,6 +41,10 @@
 #define MODE_SCANNERLESS		0	/* Sensitive parser construction mode */
 #define MODE_SCANNER			1	/* Insensitive parser construction mode */
 
+/* State scheduling orders for the LALR(1) closure */
+#define SCHEDULE_FIFO			0	/* Close states in order of queuing */
+#define SCHEDULE_LIFO			1	/* Close most recently queued first */
+
 /* Macro to verify terminals */
 #define IS_TERMINAL( s )		( ((s)->type) > SYM_NON_TERMINAL )
 
@@ -93,6 +97,11 @@
  * Type definitions
  */
 typedef struct _list				LIST;
+typedef unsigned long				BITWORD;
+typedef struct _bitset				BITSET;
+typedef struct _arena				ARENA;
+typedef struct _arena_block			ARENA_BLOCK;
+typedef struct _charmap				CHARMAP;
 typedef struct _symbol 				SYMBOL;
 typedef struct _prod 				PROD;
 typedef struct _item 				ITEM;
@@ -121,6 +130,49 @@ struct _list
 
 #define LISTFOR( ll, cc )		for( (cc) = (ll); (cc); (cc) = list_next(cc) )
 
+/* Dense bitset, used for sets of terminal symbol ids */
+struct _bitset
+{
+    int			words;			/* Number of allocated words */
+    BITWORD*	bits;			/* Bit words */
+};
+
+#define BITSET_WORDBITS			( (int)sizeof( BITWORD ) * 8 )
+
+#define BITSETFOR( set, bit )	for( (bit) = bitset_next( (set), 0 ); \
+                                    (bit) >= 0; \
+                                        (bit) = bitset_next( (set), (bit) + 1 ) )
+
+/* Region allocator; Its memory is released at once */
+struct _arena
+{
+    char*		name;			/* Arena name for statistics */
+    size_t		chunk;			/* Minimum block size */
+    size_t		objsize;		/* Size of recyclable objects */
+
+    ARENA_BLOCK*	blocks;		/* Allocated memory blocks */
+    char*		ptr;			/* Free memory in current block */
+    char*		end;			/* End of current block */
+    void*		recycled;		/* Recycled objects */
+
+    size_t		used;			/* Bytes currently in use */
+    size_t		peak;			/* High-water mark of used bytes */
+    size_t		reserved;		/* Bytes allocated for blocks */
+    long		allocs;			/* Number of allocations */
+};
+
+/* Partition of the character universe into character classes; The characters
+of a class are not distinguished by any terminal. The universe is divided into
+ranges, and every range belongs to one class. */
+struct _charmap
+{
+    wchar_t*	bounds;			/* First character of each range */
+    int*		classes;		/* Character class of each range */
+    int			ranges;			/* Number of ranges */
+    int			count;			/* Number of character classes */
+    int			universe;		/* Last character of the last range */
+};
+
 /* Symbol structure */
 struct _symbol
 {
@@ -135,7 +187,7 @@ struct _symbol
 
     plist*		productions;	/* List of productions attached to a
                                     non-terminal symbol */
-    plist*		first;			/* The symbol's first set */
+    BITSET		first;			/* The symbol's first set */
 
     plist*		all_sym;		/* List of all possible terminal
                                     definitions, for multiple-terminals.
@@ -190,6 +242,10 @@ struct _prod
     char*		emit;			/* AST node generation */
 
     plist*		rhs;			/* Right-hand side symbols */
+    BITSET*		suffix_first;	/* FIRST-sets of the right-hand side
+                                    suffixes, by dot offset */
+    BOOLEAN*	suffix_nullable;/* Nullability of the right-hand side
+                                    suffixes, by dot offset */
     plist*		sem_rhs;		/* Semantic right-hand side; This
                                     may differ from the right hand side
                                         in case of embedded productions,
@@ -216,22 +272,22 @@ struct _item
     int			dot_offset;		/* The dot's offset from the left
                                     of the right hand side */
     SYMBOL*		next_symbol;	/* Symbol following the dot */
-    plist		lookahead;		/* Set of lookahead-symbols */
+    BITSET		lookahead;		/* Set of lookahead-symbols */
 };
 
 /* LALR(1) State */
 struct _state
 {
     int			state_id;		/* State ID */
-    LIST*		kernel;			/* Kernel item set */
-    LIST*		epsilon;		/* Epsilon item set */
+    parray*		kernel;			/* Kernel item set (ITEM*) */
+    parray*		epsilon;		/* Epsilon item set (ITEM*) */
 
-    LIST*		actions;		/* Action table entries */
-    LIST*		gotos;			/* Goto table entries */
+    parray*		actions;		/* Action table entries (TABCOL) */
+    parray*		gotos;			/* Goto table entries (TABCOL) */
 
     PROD*		def_prod;		/* Default production */
 
-    BOOLEAN		done;			/* Done flag */
+    BOOLEAN		queued;			/* Queued for closure flag */
     BOOLEAN		closed;			/* Closed flag */
 
     pregex_dfa*	dfa;			/* DFA machine for regex recognition
@@ -273,6 +329,7 @@ struct _parser
     plist*		symbols;		/* Symbol table */
     plist*		productions;	/* Productions */
     parray*		states;			/* LALR(1) states */
+    plist*		kernels;		/* Kernel signatures to state ids */
     LIST*		dfa;			/* List containing the DFA for
                                     regex terminal recognition */
 
@@ -280,8 +337,13 @@ struct _parser
     SYMBOL*		end_of_input;	/* End of input symbol */
     SYMBOL*		error;			/* Error token */
 
-    LIST*		dfas;			/* Lexers */
-    LIST*		vtypes;			/* Value stack types */
+    parray*		dfas;			/* Lexers (pregex_dfa*) */
+    plist*		lexers;			/* Canonical lexer forms to lexer index */
+    CHARMAP		charmap;		/* Character classes of the lexers */
+    parray*		vtypes;			/* Value stack types (VTYPE*) */
+
+    ARENA		items;			/* Closure items */
+    ARENA		strings;		/* Symbol names and keys */
 
     short		p_mode;			/* Parser model */
     char*		p_template;		/* Parser target template */
@@ -296,6 +358,7 @@ struct _parser
     BOOLEAN		p_cis_strings;	/* Flag, if case-insensitive strings */
     BOOLEAN		p_extern_tokens;/* Flag if parser uses external tokens */
     BOOLEAN		p_reserve_regex;/* Flag, if regex'es are reserved */
+    BOOLEAN		p_compressed;	/* Flag, if parse tables are compressed */
     int			p_universe;		/* Maximum of the character universe */
 
     char*		p_header;		/* Header/Prologue program code of the parser */
@@ -326,8 +389,19 @@ struct _parser
     BOOLEAN		gen_xml;
     BOOLEAN		to_stdout;
     char*		target;			/* Target language by command-line */
+    int			schedule;		/* State scheduling order */
+    BOOLEAN		digraph;		/* Compute lookaheads by digraph method */
+    BOOLEAN		mem_stats;		/* Print arena high-water marks */
+    int			threads;		/* Number of closure worker threads */
     int			files_count;
 
+    /* Statistics */
+    int			closures;		/* Number of performed state closures */
+    int			first_passes;	/* Number of FIRST-set passes */
+    int			first_components;/* Number of FIRST-set components */
+    int			lexer_lookups;	/* Number of state lexer lookups */
+    int			lexer_hits;		/* Number of state lexers re-used */
+
     /* Debug and maintainance */
     char*		filename;
     int			debug_level;
@@ -374,6 +448,16 @@ struct _generator
     _2D_TABLE	dfa_idx;					/* DFA state index */
     _1D_TABLE	dfa_char;					/* DFA transition characters */
     _1D_TABLE	dfa_trans;					/* DFA transitions */
+    _1D_TABLE	dfa_dense;					/* DFA transitions on the
+                                                ASCII character classes */
+    _1D_TABLE	char_map;					/* Character classes */
+    _1D_TABLE	char_map_idx;				/* Character class blocks */
+    _1D_TABLE	act_base;					/* Action comb-vector bases */
+    _1D_TABLE	act_check;					/* Action comb-vector checks */
+    _1D_TABLE	act_next;					/* Action comb-vector entries */
+    _1D_TABLE	go_base;					/* Goto comb-vector bases */
+    _1D_TABLE	go_check;					/* Goto comb-vector checks */
+    _1D_TABLE	go_next;					/* Goto comb-vector entries */
     _2D_TABLE	dfa_accept;					/* DFA accepting states */
 
     char*		action_start;				/* Action code start */
@@ -469,6 +553,7 @@ typedef enum
     ERR_TAG_NOT_FOUND,
     ERR_XML_ERROR,
     ERR_XML_INCOMPLETE,
+    ERR_TAG_REQUIRES_TAG,
     ERR_DUPLICATE_ESCAPE_SEQ,
     ERR_CIRCULAR_DEFINITION,
     ERR_EMPTY_RECURSION,
@@ -481,7 +566,9 @@ typedef enum
     ERR_UNDEFINED_LHS,
     ERR_UNDEFINED_TERMINAL,
     ERR_NO_TARGET_TPL_SUPPLY,
-    ERR_DIRECTIVE_ALREADY_USED
+    ERR_DIRECTIVE_ALREADY_USED,
+    ERR_DIRECTIVE_UNSUPPORTED,
+    ERR_CMD_PARAM
 } ERRORCODE;
 
 #include "proto.h"
@@ -106,4 +106,16 @@
 #define UNICC_SEMANTIC_TERM_SEL	0
 #endif
 
+#ifndef UNICC_GETINPUT
 #define UNICC_GETINPUT             getchar()
+#endif
+
+/* Reads up to n characters into buf, and returns the number of characters
+   read, or 0 at the end of input; Without a block-wise input function, a
+   single character is read from UNICC_GETINPUT. buf holds UNICC_CHAR, so a
+   byte-wise block read like fread() only fits with UNICC_UTF8 set to 0;
+   UTF-8 input is decoded per character by UNICC_GETINPUT anyway. */
+#ifndef UNICC_READ
+#define UNICC_READ( pcb, buf, n ) \
+    ( ( *( buf ) = (UNICC_CHAR)UNICC_GETINPUT ) == ( pcb )->eof ? 0 : 1 )
+#endif
@@ -26,10 +26,15 @@ void @@prefix_parser::clear_input( void )
             UNICC_PARSER, this->bufend );
 #endif
 
-            memmove( this->buf, this->buf + this->len,
-                        ( ( this->bufend - ( this->buf + this->len ) ) + 1 + 1 )
-                            * sizeof( UNICC_CHAR ) );
-            this->bufend = this->buf + ( this->bufend - ( this->buf + this->len ) );
+            /* Slide the window behind the consumed characters; The buffer
+                is compacted by get_input() when it runs full. */
+            this->buf += this->len;
+
+            if( this->buf >= this->bufend )
+            {
+                this->buf = this->bufend = this->bufstart;
+                *( this->buf ) = 0;
+            }
 
 #if UNICC_DEBUG	> 2
     fprintf( stderr, "%s: clear input: now buf = >" UNICC_CHAR_FORMAT "<\n",
@@ -40,7 +45,7 @@ void @@prefix_parser::clear_input( void )
         }
         else
         {
-            this->bufend = this->buf;
+            this->buf = this->bufend = this->bufstart;
             *( this->buf ) = 0;
         }
     }
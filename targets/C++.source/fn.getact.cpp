@@ -1,5 +1,18 @@
 bool @@prefix_parser::get_act( void )
 {
+#if @@compressed-tables
+    int i = this->act_base[ this->tos->state ] + this->sym;
+
+    if( i >= 0 && i < @@size-of-action-vector
+            && this->act_check[ i ] == this->tos->state )
+    {
+        if( ( this->act = this->act_next[ i ][0] ) == UNICC_ERROR )
+            return 0; /* Force parse error! */
+
+        this->idx = this->act_next[ i ][1];
+        return true;
+    }
+#else
     for( int i = 1; i < this->actions[ this->tos->state ][0] * 3; i += 3 )
     {
         if( this->actions[ this->tos->state ][i] == this->sym )
@@ -12,6 +25,7 @@ bool @@prefix_parser::get_act( void )
             return true;
         }
     }
+#endif
 
     /* Default production */
     if( ( this->idx = this->def_prod[ this->tos->state ] ) > -1 )
@@ -1,5 +1,8 @@
 UNICC_CHAR @@prefix_parser::get_input( size_t offset )
 {
+    long		n;
+    long		i;
+
 #if UNICC_DEBUG	> 2
     fprintf( stderr, "%s: get input: this->buf + offset = %p this->bufend = %p\n",
                 UNICC_PARSER, this->buf + offset, this->bufend );
@@ -11,9 +14,18 @@ UNICC_CHAR @@prefix_parser::get_input( size_t offset )
             fprintf( stderr, "%s: get input: requiring more input\n",
                     UNICC_PARSER );
 #endif
-        if( !this->buf )
+        if( this->is_eof )
         {
-            this->bufend = this->buf = (UNICC_CHAR*)malloc(
+#if UNICC_DEBUG	> 2
+            fprintf( stderr, "%s: get input: can't get more input, "
+                        "end-of-file reached\n", UNICC_PARSER );
+#endif
+            return this->eof;
+        }
+
+        if( !this->bufstart )
+        {
+            this->bufend = this->buf = this->bufstart = (UNICC_CHAR*)malloc(
                 ( UNICC_MALLOCSTEP + 1 ) * sizeof( UNICC_CHAR ) );
 
             if( !this->buf )
@@ -22,51 +34,63 @@ UNICC_CHAR @@prefix_parser::get_input( size_t offset )
                 return 0;
             }
 
+            this->bufsize = UNICC_MALLOCSTEP;
             *this->buf = 0;
         }
-        else if( *this->buf && !( ( this->bufend - this->buf ) %
-                    UNICC_MALLOCSTEP ) )
+        else if( this->bufend == this->bufstart + this->bufsize )
         {
-            size_t size	= this->bufend - this->buf;
+            size_t size		= this->bufend - this->buf;
+            size_t start	= this->buf - this->bufstart;
             UNICC_CHAR*	buf;
 
-            if( !( buf = (UNICC_CHAR*)realloc( this->buf,
-                        ( size + UNICC_MALLOCSTEP + 1 )
-                            * sizeof( UNICC_CHAR ) ) ) )
+            // Move the window to the front if the consumed characters
+            // exceed half of the buffer, or double the buffer
+            if( start > this->bufsize / 2 )
             {
-                UNICC_OUTOFMEM( this );
+                memmove( this->bufstart, this->buf,
+                            ( size + 1 ) * sizeof( UNICC_CHAR ) );
+                start = 0;
+            }
+            else
+            {
+                if( !( buf = (UNICC_CHAR*)realloc( this->bufstart,
+                            ( this->bufsize * 2 + 1 )
+                                * sizeof( UNICC_CHAR ) ) ) )
+                {
+                    UNICC_OUTOFMEM( this );
 
-                free( this->buf );
-                this->buf = NULL;
+                    free( this->bufstart );
+                    this->buf = this->bufend = this->bufstart = NULL;
 
-                return 0;
+                    return 0;
+                }
+
+                this->bufstart = buf;
+                this->bufsize *= 2;
             }
 
-            this->buf = buf;
+            this->buf = this->bufstart + start;
             this->bufend = this->buf + size;
         }
 
-        if( this->is_eof || ( *( this->bufend ) = (UNICC_CHAR)UNICC_GETINPUT )
-                                    == this->eof )
-        {
-#if UNICC_DEBUG	> 2
-            fprintf( stderr, "%s: get input: can't get more input, "
-                        "end-of-file reached\n", UNICC_PARSER );
-#endif
+        // Fill the free space of the buffer; Input ends on the
+        // end-of-file character, characters read behind it are dropped
+        n = UNICC_READ( this, this->bufend,
+                this->bufstart + this->bufsize - this->bufend );
+
+        for( i = 0; i < n && this->bufend[ i ] != this->eof; i++ )
+            ;
+
+        if( i < n || n <= 0 )
             this->is_eof = true;
-            return this->eof;
-        }
-#if UNICC_DEBUG	> 2
-        fprintf( stderr, "%s: get input: read char >%c< %d\n",
-                    UNICC_PARSER, (char)*( this->bufend ), *( this->bufend ) );
-#endif
 
 #if UNICC_DEBUG	> 2
-        fprintf( stderr, "%s: get input: reading character >%c< %d\n",
-                    UNICC_PARSER, (char)*( this->bufend ), *( this->bufend ) );
+        fprintf( stderr, "%s: get input: read %ld characters\n",
+                    UNICC_PARSER, i );
 #endif
 
-        *( ++this->bufend ) = 0;
+        this->bufend += i;
+        *( this->bufend ) = 0;
     }
 
 #if UNICC_DEBUG	> 2
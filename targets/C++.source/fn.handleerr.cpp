@@ -13,6 +13,17 @@ bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )
         fprintf( @@prefix_dbg,
                 "%s: error recovery: expecting ", UNICC_PARSER );
 
+#if @@compressed-tables
+        for( int i = 0; i < @@number-of-symbols; i++ )
+        {
+            int j = this->act_base[ this->tos->state ] + i;
+
+            if( j >= 0 && j < @@size-of-action-vector
+                    && this->act_check[ j ] == this->tos->state )
+                fprintf( @@prefix_dbg, "%d (%s), ",
+                    i, this->symbols[ i ].name );
+        }
+#else
         for( int i = 1; i < this->actions[ this->tos->state ][0] * 3; i += 3 )
         {
             fprintf( @@prefix_dbg, "%d (%s)%s",
@@ -21,6 +32,7 @@ bool @@prefix_parser::handle_error( FILE* @@prefix_dbg )
                 ( i == this->actions[ this->tos->state ][0] * 3 - 3 ) ?
                         "\n" : ", " );
         }
+#endif
 
         fprintf( @@prefix_dbg, "\n%s: error recovery: error_delay is %d, %s\n",
                     UNICC_PARSER, this->error_delay,
@@ -4,6 +4,9 @@ void @@prefix_parser::lex( void )
     int 		state	= 0;
     size_t		len		= 0;
     int			chr;
+    int			cls;
+    int			lo;
+    int			hi;
     UNICC_CHAR	next;
 #if !@@mode
     int			machine	= this->dfa_select[ this->tos->state ];
@@ -28,60 +31,66 @@ fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 #endif
 
-        chr = this->dfa_idx[ machine ][ state ];
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: chr = %d\n", UNICC_PARSER, chr );
-#endif
-
-        state = -1;
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: FIRST next = %d this->dfa_chars[ chr ] = %d, "
-            "this->dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-                this->dfa_chars[ chr ], this->dfa_chars[ chr + 1 ] );
-#endif
-        while( this->dfa_chars[ chr ] > -1 )
+        // The lexer runs on the character class of next
+        if( (unsigned int)next <= @@character-universe )
+            cls = this->char_map[ this->char_map_idx[ next >> 8 ]
+                                    + ( next & 0xFF ) ];
+        else
+            cls = @@number-of-character-classes;
+
+        // The next state is looked up in the dense row of hot states for
+        // the classes of ASCII characters, and by binary search on the
+        // sorted ranges of the state otherwise
+        if( cls < @@number-of-dense-classes
+                && this->dfa_idx[ machine ][ state ][ 2 ] > -1 )
+            state = this->dfa_dense[ this->dfa_idx[ machine ][ state ][ 2 ]
+                                            + cls ];
+        else
         {
+            lo = this->dfa_idx[ machine ][ state ][ 0 ];
+            hi = lo + this->dfa_idx[ machine ][ state ][ 1 ];
+            state = -1;
+
+            while( lo < hi )
+            {
+                chr = ( lo + hi ) / 2;
 #if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: next = %d this->dfa_chars[ chr ] = %d, "
-        "this->dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-            this->dfa_chars[ chr ], this->dfa_chars[ chr + 1 ] );
+fprintf( stderr, "%s: lex: cls = %d this->dfa_chars[ chr * 2 ] = %d, "
+        "this->dfa_chars[ chr * 2 + 1 ] = %d\n", UNICC_PARSER, cls,
+            this->dfa_chars[ chr * 2 ], this->dfa_chars[ chr * 2 + 1 ] );
 #endif
-            if( next >= this->dfa_chars[ chr ] &&
-                next <= this->dfa_chars[ chr+1 ] )
-            {
-                state = *( this->dfa_trans + ( chr / 2 ) );
+                if( cls < this->dfa_chars[ chr * 2 ] )
+                    hi = chr;
+                else if( cls > this->dfa_chars[ chr * 2 + 1 ] )
+                    lo = chr + 1;
+                else
+                {
+                    state = this->dfa_trans[ chr ];
+                    break;
+                }
+            }
+        }
+
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: state = %d\n", UNICC_PARSER, state );
 #endif
-                if( this->dfa_accept[ machine ][ state ] > 0 )
-                {
-                    this->len = len + 1;
-                    this->sym = this->dfa_accept[ machine ][ state ] - 1;
+        if( state > -1 && this->dfa_accept[ machine ][ state ] > 0 )
+        {
+            this->len = len + 1;
+            this->sym = this->dfa_accept[ machine ][ state ] - 1;
 
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: new accepting symbol this->sym = %d greedy = %d\n",
             UNICC_PARSER, this->sym, this->symbols[ this->sym ].greedy );
 #endif
-                    if( this->sym == @@eof )
-                    {
-                        state = -1; /* test! */
-                        break;
-                    }
-
-                    /* Stop if matched symbol should be parsed nongreedy */
-                    if( !this->symbols[ this->sym ].greedy )
-                    {
-                        state = -1;
-                        break;
-                    }
-                }
-
-                next = this->get_input( ++len );
-                break;
-            }
-
-            chr += 2;
+            /* Stop on end of input, or if matched symbol should be parsed
+                nongreedy */
+            if( this->sym == @@eof || !this->symbols[ this->sym ].greedy )
+                state = -1;
         }
+
+        if( state > -1 )
+            next = this->get_input( ++len );
     }
     while( state > -1 && next != this->eof );
 
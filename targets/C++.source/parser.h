@@ -4,53 +4,105 @@ class @@prefix_parser
     private:
         // --- Tables ---
 
+        #if @@compressed-tables
+        // Action Table, as comb-vector
+        const @@type-of-action-base act_base[ @@number-of-states ] =
+        {
+            @@action-base
+        };
+
+        const @@type-of-action-check act_check[ @@size-of-action-vector ] =
+        {
+            @@action-check
+        };
+
+        const @@type-of-action-next act_next[ @@size-of-action-vector ][ 2 ] =
+        {
+            @@action-next
+        };
+
+        // GoTo Table, as comb-vector
+        const @@type-of-goto-base go_base[ @@number-of-states ] =
+        {
+            @@goto-base
+        };
+
+        const @@type-of-goto-check go_check[ @@size-of-goto-vector ] =
+        {
+            @@goto-check
+        };
+
+        const @@type-of-goto-next go_next[ @@size-of-goto-vector ][ 2 ] =
+        {
+            @@goto-next
+        };
+        #else
         // Action Table
-        const int actions[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =
+        const @@type-of-action-table actions[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =
         {
 @@action-table
         };
 
         // GoTo Table
-        const int go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =
+        const @@type-of-goto-table go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =
         {
 @@goto-table
         };
+        #endif
 
         // Default productions per state
-        const int def_prod[ @@number-of-states ] =
+        const @@type-of-default-productions def_prod[ @@number-of-states ] =
         {
             @@default-productions
         };
 
         #if !@@mode
         // DFA selection table
-        const int dfa_select[ @@number-of-states ] =
+        const @@type-of-dfa-select dfa_select[ @@number-of-states ] =
         {
             @@dfa-select
         };
         #endif
 
         #if @@number-of-dfa-machines
-        // DFA index table
-        const int dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ] =
+        // Character class map index
+        const @@type-of-character-map-index char_map_idx[ @@number-of-character-map-index ] =
+        {
+            @@character-map-index
+        };
+
+        // Character class map
+        const @@type-of-character-map char_map[ @@number-of-character-map ] =
+        {
+            @@character-map
+        };
+
+        // DFA index table; Offset, number of ranges and dense row of every state
+        const @@type-of-dfa-index dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ][ 3 ] =
         {
 @@dfa-index
         };
 
-        // DFA transition chars
-        const int dfa_chars[ @@size-of-dfa-characters * 2 ] =
+        // DFA transition character classes
+        const @@type-of-dfa-char dfa_chars[ @@size-of-dfa-characters * 2 ] =
         {
             @@dfa-char
         };
 
         // DFA transitions
-        const int dfa_trans[ @@size-of-dfa-characters ] =
+        const @@type-of-dfa-trans dfa_trans[ @@size-of-dfa-characters ] =
         {
             @@dfa-trans
         };
 
+        // DFA transitions on the character classes of the ASCII characters
+        const @@type-of-dfa-dense dfa_dense[ @@size-of-dfa-dense ] =
+        {
+            @@dfa-dense
+        };
+
         // DFA acception states
-        const int dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =
+        const @@type-of-dfa-accept dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =
         {
 @@dfa-accept
         };
@@ -92,11 +144,13 @@ class @@prefix_parser
         int				old_sym;
         size_t			len;
 
-        // Input buffering
+        // Input buffering; buf is the window of the current input within
+        // the buffer bufstart of bufsize characters
         UNICC_SCHAR*	lexem;
         UNICC_CHAR*		buf;
         UNICC_CHAR*		bufend;
-        UNICC_CHAR*		bufsize;
+        UNICC_CHAR*		bufstart;
+        size_t			bufsize;
 
         // Lexical analysis
         UNICC_CHAR		next;
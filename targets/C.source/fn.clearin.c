@@ -28,10 +28,15 @@ UNICC_STATIC void @@prefix_clear_input( @@prefix_pcb* pcb )
             UNICC_PARSER, pcb->bufend );
 #endif
 
-            memmove( pcb->buf, pcb->buf + pcb->len,
-                        ( ( pcb->bufend - ( pcb->buf + pcb->len ) ) + 1 + 1 )
-                            * sizeof( UNICC_CHAR ) );
-            pcb->bufend = pcb->buf + ( pcb->bufend - ( pcb->buf + pcb->len ) );
+            /* Slide the window behind the consumed characters; The buffer
+                is compacted by @@prefix_get_input() when it runs full. */
+            pcb->buf += pcb->len;
+
+            if( pcb->buf >= pcb->bufend )
+            {
+                pcb->buf = pcb->bufend = pcb->bufstart;
+                *( pcb->buf ) = 0;
+            }
 
 #if UNICC_DEBUG	> 2
     fprintf( stderr, "%s: clear input: now buf = >" UNICC_CHAR_FORMAT "<\n",
@@ -42,7 +47,7 @@ UNICC_STATIC void @@prefix_clear_input( @@prefix_pcb* pcb )
         }
         else
         {
-            pcb->bufend = pcb->buf;
+            pcb->buf = pcb->bufend = pcb->bufstart;
             *( pcb->buf ) = 0;
         }
     }
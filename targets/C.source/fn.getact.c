@@ -2,6 +2,19 @@ UNICC_STATIC int @@prefix_get_act( @@prefix_pcb* pcb )
 {
     int i;
 
+#if @@compressed-tables
+    i = @@prefix_act_base[ pcb->tos->state ] + pcb->sym;
+
+    if( i >= 0 && i < @@size-of-action-vector
+            && @@prefix_act_check[ i ] == pcb->tos->state )
+    {
+        if( ( pcb->act = @@prefix_act_next[ i ][0] ) == UNICC_ERROR )
+            return 0; /* Force parse error! */
+
+        pcb->idx = @@prefix_act_next[ i ][1];
+        return 1;
+    }
+#else
     for( i = 1; i < @@prefix_act[ pcb->tos->state ][0] * 3; i += 3 )
     {
         if( @@prefix_act[ pcb->tos->state ][i] == pcb->sym )
@@ -14,6 +27,7 @@ UNICC_STATIC int @@prefix_get_act( @@prefix_pcb* pcb )
             return 1;
         }
     }
+#endif
 
     /* Default production */
     if( ( pcb->idx = @@prefix_def_prod[ pcb->tos->state ] ) > -1 )
@@ -2,6 +2,17 @@ UNICC_STATIC int @@prefix_get_go( @@prefix_pcb* pcb )
 {
     int i;
 
+#if @@compressed-tables
+    i = @@prefix_go_base[ pcb->tos->state ] + pcb->lhs;
+
+    if( i >= 0 && i < @@size-of-goto-vector
+            && @@prefix_go_check[ i ] == pcb->tos->state )
+    {
+        pcb->act = @@prefix_go_next[ i ][0];
+        pcb->idx = @@prefix_go_next[ i ][1];
+        return 1;
+    }
+#else
     for( i = 1; i < @@prefix_go[ pcb->tos->state ][0] * 3; i += 3 )
     {
         if( @@prefix_go[ pcb->tos->state ][i] == pcb->lhs )
@@ -11,6 +22,7 @@ UNICC_STATIC int @@prefix_get_go( @@prefix_pcb* pcb )
             return 1;
         }
     }
+#endif
 
     return 0;
 }
@@ -1,5 +1,8 @@
 UNICC_STATIC UNICC_CHAR @@prefix_get_input( @@prefix_pcb* pcb, unsigned int offset )
 {
+    int		n;
+    int		i;
+
 #if UNICC_DEBUG	> 2
     fprintf( stderr, "%s: get input: pcb->buf + offset = %p pcb->bufend = %p\n",
                 UNICC_PARSER, pcb->buf + offset, pcb->bufend );
@@ -11,9 +14,18 @@ UNICC_STATIC UNICC_CHAR @@prefix_get_input( @@prefix_pcb* pcb, unsigned int offs
             fprintf( stderr, "%s: get input: requiring more input\n",
                     UNICC_PARSER );
 #endif
-        if( !pcb->buf )
+        if( pcb->is_eof )
         {
-            pcb->bufend = pcb->buf = (UNICC_CHAR*)malloc(
+#if UNICC_DEBUG	> 2
+            fprintf( stderr, "%s: get input: can't get more input, "
+                        "end-of-file reached\n", UNICC_PARSER );
+#endif
+            return pcb->eof;
+        }
+
+        if( !pcb->bufstart )
+        {
+            pcb->bufend = pcb->buf = pcb->bufstart = (UNICC_CHAR*)malloc(
                 ( UNICC_MALLOCSTEP + 1 ) * sizeof( UNICC_CHAR ) );
 
             if( !pcb->buf )
@@ -22,49 +34,62 @@ UNICC_STATIC UNICC_CHAR @@prefix_get_input( @@prefix_pcb* pcb, unsigned int offs
                 return 0;
             }
 
+            pcb->bufsize = UNICC_MALLOCSTEP;
             *pcb->buf = 0;
         }
-        else if( *pcb->buf && !( ( pcb->bufend - pcb->buf ) %
-                    UNICC_MALLOCSTEP ) )
+        else if( pcb->bufend == pcb->bufstart + pcb->bufsize )
         {
             unsigned int 	size	= (unsigned int)( pcb->bufend - pcb->buf );
+            unsigned int	start	= (unsigned int)( pcb->buf - pcb->bufstart );
             UNICC_CHAR*		buf;
 
-            if( !( buf = (UNICC_CHAR*)realloc( pcb->buf,
-                        ( size + UNICC_MALLOCSTEP + 1 )
-                            * sizeof( UNICC_CHAR ) ) ) )
+            /* Move the window to the front if the consumed characters
+                exceed half of the buffer, or double the buffer */
+            if( start > pcb->bufsize / 2 )
             {
-                UNICC_OUTOFMEM( pcb );
-                free( pcb->buf );
+                memmove( pcb->bufstart, pcb->buf,
+                            ( size + 1 ) * sizeof( UNICC_CHAR ) );
+                start = 0;
+            }
+            else
+            {
+                if( !( buf = (UNICC_CHAR*)realloc( pcb->bufstart,
+                            ( pcb->bufsize * 2 + 1 )
+                                * sizeof( UNICC_CHAR ) ) ) )
+                {
+                    UNICC_OUTOFMEM( pcb );
+                    free( pcb->bufstart );
 
-                return 0;
+                    pcb->buf = pcb->bufend = pcb->bufstart = (UNICC_CHAR*)NULL;
+                    return 0;
+                }
+
+                pcb->bufstart = buf;
+                pcb->bufsize *= 2;
             }
 
-            pcb->buf = buf;
+            pcb->buf = pcb->bufstart + start;
             pcb->bufend = pcb->buf + size;
         }
 
-        if( pcb->is_eof || ( *( pcb->bufend ) = (UNICC_CHAR)UNICC_GETINPUT )
-                                    == pcb->eof )
-        {
-#if UNICC_DEBUG	> 2
-            fprintf( stderr, "%s: get input: can't get more input, "
-                        "end-of-file reached\n", UNICC_PARSER );
-#endif
+        /* Fill the free space of the buffer; Input ends on the
+            end-of-file character, characters read behind it are dropped */
+        n = UNICC_READ( pcb, pcb->bufend,
+                (unsigned int)( pcb->bufstart + pcb->bufsize - pcb->bufend ) );
+
+        for( i = 0; i < n && pcb->bufend[ i ] != pcb->eof; i++ )
+            ;
+
+        if( i < n || n <= 0 )
             pcb->is_eof = 1;
-            return pcb->eof;
-        }
-#if UNICC_DEBUG	> 2
-        fprintf( stderr, "%s: get input: read char >%c< %d\n",
-                    UNICC_PARSER, (char)*( pcb->bufend ), *( pcb->bufend ) );
-#endif
 
 #if UNICC_DEBUG	> 2
-        fprintf( stderr, "%s: get input: reading character >%c< %d\n",
-                    UNICC_PARSER, (char)*( pcb->bufend ), *( pcb->bufend ) );
+        fprintf( stderr, "%s: get input: read %d characters\n",
+                    UNICC_PARSER, i );
 #endif
 
-        *( ++pcb->bufend ) = 0;
+        pcb->bufend += i;
+        *( pcb->bufend ) = 0;
     }
 
 #if UNICC_DEBUG	> 2
@@ -2,6 +2,9 @@ UNICC_STATIC int @@prefix_handle_error( @@prefix_pcb* pcb, FILE* @@prefix_dbg )
 {
 #if UNICC_DEBUG
     int					i;
+#if @@compressed-tables
+    int					j;
+#endif
 #endif
 
     if( !pcb->error_delay )
@@ -18,6 +21,17 @@ UNICC_STATIC int @@prefix_handle_error( @@prefix_pcb* pcb, FILE* @@prefix_dbg )
         fprintf( @@prefix_dbg,
                 "%s: error recovery: expecting ", UNICC_PARSER );
 
+#if @@compressed-tables
+        for( i = 0; i < @@number-of-symbols; i++ )
+        {
+            j = @@prefix_act_base[ pcb->tos->state ] + i;
+
+            if( j >= 0 && j < @@size-of-action-vector
+                    && @@prefix_act_check[ j ] == pcb->tos->state )
+                fprintf( @@prefix_dbg, "%d (%s), ",
+                    i, @@prefix_symbols[ i ].name );
+        }
+#else
         for( i = 1; i < @@prefix_act[ pcb->tos->state ][0] * 3; i += 3 )
         {
             fprintf( @@prefix_dbg, "%d (%s)%s",
@@ -26,6 +40,7 @@ UNICC_STATIC int @@prefix_handle_error( @@prefix_pcb* pcb, FILE* @@prefix_dbg )
                 ( i == @@prefix_act[ pcb->tos->state ][0] * 3 - 3 ) ?
                         "\n" : ", " );
         }
+#endif
 %%%end
 
         fprintf( @@prefix_dbg, "\n%s: error recovery: error_delay is %d, %s\n",
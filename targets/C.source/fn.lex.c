@@ -4,6 +4,9 @@ UNICC_STATIC void @@prefix_lex( @@prefix_pcb* pcb )
     int 			dfa_st	= 0;
     unsigned int	len		= 0;
     int				chr;
+    int				cls;
+    int				lo;
+    int				hi;
     UNICC_CHAR		next;
 #if !@@mode
     int				mach	= @@prefix_dfa_select[ pcb->tos->state ];
@@ -28,60 +31,66 @@ fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 fprintf( stderr, "%s: lex: next = %d\n", UNICC_PARSER, next );
 #endif
 
-        chr = @@prefix_dfa_idx[ mach ][ dfa_st ];
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: chr = %d\n", UNICC_PARSER, chr );
-#endif
-
-        dfa_st = -1;
-#if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: FIRST next = %d @@prefix_dfa_chars[ chr ] = %d, "
-            "@@prefix_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-                @@prefix_dfa_chars[ chr ], @@prefix_dfa_chars[ chr + 1 ] );
-#endif
-        while( @@prefix_dfa_chars[ chr ] > -1 )
+        /* The lexer runs on the character class of next */
+        if( (unsigned int)next <= @@character-universe )
+            cls = @@prefix_char_map[ @@prefix_char_map_idx[ next >> 8 ]
+                                        + ( next & 0xFF ) ];
+        else
+            cls = @@number-of-character-classes;
+
+        /* The next state is looked up in the dense row of hot states for
+            the classes of ASCII characters, and by binary search on the
+            sorted ranges of the state otherwise */
+        if( cls < @@number-of-dense-classes
+                && @@prefix_dfa_idx[ mach ][ dfa_st ][ 2 ] > -1 )
+            dfa_st = @@prefix_dfa_dense[ @@prefix_dfa_idx[ mach ][ dfa_st ][ 2 ]
+                                            + cls ];
+        else
         {
+            lo = @@prefix_dfa_idx[ mach ][ dfa_st ][ 0 ];
+            hi = lo + @@prefix_dfa_idx[ mach ][ dfa_st ][ 1 ];
+            dfa_st = -1;
+
+            while( lo < hi )
+            {
+                chr = ( lo + hi ) / 2;
 #if UNICC_DEBUG	> 1
-fprintf( stderr, "%s: lex: next = %d @@prefix_dfa_chars[ chr ] = %d, "
-        "@@prefix_dfa_chars[ chr+1 ] = %d\n", UNICC_PARSER, next,
-            @@prefix_dfa_chars[ chr ], @@prefix_dfa_chars[ chr + 1 ] );
+fprintf( stderr, "%s: lex: cls = %d @@prefix_dfa_chars[ chr * 2 ] = %d, "
+        "@@prefix_dfa_chars[ chr * 2 + 1 ] = %d\n", UNICC_PARSER, cls,
+            @@prefix_dfa_chars[ chr * 2 ], @@prefix_dfa_chars[ chr * 2 + 1 ] );
 #endif
-            if( next >= @@prefix_dfa_chars[ chr ] &&
-                next <= @@prefix_dfa_chars[ chr+1 ] )
-            {
-                dfa_st = *( @@prefix_dfa_trans + ( chr / 2 ) );
+                if( cls < @@prefix_dfa_chars[ chr * 2 ] )
+                    hi = chr;
+                else if( cls > @@prefix_dfa_chars[ chr * 2 + 1 ] )
+                    lo = chr + 1;
+                else
+                {
+                    dfa_st = @@prefix_dfa_trans[ chr ];
+                    break;
+                }
+            }
+        }
+
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: dfa_st = %d\n", UNICC_PARSER, dfa_st );
 #endif
-                if( @@prefix_dfa_accept[ mach ][ dfa_st ] > 0 )
-                {
-                    pcb->len = len + 1;
-                    pcb->sym = @@prefix_dfa_accept[ mach ][ dfa_st ] - 1;
+        if( dfa_st > -1 && @@prefix_dfa_accept[ mach ][ dfa_st ] > 0 )
+        {
+            pcb->len = len + 1;
+            pcb->sym = @@prefix_dfa_accept[ mach ][ dfa_st ] - 1;
 
 #if UNICC_DEBUG	> 1
 fprintf( stderr, "%s: lex: new accepting symbol pcb->sym = %d greedy = %d\n",
             UNICC_PARSER, pcb->sym, @@prefix_symbols[ pcb->sym ].greedy );
 #endif
-                    if( pcb->sym == @@eof )
-                    {
-                        dfa_st = -1; /* test! */
-                        break;
-                    }
-
-                    /* Stop if matched symbol should be parsed nongreedy */
-                    if( !@@prefix_symbols[ pcb->sym ].greedy )
-                    {
-                        dfa_st = -1;
-                        break;
-                    }
-                }
-
-                next = @@prefix_get_input( pcb, ++len );
-                break;
-            }
-
-            chr += 2;
+            /* Stop on end of input, or if matched symbol should be parsed
+                nongreedy */
+            if( pcb->sym == @@eof || !@@prefix_symbols[ pcb->sym ].greedy )
+                dfa_st = -1;
         }
+
+        if( dfa_st > -1 )
+            next = @@prefix_get_input( pcb, ++len );
     }
     while( dfa_st > -1 && next != pcb->eof );
 
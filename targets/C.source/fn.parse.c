@@ -308,7 +308,7 @@
     ret = @@goal-value;
 
     /* Clean up parser control block */
-    free( pcb->buf );
+    free( pcb->bufstart );
     free( pcb->stack );
 #if UNICC_UTF8
     free( pcb->lexem );
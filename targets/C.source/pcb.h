@@ -25,11 +25,13 @@ typedef struct
     int					old_sym;
     unsigned int		len;
 
-    /* Input buffering */
+    /* Input buffering; buf is the window of the current input within the
+        buffer bufstart of bufsize characters */
     UNICC_SCHAR*		lexem;
     UNICC_CHAR*			buf;
     UNICC_CHAR*			bufend;
-    UNICC_CHAR*			bufsize;
+    UNICC_CHAR*			bufstart;
+    unsigned int		bufsize;
 
     /* Lexical analysis */
     UNICC_CHAR			next;
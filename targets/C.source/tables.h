@@ -1,50 +1,102 @@
+#if @@compressed-tables
+/* Action Table, as comb-vector */
+UNICC_STATIC @@type-of-action-base @@prefix_act_base[ @@number-of-states ] =
+{
+@@action-base
+};
+
+UNICC_STATIC @@type-of-action-check @@prefix_act_check[ @@size-of-action-vector ] =
+{
+@@action-check
+};
+
+UNICC_STATIC @@type-of-action-next @@prefix_act_next[ @@size-of-action-vector ][ 2 ] =
+{
+@@action-next
+};
+
+/* GoTo Table, as comb-vector */
+UNICC_STATIC @@type-of-goto-base @@prefix_go_base[ @@number-of-states ] =
+{
+@@goto-base
+};
+
+UNICC_STATIC @@type-of-goto-check @@prefix_go_check[ @@size-of-goto-vector ] =
+{
+@@goto-check
+};
+
+UNICC_STATIC @@type-of-goto-next @@prefix_go_next[ @@size-of-goto-vector ][ 2 ] =
+{
+@@goto-next
+};
+#else
 /* Action Table */
-UNICC_STATIC int @@prefix_act[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =
+UNICC_STATIC @@type-of-action-table @@prefix_act[ @@number-of-states ][ @@deepest-action-row * 3 + 1 ] =
 {
 @@action-table
 };
 
 /* GoTo Table */
-UNICC_STATIC int @@prefix_go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =
+UNICC_STATIC @@type-of-goto-table @@prefix_go[ @@number-of-states ][ @@deepest-goto-row * 3 + 1 ] =
 {
 @@goto-table
 };
+#endif
 
 /* Default productions per state */
-UNICC_STATIC int @@prefix_def_prod[ @@number-of-states ] =
+UNICC_STATIC @@type-of-default-productions @@prefix_def_prod[ @@number-of-states ] =
 {
 @@default-productions
 };
 
 #if !@@mode
 /* DFA selection table */
-UNICC_STATIC int @@prefix_dfa_select[ @@number-of-states ] =
+UNICC_STATIC @@type-of-dfa-select @@prefix_dfa_select[ @@number-of-states ] =
 {
 @@dfa-select
 };
 #endif
 
 #if @@number-of-dfa-machines
-/* DFA index table */
-UNICC_STATIC int @@prefix_dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ] =
+/* Character class map index */
+UNICC_STATIC @@type-of-character-map-index @@prefix_char_map_idx[ @@number-of-character-map-index ] =
+{
+@@character-map-index
+};
+
+/* Character class map */
+UNICC_STATIC @@type-of-character-map @@prefix_char_map[ @@number-of-character-map ] =
+{
+@@character-map
+};
+
+/* DFA index table; Offset, number of ranges and dense row of every state */
+UNICC_STATIC @@type-of-dfa-index @@prefix_dfa_idx[ @@number-of-dfa-machines ][ @@deepest-dfa-index-row ][ 3 ] =
 {
 @@dfa-index
 };
 
-/* DFA transition chars */
-UNICC_STATIC int @@prefix_dfa_chars[ @@size-of-dfa-characters * 2 ] =
+/* DFA transition character classes */
+UNICC_STATIC @@type-of-dfa-char @@prefix_dfa_chars[ @@size-of-dfa-characters * 2 ] =
 {
 @@dfa-char
 };
 
 /* DFA transitions */
-UNICC_STATIC int @@prefix_dfa_trans[ @@size-of-dfa-characters ] =
+UNICC_STATIC @@type-of-dfa-trans @@prefix_dfa_trans[ @@size-of-dfa-characters ] =
 {
 @@dfa-trans
 };
 
+/* DFA transitions on the character classes of the ASCII characters */
+UNICC_STATIC @@type-of-dfa-dense @@prefix_dfa_dense[ @@size-of-dfa-dense ] =
+{
+@@dfa-dense
+};
+
 /* DFA acception states */
-UNICC_STATIC int @@prefix_dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =
+UNICC_STATIC @@type-of-dfa-accept @@prefix_dfa_accept[ @@number-of-dfa-machines ][ @@deepest-dfa-accept-row ] =
 {
 @@dfa-accept
 };
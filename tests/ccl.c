@@ -0,0 +1,371 @@
+/* Property test and benchmark for the character-classes of libphorward.
+
+Random character-classes over the full Unicode universe are built and modified
+by adding and removing ranges, negation, union, difference and intersection.
+Every result is compared against a bitmap of the same characters, and the test
+asserts that
+
+- the ranges are sorted, coalesced and within the universe,
+- the class contains as many characters as the bitmap,
+- the characters around every range bound, all characters up to 0x1FF and
+  random characters and ranges test like in the bitmap.
+
+Afterwards, the operations are timed on larger classes.
+
+Usage: ccl [rounds [seed]] */
+
+#include "lib/phorward.h"
+#include <time.h>
+
+#define UNIVERSE		0x10FFFF
+#define WORDS			( UNIVERSE / 32 + 1 )
+#define OPERATIONS		40
+
+#define BENCH_CLASSES	200
+#define BENCH_RANGES	500
+#define BENCH_TESTS		2000000
+
+/* Bitmap of a character-class */
+typedef unsigned int	bits[ WORDS ];
+
+#define BIT_TEST( b, ch )	( (b)[ (ch) / 32 ] & ( 1U << ( (ch) % 32 ) ) )
+#define BIT_SET( b, ch )	( (b)[ (ch) / 32 ] |= 1U << ( (ch) % 32 ) )
+#define BIT_DEL( b, ch )	( (b)[ (ch) / 32 ] &= ~( 1U << ( (ch) % 32 ) ) )
+
+/** Returns a random character; Mostly near the bitmap bound of 0xFF. */
+static wchar_t random_char( void )
+{
+    switch( rand() % 4 )
+    {
+        case 0:
+            return rand() % 0x100;
+
+        case 1:
+            return 0xF0 + rand() % 0x20;
+
+        case 2:
+            return rand() % 0x800;
+
+        default:
+            break;
+    }
+
+    return (wchar_t)( ( (unsigned long)rand() * 31 ) % ( UNIVERSE + 1 ) );
+}
+
+/** Returns a random range in //begin// and //end//. */
+static void random_range( wchar_t* begin, wchar_t* end )
+{
+    *begin = random_char();
+
+    if( rand() % 3 )
+        *end = *begin + rand() % 64;
+    else
+        *end = random_char();
+
+    if( *end > UNIVERSE )
+        *end = UNIVERSE;
+}
+
+/** Prints //msg// and exits. */
+static void fail( char* msg, int round, int op )
+{
+    fprintf( stderr, "round %d, operation %d: %s\n", round, op, msg );
+    exit( 1 );
+}
+
+/** Compares character-class //ccl// against bitmap //b//. */
+static void check( pccl* ccl, bits b, int round, int op )
+{
+    wchar_t		from;
+    wchar_t		to;
+    wchar_t		prev	= -2;
+    wchar_t		ch;
+    wchar_t		begin;
+    wchar_t		end;
+    size_t		cnt		= 0;
+    int			i;
+
+    for( i = 0; pccl_get( &from, &to, ccl, i ); i++ )
+    {
+        if( from > to || from < 0 || to > UNIVERSE )
+            fail( "invalid range", round, op );
+
+        if( from <= prev + 1 )
+            fail( "ranges are not sorted and coalesced", round, op );
+
+        for( ch = from - 1; ch <= from + 1; ch++ )
+            if( ch >= 0 && !pccl_test( ccl, ch ) != !BIT_TEST( b, ch ) )
+                fail( "pccl_test() differs at a range begin", round, op );
+
+        for( ch = to - 1; ch <= to + 1 && ch <= UNIVERSE; ch++ )
+            if( ch >= 0 && !pccl_test( ccl, ch ) != !BIT_TEST( b, ch ) )
+                fail( "pccl_test() differs at a range end", round, op );
+
+        prev = to;
+    }
+
+    for( i = 0; i < WORDS; i++ )
+    {
+        if( b[ i ] == ~0U )
+            cnt += 32;
+        else if( b[ i ] )
+            for( ch = i * 32; ch < ( i + 1 ) * 32; ch++ )
+                if( BIT_TEST( b, ch ) )
+                    cnt++;
+    }
+
+    if( cnt != pccl_count( ccl ) )
+        fail( "number of characters differs from the bitmap", round, op );
+
+    for( i = 0; i < 0x800; i++ )
+    {
+        ch = i < 0x200 ? i : random_char();
+
+        if( !pccl_test( ccl, ch ) != !BIT_TEST( b, ch ) )
+            fail( "pccl_test() differs from the bitmap", round, op );
+    }
+
+    for( i = 0; i < 100; i++ )
+    {
+        random_range( &begin, &end );
+
+        if( begin > end )
+            continue;
+
+        for( ch = begin; ch <= end && BIT_TEST( b, ch ); ch++ )
+            ;
+
+        if( !pccl_testrange( ccl, begin, end ) != !( ch > end ) )
+            fail( "pccl_testrange() differs from the bitmap", round, op );
+    }
+}
+
+/** Builds a random character-class of //n// ranges into //ccl// and
+bitmap //b//. */
+static void random_ccl( pccl* ccl, bits b, int n )
+{
+    wchar_t		begin;
+    wchar_t		end;
+    wchar_t		ch;
+
+    while( n-- )
+    {
+        random_range( &begin, &end );
+        pccl_addrange( ccl, begin, end );
+
+        if( b )
+        {
+            if( begin > end )
+            {
+                ch = begin;
+                begin = end;
+                end = ch;
+            }
+
+            for( ch = begin; ch <= end; ch++ )
+                BIT_SET( b, ch );
+        }
+    }
+}
+
+/** Runs the timed operations. */
+static void benchmark( void )
+{
+    pccl*		ccls[ BENCH_CLASSES ];
+    pccl*		res;
+    clock_t		start;
+    wchar_t		ch;
+    long		ops		= 0;
+    int			i;
+    int			j;
+
+    start = clock();
+
+    /* Many short ranges, spread over the universe */
+    for( i = 0; i < BENCH_CLASSES; i++ )
+    {
+        ccls[ i ] = pccl_create( 0, UNIVERSE, (char*)NULL );
+
+        for( j = 0; j < BENCH_RANGES; j++ )
+        {
+            ch = random_char();
+            pccl_addrange( ccls[ i ], ch, ch + rand() % 16 );
+        }
+
+        ops += BENCH_RANGES;
+    }
+
+    printf( "%ld ranges added in %ld ms\n", ops,
+                (long)( clock() - start ) * 1000 / CLOCKS_PER_SEC );
+
+    start = clock();
+    ops = 0;
+
+    for( i = 0; i < BENCH_CLASSES; i++ )
+        for( j = 0; j < BENCH_CLASSES; j++ )
+        {
+            pccl_free( pccl_intersect( ccls[ i ], ccls[ j ] ) );
+            pccl_free( pccl_union( ccls[ i ], ccls[ j ] ) );
+            pccl_free( pccl_diff( ccls[ i ], ccls[ j ] ) );
+
+            ops += 3;
+        }
+
+    printf( "%ld intersections, unions and differences in %ld ms\n", ops,
+                (long)( clock() - start ) * 1000 / CLOCKS_PER_SEC );
+
+    start = clock();
+    ops = 0;
+
+    for( i = 0; i < BENCH_TESTS; i++ )
+        ops += pccl_test( ccls[ i % BENCH_CLASSES ], random_char() );
+
+    printf( "%d character tests in %ld ms\n", BENCH_TESTS,
+                (long)( clock() - start ) * 1000 / CLOCKS_PER_SEC );
+
+    start = clock();
+
+    for( i = 0; i < BENCH_CLASSES; i++ )
+    {
+        res = pccl_dup( ccls[ i ] );
+
+        for( j = 0; j < BENCH_RANGES; j++ )
+            pccl_del( res, random_char() );
+
+        pccl_negate( res );
+        pccl_free( res );
+    }
+
+    printf( "%d classes modified and negated in %ld ms\n", BENCH_CLASSES,
+                (long)( clock() - start ) * 1000 / CLOCKS_PER_SEC );
+
+    for( i = 0; i < BENCH_CLASSES; i++ )
+        pccl_free( ccls[ i ] );
+}
+
+int main( int argc, char** argv )
+{
+    pccl*			a;
+    pccl*			b;
+    pccl*			res;
+    unsigned int*	ab;
+    unsigned int*	bb;
+    unsigned int*	rb;
+    int				rounds	= 10;
+    int				round;
+    int				op;
+    int				i;
+    wchar_t			begin;
+    wchar_t			end;
+    wchar_t			ch;
+
+    if( argc > 1 )
+        rounds = atoi( argv[ 1 ] );
+
+    srand( argc > 2 ? atoi( argv[ 2 ] ) : 1 );
+
+    ab = (unsigned int*)pmalloc( sizeof( bits ) );
+    bb = (unsigned int*)pmalloc( sizeof( bits ) );
+    rb = (unsigned int*)pmalloc( sizeof( bits ) );
+
+    for( round = 0; round < rounds; round++ )
+    {
+        a = pccl_create( 0, UNIVERSE, (char*)NULL );
+        b = pccl_create( 0, UNIVERSE, (char*)NULL );
+
+        memset( ab, 0, sizeof( bits ) );
+        memset( bb, 0, sizeof( bits ) );
+
+        random_ccl( a, ab, rand() % 20 );
+        random_ccl( b, bb, rand() % 20 );
+
+        for( op = 0; op < OPERATIONS; op++ )
+        {
+            res = (pccl*)NULL;
+
+            switch( rand() % 7 )
+            {
+                case 0:
+                    random_ccl( a, ab, 1 );
+                    break;
+
+                case 1:
+                    random_range( &begin, &end );
+                    pccl_delrange( a, begin, end );
+
+                    if( begin > end )
+                    {
+                        ch = begin;
+                        begin = end;
+                        end = ch;
+                    }
+
+                    for( ch = begin; ch <= end; ch++ )
+                        BIT_DEL( ab, ch );
+                    break;
+
+                case 2:
+                    pccl_negate( a );
+
+                    for( i = 0; i < WORDS; i++ )
+                        ab[ i ] = ~ab[ i ];
+
+                    for( ch = UNIVERSE + 1; ch < WORDS * 32; ch++ )
+                        BIT_DEL( ab, ch );
+                    break;
+
+                case 3:
+                    res = pccl_union( a, b );
+
+                    for( i = 0; i < WORDS; i++ )
+                        rb[ i ] = ab[ i ] | bb[ i ];
+                    break;
+
+                case 4:
+                    res = pccl_diff( a, b );
+
+                    for( i = 0; i < WORDS; i++ )
+                        rb[ i ] = ab[ i ] & ~bb[ i ];
+                    break;
+
+                case 5:
+                    if( !( res = pccl_intersect( a, b ) ) )
+                        res = pccl_create( 0, UNIVERSE, (char*)NULL );
+
+                    for( i = 0; i < WORDS; i++ )
+                        rb[ i ] = ab[ i ] & bb[ i ];
+                    break;
+
+                default:
+                    res = pccl_dup( a );
+                    memcpy( rb, ab, sizeof( bits ) );
+                    break;
+            }
+
+            check( a, ab, round, op );
+
+            if( res )
+            {
+                check( res, rb, round, op );
+
+                /* Continue with the result */
+                pccl_free( b );
+                b = res;
+                memcpy( bb, rb, sizeof( bits ) );
+            }
+        }
+
+        pccl_free( a );
+        pccl_free( b );
+    }
+
+    printf( "%d rounds of %d operations succeeded\n", rounds, OPERATIONS );
+
+    pfree( ab );
+    pfree( bb );
+    pfree( rb );
+
+    benchmark();
+    return 0;
+}
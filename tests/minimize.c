@@ -0,0 +1,610 @@
+/* Property test for the DFA minimization of libphorward.
+
+Randomized sets of regular expressions are turned into DFAs, which are
+minimized by pregex_dfa_minimize() and by the previous minimization algorithm
+of the library. For every set, the test asserts that
+
+- the minimized DFA never has more states than the one minimized by the
+  previous algorithm, which only merges states with equal transition lists,
+- no two states of the minimized DFA are equivalent,
+- the minimized DFA matches random input exactly like the unminimized DFA
+  and the DFA minimized by the previous algorithm.
+
+Afterwards, the state lexers of the given grammars are constructed like UniCC
+does, and checked the same way on random walks through their DFAs.
+
+Usage: minimize [sets [seed [grammar...]]] */
+
+#include "src/unicc.h"
+
+#define MAX_PATTERNS	4
+#define INPUT_LEN		16
+#define INPUTS			200
+
+/* Globals of the UniCC program module, which is not linked */
+FILE*			status;
+BOOLEAN			first_progress		= FALSE;
+BOOLEAN 		no_warnings			= TRUE;
+
+extern char*	progname;
+
+/* Characters the patterns are made of, and random input is taken from */
+static char*	chars		= "abcd";
+static char*	classes[]	= { "[a-c]", "[^b]", "[bd]", "[a\\u0100-\\u01FF]",
+                                "[^a-d]" };
+static wchar_t	input[]		= { '0', 'a', 'b', 'c', 'd', 'x', 0x100, 0x180,
+                                0x200 };
+
+/** Appends a random regular expression of nesting depth //depth// to
+//pat//. */
+static void random_pattern( char* pat, int depth )
+{
+    int		i;
+    int		cnt;
+
+    cnt = 1 + rand() % 3;
+
+    for( i = 0; i < cnt; i++ )
+    {
+        if( depth > 0 && !( rand() % 3 ) )
+        {
+            strcat( pat, "(" );
+            random_pattern( pat, depth - 1 );
+
+            if( rand() % 2 )
+            {
+                strcat( pat, "|" );
+                random_pattern( pat, depth - 1 );
+            }
+
+            strcat( pat, ")" );
+        }
+        else if( !( rand() % 4 ) )
+            strcat( pat, classes[ rand() % ( sizeof( classes )
+                                                / sizeof( *classes ) ) ] );
+        else
+            strncat( pat, chars + rand() % strlen( chars ), 1 );
+
+        switch( rand() % 6 )
+        {
+            case 0:
+                strcat( pat, "*" );
+                break;
+
+            case 1:
+                strcat( pat, "+" );
+                break;
+
+            case 2:
+                strcat( pat, "?" );
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+/** Frees the transitions of DFA state //st//. */
+static void free_dfa_state( pregex_dfa_st* st )
+{
+    plistel*		e;
+
+    plist_for( st->trans, e )
+        pccl_free( ( (pregex_dfa_tr*)plist_access( e ) )->ccl );
+
+    plist_free( st->trans );
+}
+
+/** Checks if the states //first// and //second// of //dfa// have equal
+transition lists, leading into the same groups of //groups//. */
+static pboolean equal_states( pregex_dfa* dfa, plist* groups,
+                                pregex_dfa_st* first, pregex_dfa_st* second )
+{
+    plistel*		e;
+    plistel*		f;
+    plistel*		g;
+    pregex_dfa_tr*	tr	[ 2 ];
+
+    if( plist_count( first->trans ) != plist_count( second->trans ) )
+        return FALSE;
+
+    for( e = plist_first( first->trans ), f = plist_first( second->trans );
+            e && f; e = plist_next( e ), f = plist_next( f ) )
+    {
+        tr[0] = (pregex_dfa_tr*)plist_access( e );
+        tr[1] = (pregex_dfa_tr*)plist_access( f );
+
+        if( pccl_compare( tr[0]->ccl, tr[1]->ccl ) )
+            return FALSE;
+
+        first = (pregex_dfa_st*)plist_access(
+                    plist_get( dfa->states, tr[0]->go_to ) );
+        second = (pregex_dfa_st*)plist_access(
+                    plist_get( dfa->states, tr[1]->go_to ) );
+
+        plist_for( groups, g )
+            if( plist_get_by_ptr( (plist*)plist_access( g ), first )
+                && !plist_get_by_ptr( (plist*)plist_access( g ), second ) )
+                return FALSE;
+    }
+
+    return TRUE;
+}
+
+/** The previous minimization of libphorward, which refines groups of states
+with the same accepting id until all states of a group have equal transition
+lists. Returns the number of states of the minimized //dfa//. */
+static int previous_minimize( pregex_dfa* dfa )
+{
+    pregex_dfa_st*	dfa_st;
+    pregex_dfa_st*	grp_dfa_st;
+    pregex_dfa_tr*	ent;
+    plist*			min_states;
+    plist*			group;
+    plist*			groups;
+    plist*			newgroup;
+    plistel*		e;
+    plistel*		f;
+    plistel*		g;
+    plistel*		next;
+    plistel*		next_next;
+    int				i;
+    pboolean		changes		= TRUE;
+
+    groups = plist_create( 0, PLIST_MOD_PTR );
+
+    plist_for( dfa->states, e )
+    {
+        dfa_st = (pregex_dfa_st*)plist_access( e );
+
+        plist_for( groups, f )
+        {
+            group = (plist*)plist_access( f );
+            grp_dfa_st = (pregex_dfa_st*)plist_access( plist_first( group ) );
+
+            if( grp_dfa_st->accept == dfa_st->accept )
+                break;
+        }
+
+        if( !f )
+        {
+            group = plist_create( 0, PLIST_MOD_PTR );
+            plist_push( groups, group );
+        }
+
+        plist_push( group, dfa_st );
+    }
+
+    while( changes )
+    {
+        changes = FALSE;
+
+        plist_for( groups, e )
+        {
+            newgroup = (plist*)NULL;
+            group = (plist*)plist_access( e );
+
+            dfa_st = (pregex_dfa_st*)plist_access( plist_first( group ) );
+            next_next = plist_next( plist_first( group ) );
+
+            while( ( next = next_next ) )
+            {
+                next_next = plist_next( next );
+                grp_dfa_st = (pregex_dfa_st*)plist_access( next );
+
+                if( !equal_states( dfa, groups, dfa_st, grp_dfa_st ) )
+                {
+                    plist_remove( group, next );
+
+                    if( !newgroup )
+                        newgroup = plist_create( 0, PLIST_MOD_PTR );
+
+                    plist_push( newgroup, grp_dfa_st );
+                }
+            }
+
+            if( newgroup )
+            {
+                plist_push( groups, newgroup );
+                changes = TRUE;
+            }
+        }
+    }
+
+    plist_for( groups, e )
+    {
+        group = (plist*)plist_access( e );
+        grp_dfa_st = (pregex_dfa_st*)plist_access( plist_first( group ) );
+
+        plist_for( grp_dfa_st->trans, f )
+        {
+            ent = (pregex_dfa_tr*)plist_access( f );
+            dfa_st = (pregex_dfa_st*)plist_access(
+                        plist_get( dfa->states, ent->go_to ) );
+
+            for( g = plist_first( groups ), i = 0; g; g = plist_next( g ), i++ )
+                if( plist_get_by_ptr( (plist*)plist_access( g ), dfa_st ) )
+                {
+                    ent->go_to = i;
+                    break;
+                }
+        }
+    }
+
+    min_states = plist_create( sizeof( pregex_dfa_st ), PLIST_MOD_RECYCLE );
+
+    plist_for( groups, e )
+    {
+        group = (plist*)plist_access( e );
+        grp_dfa_st = (pregex_dfa_st*)plist_access( plist_first( group ) );
+
+        for( f = plist_next( plist_first( group ) ); f; f = plist_next( f ) )
+            free_dfa_state( (pregex_dfa_st*)plist_access( f ) );
+
+        plist_push( min_states, grp_dfa_st );
+        plist_free( group );
+    }
+
+    plist_free( groups );
+    plist_free( dfa->states );
+    dfa->states = min_states;
+
+    return plist_count( dfa->states );
+}
+
+/** Returns the index of the state reached from state //st// of //dfa// on
+character //ch//, or -1 if there is no transition. */
+static int next_state( pregex_dfa* dfa, int st, wchar_t ch )
+{
+    plistel*		e;
+    pregex_dfa_tr*	tr;
+
+    plist_for( ( (pregex_dfa_st*)plist_access(
+                    plist_get( dfa->states, st ) ) )->trans, e )
+    {
+        tr = (pregex_dfa_tr*)plist_access( e );
+
+        if( pccl_test( tr->ccl, ch ) )
+            return tr->go_to;
+    }
+
+    return -1;
+}
+
+/** Returns the accepting id of state //st// of //dfa//. */
+static unsigned int accept_of( pregex_dfa* dfa, int st )
+{
+    return ( (pregex_dfa_st*)plist_access(
+                plist_get( dfa->states, st ) ) )->accept;
+}
+
+/** Runs //dfa// on //len// characters of //str//, and returns the length of
+the longest match combined with its accepting id. */
+static long run( pregex_dfa* dfa, wchar_t* str, int len )
+{
+    long	match;
+    int		st		= 0;
+    int		i;
+
+    match = accept_of( dfa, st ) ? accept_of( dfa, st ) : -1;
+
+    for( i = 0; i < len && ( st = next_state( dfa, st, str[ i ] ) ) >= 0; i++ )
+        if( accept_of( dfa, st ) )
+            match = ( i + 1 ) * 1000L + accept_of( dfa, st );
+
+    return match;
+}
+
+/** Checks if //dfa// has two equivalent states, by marking distinguishable
+pairs of states until no more pairs can be marked. */
+static pboolean has_equivalent_states( pregex_dfa* dfa )
+{
+    char*	dist;
+    int		n;
+    int		i;
+    int		j;
+    int		c;
+    int		ti;
+    int		tj;
+    int		symbols		= sizeof( input ) / sizeof( *input );
+    pboolean	changes;
+
+    n = plist_count( dfa->states );
+    dist = (char*)pmalloc( n * n + 1 );
+
+    for( i = 0; i < n; i++ )
+        for( j = 0; j < n; j++ )
+            dist[ i * n + j ] = accept_of( dfa, i ) != accept_of( dfa, j );
+
+    do
+    {
+        changes = FALSE;
+
+        for( i = 0; i < n; i++ )
+            for( j = i + 1; j < n; j++ )
+            {
+                if( dist[ i * n + j ] )
+                    continue;
+
+                for( c = 0; c < symbols; c++ )
+                {
+                    ti = next_state( dfa, i, input[ c ] );
+                    tj = next_state( dfa, j, input[ c ] );
+
+                    if( ( ti < 0 ) != ( tj < 0 )
+                        || ( ti >= 0 && dist[ ti * n + tj ] ) )
+                    {
+                        dist[ i * n + j ] = dist[ j * n + i ] = TRUE;
+                        changes = TRUE;
+                        break;
+                    }
+                }
+            }
+    }
+    while( changes );
+
+    for( i = 0; i < n; i++ )
+        for( j = i + 1; j < n; j++ )
+            if( !dist[ i * n + j ] )
+            {
+                pfree( dist );
+                return TRUE;
+            }
+
+    pfree( dist );
+    return FALSE;
+}
+
+/** Prints the pattern set //pats// of //cnt// patterns with //reason//,
+and exits. */
+static void fail( char* reason, char pats[][ 256 ], int cnt )
+{
+    int		i;
+
+    fprintf( stderr, "minimize: %s\n", reason );
+
+    for( i = 0; i < cnt; i++ )
+        fprintf( stderr, "  %d: %s\n", i + 1, pats[ i ] );
+
+    exit( 1 );
+}
+
+/** Fills //str// with up to INPUT_LEN - 1 characters of a random walk through
+//dfa//, which mostly follows its transitions and sometimes takes a random
+printable character, and returns the number of characters. */
+static int random_walk( pregex_dfa* dfa, wchar_t* str )
+{
+    pregex_dfa_tr*	tr;
+    plist*			trans;
+    wchar_t			beg;
+    wchar_t			end;
+    int				st		= 0;
+    int				len;
+    int				i;
+
+    len = rand() % INPUT_LEN;
+
+    for( i = 0; i < len; i++ )
+    {
+        trans = ( (pregex_dfa_st*)plist_access(
+                    plist_get( dfa->states, st ) ) )->trans;
+
+        if( !plist_count( trans ) || !( rand() % 8 ) )
+            str[ i ] = ' ' + rand() % 95;
+        else
+        {
+            tr = (pregex_dfa_tr*)plist_access(
+                    plist_get( trans, rand() % plist_count( trans ) ) );
+
+            pccl_get( &beg, &end, tr->ccl, rand() % pccl_size( tr->ccl ) );
+            str[ i ] = beg + rand() % ( end - beg + 1 );
+        }
+
+        if( ( st = next_state( dfa, st, str[ i ] ) ) < 0 )
+            return i + 1;
+    }
+
+    return len;
+}
+
+/** Prints the state //state_id// of the grammar //filename// with //reason//,
+and exits. */
+static void fail_lexer( char* reason, char* filename, int state_id )
+{
+    fprintf( stderr, "minimize: %s: %s in the lexer of state %d\n",
+                filename, reason, state_id );
+    exit( 1 );
+}
+
+/** Constructs the state lexers of the grammar //filename// like UniCC does,
+minimizes them by pregex_dfa_minimize() and by the previous algorithm, and
+compares their matches against the unminimized DFAs.
+
+Returns the number of lexers checked. */
+static int check_grammar( char* filename )
+{
+    PARSER*			parser;
+    STATE*			st;
+    TABCOL*			col;
+    pregex_nfa*		nfa;
+    pregex_dfa*		dfa;
+    pregex_dfa*		prev;
+    pregex_dfa*		min;
+    wchar_t			str		[ INPUT_LEN ];
+    int				lexers	= 0;
+    int				len;
+    int				i;
+
+    status = stderr;
+    parser = create_parser();
+
+    if( !pfiletostr( &parser->source, ( parser->filename = filename ) )
+        || parse_grammar( parser, filename, parser->source ) != 0
+            || !parser->goal )
+        fail_lexer( "grammar can't be parsed", filename, -1 );
+
+    /* The grammar revisions of the UniCC program module */
+    setup_single_goal( parser );
+
+    if( parser->p_mode == MODE_SCANNERLESS )
+        rewrite_grammar( parser );
+
+    inherit_vtypes( parser );
+    unique_charsets( parser );
+    symbol_orders( parser );
+    charsets_to_ptn( parser );
+
+    if( parser->p_mode == MODE_SCANNERLESS )
+        inherit_fixiations( parser );
+
+    fix_precedences( parser );
+    compute_first( parser );
+
+    if( find_undef_or_unused( parser ) )
+        fail_lexer( "grammar has undefined symbols", filename, -1 );
+
+    generate_tables( parser );
+
+    parray_for( parser->states, st )
+    {
+        nfa = pregex_nfa_create();
+
+        parray_for( st->actions, col )
+            nfa_from_symbol( parser, nfa, col->symbol );
+
+        if( !plist_count( nfa->states ) )
+        {
+            pregex_nfa_free( nfa );
+            continue;
+        }
+
+        dfa = pregex_dfa_create();
+        prev = pregex_dfa_create();
+        min = pregex_dfa_create();
+
+        pregex_dfa_from_nfa( dfa, nfa );
+        pregex_dfa_from_nfa( prev, nfa );
+        pregex_dfa_from_nfa( min, nfa );
+
+        previous_minimize( prev );
+
+        if( pregex_dfa_minimize( min ) < 0 )
+            fail_lexer( "pregex_dfa_minimize() failed",
+                            filename, st->state_id );
+
+        if( plist_count( min->states ) > plist_count( prev->states ) )
+            fail_lexer( "more states than by the previous minimization",
+                            filename, st->state_id );
+
+        for( i = 0; i < INPUTS; i++ )
+        {
+            len = random_walk( dfa, str );
+
+            if( run( min, str, len ) != run( dfa, str, len )
+                    || run( min, str, len ) != run( prev, str, len ) )
+                fail_lexer( "match results differ", filename, st->state_id );
+        }
+
+        pregex_nfa_free( nfa );
+        pregex_dfa_free( dfa );
+        pregex_dfa_free( prev );
+        pregex_dfa_free( min );
+        lexers++;
+    }
+
+    free_parser( parser );
+    return lexers;
+}
+
+int main( int argc, char** argv )
+{
+    pregex_nfa*		nfa;
+    pregex_ptn*		ptn;
+    pregex_dfa*		dfa;
+    pregex_dfa*		prev;
+    pregex_dfa*		min;
+    char			pats	[ MAX_PATTERNS ][ 256 ];
+    wchar_t			str		[ INPUT_LEN ];
+    int				sets	= 1000;
+    int				set;
+    int				cnt;
+    int				len;
+    int				i;
+    int				j;
+    long			saved	= 0;
+
+    progname = *argv;
+
+    if( argc > 1 )
+        sets = atoi( argv[ 1 ] );
+
+    srand( argc > 2 ? atoi( argv[ 2 ] ) : 1 );
+
+    for( set = 0; set < sets; set++ )
+    {
+        nfa = pregex_nfa_create();
+        cnt = 1 + rand() % MAX_PATTERNS;
+
+        for( i = 0; i < cnt; i++ )
+        {
+            *pats[ i ] = '\0';
+            random_pattern( pats[ i ], 2 );
+
+            if( !( ptn = pregex_ptn_create( pats[ i ], 0 ) ) )
+                fail( "pattern can't be compiled", pats, i + 1 );
+
+            ptn->accept = i + 1;
+            pregex_ptn_to_nfa( nfa, ptn );
+            pregex_ptn_free( ptn );
+        }
+
+        dfa = pregex_dfa_create();
+        prev = pregex_dfa_create();
+        min = pregex_dfa_create();
+
+        pregex_dfa_from_nfa( dfa, nfa );
+        pregex_dfa_from_nfa( prev, nfa );
+        pregex_dfa_from_nfa( min, nfa );
+
+        previous_minimize( prev );
+
+        if( pregex_dfa_minimize( min ) < 0 )
+            fail( "pregex_dfa_minimize() failed", pats, cnt );
+
+        if( plist_count( min->states ) > plist_count( prev->states ) )
+            fail( "more states than by the previous minimization", pats, cnt );
+
+        saved += plist_count( prev->states ) - plist_count( min->states );
+
+        if( has_equivalent_states( min ) )
+            fail( "equivalent states remain", pats, cnt );
+
+        for( i = 0; i < INPUTS; i++ )
+        {
+            len = rand() % INPUT_LEN;
+
+            for( j = 0; j < len; j++ )
+                str[ j ] = input[ rand() % ( sizeof( input )
+                                                / sizeof( *input ) ) ];
+
+            if( run( min, str, len ) != run( dfa, str, len )
+                    || run( min, str, len ) != run( prev, str, len ) )
+                fail( "match results differ", pats, cnt );
+        }
+
+        pregex_nfa_free( nfa );
+        pregex_dfa_free( dfa );
+        pregex_dfa_free( prev );
+        pregex_dfa_free( min );
+    }
+
+    printf( "%d pattern sets minimized, %ld states less than by the previous "
+                "minimization\n", sets, saved );
+
+    for( i = 3; i < argc; i++ )
+        printf( "%s: %d state lexers minimized\n",
+                    argv[ i ], check_grammar( argv[ i ] ) );
+
+    return 0;
+}